@@ -0,0 +1,143 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "boprefetch.h"
+
+#include <algorithm>
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::Cassini;
+
+
+BestOffsetPrefetcher::BestOffsetPrefetcher(ComponentId_t id, Params& params) : TrackedPrefetcher(id, params) {
+    Output out("", 1, 0, Output::STDOUT);
+
+    uint32_t rrEntries = params.find<uint32_t>("rr_entries", 256);
+    scoreMax = params.find<uint32_t>("score_max", 31);
+    roundMax = params.find<uint32_t>("round_max", 100);
+    badScore = params.find<uint32_t>("bad_score", 1);
+    uint32_t maxOffset = params.find<uint32_t>("max_offset", 256);
+    degree = params.find<uint32_t>("degree", 1);
+
+    if (rrEntries == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: rr_entries must be greater than 0\n", getName().c_str());
+    if (roundMax == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: round_max must be greater than 0\n", getName().c_str());
+    if (degree == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: degree must be greater than 0\n", getName().c_str());
+
+    // Candidate offsets: 1..max_offset with no prime factor greater than 5, limited to within a page
+    uint64_t pageLines = pageSize / blockSize;
+    for (uint32_t d = 1; d <= maxOffset && d < pageLines; d++) {
+        uint32_t n = d;
+        while (n % 2 == 0) n /= 2;
+        while (n % 3 == 0) n /= 3;
+        while (n % 5 == 0) n /= 5;
+        if (n == 1)
+            offsets.push_back(d);
+    }
+    if (offsets.empty())
+        out.fatal(CALL_INFO, -1, "%s, Error: no candidate offsets. max_offset must be at least 1 and page_size must hold more than one line\n", getName().c_str());
+
+    rrTable.assign(rrEntries, NO_LINE);
+    scores.assign(offsets.size(), 0);
+    testIndex = 0;
+    round = 0;
+    bestOffset = 1; // Start as a next-line prefetcher
+
+    statBestOffset = registerStatistic<uint64_t>("best_offset");
+}
+
+void BestOffsetPrefetcher::handleAccess(const CacheListenerNotification& notify, bool prefetchedHit) {
+    const NotifyAccessType notifyType = notify.getAccessType();
+    if (notifyType == EVICT)
+        return;
+    if (notify.getResultType() != MISS && !prefetchedHit)
+        return;
+
+    const Addr line = lineAddress(notify.getPhysicalAddress());
+    const Addr lineNum = line / blockSize;
+
+    learn(lineNum);
+
+    // Recorded even while prefetching is off so that learning can turn it back on
+    rrTable[rrSlot(lineNum)] = lineNum;
+
+    if (bestOffset == 0)
+        return;
+
+    for (uint32_t i = 1; i <= degree; i++) {
+        Addr target = line + (Addr)bestOffset * i * blockSize;
+        if (!samePage(line, target))
+            break;
+        issuePrefetch(target);
+    }
+}
+
+void BestOffsetPrefetcher::learn(Addr lineNum) {
+    uint32_t d = offsets[testIndex];
+    if (lineNum >= d) {
+        Addr base = lineNum - d;
+        if (rrTable[rrSlot(base)] == base && samePage(base * blockSize, lineNum * blockSize)) {
+            if (++scores[testIndex] >= scoreMax) {
+                endPhase();
+                return;
+            }
+        }
+    }
+
+    testIndex++;
+    if (testIndex == offsets.size()) {
+        testIndex = 0;
+        round++;
+        if (round >= roundMax)
+            endPhase();
+    }
+}
+
+void BestOffsetPrefetcher::endPhase() {
+    size_t best = 0;
+    for (size_t i = 1; i < scores.size(); i++) {
+        if (scores[i] > scores[best])
+            best = i;
+    }
+    bestOffset = (scores[best] > badScore) ? offsets[best] : 0;
+    statBestOffset->addData(bestOffset);
+
+    std::fill(scores.begin(), scores.end(), 0);
+    testIndex = 0;
+    round = 0;
+}
+
+void BestOffsetPrefetcher::serialize_order(SST::Core::Serialization::serializer& ser) {
+    TrackedPrefetcher::serialize_order(ser);
+
+    SST_SER(rrTable);
+    SST_SER(offsets);
+    SST_SER(scores);
+    SST_SER(scoreMax);
+    SST_SER(roundMax);
+    SST_SER(badScore);
+    SST_SER(testIndex);
+    SST_SER(round);
+    SST_SER(bestOffset);
+    SST_SER(degree);
+    SST_SER(statBestOffset);
+}
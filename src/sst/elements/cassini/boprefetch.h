@@ -0,0 +1,109 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_BEST_OFFSET_PREFETCH
+#define _H_SST_BEST_OFFSET_PREFETCH
+
+#include <vector>
+
+#include "trackedPrefetcher.h"
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Best-offset prefetcher (Michaud, HPCA 2016)
+ *
+ * On each trigger (a demand miss or the first hit to a prefetched line) for line X, one
+ * candidate offset D is tested by looking up X-D in a small recent-requests (RR) table and
+ * scored if present. A learning phase ends when an offset reaches score_max or after round_max
+ * passes over the candidate list; the best offset is then used to prefetch X+D until the next
+ * phase ends. Prefetching turns off if the best score is not above bad_score.
+ *
+ * The RR table normally records Y-D when prefetched line Y is filled. The listener does not see
+ * fills, so each trigger line X is recorded instead.
+ *
+ * Each trigger prefetches X+D, X+2D, ... up to 'degree' lines within the page. A cache that
+ * throttles prefetching sets the degree through setPrefetchDegree().
+ */
+class BestOffsetPrefetcher : public TrackedPrefetcher {
+public:
+    BestOffsetPrefetcher(ComponentId_t id, Params& params);
+    ~BestOffsetPrefetcher() {}
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        BestOffsetPrefetcher,
+        "cassini",
+        "BestOffsetPrefetcher",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Best-offset prefetcher",
+        SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        CASSINI_TRACKED_PREFETCHER_ELI_PARAMS,
+        { "rr_entries", "Number of entries in the recent-requests table (direct-mapped)", "256" },
+        { "score_max", "Score at which a learning phase ends early", "31" },
+        { "round_max", "Maximum number of passes over the offset list per learning phase", "100" },
+        { "bad_score", "Prefetching is off for the next phase if the best score is not above this", "1" },
+        { "max_offset", "Largest offset tested, in lines. Candidates are the numbers up to this with no prime factor above 5", "256" },
+        { "degree", "Number of lines prefetched per trigger, at multiples of the best offset. Replaced by the cache's degree when it throttles prefetching", "1" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        CASSINI_TRACKED_PREFETCHER_ELI_STATS,
+        { "best_offset", "Offset selected at the end of each learning phase (0 if prefetching was turned off)", "lines", 2 }
+    )
+
+    // Serialization support
+    BestOffsetPrefetcher() : TrackedPrefetcher() {}
+    void serialize_order(SST::Core::Serialization::serializer& ser) override;
+    ImplementSerializable(SST::Cassini::BestOffsetPrefetcher)
+
+    void setPrefetchDegree(unsigned int degree) override { this->degree = degree; }
+
+protected:
+    void handleAccess(const CacheListenerNotification& notify, bool prefetchedHit) override;
+
+private:
+    static constexpr Addr NO_LINE = ~((Addr)0);
+
+    void learn(Addr lineNum);
+    void endPhase();
+
+    /* RR table is indexed and tagged by line number */
+    size_t rrSlot(Addr lineNum) { return lineNum % rrTable.size(); }
+
+    std::vector<Addr> rrTable;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> scores;
+
+    uint32_t scoreMax;
+    uint32_t roundMax;
+    uint32_t badScore;
+
+    size_t testIndex;   // Next offset to test
+    uint32_t round;     // Passes over 'offsets' in the current phase
+    uint32_t bestOffset;  // Offset in use; 0 = prefetching off
+    uint32_t degree;      // Lines prefetched per trigger
+
+    Statistic<uint64_t>* statBestOffset;
+};
+
+}
+}
+
+#endif
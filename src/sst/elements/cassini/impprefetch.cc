@@ -0,0 +1,257 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "impprefetch.h"
+
+#include <algorithm>
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::Cassini;
+
+
+IndirectMemoryPrefetcher::IndirectMemoryPrefetcher(ComponentId_t id, Params& params) : TrackedPrefetcher(id, params) {
+    Output out("", 1, 0, Output::STDOUT);
+
+    uint32_t ptEntries = params.find<uint32_t>("pt_entries", 16);
+    ipdMisses = params.find<uint32_t>("ipd_misses", 4);
+    distance = params.find<uint32_t>("distance", 4);
+    degree = params.find<uint32_t>("degree", 1);
+    streamConfidence = params.find<uint32_t>("stream_confidence", 2);
+
+    if (ptEntries == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: pt_entries must be greater than 0\n", getName().c_str());
+    if (ipdMisses == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: ipd_misses must be greater than 0\n", getName().c_str());
+    if (distance == 0 || degree == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: distance and degree must be greater than 0\n", getName().c_str());
+
+    StreamEntry empty = {};
+    streamTable.assign(ptEntries, empty);
+
+    ipdState = IPDState::IDLE;
+    ipdPC = 0;
+    ipdIndex = 0;
+    ipdBases.assign(ipdMisses * (maxShift + 1), NO_ADDR);
+    ipdCount = 0;
+    timestamp = 0;
+    minDemand = NO_ADDR;
+    maxDemand = 0;
+
+    statPatternsDetected = registerStatistic<uint64_t>("patterns_detected");
+    statPatternsDisabled = registerStatistic<uint64_t>("patterns_disabled");
+}
+
+void IndirectMemoryPrefetcher::handleAccess(const CacheListenerNotification& notify, bool prefetchedHit) {
+    if (notify.getAccessType() == EVICT)
+        return;
+
+    const Addr addr = notify.getTargetAddress();
+    const Addr pc = notify.getInstructionPointer();
+    timestamp++;
+    if (addr < minDemand) minDemand = addr;
+    if (addr > maxDemand) maxDemand = addr;
+
+    StreamEntry* entry = findStream(pc);
+    if (entry == nullptr) {
+        entry = allocateStream(pc);
+        entry->lastAddr = addr;
+        entry->size = notify.getSize();
+        observeOther(notify);
+        return;
+    }
+    entry->lru = timestamp;
+
+    if (addr == entry->lastAddr + entry->size && notify.getSize() == entry->size) {
+        if (entry->streamConf < streamConfidence)
+            entry->streamConf++;
+    } else if (addr != entry->lastAddr) {
+        entry->streamConf = 0;
+    }
+    entry->lastAddr = addr;
+    entry->size = notify.getSize();
+
+    if (entry->streamConf >= streamConfidence)
+        observeIndex(entry, notify);
+    else
+        observeOther(notify);
+}
+
+void IndirectMemoryPrefetcher::observeIndex(StreamEntry* entry, const CacheListenerNotification& notify) {
+    uint64_t value;
+    if (!readIndex(notify, notify.getTargetAddress(), entry->size, value))
+        return; // Missed, line contents not available
+
+    if (entry->enabled) {
+        entry->expected = lineAddress(entry->base + (value << entry->shift));
+        entry->expectedValid = true;
+        entry->window = 0;
+        prefetchIndirect(entry, notify);
+        return;
+    }
+
+    if (ipdState != IPDState::IDLE && ipdPC != entry->pc)
+        return; // Detector is busy with another stream
+
+    if (ipdState == IPDState::FIRST && ipdCount > 0) {
+        ipdState = IPDState::SECOND;
+        ipdCount = 0;
+    } else {
+        // Start over with this value as idx1
+        ipdState = IPDState::FIRST;
+        ipdPC = entry->pc;
+        ipdCount = 0;
+        std::fill(ipdBases.begin(), ipdBases.end(), NO_ADDR);
+    }
+    ipdIndex = value;
+}
+
+void IndirectMemoryPrefetcher::observeOther(const CacheListenerNotification& notify) {
+    const Addr addr = notify.getTargetAddress();
+    const Addr line = lineAddress(addr);
+
+    // Verify enabled patterns: one of the next ipd_misses accesses should be to the expected line
+    for (std::vector<StreamEntry>::iterator it = streamTable.begin(); it != streamTable.end(); it++) {
+        if (!it->valid || !it->enabled || !it->expectedValid)
+            continue;
+        if (line == it->expected) {
+            if (it->indirectConf < maxConfidence)
+                it->indirectConf++;
+            it->expectedValid = false;
+        } else if (++it->window >= ipdMisses) {
+            it->expectedValid = false;
+            if (--it->indirectConf == 0) {
+                it->enabled = false;
+                statPatternsDisabled->addData(1);
+            }
+        }
+    }
+
+    if (ipdState == IPDState::IDLE || notify.getResultType() != MISS)
+        return;
+
+    if (ipdState == IPDState::FIRST) {
+        if (ipdCount < ipdMisses) {
+            for (uint32_t shift = 0; shift <= maxShift; shift++)
+                ipdBases[ipdCount * (maxShift + 1) + shift] = addr - (ipdIndex << shift);
+            ipdCount++;
+        }
+        return;
+    }
+
+    // SECOND: does this miss imply a base recorded for idx1?
+    for (uint32_t shift = 0; shift <= maxShift; shift++) {
+        Addr base = addr - (ipdIndex << shift);
+        for (uint32_t row = 0; row < ipdMisses; row++) {
+            if (ipdBases[row * (maxShift + 1) + shift] != base)
+                continue;
+            StreamEntry* entry = findStream(ipdPC);
+            if (entry) {
+                entry->enabled = true;
+                entry->shift = shift;
+                entry->base = base;
+                entry->indirectConf = 1;
+                entry->expectedValid = false;
+                statPatternsDetected->addData(1);
+            }
+            ipdState = IPDState::IDLE;
+            return;
+        }
+    }
+    if (++ipdCount >= ipdMisses)
+        ipdState = IPDState::IDLE; // No pattern for this pair of index values
+}
+
+bool IndirectMemoryPrefetcher::readIndex(const CacheListenerNotification& notify, Addr addr, uint32_t size, uint64_t& value) {
+    const std::vector<uint8_t>* data = notify.getData();
+    if (data == nullptr || size == 0 || size > sizeof(uint64_t) || addr < notify.getPhysicalAddress())
+        return false;
+
+    Addr offset = addr - notify.getPhysicalAddress();
+    if (offset + size > data->size())
+        return false;
+
+    // Little-endian
+    value = 0;
+    for (uint32_t i = 0; i < size; i++)
+        value |= (uint64_t)(*data)[offset + i] << (8 * i);
+    return true;
+}
+
+void IndirectMemoryPrefetcher::prefetchIndirect(StreamEntry* entry, const CacheListenerNotification& notify) {
+    for (uint32_t i = 0; i < degree; i++) {
+        uint64_t value;
+        Addr indexAddr = notify.getTargetAddress() + (Addr)(distance + i) * entry->size;
+        if (!readIndex(notify, indexAddr, entry->size, value))
+            return;
+
+        Addr target = lineAddress(entry->base + (value << entry->shift));
+        if (target < lineAddress(minDemand) || target > maxDemand)
+            continue; // Likely a bad index or base
+        issuePrefetch(target);
+    }
+}
+
+IndirectMemoryPrefetcher::StreamEntry* IndirectMemoryPrefetcher::findStream(Addr pc) {
+    for (std::vector<StreamEntry>::iterator it = streamTable.begin(); it != streamTable.end(); it++) {
+        if (it->valid && it->pc == pc)
+            return &(*it);
+    }
+    return nullptr;
+}
+
+IndirectMemoryPrefetcher::StreamEntry* IndirectMemoryPrefetcher::allocateStream(Addr pc) {
+    StreamEntry* victim = &streamTable[0];
+    for (std::vector<StreamEntry>::iterator it = streamTable.begin(); it != streamTable.end(); it++) {
+        if (!it->valid) {
+            victim = &(*it);
+            break;
+        }
+        if (it->lru < victim->lru)
+            victim = &(*it);
+    }
+    if (victim->valid && ipdState != IPDState::IDLE && ipdPC == victim->pc)
+        ipdState = IPDState::IDLE;
+
+    *victim = StreamEntry();
+    victim->valid = true;
+    victim->pc = pc;
+    victim->lru = timestamp;
+    return victim;
+}
+
+void IndirectMemoryPrefetcher::serialize_order(SST::Core::Serialization::serializer& ser) {
+    TrackedPrefetcher::serialize_order(ser);
+
+    SST_SER(streamTable);
+    SST_SER(ipdState);
+    SST_SER(ipdPC);
+    SST_SER(ipdIndex);
+    SST_SER(ipdBases);
+    SST_SER(ipdCount);
+    SST_SER(ipdMisses);
+    SST_SER(distance);
+    SST_SER(degree);
+    SST_SER(streamConfidence);
+    SST_SER(timestamp);
+    SST_SER(minDemand);
+    SST_SER(maxDemand);
+    SST_SER(statPatternsDetected);
+    SST_SER(statPatternsDisabled);
+}
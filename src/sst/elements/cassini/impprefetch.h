@@ -0,0 +1,153 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_IMP_PREFETCH
+#define _H_SST_IMP_PREFETCH
+
+#include <vector>
+
+#include "trackedPrefetcher.h"
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Indirect memory prefetcher (Yu et al., MICRO 2015)
+ *
+ * Targets A[B[i]] patterns. The prefetch table (PT), indexed by PC, detects index streams:
+ * loads whose address advances by exactly the access size. For a confident stream the
+ * indirect pattern detector (IPD) learns base and shift such that A[B[i]] = base + (B[i] << shift):
+ * after index value idx1 it records base = addr - (idx1 << shift) for each shift 0..3 and each of
+ * the next ipd_misses misses from other PCs, then after idx2 it looks for a miss that implies a
+ * base it recorded. Once a pattern is found, each index access prefetches base + (B[i+distance] << shift)
+ * for 'degree' indices, and the pattern is disabled if later accesses stop matching.
+ *
+ * Index values are read from the line contents the L1 passes with read hits, so the cache
+ * must be an L1. Values that lie beyond the current line are not prefetched for.
+ */
+class IndirectMemoryPrefetcher : public TrackedPrefetcher {
+public:
+    IndirectMemoryPrefetcher(ComponentId_t id, Params& params);
+    ~IndirectMemoryPrefetcher() {}
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        IndirectMemoryPrefetcher,
+        "cassini",
+        "IMPPrefetcher",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Indirect memory prefetcher for A[B[i]] access patterns. Must be attached to an L1 cache",
+        SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        CASSINI_TRACKED_PREFETCHER_ELI_PARAMS,
+        { "pt_entries", "Number of prefetch table entries (fully associative, LRU)", "16" },
+        { "ipd_misses", "Number of misses examined per index value when learning an indirect pattern", "4" },
+        { "distance", "Prefetch distance in index elements", "4" },
+        { "degree", "Number of consecutive index elements prefetched for per index access. Replaced by the cache's degree when it throttles prefetching", "1" },
+        { "stream_confidence", "Number of consecutive sequential accesses before a load is treated as an index stream", "2" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        CASSINI_TRACKED_PREFETCHER_ELI_STATS,
+        { "patterns_detected", "Indirect patterns found by the detector", "patterns", 2 },
+        { "patterns_disabled", "Indirect patterns disabled after failing verification", "patterns", 2 }
+    )
+
+    // Serialization support
+    IndirectMemoryPrefetcher() : TrackedPrefetcher() {}
+    void serialize_order(SST::Core::Serialization::serializer& ser) override;
+    ImplementSerializable(SST::Cassini::IndirectMemoryPrefetcher)
+
+    void setPrefetchDegree(unsigned int degree) override { this->degree = degree; }
+
+protected:
+    void handleAccess(const CacheListenerNotification& notify, bool prefetchedHit) override;
+
+private:
+    static constexpr Addr NO_ADDR = ~((Addr)0);
+    static constexpr uint32_t maxShift = 3;
+    static constexpr uint32_t maxConfidence = 3;
+
+    struct StreamEntry {
+        bool valid;
+        Addr pc;
+        Addr lastAddr;
+        uint32_t size;
+        uint32_t streamConf;
+        uint64_t lru;
+        /* Indirect pattern */
+        bool enabled;
+        uint32_t shift;
+        Addr base;
+        uint32_t indirectConf;
+        bool expectedValid;
+        Addr expected;      // Indirect line expected for the last index value
+        uint32_t window;    // Accesses by other PCs since the last index value
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) {
+            SST_SER(valid);
+            SST_SER(pc);
+            SST_SER(lastAddr);
+            SST_SER(size);
+            SST_SER(streamConf);
+            SST_SER(lru);
+            SST_SER(enabled);
+            SST_SER(shift);
+            SST_SER(base);
+            SST_SER(indirectConf);
+            SST_SER(expectedValid);
+            SST_SER(expected);
+            SST_SER(window);
+        }
+    };
+
+    enum class IPDState { IDLE, FIRST, SECOND };
+
+    StreamEntry* findStream(Addr pc);
+    StreamEntry* allocateStream(Addr pc);
+    void observeIndex(StreamEntry* entry, const CacheListenerNotification& notify);
+    void observeOther(const CacheListenerNotification& notify);
+    bool readIndex(const CacheListenerNotification& notify, Addr addr, uint32_t size, uint64_t& value);
+    void prefetchIndirect(StreamEntry* entry, const CacheListenerNotification& notify);
+
+    std::vector<StreamEntry> streamTable;
+
+    /* Indirect pattern detector; learns for one stream at a time */
+    IPDState ipdState;
+    Addr ipdPC;
+    uint64_t ipdIndex;
+    std::vector<Addr> ipdBases;   // ipdMisses rows of (maxShift + 1) candidate bases
+    uint32_t ipdCount;            // Rows filled (FIRST) or misses examined (SECOND)
+
+    uint32_t ipdMisses;
+    uint32_t distance;
+    uint32_t degree;
+    uint32_t streamConfidence;
+    uint64_t timestamp;
+
+    /* Range of demand addresses seen; indirect prefetches outside it are dropped */
+    Addr minDemand;
+    Addr maxDemand;
+
+    Statistic<uint64_t>* statPatternsDetected;
+    Statistic<uint64_t>* statPatternsDisabled;
+};
+
+}
+}
+
+#endif
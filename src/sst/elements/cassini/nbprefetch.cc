@@ -30,6 +30,7 @@ NextBlockPrefetcher::NextBlockPrefetcher(ComponentId_t id, Params& params) : Cac
     requireLibrary("memHierarchy");
 
     blockSize = params.find<uint64_t>("cache_line_size", 64);
+    degree = params.find<uint32_t>("degree", 1);
 
     statPrefetchEventsIssued = registerStatistic<uint64_t>("prefetches_issued");
     statMissEventsProcessed  = registerStatistic<uint64_t>("miss_events_processed");
@@ -47,18 +48,21 @@ void NextBlockPrefetcher::notifyAccess(const CacheListenerNotification& notify)
         if(notifyResType == MISS) {
             statMissEventsProcessed->addData(1);
 
-            Addr nextBlockAddr = (addr - (addr % blockSize)) + blockSize;
-            std::vector<Event::HandlerBase*>::iterator callbackItr;
-            statPrefetchEventsIssued->addData(1);
-
-            // Cycle over each registered call back and notify them that we want to issue a prefetch request
-            for(callbackItr = registeredCallbacks.begin(); callbackItr != registeredCallbacks.end(); callbackItr++) {
-                // Create a new read request, we cannot issue a write because the data will get
-                // overwritten and corrupt memory (even if we really do want to do a write)
-                MemEvent* newEv = new MemEvent(getName(), nextBlockAddr, nextBlockAddr, Command::GetS);
-                newEv->setSize(blockSize);
-                newEv->setPrefetchFlag(true);
-                (*(*callbackItr))(newEv);
+            Addr nextBlockAddr = addr - (addr % blockSize);
+            for (uint32_t i = 0; i < degree; i++) {
+                nextBlockAddr += blockSize;
+                std::vector<Event::HandlerBase*>::iterator callbackItr;
+                statPrefetchEventsIssued->addData(1);
+
+                // Cycle over each registered call back and notify them that we want to issue a prefetch request
+                for(callbackItr = registeredCallbacks.begin(); callbackItr != registeredCallbacks.end(); callbackItr++) {
+                    // Create a new read request, we cannot issue a write because the data will get
+                    // overwritten and corrupt memory (even if we really do want to do a write)
+                    MemEvent* newEv = new MemEvent(getName(), nextBlockAddr, nextBlockAddr, Command::GetS);
+                    newEv->setSize(blockSize);
+                    newEv->setPrefetchFlag(true);
+                    (*(*callbackItr))(newEv);
+                }
             }
         } else {
             statHitEventsProcessed->addData(1);
@@ -79,6 +83,7 @@ void NextBlockPrefetcher::serialize_order(SST::Core::Serialization::serializer&
 
     SST_SER(registeredCallbacks);
     SST_SER(blockSize);
+    SST_SER(degree);
     SST_SER(statPrefetchEventsIssued);
     SST_SER(statMissEventsProcessed);
     SST_SER(statHitEventsProcessed);
@@ -42,6 +42,7 @@ public:
     void notifyAccess(const CacheListenerNotification& notify) override;
     void registerResponseCallback(Event::HandlerBase *handler) override;
     void printStats(Output& out) override;
+    void setPrefetchDegree(unsigned int degree) override { this->degree = degree; }
 
     SST_ELI_REGISTER_SUBCOMPONENT(
         NextBlockPrefetcher,
@@ -53,7 +54,8 @@ public:
     )
 
     SST_ELI_DOCUMENT_PARAMS(
-        { "cache_line_size", "Size of the cache line the prefetcher is attached to", "64" }
+        { "cache_line_size", "Size of the cache line the prefetcher is attached to", "64" },
+        { "degree", "Number of blocks after the missing block to prefetch. Replaced by the cache's degree when it throttles prefetching", "1" }
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -71,6 +73,7 @@ public:
 private:
     std::vector<Event::HandlerBase*> registeredCallbacks;
     uint64_t blockSize;
+    uint32_t degree;
 
     Statistic<uint64_t>* statPrefetchEventsIssued;
     Statistic<uint64_t>* statMissEventsProcessed;
@@ -0,0 +1,195 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "smsprefetch.h"
+
+#include <algorithm>
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::Cassini;
+
+
+SMSPrefetcher::SMSPrefetcher(ComponentId_t id, Params& params) : TrackedPrefetcher(id, params) {
+    Output out("", 1, 0, Output::STDOUT);
+
+    regionSize = params.find<uint64_t>("region_size", 2048);
+    uint32_t ftEntries = params.find<uint32_t>("ft_entries", 32);
+    uint32_t agtEntries = params.find<uint32_t>("agt_entries", 64);
+    uint32_t phtEntries = params.find<uint32_t>("pht_entries", 1024);
+    phtAssoc = params.find<uint32_t>("pht_assoc", 4);
+
+    if (regionSize < blockSize || regionSize % blockSize != 0 || regionSize > pageSize)
+        out.fatal(CALL_INFO, -1, "%s, Error: region_size (%" PRIu64 ") must be a multiple of cache_line_size (%" PRIu64 ") and no larger than page_size (%" PRIu64 ")\n",
+                getName().c_str(), regionSize, blockSize, pageSize);
+    regionLines = regionSize / blockSize;
+    if (regionLines > 64 || (regionLines & (regionLines - 1)) != 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: region_size must be a power-of-two number of lines no greater than 64. Got %" PRIu32 " lines\n",
+                getName().c_str(), regionLines);
+    if (ftEntries == 0 || agtEntries == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: ft_entries and agt_entries must be greater than 0\n", getName().c_str());
+    if (phtAssoc == 0 || phtEntries == 0 || phtEntries % phtAssoc != 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: pht_entries (%" PRIu32 ") must be a non-zero multiple of pht_assoc (%" PRIu32 ")\n",
+                getName().c_str(), phtEntries, phtAssoc);
+    phtSets = phtEntries / phtAssoc;
+    linesPerDegree = params.find<uint32_t>("lines_per_degree", std::max(regionLines / 4, (uint32_t)1));
+    if (linesPerDegree == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: lines_per_degree must be greater than 0\n", getName().c_str());
+    maxLines = 0;
+
+    RegionEntry emptyRegion = { false, 0, 0, 0, 0, 0 };
+    PatternEntry emptyPattern = { false, 0, 0, 0 };
+    filterTable.assign(ftEntries, emptyRegion);
+    accumTable.assign(agtEntries, emptyRegion);
+    patternTable.assign(phtEntries, emptyPattern);
+    timestamp = 0;
+
+    statPHTHits          = registerStatistic<uint64_t>("pht_hits");
+    statPHTMisses        = registerStatistic<uint64_t>("pht_misses");
+    statPatternsRecorded = registerStatistic<uint64_t>("patterns_recorded");
+}
+
+void SMSPrefetcher::handleAccess(const CacheListenerNotification& notify, bool prefetchedHit) {
+    const Addr addr = notify.getPhysicalAddress();
+    const Addr region = addr / regionSize;
+    const uint32_t offset = (addr % regionSize) / blockSize;
+    timestamp++;
+
+    RegionEntry* accum = findRegion(accumTable, region);
+    RegionEntry* filter = accum ? nullptr : findRegion(filterTable, region);
+
+    if (notify.getAccessType() == EVICT) {
+        // End of the generation
+        if (accum) {
+            commit(*accum);
+            accum->valid = false;
+        } else if (filter) {
+            filter->valid = false; // Single-line patterns are not worth recording
+        }
+        return;
+    }
+
+    if (accum) {
+        accum->pattern |= (uint64_t)1 << offset;
+        accum->lru = timestamp;
+        return;
+    }
+
+    if (filter) {
+        if (filter->trigger != offset) {
+            // Second distinct line, start accumulating
+            RegionEntry* entry = victim(accumTable);
+            if (entry->valid)
+                commit(*entry);
+            *entry = *filter;
+            entry->pattern |= (uint64_t)1 << offset;
+            entry->lru = timestamp;
+            filter->valid = false;
+        } else {
+            filter->lru = timestamp;
+        }
+        return;
+    }
+
+    // Trigger access: start a new generation and replay the last pattern seen for this trigger
+    RegionEntry* entry = victim(filterTable);
+    entry->valid = true;
+    entry->region = region;
+    entry->pc = notify.getInstructionPointer();
+    entry->trigger = offset;
+    entry->pattern = (uint64_t)1 << offset;
+    entry->lru = timestamp;
+
+    uint64_t key = patternKey(entry->pc, offset);
+    PatternEntry* set = &patternTable[(key % phtSets) * phtAssoc];
+    for (uint32_t way = 0; way < phtAssoc; way++) {
+        if (set[way].valid && set[way].tag == key) {
+            statPHTHits->addData(1);
+            set[way].lru = timestamp;
+            uint64_t pattern = set[way].pattern & ~((uint64_t)1 << offset);
+            Addr regionBase = region * regionSize;
+            uint32_t issued = 0;
+            for (uint32_t i = 1; i < regionLines && (maxLines == 0 || issued < maxLines); i++) {
+                uint32_t line = (offset + i) & (regionLines - 1);
+                if (pattern & ((uint64_t)1 << line)) {
+                    issuePrefetch(regionBase + (Addr)line * blockSize);
+                    issued++;
+                }
+            }
+            return;
+        }
+    }
+    statPHTMisses->addData(1);
+}
+
+SMSPrefetcher::RegionEntry* SMSPrefetcher::findRegion(std::vector<RegionEntry>& table, Addr region) {
+    for (std::vector<RegionEntry>::iterator it = table.begin(); it != table.end(); it++) {
+        if (it->valid && it->region == region)
+            return &(*it);
+    }
+    return nullptr;
+}
+
+SMSPrefetcher::RegionEntry* SMSPrefetcher::victim(std::vector<RegionEntry>& table) {
+    RegionEntry* lru = &table[0];
+    for (std::vector<RegionEntry>::iterator it = table.begin(); it != table.end(); it++) {
+        if (!it->valid)
+            return &(*it);
+        if (it->lru < lru->lru)
+            lru = &(*it);
+    }
+    return lru;
+}
+
+void SMSPrefetcher::commit(const RegionEntry& entry) {
+    uint64_t key = patternKey(entry.pc, entry.trigger);
+    PatternEntry* set = &patternTable[(key % phtSets) * phtAssoc];
+    PatternEntry* target = nullptr;
+    for (uint32_t way = 0; way < phtAssoc; way++) {
+        if (set[way].valid && set[way].tag == key) {
+            target = &set[way];
+            break;
+        }
+        if (target == nullptr || !set[way].valid || (target->valid && set[way].lru < target->lru))
+            target = &set[way];
+    }
+    target->valid = true;
+    target->tag = key;
+    target->pattern = entry.pattern;
+    target->lru = timestamp;
+    statPatternsRecorded->addData(1);
+}
+
+void SMSPrefetcher::serialize_order(SST::Core::Serialization::serializer& ser) {
+    TrackedPrefetcher::serialize_order(ser);
+
+    SST_SER(filterTable);
+    SST_SER(accumTable);
+    SST_SER(patternTable);
+    SST_SER(regionSize);
+    SST_SER(regionLines);
+    SST_SER(phtSets);
+    SST_SER(phtAssoc);
+    SST_SER(linesPerDegree);
+    SST_SER(maxLines);
+    SST_SER(timestamp);
+    SST_SER(statPHTHits);
+    SST_SER(statPHTMisses);
+    SST_SER(statPatternsRecorded);
+}
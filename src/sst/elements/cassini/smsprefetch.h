@@ -0,0 +1,142 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_SMS_PREFETCH
+#define _H_SST_SMS_PREFETCH
+
+#include <vector>
+
+#include "trackedPrefetcher.h"
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Spatial memory streaming prefetcher (Somogyi et al., ISCA 2006)
+ *
+ * Memory is divided into regions of up to 64 lines. A generation starts with the first (trigger)
+ * access to a region and ends when any line of the region is evicted. The lines touched during
+ * a generation are accumulated as a bit pattern and stored in the pattern history table (PHT)
+ * under the trigger's PC and offset within the region. When a later trigger matches a PHT entry,
+ * the remaining lines in its pattern are prefetched.
+ *
+ * Regions touched once sit in the filter table; a second, distinct line moves them to the
+ * accumulation table. All tables are fixed-size with LRU replacement.
+ *
+ * A cache that throttles prefetching limits each trigger to degree * lines_per_degree lines,
+ * taken in order starting after the trigger line.
+ */
+class SMSPrefetcher : public TrackedPrefetcher {
+public:
+    SMSPrefetcher(ComponentId_t id, Params& params);
+    ~SMSPrefetcher() {}
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        SMSPrefetcher,
+        "cassini",
+        "SMSPrefetcher",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Spatial memory streaming prefetcher",
+        SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        CASSINI_TRACKED_PREFETCHER_ELI_PARAMS,
+        { "region_size", "Size of a spatial region in bytes. Must be a power-of-two multiple of cache_line_size of at most 64 lines and no larger than page_size", "2048" },
+        { "ft_entries", "Number of filter table entries (fully associative)", "32" },
+        { "agt_entries", "Number of accumulation table entries (fully associative)", "64" },
+        { "pht_entries", "Number of pattern history table entries", "1024" },
+        { "pht_assoc", "Associativity of the pattern history table", "4" },
+        { "lines_per_degree", "When the cache throttles prefetching, lines streamed per trigger for each step of degree. Default is a quarter of a region", "region lines/4" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        CASSINI_TRACKED_PREFETCHER_ELI_STATS,
+        { "pht_hits", "Triggers that found a pattern in the pattern history table", "triggers", 2 },
+        { "pht_misses", "Triggers without a pattern in the pattern history table", "triggers", 2 },
+        { "patterns_recorded", "Generations committed to the pattern history table", "patterns", 2 }
+    )
+
+    // Serialization support
+    SMSPrefetcher() : TrackedPrefetcher() {}
+    void serialize_order(SST::Core::Serialization::serializer& ser) override;
+    ImplementSerializable(SST::Cassini::SMSPrefetcher)
+
+    void setPrefetchDegree(unsigned int degree) override { maxLines = degree * linesPerDegree; }
+
+protected:
+    void handleAccess(const CacheListenerNotification& notify, bool prefetchedHit) override;
+
+private:
+    /* Filter and accumulation table entry */
+    struct RegionEntry {
+        bool valid;
+        Addr region;
+        Addr pc;
+        uint32_t trigger;   // Offset (in lines) of the trigger access
+        uint64_t pattern;   // Lines accessed this generation
+        uint64_t lru;
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) {
+            SST_SER(valid);
+            SST_SER(region);
+            SST_SER(pc);
+            SST_SER(trigger);
+            SST_SER(pattern);
+            SST_SER(lru);
+        }
+    };
+
+    struct PatternEntry {
+        bool valid;
+        uint64_t tag;
+        uint64_t pattern;
+        uint64_t lru;
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) {
+            SST_SER(valid);
+            SST_SER(tag);
+            SST_SER(pattern);
+            SST_SER(lru);
+        }
+    };
+
+    RegionEntry* findRegion(std::vector<RegionEntry>& table, Addr region);
+    RegionEntry* victim(std::vector<RegionEntry>& table);
+    void commit(const RegionEntry& entry);
+    uint64_t patternKey(Addr pc, uint32_t offset) { return (pc << 6) ^ offset; }
+
+    std::vector<RegionEntry> filterTable;
+    std::vector<RegionEntry> accumTable;
+    std::vector<PatternEntry> patternTable;
+
+    uint64_t regionSize;
+    uint32_t regionLines;
+    uint32_t phtSets;
+    uint32_t phtAssoc;
+    uint32_t linesPerDegree;
+    uint32_t maxLines;      // Lines streamed per trigger, 0 = whole pattern
+    uint64_t timestamp;
+
+    Statistic<uint64_t>* statPHTHits;
+    Statistic<uint64_t>* statPHTMisses;
+    Statistic<uint64_t>* statPatternsRecorded;
+};
+
+}
+}
+
+#endif
@@ -44,6 +44,7 @@ public:
     void notifyAccess(const CacheListenerNotification& notify) override;
     void registerResponseCallback(Event::HandlerBase *handler) override;
     void printStats(Output& out) override;
+    void setPrefetchDegree(unsigned int degree) override { strideReach = degree; }
 
     SST_ELI_REGISTER_SUBCOMPONENT(
         StridePrefetcher,
@@ -58,7 +59,7 @@ public:
         { "verbose", "Controls the verbosity of the Cassini component", "0" },
             { "cache_line_size", "Size of the cache line the prefetcher is attached to", "64" },
         { "history", "Number of entries to keep for historical comparison", "16" },
-        { "reach", "Reach (how far forward the prefetcher should fetch lines)", "2" },
+        { "reach", "Reach (how far forward the prefetcher should fetch lines). Replaced by the cache's degree when it throttles prefetching", "2" },
         { "detect_range", "Range to detect addresses over in request counts", "4" },
         { "address_count", "Number of addresses to keep in prefetch table", "64" },
         { "page_size", "Page size for this controller", "4096" },
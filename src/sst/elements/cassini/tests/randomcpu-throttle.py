@@ -0,0 +1,67 @@
+import sst
+import sys
+
+# Random accesses over a large memory, so next-block prefetches are almost never used.
+# With the default thresholds the cache throttles the prefetcher down to degree 1.
+# 'control' sets thresholds that never lower the degree, so the prefetcher stays at
+# the starting degree (2) and issues about twice as many prefetches.
+control = len(sys.argv) > 1 and sys.argv[1] == "control"
+
+DEBUG_L1 = 0
+
+sst.setStatisticLoadLevel(6)
+
+comp_cpu = sst.Component("cpu", "memHierarchy.standardCPU")
+comp_cpu.addParams({
+      "memFreq" : 2,
+      "memSize" : "64MiB",
+      "verbose" : 0,
+      "clock" : "2GHz",
+      "rngseed" : 13,
+      "maxOutstanding" : 8,
+      "opCount" : 20000,
+      "write_freq" : 25,
+      "read_freq" : 75,
+})
+
+iface = comp_cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+comp_l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+comp_l1cache.addParams({
+      "access_latency_cycles" : "2",
+      "cache_frequency" : "2 Ghz",
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MESI",
+      "associativity" : "4",
+      "cache_line_size" : "64",
+      "prefetcher" : "cassini.NextBlockPrefetcher",
+      "prefetch_throttle" : 1,
+      "prefetch_throttle_max_degree" : 4,
+      "debug" : DEBUG_L1,
+      "L1" : "1",
+      "cache_size" : "8 KB"
+})
+if control:
+    comp_l1cache.addParams({
+      "prefetch_throttle_accuracy_low" : 0.0,
+      "prefetch_throttle_accuracy_high" : 0.0,
+      "prefetch_throttle_pollution" : 1.0,
+    })
+
+comp_l1cache.enableAllStatistics({"type":"sst.AccumulatorStatistic"})
+
+comp_memory = sst.Component("memory", "memHierarchy.MemController")
+comp_memory.addParams({
+      "clock" : "1GHz",
+      "addr_range_start" : 0
+})
+backend = comp_memory.setSubComponent("backend", "memHierarchy.simpleMem")
+backend.addParams({
+      "access_time" : "100 ns",
+      "mem_size" : "64MiB",
+})
+
+link_cpu_cache_link = sst.Link("link_cpu_cache_link")
+link_cpu_cache_link.connect( (iface, "lowlink", "1000ps"), (comp_l1cache, "highlink", "1000ps") )
+link_mem_bus_link = sst.Link("link_mem_bus_link")
+link_mem_bus_link.connect( (comp_l1cache, "lowlink", "50ps"), (comp_memory, "highlink", "50ps") )
@@ -3,6 +3,8 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import re
+
 
 class testcase_cassini_prefetch(SSTTestCase):
 
@@ -28,6 +30,18 @@ class testcase_cassini_prefetch(SSTTestCase):
     def test_cassini_prefetch_nextblock(self):
         self.cassini_prefetch_test_template("nbp")
 
+    @unittest.skipIf(testing_check_get_num_threads() > 3, "cassini_prefetch: test_cassini_prefetch_bestoffset skipped if threads > 3")
+    def test_cassini_prefetch_bestoffset(self):
+        self.cassini_prefetch_check_template("bop")
+
+    @unittest.skipIf(testing_check_get_num_threads() > 3, "cassini_prefetch: test_cassini_prefetch_sms skipped if threads > 3")
+    def test_cassini_prefetch_sms(self):
+        self.cassini_prefetch_check_template("sms")
+
+    @unittest.skipIf(testing_check_get_num_threads() > 3, "cassini_prefetch: test_cassini_prefetch_throttle skipped if threads > 3")
+    def test_cassini_prefetch_throttle(self):
+        self.cassini_prefetch_throttle_template()
+
 #####
 
     def cassini_prefetch_test_template(self, testcase, testtimeout=180):
@@ -66,6 +80,66 @@ class testcase_cassini_prefetch(SSTTestCase):
             log_failure(diffdata)
             self.assertTrue(filesAreTheSame, "Output file {0} does not pass check against the Reference File {1} ".format(outfile, reffile))
 
+    # No reference file: check that the stream completes and that the prefetcher issued useful prefetches
+    def cassini_prefetch_check_template(self, testcase, testtimeout=180):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName="test_cassini_prefetch_{0}".format(testcase)
+
+        sdlfile = "{0}/streamcpu-{1}.py".format(test_path, testcase)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("cassini_prefetch test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        finished = re.search(r"streamCPU Finished after (\d+) issued reads, (\d+) returned", self._readFile(outfile))
+        self.assertTrue(finished is not None, "Output file {0} does not report that streamCPU finished".format(outfile))
+        self.assertEqual(finished.group(1), finished.group(2), "streamCPU did not receive all its reads in {0}".format(outfile))
+
+        issued = self._getStatSum(outfile, "l1cache.Prefetch_requests")
+        useful = self._getStatSum(outfile, "l1cache.prefetch_useful")
+        self.assertTrue(issued > 0, "No prefetches issued in {0}".format(outfile))
+        self.assertTrue(useful > 0, "No useful prefetches in {0}".format(outfile))
+
+    # Inaccurate prefetches must be throttled: the same random workload issues fewer prefetches
+    # than a control run whose thresholds never lower the prefetcher's degree
+    def cassini_prefetch_throttle_template(self, testtimeout=180):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        sdlfile = "{0}/randomcpu-throttle.py".format(test_path)
+
+        issued = {}
+        for run in ["throttle", "control"]:
+            testDataFileName="test_cassini_prefetch_{0}".format(run)
+            outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+            self.run_sst(sdlfile, outfile, errfile, other_args='--model-options="{0}"'.format(run), mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
+
+            if os_test_file(errfile, "-s"):
+                log_testing_note("cassini_prefetch test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+            issued[run] = self._getStatSum(outfile, "l1cache.Prefetch_requests")
+            self.assertTrue(issued[run] > 0, "No prefetches issued in {0}".format(outfile))
+
+        self.assertTrue(issued["throttle"] < issued["control"],
+            "Throttled run issued {0} prefetches, control run issued {1}".format(issued["throttle"], issued["control"]))
+
+    def _readFile(self, filename):
+        with open(filename) as fp:
+            return fp.read()
+
+    # Sum of an accumulator statistic in the console output, or -1 if it is missing
+    def _getStatSum(self, outfile, stat):
+        found = re.search(r"^ *{0} : Accumulator : Sum\.u64 = (\d+);".format(re.escape(stat)), self._readFile(outfile), re.MULTILINE)
+        return int(found.group(1)) if found else -1
+
     def _prettyPrintDiffs(self, stat_diff, oth_diff):
         out = ""
         if len(stat_diff) != 0:
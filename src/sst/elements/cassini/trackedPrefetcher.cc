@@ -0,0 +1,129 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "trackedPrefetcher.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::Cassini;
+
+
+TrackedPrefetcher::TrackedPrefetcher(ComponentId_t id, Params& params) : CacheListener(id, params) {
+    requireLibrary("memHierarchy");
+
+    blockSize = params.find<uint64_t>("cache_line_size", 64);
+    pageSize = params.find<uint64_t>("page_size", 4096);
+
+    Output out("", 1, 0, Output::STDOUT);
+    if (blockSize == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: cache_line_size must be greater than 0\n", getName().c_str());
+    if (pageSize < blockSize || pageSize % blockSize != 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: page_size (%" PRIu64 ") must be a multiple of cache_line_size (%" PRIu64 ")\n",
+                getName().c_str(), pageSize, blockSize);
+
+    uint32_t trackerEntries = params.find<uint32_t>("tracker_entries", 1024);
+    if (trackerEntries == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: tracker_entries must be greater than 0\n", getName().c_str());
+    tracker.assign(trackerEntries, NO_LINE);
+
+    statPrefetchesIssued    = registerStatistic<uint64_t>("prefetches_issued");
+    statPrefetchesUseful    = registerStatistic<uint64_t>("prefetches_useful");
+    statPrefetchesLate      = registerStatistic<uint64_t>("prefetches_late");
+    statPrefetchesUseless   = registerStatistic<uint64_t>("prefetches_useless");
+    statPrefetchesRedundant = registerStatistic<uint64_t>("prefetches_redundant");
+    statDemandMisses        = registerStatistic<uint64_t>("demand_misses");
+}
+
+void TrackedPrefetcher::notifyAccess(const CacheListenerNotification& notify) {
+    const NotifyAccessType notifyType = notify.getAccessType();
+    const Addr line = lineAddress(notify.getPhysicalAddress());
+    const size_t slot = trackerSlot(line);
+    const bool tracked = (tracker[slot] == line);
+
+    switch (notifyType) {
+        case READ:
+        case WRITE:
+            if (tracked) {
+                statPrefetchesUseful->addData(1);
+                if (notify.getResultType() == MISS)
+                    statPrefetchesLate->addData(1);
+                tracker[slot] = NO_LINE;
+            } else if (notify.getResultType() == MISS) {
+                statDemandMisses->addData(1);
+            }
+            handleAccess(notify, tracked);
+            break;
+        case EVICT:
+            if (tracked) {
+                statPrefetchesUseless->addData(1);
+                tracker[slot] = NO_LINE;
+            }
+            handleAccess(notify, false);
+            break;
+        case PREFETCH:
+            // The cache handling a prefetch; a hit means the line was already present
+            if (tracked && notify.getResultType() == HIT) {
+                statPrefetchesRedundant->addData(1);
+                tracker[slot] = NO_LINE;
+            }
+            break;
+    }
+}
+
+bool TrackedPrefetcher::issuePrefetch(Addr lineAddr) {
+    const size_t slot = trackerSlot(lineAddr);
+    if (tracker[slot] == lineAddr)
+        return false;
+
+    if (tracker[slot] != NO_LINE)
+        statPrefetchesUseless->addData(1); // Lost track of it, count as unused
+    tracker[slot] = lineAddr;
+
+    statPrefetchesIssued->addData(1);
+
+    // Cycle over each registered call back and notify them that we want to issue a prefetch request
+    for (std::vector<Event::HandlerBase*>::iterator callbackItr = registeredCallbacks.begin(); callbackItr != registeredCallbacks.end(); callbackItr++) {
+        // Create a new read request, we cannot issue a write because the data will get
+        // overwritten and corrupt memory (even if we really do want to do a write)
+        MemEvent* newEv = new MemEvent(getName(), lineAddr, lineAddr, Command::GetS);
+        newEv->setSize(blockSize);
+        newEv->setPrefetchFlag(true);
+        (*(*callbackItr))(newEv);
+    }
+    return true;
+}
+
+void TrackedPrefetcher::registerResponseCallback(Event::HandlerBase *handler) {
+    registeredCallbacks.push_back(handler);
+}
+
+void TrackedPrefetcher::serialize_order(SST::Core::Serialization::serializer& ser) {
+    CacheListener::serialize_order(ser);
+
+    SST_SER(registeredCallbacks);
+    SST_SER(blockSize);
+    SST_SER(pageSize);
+    SST_SER(tracker);
+    SST_SER(statPrefetchesIssued);
+    SST_SER(statPrefetchesUseful);
+    SST_SER(statPrefetchesLate);
+    SST_SER(statPrefetchesUseless);
+    SST_SER(statPrefetchesRedundant);
+    SST_SER(statDemandMisses);
+}
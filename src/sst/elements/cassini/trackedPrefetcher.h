@@ -0,0 +1,103 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_TRACKED_PREFETCH
+#define _H_SST_TRACKED_PREFETCH
+
+#include <vector>
+
+#include <sst/core/event.h>
+#include <sst/core/sst_types.h>
+#include <sst/core/component.h>
+#include <sst/elements/memHierarchy/memEvent.h>
+#include <sst/elements/memHierarchy/cacheListener.h>
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace std;
+
+namespace SST {
+namespace Cassini {
+
+#define CASSINI_TRACKED_PREFETCHER_ELI_PARAMS \
+    { "cache_line_size", "Size of the cache line the prefetcher is attached to", "64" },\
+    { "page_size", "Page size; prefetches do not cross page boundaries", "4096" },\
+    { "tracker_entries", "Number of issued prefetches tracked (direct-mapped) for the accuracy, coverage and timeliness statistics", "1024" }
+
+/* accuracy = useful / issued, timeliness = 1 - late / useful, coverage = (useful - late) / (useful + demand_misses) */
+#define CASSINI_TRACKED_PREFETCHER_ELI_STATS \
+    { "prefetches_issued",      "Number of prefetch requests issued", "prefetches", 1 },\
+    { "prefetches_useful",      "Prefetched lines accessed by a demand request before eviction", "prefetches", 1 },\
+    { "prefetches_late",        "Useful prefetches whose demand access still missed (prefetch had not completed)", "prefetches", 1 },\
+    { "prefetches_useless",     "Prefetched lines evicted, or dropped from tracking, before any demand access", "prefetches", 1 },\
+    { "prefetches_redundant",   "Prefetches for lines that were already in the cache", "prefetches", 1 },\
+    { "demand_misses",          "Demand misses not covered by an issued prefetch", "misses", 1 }
+
+/*
+ * Base for prefetchers that track their own prefetches
+ *
+ * Each issued line is recorded in a fixed-size, direct-mapped table. The first demand access
+ * to a recorded line makes the prefetch useful (late if that access missed); an eviction
+ * before then makes it useless. Derived classes implement handleAccess() and call issuePrefetch().
+ */
+class TrackedPrefetcher : public SST::MemHierarchy::CacheListener {
+public:
+    TrackedPrefetcher(ComponentId_t id, Params& params);
+    virtual ~TrackedPrefetcher() {}
+
+    void notifyAccess(const CacheListenerNotification& notify) override;
+    void registerResponseCallback(Event::HandlerBase *handler) override;
+    void printStats(Output& out) override { }
+
+    // Serialization support
+    TrackedPrefetcher() : SST::MemHierarchy::CacheListener() {}
+    void serialize_order(SST::Core::Serialization::serializer& ser) override;
+    ImplementVirtualSerializable(SST::Cassini::TrackedPrefetcher)
+
+protected:
+    /* Called for demand (READ/WRITE) and EVICT notifications.
+     * prefetchedHit is true for the first demand access to a line this prefetcher brought in */
+    virtual void handleAccess(const CacheListenerNotification& notify, bool prefetchedHit) = 0;
+
+    /* Request a line. Returns false if the line already has an outstanding, unused prefetch */
+    bool issuePrefetch(Addr lineAddr);
+
+    Addr lineAddress(Addr addr) { return addr - (addr % blockSize); }
+    bool samePage(Addr a, Addr b) { return (a / pageSize) == (b / pageSize); }
+
+    uint64_t blockSize;
+    uint64_t pageSize;
+
+private:
+    static constexpr Addr NO_LINE = ~((Addr)0);
+
+    size_t trackerSlot(Addr lineAddr) { return (lineAddr / blockSize) % tracker.size(); }
+
+    std::vector<Event::HandlerBase*> registeredCallbacks;
+    std::vector<Addr> tracker; // Line address of an unused prefetch, or NO_LINE
+
+    Statistic<uint64_t>* statPrefetchesIssued;
+    Statistic<uint64_t>* statPrefetchesUseful;
+    Statistic<uint64_t>* statPrefetchesLate;
+    Statistic<uint64_t>* statPrefetchesUseless;
+    Statistic<uint64_t>* statPrefetchesRedundant;
+    Statistic<uint64_t>* statDemandMisses;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
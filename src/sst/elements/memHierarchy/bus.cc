@@ -85,7 +85,7 @@ bool Bus::clockTick(Cycle_t time) {
 
 void Bus::broadcastEvent(SST::Event* ev) {
     MemEventBase* memEvent = static_cast<MemEventBase*>(ev);
-    SST::Link* srcLink = lookupNode(memEvent->getSrc());
+    SST::Link* srcLink = lookupNode(memEvent->getSrcID());
 
     for (int i = 0; i < numHighPorts_; i++) {
         if (highNetPorts_[i] == srcLink) continue;
@@ -110,7 +110,7 @@ void Bus::sendSingleEvent(SST::Event* ev) {
         fflush(stdout);
     }
 #endif
-    SST::Link* dstLink = lookupNode(event->getDst());
+    SST::Link* dstLink = lookupNode(event->getDstID());
     MemEventBase* forwardEvent = event->clone();
     dstLink->send(forwardEvent);
 
@@ -121,8 +121,8 @@ void Bus::sendSingleEvent(SST::Event* ev) {
  * Helper functions
  *---------------------------------------*/
 
-void Bus::mapNodeEntry(const std::string& name, SST::Link* link) {
-    std::map<std::string, SST::Link*>::iterator it = nameMap_.find(name);
+void Bus::mapNodeEntry(EndpointID name, SST::Link* link) {
+    std::unordered_map<EndpointID, SST::Link*>::iterator it = nameMap_.find(name);
     if (it != nameMap_.end() ) {
         if (it->second != link)
             dbg_.fatal(CALL_INFO, -1, "%s, Error: Bus attempting to map node that has already been mapped\n", getName().c_str());
@@ -131,10 +131,10 @@ void Bus::mapNodeEntry(const std::string& name, SST::Link* link) {
     nameMap_[name] = link;
 }
 
-SST::Link* Bus::lookupNode(const std::string& name) {
-    std::map<std::string, SST::Link*>::iterator it = nameMap_.find(name);
+SST::Link* Bus::lookupNode(EndpointID name) {
+    std::unordered_map<EndpointID, SST::Link*>::iterator it = nameMap_.find(name);
     if (nameMap_.end() == it) {
-        dbg_.fatal(CALL_INFO, -1, "%s, Error: Bus lookup of node %s returned no mapping\n", getName().c_str(), name.c_str());
+        dbg_.fatal(CALL_INFO, -1, "%s, Error: Bus lookup of node %s returned no mapping\n", getName().c_str(), EndpointTable::name(name).c_str());
     }
     return it->second;
 }
@@ -219,7 +219,7 @@ void Bus::init(unsigned int phase) {
             if (!memEvent) {
                 delete ev;
             } else if (memEvent->getCmd() == Command::NULLCMD) {
-                mapNodeEntry(memEvent->getSrc(), highNetPorts_[i]);
+                mapNodeEntry(memEvent->getSrcID(), highNetPorts_[i]);
 
                 if (memEvent->getInitCmd() == MemEventInit::InitCommand::Region) {
                     MemEventInitRegion * mEvReg = static_cast<MemEventInitRegion*>(memEvent);
@@ -240,12 +240,12 @@ void Bus::init(unsigned int phase) {
                     }
                 }
                 delete memEvent;
-            } else if (memEvent->getDst() == "None") {
+            } else if (memEvent->getDstID() == EndpointTable::NONE_ID) {
                 for (int k = 0; k < numLowPorts_; k++)
                     lowNetPorts_[k]->sendUntimedData(memEvent->clone());
                 delete memEvent;
             } else {
-                SST::Link* dstLink = lookupNode(memEvent->getDst());
+                SST::Link* dstLink = lookupNode(memEvent->getDstID());
                 dstLink->sendUntimedData(memEvent);
             }
         }
@@ -256,7 +256,7 @@ void Bus::init(unsigned int phase) {
             MemEventInit* memEvent = dynamic_cast<MemEventInit*>(ev);
             if (!memEvent) delete ev;
             else if (memEvent->getCmd() == Command::NULLCMD) {
-                mapNodeEntry(memEvent->getSrc(), lowNetPorts_[i]);
+                mapNodeEntry(memEvent->getSrcID(), lowNetPorts_[i]);
 
                 if (memEvent->getInitCmd() == MemEventInit::InitCommand::Region) {
                     MemEventInitRegion * mEvReg = static_cast<MemEventInitRegion*>(memEvent);
@@ -278,12 +278,12 @@ void Bus::init(unsigned int phase) {
                 }
                 delete memEvent;
             }
-            else if (memEvent->getDst() == "None") {
+            else if (memEvent->getDstID() == EndpointTable::NONE_ID) {
                 for (int k = 0; k < numHighPorts_; k++)
                     highNetPorts_[k]->sendUntimedData(memEvent->clone());
                 delete memEvent;
             } else {
-                SST::Link* dstLink = lookupNode(memEvent->getDst());
+                SST::Link* dstLink = lookupNode(memEvent->getDstID());
                 dstLink->sendUntimedData(memEvent);
             }
         }
@@ -299,11 +299,11 @@ void Bus::complete(unsigned int phase) {
         while ((ev = highNetPorts_[i]->recvUntimedData())) {
             MemEventInit* event = dynamic_cast<MemEventInit*>(ev);
             dbg_.debug(_L10_, "I: %-20s   Event:Init      (%s)\n", getName().c_str(), event->getVerboseString().c_str());
-            if (event->getDst() == "None") { // Broadcast
+            if (event->getDstID() == EndpointTable::NONE_ID) { // Broadcast
                 for (int k = 0; k < numLowPorts_; k++)
                     lowNetPorts_[k]->sendUntimedData(event->clone());
             } else {
-                SST::Link* dstLink = lookupNode(event->getDst());
+                SST::Link* dstLink = lookupNode(event->getDstID());
                 dstLink->sendUntimedData(event);
             }
         }
@@ -314,11 +314,11 @@ void Bus::complete(unsigned int phase) {
         while ((ev = lowNetPorts_[i]->recvUntimedData())) {
             MemEventInit* event = dynamic_cast<MemEventInit*>(ev);
             dbg_.debug(_L10_, "I: %-20s   Event:Init      (%s)\n", getName().c_str(), event->getVerboseString().c_str());
-            if (event->getDst() == "None") { //braodcast
+            if (event->getDstID() == EndpointTable::NONE_ID) { //braodcast
                 for (int k = 0; k < numHighPorts_; k++)
                     highNetPorts_[k]->sendUntimedData(event->clone());
             } else {
-                SST::Link* dstLink = lookupNode(event->getDst());
+                SST::Link* dstLink = lookupNode(event->getDstID());
                 dstLink->sendUntimedData(event);
             }
         }
@@ -341,6 +341,16 @@ void Bus::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(defaultTimeBase_);
     SST_SER(highNetPorts_);
     SST_SER(lowNetPorts_);
-    SST_SER(nameMap_);
+    // Endpoint IDs are only valid within a process so checkpoint the map by name
+    if (ser.mode() != SST::Core::Serialization::serializer::MAP) {
+        std::map<std::string, SST::Link*> names;
+        for (auto it = nameMap_.begin(); it != nameMap_.end(); it++)
+            names[EndpointTable::name(it->first)] = it->second;
+        SST_SER(names);
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            for (auto it = names.begin(); it != names.end(); it++)
+                nameMap_[EndpointTable::intern(it->first)] = it->second;
+        }
+    }
     SST_SER(eventQueue_);
 }
@@ -18,6 +18,7 @@
 
 #include <queue>
 #include <map>
+#include <unordered_map>
 
 #include <sst/core/event.h>
 #include <sst/core/sst_types.h>
@@ -91,8 +92,8 @@ private:
     void configureParameters(SST::Params&);
     void configureLinks();
 
-    void mapNodeEntry(const std::string&, SST::Link*);
-    SST::Link* lookupNode(const std::string&);
+    void mapNodeEntry(EndpointID, SST::Link*);
+    SST::Link* lookupNode(EndpointID);
 
 
     Output                      dbg_;
@@ -109,7 +110,7 @@ private:
 
     std::vector<SST::Link*>     highNetPorts_;
     std::vector<SST::Link*>     lowNetPorts_;
-    std::map<string,SST::Link*> nameMap_;
+    std::unordered_map<EndpointID,SST::Link*> nameMap_;
     std::queue<SST::Event*>     eventQueue_;
 
 };
@@ -25,6 +25,8 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/lineTypes.h"
+#include "sst/elements/memHierarchy/tagMatch.h"
+#include "sst/elements/memHierarchy/lineCompressor.h"
 
 using namespace std;
 
@@ -50,8 +52,18 @@ class CacheArray {
         Addr            slice_step_; // For cache slices
         unsigned int    banks_;
         vector<T*>      lines_; // The actual cache
+        vector<Addr>    tags_;  // Packed copy of each line's address, indexed by set*associativity + way, so lookups scan contiguous memory
         State* setStates;
-        std::map<unsigned int, std::vector<ReplacementInfo*> > rInfo;   // Lookup a vector of replacementInfo by set ID
+        vector<typename T::ReplacementInfoType> infos_; // Each line's replacement info, by value and indexed like tags_. Lines point into it
+        vector<ReplacementInfo*> rInfo_; // Pointers into infos_ in the form replacement policies take
+        TagMatch::MatchFunction match_;  // Tag compare for this associativity, see tagMatch.h
+        unsigned int    set_mask_;       // num_sets_ - 1 if num_sets_ is a power of two, otherwise 0
+        LineCompressor* compressor_;     // Non-null if the array is compressed, see setCompression()
+        unsigned int    data_ways_;      // Data capacity of a set in lines, if compressed
+        vector<ReplacementInfo*> candidates_; // Scratch for findCompressedCandidate
+
+        T * findCompressedCandidate(Addr addr);
+        uint64_t compressedBytes(unsigned int setBegin, unsigned int& valid, T*& free_line);
     public:
 
         CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, ReplacementPolicy* replacementMgr, HashFunction* hash);
@@ -70,6 +82,12 @@ class CacheArray {
         /** Return bank num */
         Addr getBank(Addr addr) { return (toLineAddr(addr) % banks_); }
 
+        /** Return set index */
+        unsigned int getSet(Addr addr) {
+            Addr h = hash_->hash(0, toLineAddr(addr));
+            return set_mask_ ? (h & set_mask_) : (h % num_sets_);
+        }
+
     /**** Cache queries & maintenance */
 
         /** Function returns the cacheline if found, otherwise a null pointer.
@@ -86,7 +104,13 @@ class CacheArray {
         void deallocate(T* candidate);
 
     /**** Configuration and output */
+        /** Compress lines. Each set has 'associativity' tags but only 'dataWays' lines of data.
+            A line may only be allocated if the compressed sizes of the set's valid lines fit */
+        void setCompression(LineCompressor* compressor, unsigned int dataWays);
+        bool isCompressed() const { return compressor_ != nullptr; }
         void setSliceAware(Addr size, Addr step);
+        /** Track per-sector state in each line (see LineSectors). Only for line types derived from CacheLine */
+        void setSectored(uint32_t sectorSize);
         void setBanked(unsigned int numBanks);
         void printCacheArray(Output &out);
 
@@ -116,7 +140,8 @@ class CacheArray {
 
 template <class T>
 CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, ReplacementPolicy* replacementMgr, HashFunction* hash) :
-    debug_(dbg), num_lines_(numLines), associativity_(associativity), line_size_(lineSize), replacement_mgr_(replacementMgr), hash_(hash) {
+    debug_(dbg), num_lines_(numLines), associativity_(associativity), line_size_(lineSize), replacement_mgr_(replacementMgr), hash_(hash),
+    compressor_(nullptr), data_ways_(associativity) {
 
     // Error check parameters
     if (num_lines_ == 0)
@@ -135,7 +160,12 @@ CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int assoc
                 num_lines_, associativity_);
 
     line_offset_ = log2Of(line_size_);
+    set_mask_ = (num_sets_ > 1 && isPowerOfTwo(num_sets_)) ? num_sets_ - 1 : 0;
+    match_ = TagMatch::select(associativity_);
     lines_.resize(num_lines_);
+    tags_.resize(num_lines_);
+    infos_.resize(num_lines_);
+    rInfo_.resize(num_lines_);
 
     // Set later using setter functions
     slice_step_ = 1;
@@ -143,23 +173,23 @@ CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int assoc
     banks_ = 1;
 
     for (unsigned int i = 0; i < num_lines_; i++) {
-        lines_[i] = new T(line_size_, i);
+        lines_[i] = new T(line_size_, i, &infos_[i]);
+        tags_[i] = lines_[i]->getAddr();
+        rInfo_[i] = &infos_[i];
     }
 
-    // Construct rInfo
-    for (unsigned int i = 0; i < num_sets_; i++) {
-        std::vector<ReplacementInfo*> setInfo;
-        for (unsigned int j = 0; j < associativity; j++)
-            setInfo.push_back(lines_[i*associativity + j]->getReplacementInfo());
-        rInfo.insert(std::make_pair(i, setInfo));
-    }
-    ReplacementInfo * info = rInfo.find(0)->second.front();
+    ReplacementInfo * info = rInfo_.front();
     if (!replacement_mgr_->checkCompatibility(info))
         debug_->fatal(CALL_INFO, -1, "CacheArray, Error: The replacement policy expects cache line state that is not provided by the cache line type of this cache. Check the type of the ReplacementInfo returned by the coherence protocol's line type and the ReplacementInfo type expected by the replacement policy.\n");
 
     setStates = new State[associativity_];
 }
 
+/* Line contents for compression. Lines without data compress to nothing */
+inline vector<uint8_t>* compressibleData(CacheLine* line) { return line->getData(); }
+inline vector<uint8_t>* compressibleData(DataLine* line) { return line->getData(); }
+inline vector<uint8_t>* compressibleData(DirectoryLine* line) { return nullptr; }
+
 template <class T>
 CacheArray<T>::~CacheArray() {
     for (size_t i = 0; i < lines_.size(); i++)
@@ -177,37 +207,88 @@ Addr CacheArray<T>::toLineAddr(Addr addr) {
 
 template <class T>
 T* CacheArray<T>::lookup(const Addr addr, bool updateReplacement) {
-    Addr laddr = toLineAddr(addr);
-    int set = hash_->hash(0, laddr) % num_sets_;
-    int setBegin = set * associativity_;
-    int setEnd = setBegin + associativity_;
-
-    for (int i = setBegin; i < setEnd; i++) {
-        if (lines_[i]->getAddr() == addr) {
-            if (updateReplacement)
-                replacement_mgr_->update(i, lines_[i]->getReplacementInfo());
-            return lines_[i];
-        }
-    }
-    return nullptr; // Not found
+    unsigned int setBegin = getSet(addr) * associativity_;
+
+    int way = match_(&tags_[setBegin], associativity_, addr);
+    if (way < 0)
+        return nullptr; // Not found
+
+    unsigned int i = setBegin + way;
+    if (updateReplacement)
+        replacement_mgr_->update(i, lines_[i]->getReplacementInfo());
+    return lines_[i];
 }
 
 template <class T>
 T * CacheArray<T>::findReplacementCandidate(Addr addr) {
-    Addr laddr = toLineAddr(addr);
-    int set = hash_->hash(0, laddr) % num_sets_;
+    if (compressor_)
+        return findCompressedCandidate(addr);
+
+    unsigned int setBegin = getSet(addr) * associativity_;
+
+    unsigned int id = replacement_mgr_->findBestCandidate(&rInfo_[setBegin], associativity_);
+
+    return lines_[id];
+}
+
+/*
+ * Return an invalid line if the set has a free tag and the data fits in the set's data ways,
+ * otherwise the replacement manager's choice among the valid lines.
+ * Lines that are not yet filled count as uncompressed. Callers evict the returned line and ask
+ * again until they get an invalid one, so an allocation may evict several lines. A line that
+ * is written after it is filled can still leave the set over its data ways until the next
+ * allocation in the set.
+ */
+template <class T>
+T * CacheArray<T>::findCompressedCandidate(Addr addr) {
+    unsigned int setBegin = getSet(addr) * associativity_;
+    unsigned int valid = 0;
+    T* free_line = nullptr;
+
+    candidates_.clear();
+    uint64_t used = compressedBytes(setBegin, valid, free_line);
 
-    unsigned int id = replacement_mgr_->findBestCandidate(rInfo[set]);
+    if (free_line && (used + line_size_ <= (uint64_t)data_ways_ * line_size_ || candidates_.empty()))
+        return free_line;
 
+    unsigned int id = replacement_mgr_->findBestCandidate(candidates_.data(), candidates_.size());
     return lines_[id];
 }
 
+/* Compressed size of the set's valid lines. Collects their replacement info in candidates_ */
+template <class T>
+uint64_t CacheArray<T>::compressedBytes(unsigned int setBegin, unsigned int& valid, T*& free_line) {
+    uint64_t used = 0;
+    for (unsigned int i = setBegin; i < setBegin + associativity_; i++) {
+        if (!lines_[i]->isAllocated()) {
+            if (!free_line)
+                free_line = lines_[i];
+            continue;
+        }
+        vector<uint8_t>* data = compressibleData(lines_[i]);
+        if (data)
+            used += data->empty() ? line_size_ : compressor_->compressedSize(*data);
+        valid++;
+        candidates_.push_back(rInfo_[i]);
+    }
+    return used;
+}
+
+/* Compressed arrays record the set in the compressor's statistics once per allocation, here */
 template <class T>
 void CacheArray<T>::replace(Addr addr, T* candidate) {
     unsigned int index = candidate->getIndex();
+    if (compressor_) {
+        unsigned int valid = 0;
+        T* free_line = nullptr;
+        candidates_.clear();
+        uint64_t used = compressedBytes(index - (index % associativity_), valid, free_line);
+        compressor_->recordSet(valid, used, data_ways_);
+    }
     replacement_mgr_->replaced(index);
     candidate->reset();
     candidate->setAddr(addr);
+    tags_[index] = addr;
     replacement_mgr_->update(index, lines_[index]->getReplacementInfo());
 }
 
@@ -216,6 +297,17 @@ void CacheArray<T>::deallocate(T* candidate) {
     unsigned int index = candidate->getIndex();
     replacement_mgr_->replaced(index);
     candidate->reset();
+    tags_[index] = candidate->getAddr();
+}
+
+template <class T>
+void CacheArray<T>::setCompression(LineCompressor* compressor, unsigned int dataWays) {
+    if (dataWays == 0 || dataWays > associativity_)
+        debug_->fatal(CALL_INFO, -1, "CacheArray, Error: compressed array has %u data ways per set, must be between 1 and the tag associativity (%u).\n",
+                dataWays, associativity_);
+    compressor_ = compressor;
+    data_ways_ = dataWays;
+    candidates_.reserve(associativity_);
 }
 
 template <class T>
@@ -226,6 +318,12 @@ void CacheArray<T>::setSliceAware(Addr size, Addr step) {
     if (slice_step_ == 0) slice_step_ = 1;
 }
 
+template <class T>
+void CacheArray<T>::setSectored(uint32_t sectorSize) {
+    for (unsigned int i = 0; i < num_lines_; i++)
+        lines_[i]->setSectored(line_size_, sectorSize);
+}
+
 template <class T>
 void CacheArray<T>::setBanked(unsigned int numBanks) {
     banks_ = numBanks;
@@ -253,8 +351,21 @@ void CacheArray<T>::serialize_order(SST::Core::Serialization::serializer& ser)
     SST_SER(slice_step_);
     SST_SER(banks_);
     SST_SER(lines_);
+    SST_SER(tags_);
     SST_SER(setStates);
-    SST_SER(rInfo);
+    SST_SER(infos_);
+    SST_SER(set_mask_);
+    SST_SER(compressor_);
+    SST_SER(data_ways_);
+
+    if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+        match_ = TagMatch::select(associativity_);
+        rInfo_.resize(num_lines_);
+        for (unsigned int i = 0; i < num_lines_; i++) {
+            lines_[i]->setReplacementInfo(&infos_[i]);
+            rInfo_[i] = &infos_[i];
+        }
+    }
 }
 
 }}
@@ -42,6 +42,10 @@ void Cache::handleEvent(SST::Event * ev) {
     if (!clockIsOn_)
         turnClockOn();
 
+    // Functional warmup is untimed; handle it on arrival
+    if (processWarmup(event))
+        return;
+
     // Record the time at which requests arrive for latency statistics
     if (CommandClassArr[(int)event->getCmd()] == CommandClass::Request && !CommandWriteback[(int)event->getCmd()])
         coherenceMgr_->recordIncomingRequest(event);
@@ -58,6 +62,10 @@ void Cache::handleEvent(SST::Event * ev) {
         fflush(stdout);
     }
 
+    // Nothing is waiting ahead of this event, try to handle it now instead of on the next clock tick
+    if (fastPath_ && eventBuffer_.empty() && retryBuffer_.empty() && processFastPath(event))
+        return;
+
     eventBuffer_.push_back(event);
     //printf("DBG: %s, inserted <%" PRIu64 ", %d>, size=%zu\n", getName().c_str(), event->getID().first, event->getID().second, eventBuffer_.size());
 
@@ -68,8 +76,15 @@ void Cache::handleEvent(SST::Event * ev) {
  * -> Delay prefetch using a self link since prefetcher can
  *  return a prefetch request in the same cycle it identifies
  *  a prefetch target
+ * -> If throttling, drop prefetches beyond the prefetcher's degree for this cycle
  */
-void Cache::handlePrefetchEvent(SST::Event * ev) {
+void Cache::handlePrefetchEvent(SST::Event * ev, unsigned int prefetcher) {
+    if (prefetchThrottle_.enabled() && !prefetchThrottle_.admit(prefetcher, static_cast<MemEventBase*>(ev), getCurrentSimCycle())) {
+        statPrefetchRequest->addData(1);
+        statPrefetchDrop->addData(1);
+        delete ev;
+        return;
+    }
     prefetchSelfLink_->send(prefetchDelay_, ev);
 }
 
@@ -77,8 +92,8 @@ void Cache::handlePrefetchEvent(SST::Event * ev) {
 void Cache::processPrefetchEvent(SST::Event * ev) {
     MemEvent * event = static_cast<MemEvent*>(ev);
     event->setBaseAddr(toBaseAddr(event->getAddr()));
-    event->setRqstr(getName());
-    event->setSrc(getName());
+    event->setRqstrID(cacheid_);
+    event->setSrcID(cacheid_);
 
     if (!clockIsOn_) {
         turnClockOn();
@@ -161,9 +176,14 @@ bool Cache::clockTick(Cycle_t time) {
                     getCurrentSimCycle(), timestamp_, getName().c_str(), (*it)->getVerboseString().c_str());
             fflush(stdout);
         }
+        bool fastPathCandidate = fastPath_ && isFastPathRequest(*it);
+        Addr fastPathAddr = fastPathCandidate ? static_cast<MemEvent*>(*it)->getBaseAddr() : 0;
+        fastPathCandidate = fastPathCandidate && !mshr_->exists(fastPathAddr);
         if (processEvent(*it, false)) {
             accepted++;
             statRecvEvents->addData(1);
+            if (fastPathCandidate && !mshr_->exists(fastPathAddr))
+                statFastPathHits->addData(0); // A hit that could have taken the fast path but was buffered
             it = eventBuffer_.erase(it);
             //printf("DBG: %s, erased <%" PRIu64 ", %d>, it=%d, size=%zu\n", getName().c_str(), id.first, id.second, it == eventBuffer_.end(), eventBuffer_.size());
         } else {
@@ -184,12 +204,16 @@ bool Cache::clockTick(Cycle_t time) {
         } else {
             statPrefetchDrop->addData(1);
             coherenceMgr_->removeRequestRecord(prefetchBuffer_.front()->getID());
+            prefetchThrottle_.drop(prefetchBuffer_.front()->getID());
 	    MemEventBase* ev = prefetchBuffer_.front();
 	    prefetchBuffer_.pop();
 	    delete ev;
         }
     }
 
+    // Fast path requests that arrive before the next tick share this cycle's request limit
+    requestsThisCycle_ = accepted;
+
     // Push any events that need to be retried next cycle onto the retry buffer
     std::vector<MemEventBase*>* rBuf = coherenceMgr_->getRetryBuffer();
     std::copy( rBuf->begin(), rBuf->end(), std::back_inserter(retryBuffer_) );
@@ -216,6 +240,12 @@ void Cache::turnClockOn() {
     statMSHROccupancy->addDataNTimes(cyclesOff, mshr_->getSize());
     //dbg_->debug(_L3_, "%s turning clock ON at cycle %" PRIu64 ", timestamp %" PRIu64 ", ns %" PRIu64 "\n", this->getName().c_str(), getCurrentSimCycle(), timestamp_, getCurrentSimTimeNano());
     clockIsOn_ = true;
+
+    // Nothing was accessed while the clock was off; clear arbitration state so the fast path does not see stale accesses
+    requestsThisCycle_ = 0;
+    for (unsigned int bank = 0; bank < bankStatus_.size(); bank++)
+        bankStatus_[bank] = false;
+    addrsThisCycle_.clear();
 }
 
 void Cache::turnClockOff() {
@@ -265,6 +295,8 @@ bool Cache::processEvent(MemEventBase* ev, bool retry) {
         return false;
     }
 
+    coherenceMgr_->setInstructionPointer(event->getInstructionPointer());
+
     bool dbgevent = mem_h_is_debug_event(event);
     bool accepted = false;
 
@@ -373,6 +405,91 @@ bool Cache::processEvent(MemEventBase* ev, bool retry) {
     return accepted;
 }
 
+/* Whether an event is a cacheable request that may use the fast path */
+bool Cache::isFastPathRequest(MemEventBase* ev) {
+    Command cmd = ev->getCmd();
+    if (cmd != Command::GetS && cmd != Command::GetX && cmd != Command::GetSX && cmd != Command::Write)
+        return false;
+    return !allNoncacheableRequests_ && !ev->queryFlag(MemEventBase::F_NONCACHEABLE);
+}
+
+/*
+ * Functional warmup
+ * Until warmup_end, cacheable requests from above are handled by the coherence manager's
+ * handleWarmup(). Warmup copies (F_WARMUP) from warmed caches above are handled the same way
+ * whether or not this cache has warmup_end set. Warm lines are clean and carry no data; memory's
+ * backing store holds the data (see FunctionalMemory). Any other event ends warmup, since timed
+ * handling needs the data in the lines. At the end of warmup, caches that keep their warm state
+ * (by default, only the last coherence level) fill their lines from memory; the others
+ * invalidate them so upper levels never hold lines that a lower level has silently dropped.
+ *
+ *   Returns: whether the event was handled (and consumed)
+ */
+bool Cache::processWarmup(MemEventBase* ev) {
+    bool copy = ev->queryFlag(MemEventBase::F_WARMUP);
+    bool request = isFastPathRequest(ev);
+
+    if (warmup_ && getCurrentSimTimeNano() >= warmupEndNs_)
+        endWarmup();
+
+    if (!copy && !(warmup_ && request)) {
+        if (warmState_ && !warmupDone_)
+            endWarmup();
+        return false;
+    }
+
+    if (warmupDone_) { // Copy sent before the cache above left warmup
+        delete ev;
+        return true;
+    }
+
+    warmState_ = true;
+    bool hit = coherenceMgr_->handleWarmup(static_cast<MemEvent*>(ev));
+    if (request)
+        (hit ? statWarmupHits : statWarmupMisses)->addData(1);
+    return true;
+}
+
+void Cache::endWarmup() {
+    warmup_ = false;
+    warmupDone_ = true;
+    bool keep = (warmupKeepState_ < 0) ? coherenceMgr_->isLastLevel() : (warmupKeepState_ == 1);
+    if (warmState_)
+        coherenceMgr_->endWarmState(keep);
+}
+
+/*
+ * Fast path for requests that arrive while no other events are buffered
+ * An uncontended request (no MSHR entry for the line, bank free, request limit not reached)
+ * is handled on arrival, in the cycle that precedes the next clock tick, rather than being
+ * buffered until that tick. Hits return one cycle sooner and skip the event buffer entirely.
+ *
+ *   Returns: whether the event was accepted; if not, it should be buffered as usual
+ */
+bool Cache::processFastPath(MemEventBase* ev) {
+    if (!isFastPathRequest(ev) || requestsThisCycle_ == maxRequestsPerCycle_)
+        return false;
+
+    Addr addr = static_cast<MemEvent*>(ev)->getBaseAddr();
+    if (mshr_->exists(addr))
+        return false;
+
+    if (mem_h_is_debug_event(ev)) {
+        dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Fast    (%s)\n",
+                getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getVerboseString().c_str());
+        fflush(stdout);
+    }
+
+    if (!processEvent(ev, false))
+        return false;
+
+    requestsThisCycle_++;
+    statRecvEvents->addData(1);
+    if (!mshr_->exists(addr))
+        statFastPathHits->addData(1); // Misses allocate an MSHR entry
+    return true;
+}
+
 /* Arbitrate for access. Return whether successful */
 bool Cache::arbitrateAccess(Addr addr) {
     if (!banked_) {
@@ -688,7 +805,10 @@ void Cache::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(timeoutSelfLink_);
     SST_SER(mshr_);
     SST_SER(coherenceMgr_);
+    SST_SER(prefetchThrottle_);
     SST_SER(init_requests_);
+    if (ser.mode() == SST::Core::Serialization::serializer::UNPACK)
+        cacheid_ = EndpointTable::intern(getName());
     SST_SER(prefetchDelay_);
     SST_SER(lineSize_);
     SST_SER(allNoncacheableRequests_);
@@ -697,6 +817,12 @@ void Cache::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(timeout_);
     SST_SER(maxOutstandingPrefetch_);
     SST_SER(banked_);
+    SST_SER(fastPath_);
+    SST_SER(warmup_);
+    SST_SER(warmupEndNs_);
+    SST_SER(warmupKeepState_);
+    SST_SER(warmState_);
+    SST_SER(warmupDone_);
 
     SST_SER(clockHandler_);
     SST_SER(defaultTimeBase_);
@@ -724,10 +850,15 @@ void Cache::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(statPrefetchRequest);
     SST_SER(statRecvEvents);
     SST_SER(statRetryEvents);
+    SST_SER(statFastPathHits);
+    SST_SER(statWarmupHits);
+    SST_SER(statWarmupMisses);
     SST_SER(statUncacheRecv);
     SST_SER(statCacheRecv);
 
     if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
         coherenceMgr_->registerClockEnableFunction(std::bind(&Cache::turnClockOn, this));
+        if (prefetchThrottle_.enabled())
+            coherenceMgr_->setPrefetchThrottle(&prefetchThrottle_);
     }
 }
@@ -34,6 +34,7 @@
 #include "sst/elements/memHierarchy/coherencemgr/coherenceController.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
+#include "sst/elements/memHierarchy/prefetchThrottle.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
 
 namespace SST { namespace MemHierarchy {
@@ -75,9 +76,24 @@ public:
             {"prefetch_delay_cycles",   "(uint) Delay prefetches from prefetcher by this number of cycles.", "1"},
             {"max_outstanding_prefetch","(uint) Maximum number of prefetch misses that can be outstanding, additional prefetches will be dropped/NACKed. Default is 1/2 of MSHR entries.", "0.5*mshr_num_entries"},
             {"drop_prefetch_mshr_level","(uint) Drop/NACK prefetches if the number of in-use mshrs is greater than or equal to this number. Default is mshr_num_entries - 2.", "mshr_num_entries-2"},
+            {"prefetch_throttle",       "(bool) Adjust each prefetcher's degree every epoch based on its accuracy, lateness, and cache pollution. Prefetchers scale how much they issue with the degree and the cache accepts at most 'degree' prefetches per cycle from each. Options: 0[off], 1[on]", "false"},
+            {"prefetch_throttle_max_degree", "(uint) Prefetch throttling: highest degree a prefetcher can be raised to. Prefetchers start at half this.", "4"},
+            {"prefetch_throttle_epoch", "(uint) Prefetch throttling: number of evictions per epoch. Default is half the number of lines in the cache.", "lines/2"},
+            {"prefetch_throttle_accuracy_high", "(float) Prefetch throttling: accuracy at or above this is high", "0.75"},
+            {"prefetch_throttle_accuracy_low", "(float) Prefetch throttling: accuracy below this is low", "0.40"},
+            {"prefetch_throttle_lateness", "(float) Prefetch throttling: prefetches are late if the fraction of useful prefetches that were still in flight exceeds this", "0.01"},
+            {"prefetch_throttle_pollution", "(float) Prefetch throttling: prefetches pollute the cache if the fraction of demand misses caused by prefetch evictions exceeds this", "0.005"},
+            {"prefetch_throttle_filter_bits", "(uint) Prefetch throttling: size of the bloom filter that records lines evicted by prefetches. Default is the number of lines in the cache.", "lines"},
+            {"compression",             "(string) Compress lines by content so sets can hold more than 'associativity' lines. Not valid for L1s. Requires a backing store for meaningful data. Options: none, bdi, fpc", "none"},
+            {"compression_tag_factor",  "(uint) Compression: tags per set as a multiple of associativity. Bounds how many compressed lines a set can hold.", "2"},
+            {"decompression_latency_cycles", "(uint) Compression: cycles added to hits on a compressed line. Default is 1 for bdi and 5 for fpc.", ""},
+            {"sector_size",             "(uint) Sectored lines: track valid/dirty state per sector of this many bytes so that misses and writebacks move only the sectors needed. Must be a power of two dividing cache_line_size into at most 64 sectors. Supported by non-L1 inclusive and non-coherent caches. 0 disables.", "0"},
+            {"warmup_end",              "(string) Functional warmup: until this simulated time (with units, e.g. '2ms'), requests from above update tags and replacement state only and are answered immediately. Misses and evictions are passed down as warmup copies. Data is read from and written to memory's backing store directly, so memory must have a backing store and be on the same rank; warm lines are clean. Set the same value on every cache above a warmed cache. '0s' disables warmup.", "0s"},
+            {"warmup_keep_state",       "(string) Functional warmup: whether lines installed during warmup are kept, and filled from memory, when the cache switches to timed simulation. Lines whose memory is not reachable are dropped. Options: auto (keep only in the last coherence level), true, false", "auto"},
             {"num_cache_slices",        "(uint) For a distributed, shared cache, total number of cache slices", "1"},
             {"slice_id",                "(uint) For distributed, shared caches, unique ID for this cache slice", "0"},
-            {"slice_allocation_policy", "(string) Policy for allocating addresses among distributed shared cache. Options: rr[round-robin]", "rr"},
+            {"slice_allocation_policy", "(string) Policy for allocating addresses among distributed shared cache. Options: rr[round-robin], xor[XOR slice hash of the interleaved chunks; all slices must use it]", "rr"},
+            {"slice_hash_bits",         "(uint) For slice_allocation_policy=xor, number of address bits above the interleave step folded into the slice hash", "32"},
             {"maxRequestDelay",         "(uint) Set an error timeout if memory requests take longer than this in ns (0: disable)", "0"},
             {"snoop_l1_invalidations",  "(bool) Forward invalidations from L1s to processors. Options: 0[off], 1[on]", "false"},
             {"llsc_block_cycles",       "(uint64_t) Number of cycles to prevent competing access to an LL/LR line. Encourages forward progress", "0"},
@@ -88,6 +104,7 @@ public:
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
             {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
+            {"fast_path",               "(bool) Handle uncontended requests (no MSHR entry for the line, bank free, nothing buffered) on arrival instead of on the next clock tick. Hits return one cycle sooner. Options: 0[off], 1[on]", "false"},
             {"node",			        "(uint) Node number in multinode environment", "0"})
 
     SST_ELI_DOCUMENT_PORTS(
@@ -123,7 +140,14 @@ public:
             {"MSHR_occupancy",          "Number of events in MSHR each cycle", "events", 1},
             {"Bank_conflicts",          "Total number of bank conflicts detected", "count", 1},
             {"Prefetch_requests",       "Number of prefetches received from prefetcher at this cache", "events", 1},
-            {"Prefetch_drops",          "Number of prefetches that were cancelled. Reasons: too many prefetches outstanding, cache can't handle prefetch this cycle, currently handling another event for the address.", "events", 1},
+            {"FastPath_hits",           "Records 1 for each hit handled by the fast path and 0 for each hit that was eligible but buffered. The mean is the fraction of hits handled by the fast path. Requires 'fast_path'.", "events", 1},
+            {"Prefetch_drops",          "Number of prefetches that were cancelled. Reasons: too many prefetches outstanding, cache can't handle prefetch this cycle, currently handling another event for the address, prefetcher exceeded its throttled degree.", "events", 1},
+            {"Warmup_hits",             "Functional warmup: requests (including warmup copies from above) that found their line", "events", 1},
+            {"Warmup_misses",           "Functional warmup: requests (including warmup copies from above) that missed", "events", 1},
+            {"Prefetch_throttle_degree",    "Prefetch throttling: degree of each prefetcher at the end of each epoch. Sub-ID is the prefetcher's slot number.", "count", 2},
+            {"Prefetch_throttle_accuracy",  "Prefetch throttling: smoothed accuracy (percent) of each prefetcher at the end of each epoch. Sub-ID is the prefetcher's slot number.", "percent", 2},
+            {"Prefetch_throttle_lateness",  "Prefetch throttling: smoothed lateness (percent) of each prefetcher at the end of each epoch. Sub-ID is the prefetcher's slot number.", "percent", 2},
+            {"Prefetch_throttle_pollution", "Prefetch throttling: smoothed cache pollution (percent) at the end of each epoch. Sub-ID is the prefetcher's slot number.", "percent", 2},
             /*Event receives */
             {"GetS_recv",               "Event received: GetS", "count", 2},
             {"GetX_recv",               "Event received: GetX", "count", 2},
@@ -177,6 +201,7 @@ public:
             {"listener", "Cache listener(s) for statistics, tracing, etc. In contrast to prefetcher, cannot send events to cache", "SST::MemHierarchy::CacheListener"},
             {"replacement", "Replacement policies. Slot 0 is for cache. In caches that include a directory, use slot 1 to specify the directory's replacement policy. ", "SST::MemHierarchy::ReplacementPolicy"},
             {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"},
+            {"compressor", "Line compressor for non-L1 caches. Overrides the 'compression' parameter", "SST::MemHierarchy::LineCompressor"},
             {"coherence", "Coherence protocol. The cache will fill this slot automatically based on cache parameters. Do not use this slot directly.", "SST::MemHierarchy::CoherenceController"})
 
 /* Class definition */
@@ -239,7 +264,7 @@ private:
     void handleEvent(SST::Event *event);
 
     // Handle incoming prefetching events -> prepare to process
-    void handlePrefetchEvent(SST::Event *event);
+    void handlePrefetchEvent(SST::Event *event, unsigned int prefetcher);
 
     // Process events
     bool processEvent(MemEventBase * ev, bool inMSHR);
@@ -261,6 +286,14 @@ private:
     void timeoutWakeup(SST::Event * ev);
     void checkTimeout();
 
+    // Fast path - handle uncontended requests on arrival
+    bool isFastPathRequest(MemEventBase* ev);
+    bool processFastPath(MemEventBase* ev);
+
+    // Functional warmup - handle requests and warmup copies on arrival, untimed
+    bool processWarmup(MemEventBase* ev);
+    void endWarmup();
+
     // Arbitrate for bank and/or line access
     bool arbitrateAccess(Addr addr);
     void updateAccessStatus(Addr addr);
@@ -277,7 +310,9 @@ private:
     Link* timeoutSelfLink_ = nullptr;       // link to check for timeouts (possible deadlock)
     MSHR* mshr_;                            // MSHR
     CoherenceController* coherenceMgr_;     // Coherence protocol - where most of the event handling happens
+    PrefetchThrottle prefetchThrottle_;     // Feedback-directed prefetch throttling, if enabled
     std::map<MemEventBase::id_type, std::string> init_requests_;    // Event response routing for untimed/init events
+    EndpointID cacheid_;                    // Interned getName(), not serialized (process-local)
 
     /** Latencies **************************************************************/
     SimTime_t   prefetchDelay_;
@@ -290,6 +325,14 @@ private:
     SimTime_t           timeout_;
     uint64_t            maxOutstandingPrefetch_;
     bool                banked_;
+    bool                fastPath_;
+
+    /** Functional warmup ******************************************************/
+    bool                warmup_;            // Handle requests from above functionally until warmupEndNs_
+    uint64_t            warmupEndNs_;
+    int                 warmupKeepState_;   // Keep warm lines at the end of warmup: -1 if last coherence level, otherwise 0/1
+    bool                warmState_;         // Lines have been installed by warmup
+    bool                warmupDone_;        // Warmup has ended, late warmup copies are dropped
 
     /** Clocks *****************************************************************/
     Clock::HandlerBase*     clockHandler_;
@@ -326,6 +369,9 @@ private:
     // Event counts
     Statistic<uint64_t>* statRecvEvents;
     Statistic<uint64_t>* statRetryEvents;
+    Statistic<uint64_t>* statFastPathHits;
+    Statistic<uint64_t>* statWarmupHits;
+    Statistic<uint64_t>* statWarmupMisses;
     Statistic<uint64_t>* statUncacheRecv[(int)Command::LAST_CMD];
     Statistic<uint64_t>* statCacheRecv[(int)Command::LAST_CMD];
 };
@@ -45,6 +45,8 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
 
     bool found;
 
+    cacheid_ = EndpointTable::intern(getName());
+
     /* Warn about deprecated parameters */
     checkDeprecatedParams(params);
 
@@ -65,8 +67,21 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
 
     allNoncacheableRequests_    = params.find<bool>("force_noncacheable_reqs", false);
     maxRequestsPerCycle_        = params.find<int>("max_requests_per_cycle",-1);
+    fastPath_                   = params.find<bool>("fast_path", false);
     string packetSize           = params.find<std::string>("min_packet_size", "8B");
 
+    UnitAlgebra warmupEnd = params.find<UnitAlgebra>("warmup_end", UnitAlgebra("0s"));
+    if (!warmupEnd.hasUnits("s"))
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param: warmup_end - must have units of seconds (s). SI units are ok. You specified '%s'\n", getName().c_str(), warmupEnd.toString().c_str());
+    warmupEnd *= UnitAlgebra("1GHz");
+    warmupEndNs_ = warmupEnd.getRoundedValue();
+    warmup_ = (warmupEndNs_ > 0);
+    std::string keepState = params.find<std::string>("warmup_keep_state", "auto");
+    to_lower(keepState);
+    warmupKeepState_ = (keepState == "auto") ? -1 : (params.find<bool>("warmup_keep_state", false) ? 1 : 0);
+    warmState_ = false;
+    warmupDone_ = false;
+
     try {
         UnitAlgebra packetSize_ua(packetSize);
 
@@ -125,6 +140,19 @@ void Cache::createCoherenceManager(Params &params) {
         out_->fatal(CALL_INFO, -1, "%s, Invalid param: cache_type - valid options are 'inclusive' or 'noninclusive' or 'noninclusive_with_directory'. You specified '%s'.\n", getName().c_str(), itype.c_str());
 
 
+    std::string compression = params.find<std::string>("compression", "none");
+    to_lower(compression);
+    if (L1 && compression != "none")
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param: compression - not supported for L1s. You specified '%s'.\n", getName().c_str(), compression.c_str());
+
+    uint64_t sectorSize = params.find<uint64_t>("sector_size", 0);
+    if (sectorSize != 0 && sectorSize != lineSize_) {
+        if (L1 || (protocol != CoherenceProtocol::NONE && itype != "inclusive"))
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param: sector_size - sectored lines are only supported by non-L1 caches that are inclusive or non-coherent.\n", getName().c_str());
+        if (compression != "none")
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: sector_size and compression - sectored lines cannot be compressed.\n", getName().c_str());
+    }
+
     if (L1 && itype != "inclusive") {
         out_->fatal(CALL_INFO, -1, "%s, Invalid param: cache_type - must be 'inclusive' for an L1. You specified '%s'.\n", getName().c_str(), itype.c_str());
     } else if (!L1 && protocol == CoherenceProtocol::NONE && itype != "noninclusive") {
@@ -163,6 +191,11 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceParams.insert("dassoc", params.find<std::string>("noninclusive_directory_associativity", "0"));
     coherenceParams.insert("drpolicy", params.find<std::string>("noninclusive_directory_repl", "lru"));
     coherenceParams.insert("cache_frequency", params.find<std::string>("cache_frequency", "")); // Not used by all managers, already error checked
+    coherenceParams.insert("compression", params.find<std::string>("compression", "none")); // Not used by L1s
+    coherenceParams.insert("compression_tag_factor", params.find<std::string>("compression_tag_factor", "2"));
+    if (params.contains("decompression_latency_cycles"))
+        coherenceParams.insert("decompression_latency_cycles", params.find<std::string>("decompression_latency_cycles"));
+    coherenceParams.insert("sector_size", params.find<std::string>("sector_size", "0")); // Not used by all managers
     bool prefetch = (statPrefetchRequest != nullptr);
 
     if (!L1) {
@@ -211,6 +244,8 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceMgr_->setLinks(linkUp_, linkDown_);
     coherenceMgr_->setMSHR(mshr_);
     coherenceMgr_->setCacheListener(listeners_, dropPrefetchLevel, maxOutstandingPrefetch);
+    if (prefetchThrottle_.enabled())
+        coherenceMgr_->setPrefetchThrottle(&prefetchThrottle_);
     coherenceMgr_->setDebug(debug_addr_filter_);
     coherenceMgr_->setSliceAware(region_.interleaveSize, region_.interleaveStep);
     coherenceMgr_->registerClockEnableFunction(std::bind(&Cache::turnClockOn, this));
@@ -271,15 +306,19 @@ void Cache::configureLinks(Params &params, TimeConverter* tc) {
         uint64_t sliceCount         = params.find<uint64_t>("num_cache_slices", 1);
         uint64_t sliceID            = params.find<uint64_t>("slice_id", 0);
         std::string slicePolicy     = params.find<std::string>("slice_allocation_policy", "rr");
+        uint32_t sliceHashBits      = params.find<uint32_t>("slice_hash_bits", 32);
+        if (slicePolicy != "rr" && slicePolicy != "xor")
+            out_->fatal(CALL_INFO,-1, "%s, Invalid param: slice_allocation_policy - supported policies are 'rr' (round-robin) and 'xor' (XOR slice hash). You specified '%s'.\n",
+                    getName().c_str(), slicePolicy.c_str());
+        if (slicePolicy == "xor" && (sliceHashBits == 0 || sliceHashBits > 64))
+            out_->fatal(CALL_INFO,-1, "%s, Invalid param: slice_hash_bits - must be between 1 and 64. You specified %" PRIu32 ".\n",
+                    getName().c_str(), sliceHashBits);
         if (sliceCount == 1)
             sliceID = 0;
         else if (sliceCount > 1) {
             if (sliceID >= sliceCount)
                 out_->fatal(CALL_INFO,-1, "%s, Invalid param: slice_id - should be between 0 and num_cache_slices-1. You specified %" PRIu64 ".\n",
                         getName().c_str(), sliceID);
-            if (slicePolicy != "rr")
-                out_->fatal(CALL_INFO,-1, "%s, Invalid param: slice_allocation_policy - supported policy is 'rr' (round-robin). You specified '%s'.\n",
-                        getName().c_str(), slicePolicy.c_str());
         } else {
             out_->fatal(CALL_INFO, -1, "%s, Invalid param: num_cache_slices - should be 1 or greater. You specified %" PRIu64 ".\n",
                     getName().c_str(), sliceCount);
@@ -321,7 +360,7 @@ void Cache::configureLinks(Params &params, TimeConverter* tc) {
 
         if (!gotRegion && sliceCount > 1) {
             gotRegion = true;
-            if (slicePolicy == "rr") {
+            if (slicePolicy == "rr" || slicePolicy == "xor") { // xor hashes the same interleaving, see below
                 region_.start = sliceID*lineSize_;
                 region_.end = region_.REGION_MAX;
                 region_.interleaveSize = lineSize_;
@@ -350,6 +389,12 @@ void Cache::configureLinks(Params &params, TimeConverter* tc) {
             linkUp_->setRegion(region_);
         }
 
+        // Slice hashing assigns the interleaved chunks by hash; peers on the network learn this from the links
+        if (slicePolicy == "xor") {
+            linkDown_->setSliceHash(sliceHashBits);
+            linkUp_->setSliceHash(sliceHashBits);
+        }
+
         clockUpLink_ = linkUp_->isClocked();
         clockDownLink_ = linkDown_->isClocked();
 
@@ -648,7 +693,7 @@ void Cache::createListeners(Params &params) {
         for (int i = 0; i <= lists->getMaxPopulatedSlotNumber(); i++) {
             if (lists->isPopulated(i)) {
                 listeners_.push_back(lists->create<CacheListener>(i, ComponentInfo::SHARE_NONE));
-                listeners_[k]->registerResponseCallback(new Event::Handler2<Cache, &Cache::handlePrefetchEvent>(this));
+                listeners_[k]->registerResponseCallback(new Event::Handler2<Cache, &Cache::handlePrefetchEvent, unsigned int>(this, k));
                 k++;
             }
         }
@@ -658,12 +703,25 @@ void Cache::createListeners(Params &params) {
         if (!prefetcher.empty()) {
             prefParams = params.get_scoped_params("prefetcher");
             listeners_.push_back(loadAnonymousSubComponent<CacheListener>(prefetcher, "prefetcher", 0, ComponentInfo::INSERT_STATS, prefParams));
-            listeners_[0]->registerResponseCallback(new Event::Handler2<Cache, &Cache::handlePrefetchEvent>(this));
+            listeners_[0]->registerResponseCallback(new Event::Handler2<Cache, &Cache::handlePrefetchEvent, unsigned int>(this, 0));
         }
     }
     if (!listeners_.empty()) {
         statPrefetchRequest = registerStatistic<uint64_t>("Prefetch_requests");
         statPrefetchDrop = registerStatistic<uint64_t>("Prefetch_drops");
+
+        // Only prefetchers have been loaded so far
+        prefetchThrottle_.configure(out_, getName(), params, params.find<uint64_t>("lines", 0), lineSize_);
+        if (prefetchThrottle_.enabled()) {
+            for (unsigned int i = 0; i < listeners_.size(); i++) {
+                std::string id = std::to_string(i);
+                prefetchThrottle_.addPrefetcher(listeners_[i],
+                        registerStatistic<uint64_t>("Prefetch_throttle_degree", id),
+                        registerStatistic<uint64_t>("Prefetch_throttle_accuracy", id),
+                        registerStatistic<uint64_t>("Prefetch_throttle_lateness", id),
+                        registerStatistic<uint64_t>("Prefetch_throttle_pollution", id));
+            }
+        }
     } else {
         statPrefetchRequest = nullptr;
         statPrefetchDrop = nullptr;
@@ -835,6 +893,9 @@ void Cache::registerStatistics() {
 
     statRecvEvents  = registerStatistic<uint64_t>("TotalEventsReceived");
     statRetryEvents = registerStatistic<uint64_t>("TotalEventsReplayed");
+    statFastPathHits = registerStatistic<uint64_t>("FastPath_hits");
+    statWarmupHits = registerStatistic<uint64_t>("Warmup_hits");
+    statWarmupMisses = registerStatistic<uint64_t>("Warmup_misses");
 
     statUncacheRecv[(int)Command::Put]      = registerStatistic<uint64_t>("Put_uncache_recv");
     statUncacheRecv[(int)Command::Get]      = registerStatistic<uint64_t>("Get_uncache_recv");
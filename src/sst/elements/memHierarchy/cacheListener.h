@@ -58,6 +58,11 @@ public:
     NotifyResultType getResultType() const { return result; }
     uint32_t getSize() const { return size; }
 
+    /** Contents of the accessed line, or nullptr if not available. Only valid during notifyAccess().
+        Provided on L1 read hits so that listeners can observe loaded values (e.g., indirect prefetchers). */
+    const std::vector<uint8_t>* getData() const { return data; }
+    void setData(const std::vector<uint8_t>* lineData) { data = lineData; }
+
     CacheListenerNotification() = default; // For serialization
 
     void serialize_order(SST::Core::Serialization::serializer& ser) {
@@ -78,6 +83,7 @@ private:
     Addr instPtr;
     NotifyAccessType access;
     NotifyResultType result;
+    const std::vector<uint8_t>* data = nullptr; // Not serialized
 };
 
 class CacheListener : public SubComponent {
@@ -101,6 +107,10 @@ public:
     virtual void printStats(Output& out) {}
     virtual void notifyAccess(const CacheListenerNotification& notify) {}
     virtual void registerResponseCallback(Event::HandlerBase *handler) { delete handler; }
+    /** Prefetch throttling: the degree (1 = least aggressive) the cache wants this listener to run at.
+     *  Prefetchers scale how much they issue per trigger (or how far ahead) with it. The cache also drops
+     *  prefetches beyond 'degree' per cycle, which is all the throttling a listener that ignores this gets */
+    virtual void setPrefetchDegree(unsigned int degree) {}
 
     void serialize_order(SST::Core::Serialization::serializer& ser) override {
         SST::SubComponent::serialize_order(ser);
@@ -41,12 +41,21 @@ Incoherent::Incoherent(SST::ComponentId_t id, Params& params, Params& owner_para
     // Cache Array
     uint64_t lines = params.find<uint64_t>("lines");
     uint64_t assoc = params.find<uint64_t>("associativity");
-    ReplacementPolicy * rmgr = createReplacementPolicy(lines, assoc, params, true);
+    unsigned int tag_factor = createCompressor(params); // Compressed arrays have extra tags per set
+    ReplacementPolicy * rmgr = createReplacementPolicy(lines * tag_factor, assoc * tag_factor, params, true);
     HashFunction * ht = createHashFunction(params);
 
-    cache_array_ = new CacheArray<PrivateCacheLine>(debug_, lines, assoc, line_size_, rmgr, ht);
+    cache_array_ = new CacheArray<PrivateCacheLine>(debug_, lines * tag_factor, assoc * tag_factor, line_size_, rmgr, ht);
+    if (compressor_)
+        cache_array_->setCompression(compressor_, assoc);
     cache_array_->setBanked(params.find<uint64_t>("banks", 0));
 
+    sector_size_ = getSectorSize(params);
+    if (sector_size_) {
+        cache_array_->setSectored(sector_size_);
+        sector_line_mask_ = ~(line_size_ - 1);
+    }
+
     stat_event_state_[(int)Command::GetS][I] = registerStatistic<uint64_t>("stateEvent_GetS_I");
     stat_event_state_[(int)Command::GetS][E] = registerStatistic<uint64_t>("stateEvent_GetS_E");
     stat_event_state_[(int)Command::GetS][M] = registerStatistic<uint64_t>("stateEvent_GetS_M");
@@ -144,6 +153,12 @@ Incoherent::Incoherent(SST::ComponentId_t id, Params& params, Params& owner_para
         stat_prefetch_hit_ = registerStatistic<uint64_t>("prefetch_useful");
         stat_prefetch_redundant_ = registerStatistic<uint64_t>("prefetch_redundant");
     }
+
+    if (sector_size_) {
+        stat_sector_miss_ = registerStatistic<uint64_t>("SectorMisses");
+        stat_sectors_fetched_ = registerStatistic<uint64_t>("SectorsFetched");
+        stat_sectors_writeback_ = registerStatistic<uint64_t>("SectorsWrittenBack");
+    }
 }
 
 
@@ -153,9 +168,9 @@ Incoherent::Incoherent(SST::ComponentId_t id, Params& params, Params& owner_para
  ***********************************************************************************************************/
 
 bool Incoherent::handleGetS(MemEvent * event, bool in_mshr) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
     PrivateCacheLine * line = cache_array_->lookup(addr, true);
-    bool local_prefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool local_prefetch = event->isPrefetch() && (event->getRqstrID() == cacheid_);
     State state = line ? line->getState() : I;
     uint64_t send_time = 0;
     MemEventStatus status = MemEventStatus::OK;
@@ -163,7 +178,10 @@ bool Incoherent::handleGetS(MemEvent * event, bool in_mshr) {
     if (mem_h_is_debug_event(event))
         event_debuginfo_.prefill(event->getID(), Command::GetS, (local_prefetch ? "-pref" : ""), addr, state);
 
-    switch (state) {
+    /* A demand request for sectors that are not present misses like a request for an absent line */
+    bool sector_miss = !local_prefetch && isSectorMiss(event, line);
+
+    switch (sector_miss ? I : state) {
         case I:
             if (local_prefetch)
                 status = processCacheMiss(event, line, in_mshr);
@@ -176,6 +194,8 @@ bool Incoherent::handleGetS(MemEvent * event, bool in_mshr) {
                     mshr_->setProfiled(addr);
                     stat_misses_->addData(1);
                     stat_miss_[0][(int)in_mshr]->addData(1);
+                    if (sector_miss)
+                        stat_sector_miss_->addData(1);
                 }
                 recordLatencyType(event->getID(), LatType::MISS);
                 send_time = forwardMessage(event, event->getSize(), 0, nullptr);
@@ -204,7 +224,7 @@ bool Incoherent::handleGetS(MemEvent * event, bool in_mshr) {
             recordPrefetchResult(line, stat_prefetch_hit_);
             recordLatencyType(event->getID(), LatType::HIT);
 
-            send_time = sendResponseUp(event, line->getData(), in_mshr, line->getTimestamp());
+            send_time = sendResponseUp(event, getRequestData(event, line), in_mshr, line->getTimestamp());
             line->setTimestamp(send_time);
             if (mem_h_is_debug_event(event))
                 event_debuginfo_.reason = "hit";
@@ -233,7 +253,7 @@ bool Incoherent::handleGetS(MemEvent * event, bool in_mshr) {
 
 
 bool Incoherent::handleGetX(MemEvent * event, bool in_mshr) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
     PrivateCacheLine * line = cache_array_->lookup(addr, true);
     State state = line ? line->getState() : I;
     uint64_t send_time = 0;
@@ -242,7 +262,9 @@ bool Incoherent::handleGetX(MemEvent * event, bool in_mshr) {
     if (mem_h_is_debug_event(event))
         event_debuginfo_.prefill(event->getID(), event->getCmd(), "", addr, state);
 
-    switch (state) {
+    bool sector_miss = isSectorMiss(event, line);
+
+    switch (sector_miss ? I : state) {
         case I:
             status = in_mshr ? MemEventStatus::OK : allocateMSHR(event, false);
             if (status == MemEventStatus::OK) {
@@ -255,6 +277,8 @@ bool Incoherent::handleGetX(MemEvent * event, bool in_mshr) {
                     else
                         stat_miss_[2][(int)in_mshr]->addData(1);
                     stat_misses_->addData(1);
+                    if (sector_miss)
+                        stat_sector_miss_->addData(1);
                 }
                 recordLatencyType(event->getID(), LatType::MISS);
                 forwardMessage(event, event->getSize(), 0, nullptr);
@@ -275,7 +299,7 @@ bool Incoherent::handleGetX(MemEvent * event, bool in_mshr) {
                 stat_hits_->addData(1);
             }
             recordPrefetchResult(line, stat_prefetch_hit_);
-            send_time = sendResponseUp(event, line->getData(), in_mshr, line->getTimestamp());
+            send_time = sendResponseUp(event, getRequestData(event, line), in_mshr, line->getTimestamp());
             line->setTimestamp(send_time);
             recordLatencyType(event->getID(), LatType::HIT);
 
@@ -309,7 +333,7 @@ bool Incoherent::handleGetSX(MemEvent * event, bool in_mshr) {
 
 
 bool Incoherent::handleFlushLine(MemEvent * event, bool in_mshr) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
     PrivateCacheLine * line = cache_array_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
@@ -327,7 +351,7 @@ bool Incoherent::handleFlushLine(MemEvent * event, bool in_mshr) {
         state = line->getState();
     }
 
-    switch (state) {
+    switch (isSectorMiss(event, line) ? I : state) {
         case I:
             if (status == MemEventStatus::OK) {
                 forwardFlush(event, event->getEvict(), &(event->getPayload()), event->getDirty(), 0);
@@ -337,7 +361,14 @@ bool Incoherent::handleFlushLine(MemEvent * event, bool in_mshr) {
         case E:
         case M:
             if (status == MemEventStatus::OK) {
-                forwardFlush(event, state == M, line->getData(), state == M, 0);
+                if (line->getSectors()->enabled()) {
+                    uint64_t dirty = line->getSectors()->getDirty() & sectorMask(event, line);
+                    forwardFlush(event, dirty, getRequestData(event, line), dirty, 0);
+                    line->getSectors()->clean(dirty);
+                    stat_sectors_writeback_->addData(LineSectors::popcount(dirty));
+                } else {
+                    forwardFlush(event, state == M, line->getData(), state == M, 0);
+                }
                 line->setState(S_B);
                 mshr_->setInProgress(addr);
             }
@@ -359,7 +390,7 @@ bool Incoherent::handleFlushLine(MemEvent * event, bool in_mshr) {
 
 
 bool Incoherent::handleFlushLineInv(MemEvent * event, bool in_mshr) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
     PrivateCacheLine * line = cache_array_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
@@ -377,7 +408,7 @@ bool Incoherent::handleFlushLineInv(MemEvent * event, bool in_mshr) {
         state = line->getState();
     }
 
-    switch (state) {
+    switch (isSectorMiss(event, line) ? I : state) {
         case I:
             if (status == MemEventStatus::OK) {
                 forwardFlush(event, event->getEvict(), &(event->getPayload()), event->getDirty(), 0);
@@ -388,7 +419,15 @@ bool Incoherent::handleFlushLineInv(MemEvent * event, bool in_mshr) {
         case M:
             if (status == MemEventStatus::OK) {
                 recordPrefetchResult(line, stat_prefetch_evict_);
-                forwardFlush(event, true, line->getData(), state == M, line->getTimestamp());
+                if (line->getSectors()->enabled()) {
+                    uint64_t mask = sectorMask(event, line);
+                    uint64_t dirty = line->getSectors()->getDirty() & mask;
+                    forwardFlush(event, true, getRequestData(event, line), dirty, line->getTimestamp());
+                    line->getSectors()->invalidate(mask);
+                    stat_sectors_writeback_->addData(LineSectors::popcount(dirty));
+                } else {
+                    forwardFlush(event, true, line->getData(), state == M, line->getTimestamp());
+                }
                 line->setState(I_B);
                 mshr_->setInProgress(addr);
             }
@@ -411,7 +450,7 @@ bool Incoherent::handleFlushLineInv(MemEvent * event, bool in_mshr) {
 
 
 bool Incoherent::handlePutE(MemEvent * event, bool in_mshr) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
     PrivateCacheLine * line = cache_array_->lookup(addr, true);
     State state = line ? line->getState() : I;
     MemEventStatus status = MemEventStatus::OK;
@@ -423,7 +462,8 @@ bool Incoherent::handlePutE(MemEvent * event, bool in_mshr) {
         case I:
             status = allocateLine(event, line, in_mshr);
             if (status == MemEventStatus::OK) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer().data(), event->getBaseAddr() - addr);
+                line->getSectors()->setValid(sectorMask(event, line));
                 line->setState(E);
                 if (send_writeback_ack_)
                     sendWritebackAck(event);
@@ -432,6 +472,10 @@ bool Incoherent::handlePutE(MemEvent * event, bool in_mshr) {
             break;
         case E:
         case M:
+            if (isSectorMiss(event, line)) {
+                line->setData(event->getPayloadBuffer().data(), event->getBaseAddr() - addr);
+                line->getSectors()->setValid(sectorMask(event, line));
+            }
             if (send_writeback_ack_)
                 sendWritebackAck(event);
             cleanUpAfterRequest(event, in_mshr);
@@ -454,7 +498,7 @@ bool Incoherent::handlePutE(MemEvent * event, bool in_mshr) {
 
 
 bool Incoherent::handlePutM(MemEvent * event, bool in_mshr) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
     PrivateCacheLine * line = cache_array_->lookup(addr, true);
     State state = line ? line->getState() : I;
     MemEventStatus status = MemEventStatus::OK;
@@ -466,7 +510,8 @@ bool Incoherent::handlePutM(MemEvent * event, bool in_mshr) {
         case I:
             status = allocateLine(event, line, in_mshr);
             if (status == MemEventStatus::OK) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer().data(), event->getBaseAddr() - addr);
+                line->getSectors()->setDirty(sectorMask(event, line));
                 line->setState(M);
                 if (send_writeback_ack_)
                     sendWritebackAck(event);
@@ -476,7 +521,8 @@ bool Incoherent::handlePutM(MemEvent * event, bool in_mshr) {
         case E:
             line->setState(M);
         case M:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer().data(), event->getBaseAddr() - addr);
+            line->getSectors()->setDirty(sectorMask(event, line));
             if (send_writeback_ack_)
                 sendWritebackAck(event);
             cleanUpAfterRequest(event, in_mshr);
@@ -499,7 +545,7 @@ bool Incoherent::handlePutM(MemEvent * event, bool in_mshr) {
 
 
 bool Incoherent::handleGetSResp(MemEvent * event, bool in_mshr) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
     PrivateCacheLine * line = cache_array_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
@@ -513,12 +559,16 @@ bool Incoherent::handleGetSResp(MemEvent * event, bool in_mshr) {
 
     sendResponseUp(req, &event->getPayload(), true, 0);
 
-    if (line) {
+    if (line && state == IS) {
         line->setState(E);
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getPayloadBuffer().data(), 0);
+        if (line->getSectors()->enabled())
+            line->getSectors()->setValid(line->getSectors()->all());
         // Has to be a local prefetch
         line->setPrefetch(true);
         recordPrefetchLatency(req->getID(), LatType::MISS);
+    } else if (line) {
+        fillSectors(event, line);
     }
 
     cleanUpAfterResponse(event);
@@ -533,7 +583,7 @@ bool Incoherent::handleGetSResp(MemEvent * event, bool in_mshr) {
 
 
 bool Incoherent::handleGetXResp(MemEvent * event, bool in_mshr) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
     PrivateCacheLine * line = cache_array_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
@@ -547,6 +597,9 @@ bool Incoherent::handleGetXResp(MemEvent * event, bool in_mshr) {
 
     sendResponseUp(req, &event->getPayload(), true, 0);
 
+    if (line)
+        fillSectors(event, line);
+
     cleanUpAfterResponse(event);
 
     return true;
@@ -554,7 +607,7 @@ bool Incoherent::handleGetXResp(MemEvent * event, bool in_mshr) {
 
 
 bool Incoherent::handleFlushLineResp(MemEvent * event, bool in_mshr) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
     PrivateCacheLine * line = cache_array_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
@@ -569,11 +622,15 @@ bool Incoherent::handleFlushLineResp(MemEvent * event, bool in_mshr) {
         case I:
             break;
         case I_B:
-            line->setState(I);
-            cache_array_->deallocate(line);
+            if (line->getSectors()->getValid()) { // Other sectors of a sectored line remain
+                line->setState(line->getSectors()->getDirty() ? M : E);
+            } else {
+                line->setState(I);
+                cache_array_->deallocate(line);
+            }
             break;
         case S_B:
-            line->setState(E);
+            line->setState(line->getSectors()->getDirty() ? M : E);
             break;
         default:
             debug_->fatal(CALL_INFO, -1, "%s, Error: Received FlushLineResp in unhandled state '%s'. Event: %s. Time = %" PRIu64 "ns\n",
@@ -602,7 +659,7 @@ bool Incoherent::handleNULLCMD(MemEvent* event, bool in_mshr) {
     printLine(event->getBaseAddr());
     bool evicted = handleEviction(newAddr, line, event_debuginfo_);
     if (evicted) {
-        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer());
+        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer(), event);
         retry_buffer_.push_back(mshr_->getFrontEvent(newAddr));
         if (mshr_->removeEvictPointer(oldAddr, newAddr))
             retry(oldAddr);
@@ -625,7 +682,7 @@ bool Incoherent::handleNULLCMD(MemEvent* event, bool in_mshr) {
 
 bool Incoherent::handleNACK(MemEvent* event, bool in_mshr) {
     MemEvent* nackedEvent = event->getNACKedEvent();
-    Addr addr = nackedEvent->getBaseAddr();
+    Addr addr = mshrAddr(nackedEvent->getBaseAddr());
     PrivateCacheLine * line = cache_array_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
@@ -646,7 +703,7 @@ bool Incoherent::handleNACK(MemEvent* event, bool in_mshr) {
 
 MemEventStatus Incoherent::processCacheMiss(MemEvent * event, PrivateCacheLine* &line, bool in_mshr) {
     MemEventStatus status = in_mshr ? MemEventStatus::OK : allocateMSHR(event, false);
-    if (in_mshr && mshr_->getFrontEvent(event->getBaseAddr()) != event) {
+    if (in_mshr && mshr_->getFrontEvent(mshrAddr(event->getBaseAddr())) != event) {
         if (mem_h_is_debug_event(event))
             event_debuginfo_.action = "Stall";
         return MemEventStatus::Stall;
@@ -659,9 +716,29 @@ MemEventStatus Incoherent::processCacheMiss(MemEvent * event, PrivateCacheLine*
 }
 
 MemEventStatus Incoherent::allocateLine(MemEvent * event, PrivateCacheLine* &line, bool in_mshr) {
+    Addr addr = mshrAddr(event->getBaseAddr());
     evict_debuginfo_.prefill(event->getID(), Command::Evict, "", 0, I);
 
-    bool evicted = handleEviction(event->getBaseAddr(), line, evict_debuginfo_);
+    // A free candidate fits. Otherwise a compressed set may need more than one line evicted
+    // before the new line fits
+    bool fits = false;
+    if (!line) {
+        line = cache_array_->findReplacementCandidate(addr);
+        fits = !line->isAllocated();
+    }
+    bool evicted = handleEviction(addr, line, evict_debuginfo_);
+    PrivateCacheLine* victim = line; // Last line evicted, reported to listeners
+
+    while (evicted && !fits && cache_array_->isCompressed()) {
+        PrivateCacheLine* next = cache_array_->findReplacementCandidate(addr);
+        if (!next->isAllocated()) {
+            line = next;
+            break;
+        }
+        notifyListenerOfEvict(victim->getAddr(), line_size_, event->getInstructionPointer(), event);
+        line = victim = next;
+        evicted = handleEviction(addr, line, evict_debuginfo_);
+    }
 
     if (mem_h_is_debug_event(event) || mem_h_is_debug_addr(line->getAddr())) {
         evict_debuginfo_.new_state = line->getState();
@@ -671,16 +748,16 @@ MemEventStatus Incoherent::allocateLine(MemEvent * event, PrivateCacheLine* &lin
     }
 
     if (evicted) {
-        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer());
-        cache_array_->replace(event->getBaseAddr(), line);
+        notifyListenerOfEvict(victim->getAddr(), line_size_, event->getInstructionPointer(), event);
+        cache_array_->replace(addr, line);
         if (mem_h_is_debug_event(event))
-            printDebugAlloc(true, event->getBaseAddr(), "");
+            printDebugAlloc(true, addr, "");
         return MemEventStatus::OK;
     } else {
-        if (in_mshr || mshr_->insertEvent(event->getBaseAddr(), event, -1, false, true) != -1) {
-            mshr_->insertEviction(line->getAddr(), event->getBaseAddr());
+        if (in_mshr || mshr_->insertEvent(addr, event, -1, false, true) != -1) {
+            mshr_->insertEviction(line->getAddr(), addr);
             if (in_mshr)
-                mshr_->setStalledForEvict(event->getBaseAddr(), true);
+                mshr_->setStalledForEvict(addr, true);
             if (mem_h_is_debug_event(event)) {
                 event_debuginfo_.action = "Stall";
                 std::stringstream reason;
@@ -718,7 +795,10 @@ bool Incoherent::handleEviction(Addr addr, PrivateCacheLine* &line, dbgin &debug
             return true;
         case E:
             if (!silent_evict_clean_) {
-                sendWriteback(Command::PutE, line, false);
+                if (line->getSectors()->enabled())
+                    sendSectorWritebacks(line, true);
+                else
+                    sendWriteback(Command::PutE, line, false);
                 if (mem_h_is_debug_addr(line->getAddr()))
                     printDebugAlloc(false, line->getAddr(), "Writeback");
             } else if (mem_h_is_debug_addr(line->getAddr()))
@@ -726,7 +806,10 @@ bool Incoherent::handleEviction(Addr addr, PrivateCacheLine* &line, dbgin &debug
             line->setState(I);
             break;
         case M:
-            sendWriteback(Command::PutM, line, true);
+            if (line->getSectors()->enabled())
+                sendSectorWritebacks(line, !silent_evict_clean_);
+            else
+                sendWriteback(Command::PutM, line, true);
             line->setState(I);
             if (mem_h_is_debug_addr(line->getAddr()))
                 printDebugAlloc(false, line->getAddr(), "Writeback");
@@ -746,10 +829,10 @@ bool Incoherent::handleEviction(Addr addr, PrivateCacheLine* &line, dbgin &debug
 
 
 void Incoherent::cleanUpAfterRequest(MemEvent * event, bool in_mshr) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
 
     if (in_mshr) {
-        if (event->isPrefetch() && event->getRqstr() == cachename_) outstanding_prefetch_count_--;
+        if (event->isPrefetch() && event->getRqstrID() == cacheid_) outstanding_prefetch_count_--;
         mshr_->removeFront(addr);
     }
 
@@ -761,7 +844,7 @@ void Incoherent::cleanUpAfterRequest(MemEvent * event, bool in_mshr) {
 
 
 void Incoherent::cleanUpAfterResponse(MemEvent * event) {
-    Addr addr = event->getBaseAddr();
+    Addr addr = mshrAddr(event->getBaseAddr());
 
     /* Clean up MSHR */
     MemEvent * req = nullptr;
@@ -772,7 +855,7 @@ void Incoherent::cleanUpAfterResponse(MemEvent * event) {
     delete event;
 
     if (req) {
-        if (req->isPrefetch() && req->getRqstr() == cachename_) outstanding_prefetch_count_--;
+        if (req->isPrefetch() && req->getRqstrID() == cacheid_) outstanding_prefetch_count_--;
         delete req;
     }
     retry(addr);
@@ -787,7 +870,7 @@ void Incoherent::retry(Addr addr) {
         } else { // Pointer -> another request is waiting to evict this address
             std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
             for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                 retry_buffer_.push_back(ev);
             }
         }
@@ -799,9 +882,14 @@ void Incoherent::doEvict(MemEvent * event, PrivateCacheLine * line) {
     State state = line ? line->getState() : I;
 
     if (state == E || state == M) {
+        uint32_t offset = event->getBaseAddr() - line->getAddr();
         if (event->getDirty()) {
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer().data(), offset);
+            line->getSectors()->setDirty(sectorMask(event, line));
+        } else if (isSectorMiss(event, line)) {
+            line->setData(event->getPayloadBuffer().data(), offset);
+            line->getSectors()->setValid(sectorMask(event, line));
         }
 
         event->setEvict(false);
@@ -837,7 +925,7 @@ SimTime_t Incoherent::sendResponseUp(MemEvent * event, vector<uint8_t> * data, b
 
 
 void Incoherent::sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty) {
-    MemEvent * writeback = new MemEvent(cachename_, line->getAddr(), line->getAddr(), cmd);
+    MemEvent * writeback = new MemEvent(cacheid_, line->getAddr(), line->getAddr(), cmd);
     writeback->setSize(line_size_);
 
     uint64_t latency = tag_latency_;
@@ -849,7 +937,7 @@ void Incoherent::sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty)
         latency = access_latency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cacheid_);
 
     uint64_t time = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     time += latency;
@@ -879,6 +967,33 @@ void Incoherent::forwardFlush(MemEvent * event, bool evict, std::vector<uint8_t>
 }
 
 
+/* Sectored lines: write back each dirty sector, and each clean valid sector if 'clean' */
+void Incoherent::sendSectorWritebacks(PrivateCacheLine * line, bool clean) {
+    LineSectors * sectors = line->getSectors();
+    uint64_t dirty = sectors->getDirty();
+    uint64_t send = clean ? sectors->getValid() : dirty;
+    uint64_t time = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
+
+    for (uint32_t i = 0; i < sectors->count(); i++) {
+        uint64_t bit = 1ULL << i;
+        if (!(send & bit))
+            continue;
+        Addr addr = line->getAddr() + i * sector_size_;
+        MemEvent * writeback = new MemEvent(cacheid_, addr, addr, (dirty & bit) ? Command::PutM : Command::PutE);
+        writeback->setSize(sector_size_);
+        if (dirty & bit) {
+            std::vector<uint8_t> data(line->getData()->begin() + i * sector_size_, line->getData()->begin() + (i + 1) * sector_size_);
+            writeback->setPayload(data);
+            writeback->setDirty(true);
+        }
+        writeback->setRqstrID(cacheid_);
+        forwardByAddress(writeback, time + ((dirty & bit) ? access_latency_ : tag_latency_));
+    }
+    stat_sectors_writeback_->addData(LineSectors::popcount(dirty));
+    line->setTimestamp(time + access_latency_ - 1);
+}
+
+
 void Incoherent::sendWritebackAck(MemEvent * event) {
     MemEvent * ack = event->makeResponse();
 
@@ -945,6 +1060,76 @@ void Incoherent::recordLatency(Command cmd, int type, uint64_t latency) {
 
 void Incoherent::printLine(Addr addr) { }
 
+/* Sectored lines: the sectors of 'line' that 'event' covers, or 0 if the line is not sectored */
+uint64_t Incoherent::sectorMask(MemEvent * event, PrivateCacheLine * line) {
+    LineSectors * sectors = line->getSectors();
+    if (!sectors->enabled())
+        return 0;
+    Addr offset = event->getBaseAddr() - line->getAddr();
+    if ((offset | event->getSize()) & (sector_size_ - 1))
+        debug_->fatal(CALL_INFO, -1, "%s, Error: Request does not cover whole sectors. sector_size (%" PRIu32 ") must not exceed the line size of the caches above. Event: %s\n",
+                getName().c_str(), sector_size_, event->getVerboseString().c_str());
+    return sectors->mask(offset, event->getSize());
+}
+
+/* Sectored lines: whether the line is present but some sector the event covers is not */
+bool Incoherent::isSectorMiss(MemEvent * event, PrivateCacheLine * line) {
+    if (!line || !line->getSectors()->enabled())
+        return false;
+    State state = line->getState();
+    return (state == E || state == M) && !line->getSectors()->isValid(sectorMask(event, line));
+}
+
+/* Data to return for a request that hit. Sectored lines return only the requested bytes */
+vector<uint8_t>* Incoherent::getRequestData(MemEvent * event, PrivateCacheLine * line) {
+    if (!line->getSectors()->enabled())
+        return line->getData();
+    vector<uint8_t>::iterator begin = line->getData()->begin() + (event->getBaseAddr() - line->getAddr());
+    sector_data_.assign(begin, begin + event->getSize());
+    return &sector_data_;
+}
+
+/* Sectored lines: install response data for sectors that are still missing. Sectors written
+ * from above while the request was outstanding are newer than the response and are kept */
+void Incoherent::fillSectors(MemEvent * event, PrivateCacheLine * line) {
+    LineSectors * sectors = line->getSectors();
+    State state = line->getState();
+    if (!sectors->enabled() || (state != E && state != M))
+        return;
+
+    uint32_t offset = event->getBaseAddr() - line->getAddr();
+    uint64_t missing = sectorMask(event, line) & ~sectors->getValid();
+    const vector<uint8_t>& data = event->getPayloadBuffer().data();
+    uint32_t first = 0, count = 0;
+    while (sectors->nextRun(missing, first, count)) {
+        uint32_t start = first * sector_size_;
+        std::copy(data.begin() + (start - offset), data.begin() + (start - offset + count * sector_size_), line->getData()->begin() + start);
+        first += count;
+    }
+    sectors->setValid(missing);
+    stat_sectors_fetched_->addData(LineSectors::popcount(missing));
+}
+
+/* Functional warmup. Sectored lines are tagged by line address and only the sectors the event covers become valid */
+bool Incoherent::warmupLine(MemEvent* event, WarmupVictim& victim) {
+    bool allocate = CommandWriteback[(int)event->getCmd()];
+    if (!sector_size_)
+        return warmupArray(cache_array_, event, allocate, E, victim);
+
+    Addr base = event->getBaseAddr();
+    event->setBaseAddr(mshrAddr(base));
+    bool hit = warmupArray(cache_array_, event, allocate, E, victim);
+    event->setBaseAddr(base);
+
+    PrivateCacheLine * line = cache_array_->lookup(mshrAddr(base), false);
+    if (line && isWarmupStable(line->getState()) && line->getState() != I) {
+        uint64_t mask = sectorMask(event, line);
+        hit = hit && line->getSectors()->isValid(mask);
+        line->getSectors()->setValid(mask); // Warm lines are clean; memory holds the data
+    }
+    return hit;
+}
+
 std::set<Command> Incoherent::getValidReceiveEvents()  {
     std::set<Command> cmds = { Command::GetS,
         Command::GetX,
@@ -974,4 +1159,8 @@ void Incoherent::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(stat_miss_);
     SST_SER(stat_hits_);
     SST_SER(stat_misses_);
+    SST_SER(sector_size_);
+    SST_SER(stat_sector_miss_);
+    SST_SER(stat_sectors_fetched_);
+    SST_SER(stat_sectors_writeback_);
 }
\ No newline at end of file
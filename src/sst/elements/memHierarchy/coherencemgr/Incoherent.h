@@ -130,11 +130,16 @@ public:
         {"prefetch_useful",         "Prefetched block had a subsequent hit (useful prefetch)", "count", 2},
         {"prefetch_evict",          "Prefetched block was evicted/flushed before being accessed", "count", 2},
         {"prefetch_redundant",      "Prefetch issued for a block that was already in cache", "count", 2},
+        /* Sectored lines */
+        {"SectorMisses",            "Sectored lines: requests that found their line but not all of their sectors", "count", 1},
+        {"SectorsFetched",          "Sectored lines: sectors filled into present lines from responses", "sectors", 1},
+        {"SectorsWrittenBack",      "Sectored lines: dirty sectors written back on eviction or flush", "sectors", 1},
         {"default_stat",            "Default statistic used for unexpected events/states/etc. Should be 0, if not, check for missing statistic registerations.", "none", 7})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"replacement", "Replacement policies, slot 0 is for cache, slot 1 is for directory (if it exists)", "SST::MemHierarchy::ReplacementPolicy"},
-            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"} )
+            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"},
+            {"compressor", "Line compressor. Overrides the 'compression' parameter", "SST::MemHierarchy::LineCompressor"} )
 /* Class definition */
     /** Constructor for Incoherent. */
     Incoherent(SST::ComponentId_t id, Params& params, Params& owner_params, bool prefetch);
@@ -156,6 +161,10 @@ public:
     bool handleNACK(MemEvent * event, bool in_mshr)override ;
 
     Addr getBank(Addr addr) override { return cache_array_->getBank(addr); }
+
+    /* Functional warmup. Non-inclusive, so only writebacks allocate */
+    bool warmupLine(MemEvent* event, WarmupVictim& victim) override;
+    void endWarmState(bool keep) override { endWarmArray(cache_array_, keep); }
     void setSliceAware(uint64_t size, uint64_t step) override { cache_array_->setSliceAware(size, step); }
 
     MemEventInitCoherence * getInitCoherenceEvent() override;
@@ -199,9 +208,18 @@ private:
 
     void printLine(Addr addr);
 
+    /* Sectored lines. Requests cover one or more sectors of a line; lines are tagged by line address */
+    uint64_t sectorMask(MemEvent * event, PrivateCacheLine * line);
+    bool isSectorMiss(MemEvent * event, PrivateCacheLine * line);
+    vector<uint8_t>* getRequestData(MemEvent * event, PrivateCacheLine * line);
+    void fillSectors(MemEvent * event, PrivateCacheLine * line);
+    void sendSectorWritebacks(PrivateCacheLine * line, bool clean);
+
 /* Data members */
 
     CacheArray<PrivateCacheLine>* cache_array_ = nullptr;
+    uint32_t sector_size_ = 0;          // 0 if lines are not sectored
+    vector<uint8_t> sector_data_;       // Scratch for returning part of a sectored line
 
 /* Statistics */
     Statistic<uint64_t>* stat_latency_GetS_[2] = {nullptr, nullptr};
@@ -213,6 +231,9 @@ private:
     Statistic<uint64_t>* stat_miss_[3][2] = { {nullptr, nullptr}, {nullptr, nullptr}, {nullptr, nullptr} };
     Statistic<uint64_t>* stat_hits_ = nullptr;
     Statistic<uint64_t>* stat_misses_ = nullptr;
+    Statistic<uint64_t>* stat_sector_miss_ = nullptr;
+    Statistic<uint64_t>* stat_sectors_fetched_ = nullptr;
+    Statistic<uint64_t>* stat_sectors_writeback_ = nullptr;
 };
 
 
@@ -149,7 +149,7 @@ IncoherentL1::IncoherentL1(ComponentId_t id, Params& params, Params& owner_param
 bool IncoherentL1::handleGetS(MemEvent* event, bool in_mshr){
     Addr addr = event->getBaseAddr();
     L1CacheLine * line = cache_array_->lookup(addr, true);
-    bool local_prefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool local_prefetch = event->isPrefetch() && (event->getRqstrID() == cacheid_);
     State state = line ? line->getState() : I;
     uint64_t send_time = 0;
     MemEventStatus status = MemEventStatus::OK;
@@ -191,7 +191,7 @@ bool IncoherentL1::handleGetS(MemEvent* event, bool in_mshr){
                 stat_event_state_[(int)Command::GetS][state]->addData(1);
                 stat_hit_[0][in_mshr]->addData(1);
                 stat_hits_->addData(1);
-                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
+                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT, line->getData());
             }
             if (local_prefetch) {
                 recordPrefetchResult(line, stat_prefetch_redundant_);
@@ -292,7 +292,7 @@ bool IncoherentL1::handleGetX(MemEvent* event, bool in_mshr) {
 
             // Handle
             if (!event->isStoreConditional() || line->isAtomic(event->getThreadID())) { /* Don't write on a non-atomic SC */
-                line->setData(event->getPayload(), event->getAddr() - event->getBaseAddr());
+                line->setData(event->getPayloadBuffer().data(), event->getAddr() - event->getBaseAddr());
                 line->atomicEnd();
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, line->getData(), true);
@@ -370,7 +370,7 @@ bool IncoherentL1::handleGetSX(MemEvent* event, bool in_mshr) {
             // Profile
             recordPrefetchResult(line, stat_prefetch_hit_);
             if (!in_mshr || !mshr_->getProfiled(addr)) {
-                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
+                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT, line->getData());
                 recordLatencyType(event->getID(), LatType::HIT);
                 stat_event_state_[(int)Command::GetSX][state]->addData(1);
                 stat_hit_[2][in_mshr]->addData(1);
@@ -522,13 +522,13 @@ bool IncoherentL1::handleGetSResp(MemEvent * event, bool in_mshr) {
     stat_event_state_[(int)(event->getCmd())][state]->addData(1);
 
     MemEvent * request = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-    bool local_prefetch = request->isPrefetch() && (request->getRqstr() == cachename_);
+    bool local_prefetch = request->isPrefetch() && (request->getRqstrID() == cacheid_);
 
    if (mem_h_is_debug_addr(addr))
         event_debuginfo_.prefill(event->getID(), Command::GetSResp, (local_prefetch ? "-pref" : ""), addr, state);
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer().data(), 0);
     line->setState(E);
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, line->getData(), false);
@@ -579,7 +579,7 @@ bool IncoherentL1::handleGetXResp(MemEvent * event, bool in_mshr) {
     request->setMemFlags(event->getMemFlags());
 
     // Set line data
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer().data(), 0);
     if (mem_h_is_debug_addr(line->getAddr()))
         printDataValue(line->getAddr(), line->getData(), true);
 
@@ -592,7 +592,7 @@ bool IncoherentL1::handleGetXResp(MemEvent * event, bool in_mshr) {
     bool success = true;
     if (request->getCmd() == Command::GetX || request->getCmd() == Command::Write) {
         if (!request->isStoreConditional() || line->isAtomic(request->getThreadID())) {
-            line->setData(request->getPayload(), offset);
+            line->setData(request->getPayloadBuffer().data(), offset);
             if (mem_h_is_debug_addr(line->getAddr()))
                 printDataValue(line->getAddr(), line->getData(), true);
             line->atomicEnd();
@@ -679,7 +679,7 @@ bool IncoherentL1::handleNULLCMD(MemEvent* event, bool in_mshr) {
     }
 
     if (evicted) {
-        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer());
+        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer(), event);
         retry_buffer_.push_back(mshr_->getFrontEvent(newAddr));
         if (mshr_->removeEvictPointer(oldAddr, newAddr))
             retry(oldAddr);
@@ -751,7 +751,7 @@ MemEventStatus IncoherentL1::allocateMSHR(MemEvent * event, bool fwdReq, int pos
     // Screen prefetches first to ensure limits are not exceeeded:
     //      - Maximum number of outstanding prefetches
     //      - MSHR too full to accept prefetches
-    if (event->isPrefetch() && event->getRqstr() == cachename_) {
+    if (event->isPrefetch() && event->getRqstrID() == cacheid_) {
         if (drop_prefetch_level_ <= mshr_->getSize()) {
             event_debuginfo_.action = "Reject";
             event_debuginfo_.reason = "Prefetch drop level";
@@ -786,7 +786,7 @@ L1CacheLine* IncoherentL1::allocateLine(MemEvent * event, L1CacheLine * line) {
     if (evicted) {
         if (mem_h_is_debug_event(event) || mem_h_is_debug_addr(event->getBaseAddr()))
             printDebugAlloc(true, event->getBaseAddr(), "");
-        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer());
+        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer(), event);
         cache_array_->replace(event->getBaseAddr(), line);
         return line;
     } else {
@@ -875,7 +875,7 @@ void IncoherentL1::cleanUpAfterRequest(MemEvent* event, bool in_mshr) {
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict) {
                 std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
                 for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
+                    MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
                     retry_buffer_.push_back(ev);
                 }
             }
@@ -903,7 +903,7 @@ void IncoherentL1::cleanUpAfterResponse(MemEvent* event, bool in_mshr) {
         } else {
             std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
             for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
+                MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
                 retry_buffer_.push_back(ev);
             }
         }
@@ -917,7 +917,7 @@ void IncoherentL1::retry(Addr addr) {
         } else if (!(mshr_->pendingWriteback(addr))) {
             std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
             for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
+                MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
                 retry_buffer_.push_back(ev);
             }
         }
@@ -1015,7 +1015,7 @@ void IncoherentL1::forwardFlush(MemEvent * event, L1CacheLine * line, bool evict
  *  Latency: cache access + tag to read data that is being written back and update coherence state
  */
 void IncoherentL1::sendWriteback(Command cmd, L1CacheLine* line, bool dirty) {
-    MemEvent* writeback = new MemEvent(cachename_, line->getAddr(), line->getAddr(), cmd, getCurrentSimTimeNano());
+    MemEvent* writeback = new MemEvent(cacheid_, line->getAddr(), line->getAddr(), cmd, getCurrentSimTimeNano());
     writeback->setSize(line_size_);
 
     uint64_t latency = tag_latency_;
@@ -1032,7 +1032,7 @@ void IncoherentL1::sendWriteback(Command cmd, L1CacheLine* line, bool dirty) {
         latency = access_latency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cacheid_);
 
     uint64_t base_time = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     uint64_t delivery_time = base_time + latency;
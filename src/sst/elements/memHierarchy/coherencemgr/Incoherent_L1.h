@@ -144,6 +144,10 @@ public:
     bool handleNACK(MemEvent * event, bool in_mshr) override;
 
     Addr getBank(Addr addr) override { return cache_array_->getBank(addr); }
+
+    /* Functional warmup */
+    bool warmupLine(MemEvent* event, WarmupVictim& victim) override { return warmupArray(cache_array_, event, true, E, victim); }
+    void endWarmState(bool keep) override { endWarmArray(cache_array_, keep); }
     void setSliceAware(uint64_t size, uint64_t step) override { cache_array_->setSliceAware(size, step); }
 
     MemEventInitCoherence * getInitCoherenceEvent() override;
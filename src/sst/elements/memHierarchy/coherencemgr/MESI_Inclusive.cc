@@ -65,11 +65,20 @@ MESIInclusive::MESIInclusive(SST::ComponentId_t id, Params& params, Params& owne
     uint64_t lines = params.find<uint64_t>("lines");
     uint64_t assoc = params.find<uint64_t>("associativity");
 
-    ReplacementPolicy * rmgr = createReplacementPolicy(lines, assoc, params, false);
+    unsigned int tag_factor = createCompressor(params); // Compressed arrays have extra tags per set
+    ReplacementPolicy * rmgr = createReplacementPolicy(lines * tag_factor, assoc * tag_factor, params, false);
     HashFunction * ht = createHashFunction(params);
-    cache_array_ = new CacheArray<SharedCacheLine>(debug_, lines, assoc, line_size_, rmgr, ht);
+    cache_array_ = new CacheArray<SharedCacheLine>(debug_, lines * tag_factor, assoc * tag_factor, line_size_, rmgr, ht);
+    if (compressor_)
+        cache_array_->setCompression(compressor_, assoc);
     cache_array_->setBanked(params.find<uint64_t>("banks", 0));
 
+    /* Coherence is tracked per line, so sectors only limit writebacks to the dirty part of a line.
+     * That is only possible where the level below is memory and accepts partial-line writebacks */
+    sector_size_ = getSectorSize(params);
+    if (sector_size_)
+        cache_array_->setSectored(sector_size_);
+
     /* Statistics */
     stat_evict_[I] =         registerStatistic<uint64_t>("evict_I");
     stat_evict_[IS] =        registerStatistic<uint64_t>("evict_IS");
@@ -244,6 +253,11 @@ MESIInclusive::MESIInclusive(SST::ComponentId_t id, Params& params, Params& owne
         stat_prefetch_redundant_ = registerStatistic<uint64_t>("prefetch_redundant");
     }
 
+    if (sector_size_) {
+        stat_sectors_writeback_ = registerStatistic<uint64_t>("SectorsWrittenBack");
+        stat_sectors_clean_ = registerStatistic<uint64_t>("SectorsNotWrittenBack");
+    }
+
     /* Only for caches that expect writeback acks but we don't know yet so always enabled for now (can't register statistics later) */
     stat_event_state_[(int)Command::AckPut][I] = registerStatistic<uint64_t>("stateEvent_AckPut_I");
 
@@ -294,7 +308,7 @@ MESIInclusive::MESIInclusive(SST::ComponentId_t id, Params& params, Params& owne
 bool MESIInclusive::handleGetS(MemEvent * event, bool in_mshr) {
     Addr addr = event->getBaseAddr();
     SharedCacheLine * line = cache_array_->lookup(addr, true);
-    bool local_prefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool local_prefetch = event->isPrefetch() && (event->getRqstrID() == cacheid_);
     State state = line ? line->getState() : I;
 
     MemEventStatus status = MemEventStatus::OK;
@@ -899,7 +913,7 @@ bool MESIInclusive::handleFlushAll(MemEvent * event, bool in_mshr) {
             for (auto it : *cache_array_) {
                 if (it->getState() == I) continue;
                 if (it->getState() == S || it->getState() == E || it->getState() == M) {
-                        MemEvent * ev = new MemEvent(cachename_, it->getAddr(), it->getAddr(), Command::NULLCMD);
+                        MemEvent * ev = new MemEvent(cacheid_, it->getAddr(), it->getAddr(), Command::NULLCMD);
                         retry_buffer_.push_back(ev);
                         count++;
                     } else {
@@ -970,7 +984,7 @@ bool MESIInclusive::handleForwardFlush(MemEvent * event, bool in_mshr) {
                 for (auto it : *cache_array_) {
                     if (it->getState() == I) continue;
                     if (it->getState() == S || it->getState() == E || it->getState() == M) {
-                        MemEvent * ev = new MemEvent(cachename_, it->getAddr(), it->getAddr(), Command::NULLCMD);
+                        MemEvent * ev = new MemEvent(cacheid_, it->getAddr(), it->getAddr(), Command::NULLCMD);
                         retry_buffer_.push_back(ev);
                         evictionNeeded = true;
                         mshr_->incrementFlushCount();
@@ -1001,7 +1015,7 @@ bool MESIInclusive::handleForwardFlush(MemEvent * event, bool in_mshr) {
         for (auto it : *cache_array_) {
             if (it->getState() == I) continue;
             if (it->getState() == S || it->getState() == E || it->getState() == M) {
-                MemEvent * ev = new MemEvent(cachename_, it->getAddr(), it->getAddr(), Command::NULLCMD);
+                MemEvent * ev = new MemEvent(cacheid_, it->getAddr(), it->getAddr(), Command::NULLCMD);
                 retry_buffer_.push_back(ev);
                 evictionNeeded = true;
                 mshr_->incrementFlushCount();
@@ -1771,7 +1785,7 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool in_mshr) {
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
     //if (mem_h_is_debug_addr(addr))
         //debug_->debug(_L5_, "    Request: %s\n", req->getBriefString().c_str());
-    bool local_prefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool local_prefetch = req->isPrefetch() && (req->getRqstrID() == cacheid_);
     req->setFlags(event->getMemFlags());
 
     // Sanity check line state
@@ -1781,7 +1795,7 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool in_mshr) {
     }
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer().data(), 0);
     line->setState(S);
 
     if (mem_h_is_debug_addr(addr))
@@ -1821,7 +1835,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
 
     // Get matching request
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
-    bool local_prefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool local_prefetch = req->isPrefetch() && (req->getRqstrID() == cacheid_);
     req->setFlags(event->getMemFlags());
 
     std::vector<uint8_t> data;
@@ -1830,10 +1844,11 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
     switch (state) {
         case IS:
         {
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer().data(), 0);
 
             if (event->getDirty())  {
                 line->setState(M); // Sometimes get dirty data from a noninclusive cache
+                line->getSectors()->setDirty(line->getSectors()->all());
             } else {
                 line->setState(protocol_state_);
             }
@@ -1860,7 +1875,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
             break;
         }
         case IM:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer().data(), 0);
             if (mem_h_is_debug_addr(line->getAddr()))
                 printDataValue(addr, line->getData(), true);
         case SM:
@@ -2153,7 +2168,7 @@ bool MESIInclusive::handleNULLCMD(MemEvent* event, bool in_mshr) {
         event_debuginfo_.verbose_line = line->getString();
     }
     if (evicted) {
-        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer());
+        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer(), event);
         cache_array_->deallocate(line);
 
         if (oldAddr != newAddr) { /* Reallocating a line to a new address */
@@ -2273,9 +2288,28 @@ MemEventStatus MESIInclusive::processCacheMiss(MemEvent * event, SharedCacheLine
 
 
 SharedCacheLine * MESIInclusive::allocateLine(MemEvent * event, SharedCacheLine * line) {
+    // A free candidate fits. Otherwise a compressed set may need more than one line evicted
+    // before the new line fits
+    bool fits = false;
+    if (!line) {
+        line = cache_array_->findReplacementCandidate(event->getBaseAddr());
+        fits = !line->isAllocated();
+    }
     bool evicted = handleEviction(event->getBaseAddr(), line);
+    SharedCacheLine* victim = line; // Last line evicted, reported to listeners
+
+    while (evicted && !fits && cache_array_->isCompressed()) {
+        SharedCacheLine* next = cache_array_->findReplacementCandidate(event->getBaseAddr());
+        if (!next->isAllocated()) {
+            line = next;
+            break;
+        }
+        notifyListenerOfEvict(victim->getAddr(), line_size_, event->getInstructionPointer(), event);
+        line = victim = next;
+        evicted = handleEviction(event->getBaseAddr(), line);
+    }
     if (evicted) {
-        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer());
+        notifyListenerOfEvict(victim->getAddr(), line_size_, event->getInstructionPointer(), event);
         cache_array_->replace(event->getBaseAddr(), line);
         if (mem_h_is_debug_event(event))
             printDebugAlloc(true, event->getBaseAddr(), "");
@@ -2354,7 +2388,10 @@ bool MESIInclusive::handleEviction(Addr addr, SharedCacheLine *& line) {
                     if (mem_h_is_debug_addr(line->getAddr()))
                         printDebugAlloc(false, line->getAddr(), "InProg, M_Inv");
                 } else {
-                    sendWriteback(Command::PutM, line, true);
+                    if (sector_size_ && last_level_ && !recv_writeback_ack_)
+                        sendSectorWritebacks(line);
+                    else
+                        sendWriteback(Command::PutM, line, true);
                     wbSent = true;
                     line->setState(I);
                     evict = true;
@@ -2387,7 +2424,7 @@ void MESIInclusive::cleanUpEvent(MemEvent* event, bool in_mshr) {
 
     /* Remove from MSHR */
     if (in_mshr) {
-        if (event->isPrefetch() && event->getRqstr() == cachename_) outstanding_prefetch_count_--;
+        if (event->isPrefetch() && event->getRqstrID() == cacheid_) outstanding_prefetch_count_--;
         mshr_->removeFront(addr);
     }
 
@@ -2411,7 +2448,7 @@ void MESIInclusive::cleanUpAfterRequest(MemEvent* event, bool in_mshr) {
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict && mshr_->getAcksNeeded(addr) == 0) {
                 std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
                 for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                    MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                     retry_buffer_.push_back(ev);
                 }
             }
@@ -2431,7 +2468,7 @@ void MESIInclusive::cleanUpAfterResponse(MemEvent* event, bool in_mshr) {
     mshr_->removeFront(addr);
     delete event;
     if (req) {
-        if (req->isPrefetch() && req->getRqstr() == cachename_)
+        if (req->isPrefetch() && req->getRqstrID() == cacheid_)
             outstanding_prefetch_count_--;
         delete req;
     }
@@ -2445,7 +2482,7 @@ void MESIInclusive::cleanUpAfterResponse(MemEvent* event, bool in_mshr) {
             if (mshr_->getAcksNeeded(addr) == 0) {
                 std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
                 for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                    MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                     retry_buffer_.push_back(ev);
                 }
             }
@@ -2466,7 +2503,7 @@ void MESIInclusive::retry(Addr addr) {
             //    debug_->debug(_L5_, "    Retry: Waiting Evict in MSHR, retrying eviction\n");
             std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
             for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                 retry_buffer_.push_back(ev);
             }
         }
@@ -2479,7 +2516,7 @@ State MESIInclusive::doEviction(MemEvent * event, SharedCacheLine * line, State
     recordPrefetchResult(line, stat_prefetch_evict_);
 
     if (event->getDirty()) {
-        line->setData(event->getPayload(), 0);
+        line->setDirtyData(event->getPayloadBuffer().data(), event->getBaseAddr() - line->getAddr());
         if (mem_h_is_debug_addr(event->getBaseAddr())) {
                 printDataValue(event->getBaseAddr(), line->getData(), true);
         }
@@ -2599,7 +2636,7 @@ void MESIInclusive::forwardFlush(MemEvent * event, SharedCacheLine * line, bool
  *  Latency: cache access + tag to read data that is being written back and update coherence state
  */
 void MESIInclusive::sendWriteback(Command cmd, SharedCacheLine* line, bool dirty) {
-    MemEvent* writeback = new MemEvent(cachename_, line->getAddr(), line->getAddr(), cmd);
+    MemEvent* writeback = new MemEvent(cacheid_, line->getAddr(), line->getAddr(), cmd);
     writeback->setSize(line_size_);
 
     uint64_t latency = tag_latency_;
@@ -2616,7 +2653,7 @@ void MESIInclusive::sendWriteback(Command cmd, SharedCacheLine* line, bool dirty
         latency = access_latency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cacheid_);
 
     uint64_t base_time = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     uint64_t delivery_time = base_time + latency;
@@ -2629,6 +2666,48 @@ void MESIInclusive::sendWriteback(Command cmd, SharedCacheLine* line, bool dirty
 }
 
 
+/*
+ *  Handles: writing back a modified, sectored line
+ *  Each run of contiguous dirty sectors is written back with its own PutM. If no sector is
+ *  dirty, the line is evicted like a clean one.
+ *  Latency: cache access to read the dirty data
+ */
+void MESIInclusive::sendSectorWritebacks(SharedCacheLine* line) {
+    LineSectors * sectors = line->getSectors();
+    uint64_t dirty = sectors->getDirty();
+
+    stat_sectors_writeback_->addData(LineSectors::popcount(dirty));
+    stat_sectors_clean_->addData(sectors->count() - LineSectors::popcount(dirty));
+
+    if (!dirty) {
+        if (!silent_evict_clean_)
+            sendWriteback(Command::PutE, line, false);
+        return;
+    }
+
+    uint64_t base_time = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
+    uint64_t delivery_time = base_time + access_latency_;
+
+    uint32_t first = 0, count = 0;
+    while (sectors->nextRun(dirty, first, count)) {
+        Addr addr = line->getAddr() + first * sector_size_;
+        MemEvent* writeback = new MemEvent(cacheid_, addr, addr, Command::PutM);
+        std::vector<uint8_t> data(line->getData()->begin() + first * sector_size_,
+                line->getData()->begin() + (first + count) * sector_size_);
+        writeback->setPayload(data);
+        writeback->setDirty(true);
+        writeback->setRqstrID(cacheid_);
+        forwardByAddress(writeback, delivery_time);
+        first += count;
+    }
+
+    if (mem_h_is_debug_addr(line->getAddr()))
+        printDataValue(line->getAddr(), line->getData(), false);
+
+    line->setTimestamp(delivery_time-1);
+}
+
+
 void MESIInclusive::sendAckPut(MemEvent * event) {
     MemEvent * ack = event->makeResponse();
     ack->copyMetadata(event);
@@ -2645,7 +2724,7 @@ void MESIInclusive::sendAckPut(MemEvent * event) {
 
 void MESIInclusive::downgradeOwner(MemEvent * event, SharedCacheLine* line, bool in_mshr) {
     Addr addr = event->getBaseAddr();
-    MemEvent * fetch = new MemEvent(cachename_, addr, addr, Command::FetchInvX);
+    MemEvent * fetch = new MemEvent(cacheid_, addr, addr, Command::FetchInvX);
     fetch->copyMetadata(event);
     fetch->setDst(line->getOwner());
     fetch->setSize(line_size_);
@@ -2713,11 +2792,11 @@ bool MESIInclusive::invalidateAll(MemEvent * event, SharedCacheLine * line, bool
 uint64_t MESIInclusive::invalidateSharer(std::string shr, MemEvent * event, SharedCacheLine * line, bool in_mshr, Command cmd) {
     if (line->isSharer(shr)) {
         Addr addr = line->getAddr();
-        MemEvent * inv = new MemEvent(cachename_, addr, addr, cmd);
+        MemEvent * inv = new MemEvent(cacheid_, addr, addr, cmd);
         if (event) {
             inv->copyMetadata(event);
         } else {
-            inv->setRqstr(cachename_);
+            inv->setRqstrID(cacheid_);
         }
         inv->setDst(shr);
         inv->setSize(line_size_);
@@ -2750,11 +2829,11 @@ bool MESIInclusive::invalidateOwner(MemEvent * event, SharedCacheLine * line, bo
     if (line->getOwner() == "")
         return false;
 
-    MemEvent * inv = new MemEvent(cachename_, addr, addr, cmd);
+    MemEvent * inv = new MemEvent(cacheid_, addr, addr, cmd);
     if (event) {
         inv->copyMetadata(event);
     } else {
-        inv->setRqstr(cachename_);
+        inv->setRqstrID(cacheid_);
     }
     inv->setDst(line->getOwner());
     inv->setSize(line_size_);
@@ -2925,7 +3004,7 @@ void MESIInclusive::processCompleteEvent(MemEventInit* event, MemLinkBase* highl
         }
     } else if (event->getCmd() == Command::Write ) {
         SharedCacheLine * line = cache_array_->lookup(event->getAddr(), false);
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getPayloadBuffer().data(), 0);
         line->setState(M); // Force a writeback of this data
     }
     delete event; // Nothing for now
@@ -2993,4 +3072,7 @@ void MESIInclusive::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(stat_miss_);
     SST_SER(stat_hits_);
     SST_SER(stat_misses_);
+    SST_SER(sector_size_);
+    SST_SER(stat_sectors_writeback_);
+    SST_SER(stat_sectors_clean_);
 }
\ No newline at end of file
@@ -242,11 +242,15 @@ public:
         {"prefetch_inv",            "Prefetched block was invalidated before being accessed", "count", 2},
         {"prefetch_coherence_miss", "Prefetched block incurred a coherence miss (upgrade) on its first access", "count", 2},
         {"prefetch_redundant",      "Prefetch issued for a block that was already in cache", "count", 2},
+        /* Sectored lines */
+        {"SectorsWrittenBack",      "Sectored lines: dirty sectors written back on eviction of a modified line", "sectors", 1},
+        {"SectorsNotWrittenBack",   "Sectored lines: clean sectors of an evicted modified line that were not written back", "sectors", 1},
         {"default_stat",            "Default statistic used for unexpected events/states/etc. Should be 0, if not, check for missing statistic registerations.", "none", 7})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"replacement", "Replacement policies, slot 0 is for cache, slot 1 is for directory (if it exists)", "SST::MemHierarchy::ReplacementPolicy"},
-            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"} )
+            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"},
+            {"compressor", "Line compressor. Overrides the 'compression' parameter", "SST::MemHierarchy::LineCompressor"} )
 
 /* Class definition */
     /** Note that MESIInclusive handles both MESI & MSI protocols */
@@ -287,6 +291,12 @@ public:
     /** Bank conflict detection - used by controller */
     virtual Addr getBank(Addr addr) override { return cache_array_->getBank(addr); }
 
+    /* Functional warmup. Only requests allocate; upper level sharers are not tracked */
+    bool warmupLine(MemEvent* event, WarmupVictim& victim) override {
+        return warmupArray(cache_array_, event, !CommandWriteback[(int)event->getCmd()], protocol_state_, victim);
+    }
+    void endWarmState(bool keep) override { endWarmArray(cache_array_, keep); }
+
     /** Configuration **/
     MemEventInitCoherence * getInitCoherenceEvent() override;
     std::set<Command> getValidReceiveEvents() override;
@@ -328,6 +338,9 @@ private:
     /** Send writeback */
     void sendWriteback(Command cmd, SharedCacheLine * line, bool dirty);
 
+    /** Send writebacks for the dirty sectors of a modified, sectored line */
+    void sendSectorWritebacks(SharedCacheLine * line);
+
     /** Send AckPut */
     void sendAckPut(MemEvent * event);
 
@@ -355,6 +368,7 @@ private:
 
 /* Variables */
     CacheArray<SharedCacheLine> * cache_array_ = nullptr;
+    uint32_t sector_size_ = 0;  // 0 if lines are not sectored
     State protocol_state_;       // State to transition to on exclusive response to read/shared request
     bool protocol_;             // True for MESI, false for MSI
 
@@ -375,6 +389,8 @@ private:
     Statistic<uint64_t>* stat_miss_[3][2] = { {nullptr, nullptr}, {nullptr, nullptr}, {nullptr, nullptr} };
     Statistic<uint64_t>* stat_hits_ = nullptr;
     Statistic<uint64_t>* stat_misses_ = nullptr;
+    Statistic<uint64_t>* stat_sectors_writeback_ = nullptr;
+    Statistic<uint64_t>* stat_sectors_clean_ = nullptr;
 };
 
 
@@ -231,7 +231,7 @@ MESIL1::MESIL1(ComponentId_t id, Params& params, Params& owner_params, bool pref
 bool MESIL1::handleGetS(MemEvent * event, bool in_mshr) {
     Addr addr = event->getBaseAddr();
     L1CacheLine * line = cache_array_->lookup(addr, true);
-    bool local_prefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool local_prefetch = event->isPrefetch() && (event->getRqstrID() == cacheid_);
     State state = line ?  line->getState() : I;
     uint64_t send_time = 0;
     MemEventStatus status = MemEventStatus::OK;
@@ -283,7 +283,7 @@ bool MESIL1::handleGetS(MemEvent * event, bool in_mshr) {
                 stat_event_state_[(int)Command::GetS][state]->addData(1);
                 stat_hit_[0][in_mshr]->addData(1);
                 stat_hits_->addData(1);
-                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
+                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT, line->getData());
             }
 
             if (local_prefetch) {
@@ -442,7 +442,7 @@ bool MESIL1::handleGetX(MemEvent* event, bool in_mshr) {
             }
 
             if (!event->isStoreConditional() || line->isAtomic(event->getThreadID())) { // Don't write on a non-atomic SC
-                line->setData(event->getPayload(), event->getAddr() - event->getBaseAddr());
+                line->setData(event->getPayloadBuffer().data(), event->getAddr() - event->getBaseAddr());
                 line->atomicEnd();
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, line->getData(), true);
@@ -563,7 +563,7 @@ bool MESIL1::handleGetSX(MemEvent* event, bool in_mshr) {
         case M:
             recordPrefetchResult(line, stat_prefetch_hit_);
             if (!in_mshr || !mshr_->getProfiled(addr)) {
-                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
+                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT, line->getData());
                 recordLatencyType(event->getID(), LatType::HIT);
                 stat_event_state_[(int)Command::GetSX][state]->addData(1);
                 stat_hit_[2][in_mshr]->addData(1);
@@ -791,7 +791,7 @@ bool MESIL1::handleFlushAll(MemEvent* event, bool in_mshr) {
             case E:
             case M:
                 {
-                MemEvent * ev = new MemEvent(cachename_, it->getAddr(), it->getAddr(), Command::NULLCMD);
+                MemEvent * ev = new MemEvent(cacheid_, it->getAddr(), it->getAddr(), Command::NULLCMD);
                 retry_buffer_.push_back(ev);
                 eviction_needed = true;
                 mshr_->incrementFlushCount();
@@ -861,7 +861,7 @@ bool MESIL1::handleForwardFlush(MemEvent* event, bool in_mshr) {
             case E:
             case M:
                 {
-                MemEvent * ev = new MemEvent(cachename_, it->getAddr(), it->getAddr(), Command::NULLCMD);
+                MemEvent * ev = new MemEvent(cacheid_, it->getAddr(), it->getAddr(), Command::NULLCMD);
                 retry_buffer_.push_back(ev);
                 eviction_needed = true;
                 mshr_->incrementFlushCount();
@@ -1235,7 +1235,7 @@ bool MESIL1::handleGetSResp(MemEvent* event, bool in_mshr) {
     stat_event_state_[(int)Command::GetSResp][state]->addData(1);
 
     MemEvent * request = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-    bool local_prefetch = request->isPrefetch() && (request->getRqstr() == cachename_);
+    bool local_prefetch = request->isPrefetch() && (request->getRqstrID() == cacheid_);
 
     if (mem_h_is_debug_addr(addr))
         event_debuginfo_.prefill(event->getID(), request->getThreadID(), Command::GetSResp, (local_prefetch ? "-pref" : ""), addr, state);
@@ -1243,7 +1243,7 @@ bool MESIL1::handleGetSResp(MemEvent* event, bool in_mshr) {
     request->setMemFlags(event->getMemFlags()); // Copy MemFlags through
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer().data(), 0);
     line->setState(S);
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, line->getData(), false);
@@ -1286,7 +1286,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool in_mshr) {
     stat_event_state_[(int)Command::GetXResp][state]->addData(1);
 
     MemEvent * request = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-    bool local_prefetch = request->isPrefetch() && (request->getRqstr() == cachename_);
+    bool local_prefetch = request->isPrefetch() && (request->getRqstrID() == cacheid_);
 
     if (mem_h_is_debug_addr(addr)) {
         std::string mod = local_prefetch ? "-pref" : (request->isLoadLink() ? "-LL" : (request->isStoreConditional() ? "-SC" : ""));
@@ -1301,7 +1301,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool in_mshr) {
     switch (state) {
         case IS:
             {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, line->getData(), true);
 
@@ -1322,7 +1322,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool in_mshr) {
                 break;
             }
         case IM:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer().data(), 0);
             if (mem_h_is_debug_addr(addr))
                 printDataValue(addr, line->getData(), true);
         case SM:
@@ -1331,7 +1331,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool in_mshr) {
 
                 if (request->getCmd() == Command::Write || request->getCmd() == Command::GetX) {
                     if (!request->isStoreConditional() || line->isAtomic(request->getThreadID())) { // Normal or successful store-conditional
-                        line->setData(request->getPayload(), offset);
+                        line->setData(request->getPayloadBuffer().data(), offset);
 
                         if (mem_h_is_debug_addr(addr))
                             printDataValue(addr, line->getData(), true);
@@ -1468,7 +1468,7 @@ bool MESIL1::handleNULLCMD(MemEvent * event, bool in_mshr) {
     }
 
     if (evicted) {
-        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer());
+        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer(), event);
         cache_array_->deallocate(line);
 
         if (oldAddr != newAddr) { /* Reallocating a line to a new address */
@@ -1587,7 +1587,7 @@ L1CacheLine* MESIL1::allocateLine(MemEvent* event, L1CacheLine* line) {
     bool evicted = handleEviction(event->getBaseAddr(), line, false);
 
     if (evicted) {
-        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer());
+        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer(), event);
         cache_array_->replace(event->getBaseAddr(), line);
         if (mem_h_is_debug_addr(event->getBaseAddr()))
             printDebugAlloc(true, event->getBaseAddr(), "");
@@ -1696,7 +1696,7 @@ void MESIL1::cleanUpAfterRequest(MemEvent * event, bool in_mshr) {
 
     /* Remove from MSHR */
     if (in_mshr) {
-        if (event->isPrefetch() && event->getRqstr() == cachename_) outstanding_prefetch_count_--;
+        if (event->isPrefetch() && event->getRqstrID() == cacheid_) outstanding_prefetch_count_--;
         mshr_->removeFront(addr);
     }
 
@@ -1713,7 +1713,7 @@ void MESIL1::cleanUpAfterRequest(MemEvent * event, bool in_mshr) {
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict) {
                 std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
                 for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                    MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                     retry_buffer_.push_back(ev);
                 }
             }
@@ -1735,7 +1735,7 @@ void MESIL1::cleanUpAfterResponse(MemEvent* event, bool in_mshr) {
     mshr_->removeFront(addr); // delete request after this since debug might print the event it's removing
     delete event;
     if (request) {
-        if (request->isPrefetch() && request->getRqstr() == cachename_) outstanding_prefetch_count_--;
+        if (request->isPrefetch() && request->getRqstrID() == cacheid_) outstanding_prefetch_count_--;
         delete request;
     }
 
@@ -1749,7 +1749,7 @@ void MESIL1::cleanUpAfterResponse(MemEvent* event, bool in_mshr) {
         } else { // Pointer to an eviction
             std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
             for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                 retry_buffer_.push_back(ev);
             }
         }
@@ -1783,7 +1783,7 @@ void MESIL1::retry(Addr addr) {
         } else if (!(mshr_->pendingWriteback(addr))) {
             std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
             for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                 retry_buffer_.push_back(ev);
             }
         }
@@ -1909,7 +1909,7 @@ void MESIL1::forwardFlush(MemEvent* event, L1CacheLine* line, bool evict) {
  * Latency: cache access + tag to read data that is being written back and update coherence state
  */
 void MESIL1::sendWriteback(Command cmd, L1CacheLine * line, bool dirty, bool flush) {
-    MemEvent* writeback = new MemEvent(cachename_, line->getAddr(), line->getAddr(), cmd);
+    MemEvent* writeback = new MemEvent(cacheid_, line->getAddr(), line->getAddr(), cmd);
     writeback->setSize(line_size_);
 
     uint64_t latency = tag_latency_;
@@ -1926,7 +1926,7 @@ void MESIL1::sendWriteback(Command cmd, L1CacheLine * line, bool dirty, bool flu
     }
 
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cacheid_);
 
     uint64_t base_time = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     uint64_t delivery_time = base_time + latency;
@@ -1946,7 +1946,7 @@ void MESIL1::sendWriteback(Command cmd, L1CacheLine * line, bool dirty, bool flu
 void MESIL1::snoopInvalidation(MemEvent * event, L1CacheLine * line) {
     if (snoop_l1_invs_ && line) {
         for (auto it = system_cpu_names_.begin(); it != system_cpu_names_.end(); it++) {
-            MemEvent * snoop = new MemEvent(cachename_, event->getAddr(), event->getBaseAddr(), Command::Inv);
+            MemEvent * snoop = new MemEvent(cacheid_, event->getAddr(), event->getBaseAddr(), Command::Inv);
             uint64_t base_time = timestamp_ > line->getTimestamp() ? timestamp_ : line->getTimestamp();
             uint64_t delivery_time = base_time + tag_latency_;
             snoop->setDst(*it);
@@ -213,6 +213,10 @@ public:
     /** Bank conflict detection - used by controller */
     Addr getBank(Addr addr) override;
 
+    /* Functional warmup */
+    bool warmupLine(MemEvent* event, WarmupVictim& victim) override { return warmupArray(cache_array_, event, true, protocol_read_state_, victim); }
+    void endWarmState(bool keep) override { endWarmArray(cache_array_, keep); }
+
     /** Configuration */
     MemEventInitCoherence* getInitCoherenceEvent() override;
     virtual std::set<Command> getValidReceiveEvents() override;
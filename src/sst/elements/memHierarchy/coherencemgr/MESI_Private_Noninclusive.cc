@@ -50,9 +50,12 @@ MESIPrivNoninclusive::MESIPrivNoninclusive(SST::ComponentId_t id, Params& params
     uint64_t lines = params.find<uint64_t>("lines");
     uint64_t assoc = params.find<uint64_t>("associativity");
 
-    ReplacementPolicy * rmgr = createReplacementPolicy(lines, assoc, params, false);
+    unsigned int tag_factor = createCompressor(params); // Compressed arrays have extra tags per set
+    ReplacementPolicy * rmgr = createReplacementPolicy(lines * tag_factor, assoc * tag_factor, params, false);
     HashFunction * ht = createHashFunction(params);
-    cache_array_ = new CacheArray<PrivateCacheLine>(debug_, lines, assoc, line_size_, rmgr, ht);
+    cache_array_ = new CacheArray<PrivateCacheLine>(debug_, lines * tag_factor, assoc * tag_factor, line_size_, rmgr, ht);
+    if (compressor_)
+        cache_array_->setCompression(compressor_, assoc);
     cache_array_->setBanked(params.find<uint64_t>("banks", 0));
 
     flush_state_ = FlushState::Ready;
@@ -447,7 +450,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool in_mshr) {
                     mshr_->setProfiled(addr);
                 }
             } else if (mshr_->getAcksNeeded(addr) != 0 && event->getEvict()) {
-                mshr_->setData(addr, event->getPayload(), event->getDirty());
+                mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 event->setEvict(false);
                 if ((static_cast<MemEvent*>(mshr_->getFrontEvent(addr)))->getCmd() == Command::FetchInvX) {
                     responses_.erase(addr);
@@ -475,7 +478,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool in_mshr) {
                     line->setOwned(false);
                     line->setShared(true);
                     if (event->getDirty()) {
-                        line->setData(event->getPayload(), 0);
+                        line->setData(event->getPayloadBuffer().data(), 0);
                         if (mem_h_is_debug_addr(addr))
                             printDataValue(line->getAddr(), line->getData(), true);
                     }
@@ -496,7 +499,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool in_mshr) {
                 line->setOwned(false);
                 line->setShared(true);
                 if (event->getDirty()) {
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer().data(), 0);
                     if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
                     line->setState(M_Inv);
@@ -510,7 +513,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool in_mshr) {
             line->setOwned(false);
             line->setShared(true);
             if (event->getDirty()) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(line->getAddr(), line->getData(), true);
                 line->setState(M_Inv);
@@ -581,7 +584,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool in_mshr) {
                     break;
 
                 // Copy data in and update state to resolve race with conflicting event
-                mshr_->setData(addr, event->getPayload(), event->getDirty());
+                mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 if (race->getCmd() == Command::FetchInvX) {
                     event->setDirty(false);
                 } else if (race->getCmd() != Command::Fetch) { // FetchInv, ForceInv, or Inv
@@ -613,7 +616,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool in_mshr) {
                     line->setOwned(false);
                     line->setShared(false);
                     if (event->getDirty()) {
-                        line->setData(event->getPayload(), 0);
+                        line->setData(event->getPayloadBuffer().data(), 0);
                         line->setState(M);
                         if (mem_h_is_debug_addr(addr))
                             printDataValue(line->getAddr(), line->getData(), true);
@@ -643,7 +646,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool in_mshr) {
             line->setOwned(false);
             line->setShared(false);
             if (event->getDirty()) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer().data(), 0);
                 line->setState(M);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(line->getAddr(), line->getData(), true);
@@ -662,7 +665,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool in_mshr) {
             line->setOwned(false);
             line->setShared(false);
             if (event->getDirty()) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(line->getAddr(), line->getData(), true);
             }
@@ -755,7 +758,7 @@ bool MESIPrivNoninclusive::handleFlushAll(MemEvent * event, bool in_mshr) {
             for (auto it : *cache_array_) {
                 if (it->getState() == I) continue;
                 if (it->getState() == S || it->getState() == E || it->getState() == M) {
-                        MemEvent * ev = new MemEvent(cachename_, it->getAddr(), it->getAddr(), Command::NULLCMD);
+                        MemEvent * ev = new MemEvent(cacheid_, it->getAddr(), it->getAddr(), Command::NULLCMD);
                         retry_buffer_.push_back(ev);
                         mshr_->incrementFlushCount();
                         eviction_needed = true;
@@ -824,7 +827,7 @@ bool MESIPrivNoninclusive::handleForwardFlush(MemEvent * event, bool in_mshr) {
             for (auto it : *cache_array_) {
                 if (it->getState() == I) continue;
                 if (it->getState() == S || it->getState() == E || it->getState() == M) {
-                    MemEvent * ev = new MemEvent(cachename_, it->getAddr(), it->getAddr(), Command::NULLCMD);
+                    MemEvent * ev = new MemEvent(cacheid_, it->getAddr(), it->getAddr(), Command::NULLCMD);
                     retry_buffer_.push_back(ev);
                     eviction_needed = true;
                     mshr_->incrementFlushCount();
@@ -873,14 +876,14 @@ bool MESIPrivNoninclusive::handlePutS(MemEvent * event, bool in_mshr) {
                     sendWritebackAck(event);
                     delete event;
                 } else {
-                    mshr_->setData(addr, event->getPayload(), false);
+                    mshr_->setData(addr, event->getPayloadBuffer(), false);
                     responses_.erase(addr);
                     mshr_->decrementAcksNeeded(addr);
                     if (mshr_->getFrontType(addr) == MSHREntryType::Event && mshr_->getFrontEvent(addr)->getCmd() == Command::Fetch) {
                         status = allocateLine(event, line, false);
                         if (status == MemEventStatus::OK) {
                             line->setState(S);
-                            line->setData(event->getPayload(), 0);
+                            line->setData(event->getPayloadBuffer().data(), 0);
                             if (mem_h_is_debug_addr(addr))
                                 printDataValue(line->getAddr(), line->getData(), true);
                             mshr_->clearData(addr);
@@ -898,7 +901,7 @@ bool MESIPrivNoninclusive::handlePutS(MemEvent * event, bool in_mshr) {
                 status = allocateLine(event, line, in_mshr);
                 if (status == MemEventStatus::OK) {
                     line->setState(S);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer().data(), 0);
                     if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
                     if (mshr_->hasData(addr)) mshr_->clearData(addr);
@@ -980,13 +983,13 @@ bool MESIPrivNoninclusive::handlePutE(MemEvent * event, bool in_mshr) {
                 if (mshr_->getFrontType(addr) == MSHREntryType::Event && mshr_->getFrontEvent(addr)->getCmd() == Command::FetchInvX) {
                     mshr_->decrementAcksNeeded(addr);
                     responses_.erase(addr);
-                    mshr_->setData(addr, event->getPayload(), false);
+                    mshr_->setData(addr, event->getPayloadBuffer(), false);
                     event->setCmd(Command::PutS);
                     event->setDirty(false);
                     retry(addr);
                     status = allocateMSHR(event, false, 1, false);
                 } else {
-                    mshr_->setData(addr, event->getPayload(), false);
+                    mshr_->setData(addr, event->getPayloadBuffer(), false);
                     mshr_->decrementAcksNeeded(addr);
                     responses_.erase(addr);
                     sendWritebackAck(event);
@@ -997,7 +1000,7 @@ bool MESIPrivNoninclusive::handlePutE(MemEvent * event, bool in_mshr) {
                 status = allocateLine(event, line, in_mshr);
                 if (status == MemEventStatus::OK) {
                     event->getDirty() ? line->setState(M) : line->setState(E);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer().data(), 0);
                     if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
                     sendWritebackAck(event);
@@ -1070,13 +1073,13 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
                 if (mshr_->getFrontType(addr) == MSHREntryType::Event && mshr_->getFrontEvent(addr)->getCmd() == Command::FetchInvX) {
                     mshr_->decrementAcksNeeded(addr);
                     responses_.erase(addr);
-                    mshr_->setData(addr, event->getPayload(), true);
+                    mshr_->setData(addr, event->getPayloadBuffer(), true);
                     event->setCmd(Command::PutS);
                     event->setDirty(false);
                     retry(addr);
                     status = allocateMSHR(event, false, 1);
                 } else { // Eviction or invalidation -> we won't need a line
-                    mshr_->setData(addr, event->getPayload(), true);
+                    mshr_->setData(addr, event->getPayloadBuffer(), true);
                     mshr_->decrementAcksNeeded(addr);
                     responses_.erase(addr);
                     sendWritebackAck(event);
@@ -1087,7 +1090,7 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
                 status = allocateLine(event, line, in_mshr);
                 if (status == MemEventStatus::OK) {
                     line->setState(M);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer().data(), 0);
                     if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
                     if (mshr_->hasData(addr)) mshr_->clearData(addr);
@@ -1100,7 +1103,7 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
         case M:
             line->setOwned(false);
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer().data(), 0);
             if (mem_h_is_debug_addr(addr))
                 printDataValue(line->getAddr(), line->getData(), true);
             sendWritebackAck(event);
@@ -1155,7 +1158,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
     switch (state) {
         case I:
             if (mshr_->getAcksNeeded(addr)) {
-                mshr_->setData(addr, event->getPayload(), event->getDirty());
+                mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 sendWritebackAck(event);
                 delete event;
 
@@ -1168,7 +1171,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
                 status = allocateLine(event, line, in_mshr);
                 if (status == MemEventStatus::OK) {
                     event->getDirty() ? line->setState(M) : line->setState(E);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer().data(), 0);
                     if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
                     sendWritebackAck(event);
@@ -1183,7 +1186,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
             line->setShared(true);
             if (event->getDirty()) {
                 line->setState(M);
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(line->getAddr(), line->getData(), true);
             }
@@ -1196,7 +1199,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
             line->setShared(true);
             if (event->getDirty()) {
                 line->setState(M_Inv);
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(line->getAddr(), line->getData(), true);
             }
@@ -1211,7 +1214,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
             line->setShared(true);
             if (event->getDirty()) {
                 line->setState(M);
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
             } else {
@@ -1477,7 +1480,7 @@ bool MESIPrivNoninclusive::handleForceInv(MemEvent * event, bool in_mshr) {
             } else if (mshr_->exists(addr) && mshr_->getFrontEvent(addr)->getCmd() == Command::PutX) { // Drop PutX, Ack it, forward request up
                 MemEvent * put = static_cast<MemEvent*>(mshr_->swapFrontEvent(addr, event));
                 sendWritebackAck(put);
-                mshr_->setData(addr, put->getPayload(), put->getDirty());
+                mshr_->setData(addr, put->getPayloadBuffer(), put->getDirty());
                 delete put;
                 sendFwdRequest(event, Command::ForceInv, upper_cache_name_, line_size_, 0, in_mshr);
             } else if (mshr_->exists(addr) && (CommandWriteback[(int)mshr_->getFrontEvent(addr)->getCmd()])) {
@@ -1640,7 +1643,7 @@ bool MESIPrivNoninclusive::handleFetchInv(MemEvent * event, bool in_mshr){
             } else if (mshr_->exists(addr) && mshr_->getFrontEvent(addr)->getCmd() == Command::PutX) { // Drop PutX, Ack it, forward request up
                 MemEvent * put = static_cast<MemEvent*>(mshr_->swapFrontEvent(addr, event));
                 sendWritebackAck(put);
-                mshr_->setData(addr, put->getPayload(), put->getDirty());
+                mshr_->setData(addr, put->getPayloadBuffer(), put->getDirty());
                 delete put;
                 sendFwdRequest(event, Command::FetchInv, upper_cache_name_, line_size_, 0, in_mshr);
             } else if (mshr_->exists(addr) && (CommandWriteback[(int)mshr_->getFrontEvent(addr)->getCmd()])) {
@@ -1843,7 +1846,7 @@ bool MESIPrivNoninclusive::handleGetSResp(MemEvent * event, bool in_mshr) {
 
     // Update line
     if (line) {
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getPayloadBuffer().data(), 0);
         line->setState(S);
         line->setShared(true);
         line->setTimestamp(send_time-1);
@@ -1995,7 +1998,7 @@ bool MESIPrivNoninclusive::handleFetchResp(MemEvent * event, bool in_mshr) {
     } else {    // FetchInv only
         if (event->getDirty()) {
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer().data(), 0);
             if (mem_h_is_debug_addr(addr))
                 printDataValue(line->getAddr(), line->getData(), true);
         } else if (state == M_Inv) {
@@ -2042,7 +2045,7 @@ bool MESIPrivNoninclusive::handleFetchXResp(MemEvent * event, bool in_mshr) {
         line->setShared(true);
         if (event->getDirty()) {
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer().data(), 0);
             if (mem_h_is_debug_addr(addr))
                 printDataValue(line->getAddr(), line->getData(), true);
         } else if (state == M_InvX) {
@@ -2182,7 +2185,7 @@ bool MESIPrivNoninclusive::handleNULLCMD(MemEvent* event, bool in_mshr) {
         event_debuginfo_.verbose_line = line->getString();
     }
     if (evicted) {
-        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer());
+        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer(), event);
         if (oldAddr != newAddr) {
             if (mshr_->exists(newAddr) && mshr_->getStalledForEvict(newAddr)) {
                 debug_->debug(_L5_, "%s, Retry for 0x%" PRIx64 "\n", cachename_.c_str(), newAddr);
@@ -2298,7 +2301,26 @@ MemEventStatus MESIPrivNoninclusive::allocateLine(MemEvent * event, PrivateCache
 
     evict_debuginfo_.prefill(event->getID(), Command::Evict, "", 0, I);
 
+    // A free candidate fits. Otherwise a compressed set may need more than one line evicted
+    // before the new line fits
+    bool fits = false;
+    if (!line) {
+        line = cache_array_->findReplacementCandidate(event->getBaseAddr());
+        fits = !line->isAllocated();
+    }
     bool evicted = handleEviction(event->getBaseAddr(), line, evict_debuginfo_);
+    PrivateCacheLine* victim = line; // Last line evicted, reported to listeners
+
+    while (evicted && !fits && cache_array_->isCompressed()) {
+        PrivateCacheLine* next = cache_array_->findReplacementCandidate(event->getBaseAddr());
+        if (!next->isAllocated()) {
+            line = next;
+            break;
+        }
+        notifyListenerOfEvict(victim->getAddr(), line_size_, event->getInstructionPointer(), event);
+        line = victim = next;
+        evicted = handleEviction(event->getBaseAddr(), line, evict_debuginfo_);
+    }
 
     if (mem_h_is_debug_event(event) || mem_h_is_debug_addr(line->getAddr())) {
         evict_debuginfo_.new_state = line->getState();
@@ -2308,7 +2330,7 @@ MemEventStatus MESIPrivNoninclusive::allocateLine(MemEvent * event, PrivateCache
     }
 
     if (evicted) {
-        notifyListenerOfEvict(line->getAddr(), line_size_, event->getInstructionPointer());
+        notifyListenerOfEvict(victim->getAddr(), line_size_, event->getInstructionPointer(), event);
         cache_array_->replace(event->getBaseAddr(), line);
         if (mem_h_is_debug_addr(event->getBaseAddr()))
             printDebugAlloc(true, event->getBaseAddr(), "");
@@ -2525,7 +2547,7 @@ void MESIPrivNoninclusive::cleanUpAfterRequest(MemEvent* event, bool in_mshr) {
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict && mshr_->getAcksNeeded(addr) == 0) {
                 std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
                 for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                    MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                     retry_buffer_.push_back(ev);
                 }
             }
@@ -2559,7 +2581,7 @@ void MESIPrivNoninclusive::cleanUpAfterResponse(MemEvent* event, bool in_mshr) {
             if (mshr_->getAcksNeeded(addr) == 0) {
                 std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
                 for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                    MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                     retry_buffer_.push_back(ev);
                 }
             }
@@ -2576,7 +2598,7 @@ void MESIPrivNoninclusive::retry(Addr addr) {
         } else if (!(mshr_->pendingWriteback(addr))) {
             std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
             for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                 retry_buffer_.push_back(ev);
             }
         }
@@ -2708,7 +2730,7 @@ uint64_t MESIPrivNoninclusive::forwardFlush(MemEvent * event, bool evict, std::v
  */
 
 uint64_t MESIPrivNoninclusive::sendWriteback(Addr addr, uint32_t size, Command cmd, std::vector<uint8_t>* data, bool dirty, uint64_t startTime) {
-    MemEvent* writeback = new MemEvent(cachename_, addr, addr, cmd);
+    MemEvent* writeback = new MemEvent(cacheid_, addr, addr, cmd);
     writeback->setSize(size);
 
     uint64_t latency = tag_latency_;
@@ -2725,7 +2747,7 @@ uint64_t MESIPrivNoninclusive::sendWriteback(Addr addr, uint32_t size, Command c
         latency = access_latency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cacheid_);
 
     uint64_t send_time = timestamp_ > startTime ? timestamp_ : startTime;
     send_time += latency;
@@ -2739,7 +2761,7 @@ uint64_t MESIPrivNoninclusive::sendWriteback(Addr addr, uint32_t size, Command c
 
 uint64_t MESIPrivNoninclusive::sendFwdRequest(MemEvent * event, Command cmd, std::string dst, uint32_t size, uint64_t startTime, bool in_mshr) {
     Addr addr = event->getBaseAddr();
-    MemEvent * request = new MemEvent(cachename_, addr, addr, cmd);
+    MemEvent * request = new MemEvent(cacheid_, addr, addr, cmd);
     request->copyMetadata(event);
     request->setDst(dst);
     request->setSize(size);
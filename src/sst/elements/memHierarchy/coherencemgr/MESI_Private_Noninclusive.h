@@ -213,7 +213,8 @@ public:
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"replacement", "Replacement policies, slot 0 is for cache, slot 1 is for directory (if it exists)", "SST::MemHierarchy::ReplacementPolicy"},
-            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"} )
+            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"},
+            {"compressor", "Line compressor. Overrides the 'compression' parameter", "SST::MemHierarchy::LineCompressor"} )
 
 /* Class definition */
     MESIPrivNoninclusive(SST::ComponentId_t id, Params& params, Params& owner_params, bool prefetch);
@@ -253,6 +254,12 @@ public:
     /** Bank conflict detection - used by controller */
     Addr getBank(Addr addr) override { return cache_array_->getBank(addr); }
 
+    /* Functional warmup. Non-inclusive, so only writebacks allocate */
+    bool warmupLine(MemEvent* event, WarmupVictim& victim) override {
+        return warmupArray(cache_array_, event, CommandWriteback[(int)event->getCmd()], protocol_state_, victim);
+    }
+    void endWarmState(bool keep) override { endWarmArray(cache_array_, keep); }
+
     /** Configuration */
     MemEventInitCoherence* getInitCoherenceEvent() override;
     void setSliceAware(uint64_t size, uint64_t step) override { cache_array_->setSliceAware(size, step); }
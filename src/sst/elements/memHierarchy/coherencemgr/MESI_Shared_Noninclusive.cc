@@ -48,9 +48,12 @@ MESISharNoninclusive::MESISharNoninclusive(ComponentId_t id, Params& params, Par
     uint64_t lines = params.find<uint64_t>("lines");
     uint64_t assoc = params.find<uint64_t>("associativity");
 
-    ReplacementPolicy * rmgr = createReplacementPolicy(lines, assoc, params, false);
+    unsigned int tag_factor = createCompressor(params); // Compressed arrays have extra tags per set
+    ReplacementPolicy * rmgr = createReplacementPolicy(lines * tag_factor, assoc * tag_factor, params, false);
     HashFunction * ht = createHashFunction(params);
-    data_array_ = new CacheArray<DataLine>(debug_, lines, assoc, line_size_, rmgr, ht);
+    data_array_ = new CacheArray<DataLine>(debug_, lines * tag_factor, assoc * tag_factor, line_size_, rmgr, ht);
+    if (compressor_)
+        data_array_->setCompression(compressor_, assoc);
     data_array_->setBanked(params.find<uint64_t>("banks", 0));
 
     uint64_t dir_lines = params.find<uint64_t>("dlines");
@@ -306,7 +309,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool in_mshr) {
     DataLine * data = (tag) ? data_array_->lookup(addr, true) : nullptr;
     if (data && data->getTag() != tag) data = nullptr;
 
-    bool local_prefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool local_prefetch = event->isPrefetch() && (event->getRqstrID() == cacheid_);
     uint64_t send_time = 0;
     MemEventStatus status = MemEventStatus::OK;
     Command response_command;
@@ -952,7 +955,7 @@ bool MESISharNoninclusive::handleFlushAll(MemEvent* event, bool in_mshr) {
             for (auto it : *dir_array_) {
                 if (it->getState() == I) continue;
                 if (it->getState() == S || it->getState() == E || it->getState() == M) {
-                        MemEvent * ev = new MemEvent(cachename_, it->getAddr(), it->getAddr(), Command::NULLCMD);
+                        MemEvent * ev = new MemEvent(cacheid_, it->getAddr(), it->getAddr(), Command::NULLCMD);
                         retry_buffer_.push_back(ev);
                         mshr_->incrementFlushCount();
                 } else {
@@ -1032,7 +1035,7 @@ bool MESISharNoninclusive::handleForwardFlush(MemEvent* event, bool in_mshr) {
                 for (auto it : *dir_array_) {
                     if (it->getState() == I) continue;
                     if (it->getState() == S || it->getState() == E || it->getState() == M) {
-                        MemEvent * ev = new MemEvent(cachename_, it->getAddr(), it->getAddr(), Command::NULLCMD);
+                        MemEvent * ev = new MemEvent(cacheid_, it->getAddr(), it->getAddr(), Command::NULLCMD);
                         retry_buffer_.push_back(ev);
                         mshr_->incrementFlushCount();
                     } else {
@@ -1068,7 +1071,7 @@ bool MESISharNoninclusive::handleForwardFlush(MemEvent* event, bool in_mshr) {
             for (auto it : *dir_array_) {
                 if (it->getState() == I) continue;
                 if (it->getState() == S || it->getState() == E || it->getState() == M) {
-                    MemEvent * ev = new MemEvent(cachename_, it->getAddr(), it->getAddr(), Command::NULLCMD);
+                    MemEvent * ev = new MemEvent(cacheid_, it->getAddr(), it->getAddr(), Command::NULLCMD);
                     retry_buffer_.push_back(ev);
                     evictionNeeded = true;
                     mshr_->incrementFlushCount();
@@ -1145,7 +1148,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool in_mshr) {
                     break;
                 }
                 data = data_array_->lookup(addr, true);
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
                 in_mshr = true;
@@ -1195,7 +1198,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool in_mshr) {
             if (event->getSrc() == *(tag->getSharers()->begin())) { // Sent fetch to this requestor
                 // Retry the pending fetch
                 mshr_->decrementAcksNeeded(addr);
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
                 responses_.find(addr)->second.erase(event->getSrc());
                 if (responses_.find(addr)->second.empty())
                     responses_.erase(addr);
@@ -1278,7 +1281,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool in_mshr) {
                     break;
                 }
                 data = data_array_->lookup(addr, true);
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
                 in_mshr = true;
@@ -1295,7 +1298,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool in_mshr) {
             tag->removeOwner();
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             responses_.find(addr)->second.erase(event->getSrc());
             if (responses_.find(addr)->second.empty())
                 responses_.erase(addr);
@@ -1324,7 +1327,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool in_mshr) {
         case M_Inv:
             tag->removeOwner();
             if (!data && !mshr_->hasData(addr))
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             responses_.find(addr)->second.erase(event->getSrc());
             if (responses_.find(addr)->second.empty())
                 responses_.erase(addr);
@@ -1407,7 +1410,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
             if (mem_h_is_debug_addr(addr))
                 printDataValue(addr, &(event->getPayload()), true);
             data = data_array_->lookup(addr, true);
-            data->setData(event->getPayload(), 0);
+            data->setData(event->getPayloadBuffer().data(), 0);
             if (mem_h_is_debug_event(event))
                 event_debuginfo_.reason = "hit";
 
@@ -1431,7 +1434,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
                 if (!in_mshr || !mshr_->getProfiled(addr)) {
                     stat_event_state_[(int)Command::PutM][state]->addData(1);
                 }
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
                 sendWritebackAck(event);
@@ -1439,7 +1442,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
             } else {
                 tag->addSharer(event->getSrc());
                 event->setCmd(Command::PutS);
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
                 if (in_mshr)
                     mshr_->removeFront(addr); // Need to reinsert after the conflicting request
                 MemEventBase* entry = mshr_->getEntryEvent(addr, 1);
@@ -1461,9 +1464,9 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
             tag->removeOwner();
 
             if (!data)
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             else
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer().data(), 0);
             responses_.find(addr)->second.erase(event->getSrc());
             if (responses_.find(addr)->second.empty())
                 responses_.erase(addr);
@@ -1523,7 +1526,7 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
                 tag->setState(M);
 
             if (data) {
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
             }
@@ -1537,9 +1540,9 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
                 tag->setState(E);
 
             if (data)
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer().data(), 0);
             else
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
 
             if (mem_h_is_debug_addr(addr))
                 printDataValue(addr, &(event->getPayload()), true);
@@ -1554,9 +1557,9 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
                 tag->setState(M_Inv);
 
             if (data)
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer().data(), 0);
             else
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
 
             if (mem_h_is_debug_addr(addr))
                 printDataValue(addr, &(event->getPayload()), true);
@@ -2366,7 +2369,7 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool in_mshr) {
     // Find matching request in MSHR
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
 
-    bool local_prefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool local_prefetch = req->isPrefetch() && (req->getRqstrID() == cacheid_);
     req->setFlags(event->getMemFlags());
 
     if (mem_h_is_debug_event(event))
@@ -2376,7 +2379,7 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool in_mshr) {
 
     tag->setState(S);
     if (data) {
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer().data(), 0);
         if (mem_h_is_debug_addr(addr))
             printDataValue(addr, &(event->getPayload()), true);
     }
@@ -2414,7 +2417,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
     // Get matching request
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
 
-    bool local_prefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool local_prefetch = req->isPrefetch() && (req->getRqstrID() == cacheid_);
     req->setFlags(event->getMemFlags());
 
     if (mem_h_is_debug_event(event))
@@ -2427,7 +2430,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
         {
             // Update line if we have it locally
             if (data) {
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
             }
@@ -2458,7 +2461,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
         }
         case IM:
             if (data) {
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer().data(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
             } // fall-thru
@@ -2489,9 +2492,9 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
             mshr_->setInProgress(addr, false);
             if (event->getPayloadSize() != 0) {
                 if (data) {
-                    data->setData(event->getPayload(), 0);
+                    data->setData(event->getPayloadBuffer().data(), 0);
                 } else {
-                    mshr_->setData(addr, event->getPayload());
+                    mshr_->setData(addr, event->getPayloadBuffer());
                 }
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
@@ -2603,9 +2606,9 @@ bool MESISharNoninclusive::handleFetchResp(MemEvent * event, bool in_mshr) {
         responses_.erase(addr);
 
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer().data(), 0);
     else
-        mshr_->setData(addr, event->getPayload(), event->getDirty());
+        mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
 
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, &(event->getPayload()), true);
@@ -2710,9 +2713,9 @@ bool MESISharNoninclusive::handleFetchXResp(MemEvent * event, bool in_mshr) {
 
     // Save data
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer().data(), 0);
     else
-        mshr_->setData(addr, event->getPayload(), event->getDirty());
+        mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
 
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, &(event->getPayload()), true);
@@ -2835,7 +2838,7 @@ bool MESISharNoninclusive::handleNULLCMD(MemEvent* event, bool in_mshr) {
         }
 
         if (evicted) {
-            notifyListenerOfEvict(tag->getAddr(), line_size_, event->getInstructionPointer());
+            notifyListenerOfEvict(tag->getAddr(), line_size_, event->getInstructionPointer(), event);
             retry_buffer_.push_back(mshr_->getFrontEvent(newAddr));
             mshr_->addPendingRetry(newAddr);
             if (mshr_->removeEvictPointer(oldAddr, newAddr))
@@ -3022,8 +3025,25 @@ MemEventStatus MESISharNoninclusive::processDirectoryMiss(MemEvent * event, Dire
 
 MemEventStatus MESISharNoninclusive::processDataMiss(MemEvent * event, DirectoryLine * tag, DataLine * data, bool in_mshr) {
     // Evict a data line, if that requires evicting a dirline, evict a dirline too
+    // A free candidate fits. Otherwise a compressed set may need more than one line evicted
+    // before the new line fits
+    bool fits = false;
+    if (!data) {
+        data = data_array_->findReplacementCandidate(event->getBaseAddr());
+        fits = !data->isAllocated();
+    }
     bool evicted = handleDataEviction(event->getBaseAddr(), data);
 
+    while (evicted && !fits && data_array_->isCompressed()) {
+        DataLine* next = data_array_->findReplacementCandidate(event->getBaseAddr());
+        if (!next->isAllocated()) {
+            data = next;
+            break;
+        }
+        data = next;
+        evicted = handleDataEviction(event->getBaseAddr(), data);
+    }
+
     if (evicted) {
         if (mem_h_is_debug_event(event))
             printDebugAlloc(true, event->getBaseAddr(), "Data");
@@ -3055,7 +3075,7 @@ MemEventStatus MESISharNoninclusive::processDataMiss(MemEvent * event, Directory
 DirectoryLine* MESISharNoninclusive::allocateDirLine(MemEvent * event, DirectoryLine * tag) {
     bool evicted = handleDirEviction(event->getBaseAddr(), tag);
     if (evicted) {
-        notifyListenerOfEvict(tag->getAddr(), line_size_, event->getInstructionPointer());
+        notifyListenerOfEvict(tag->getAddr(), line_size_, event->getInstructionPointer(), event);
         dir_array_->replace(event->getBaseAddr(), tag);
         if (mem_h_is_debug_event(event))
             printDebugAlloc(true, event->getBaseAddr(), "Dir");
@@ -3298,7 +3318,7 @@ void MESISharNoninclusive::cleanUpEvent(MemEvent* event, bool in_mshr) {
 
     /* Remove from MSHR */
     if (in_mshr) {
-        if (event->isPrefetch() && event->getRqstr() == cachename_) outstanding_prefetch_count_--;
+        if (event->isPrefetch() && event->getRqstrID() == cacheid_) outstanding_prefetch_count_--;
         mshr_->removeFront(addr);
 
         if (flush_state_ == FlushState::Drain) {
@@ -3330,7 +3350,7 @@ void MESISharNoninclusive::cleanUpAfterRequest(MemEvent* event, bool in_mshr) {
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict && mshr_->getAcksNeeded(addr) == 0) {
                 std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
                 for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                    MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                     retry_buffer_.push_back(ev);
                 }
             }
@@ -3352,7 +3372,7 @@ void MESISharNoninclusive::cleanUpAfterResponse(MemEvent* event, bool in_mshr) {
     delete event;
 
     if (req) {
-        if (req->isPrefetch() && req->getRqstr() == cachename_) outstanding_prefetch_count_--;
+        if (req->isPrefetch() && req->getRqstrID() == cacheid_) outstanding_prefetch_count_--;
         delete req;
     }
 
@@ -3366,7 +3386,7 @@ void MESISharNoninclusive::cleanUpAfterResponse(MemEvent* event, bool in_mshr) {
             if (mshr_->getAcksNeeded(addr) == 0) {
                 std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
                 for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                    MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                    MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                     retry_buffer_.push_back(ev);
                 }
             }
@@ -3389,7 +3409,7 @@ void MESISharNoninclusive::retry(Addr addr) {
         } else if (!(mshr_->pendingWriteback(addr))) {
             std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
             for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
-                MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
+                MemEvent * ev = new MemEvent(cacheid_, addr, *it, Command::NULLCMD);
                 retry_buffer_.push_back(ev);
             }
             if (mem_h_is_debug_addr(addr)) {
@@ -3492,7 +3512,7 @@ uint64_t MESISharNoninclusive::forwardFlush(MemEvent * event, bool evict, std::v
 *  Latency: cache access + tag to read data that is being written back and update coherence state
 */
 void MESISharNoninclusive::sendWritebackFromCache(Command cmd, DirectoryLine* tag, DataLine* data, bool dirty) {
-    MemEvent* writeback = new MemEvent(cachename_, tag->getAddr(), tag->getAddr(), cmd);
+    MemEvent* writeback = new MemEvent(cacheid_, tag->getAddr(), tag->getAddr(), cmd);
     writeback->setSize(line_size_);
 
     uint64_t latency = tag_latency_;
@@ -3509,7 +3529,7 @@ void MESISharNoninclusive::sendWritebackFromCache(Command cmd, DirectoryLine* ta
         latency = access_latency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cacheid_);
 
     uint64_t base_time = (timestamp_ > tag->getTimestamp()) ? timestamp_ : tag->getTimestamp();
     uint64_t delivery_time = base_time + latency;
@@ -3519,14 +3539,14 @@ void MESISharNoninclusive::sendWritebackFromCache(Command cmd, DirectoryLine* ta
 }
 
 void MESISharNoninclusive::sendWritebackFromMSHR(Command cmd, DirectoryLine* tag, bool dirty) {
-    MemEvent* writeback = new MemEvent(cachename_, tag->getAddr(), tag->getAddr(), cmd);
+    MemEvent* writeback = new MemEvent(cacheid_, tag->getAddr(), tag->getAddr(), cmd);
     writeback->setSize(line_size_);
 
     uint64_t latency = tag_latency_;
 
     /* Writeback data */
     if (dirty || writeback_clean_blocks_) {
-        writeback->setPayload(mshr_->getData(tag->getAddr()));
+        writeback->setPayload(mshr_->getDataBuffer(tag->getAddr()));
         writeback->setDirty(dirty);
 
         if (mem_h_is_debug_addr(tag->getAddr())) {
@@ -3536,7 +3556,7 @@ void MESISharNoninclusive::sendWritebackFromMSHR(Command cmd, DirectoryLine* tag
         latency = access_latency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cacheid_);
 
     uint64_t base_time = (timestamp_ > tag->getTimestamp()) ? timestamp_ : tag->getTimestamp();
     uint64_t delivery_time = base_time + latency;
@@ -3558,7 +3578,7 @@ void MESISharNoninclusive::sendWritebackAck(MemEvent * event) {
 
 uint64_t MESISharNoninclusive::sendFetch(Command cmd, MemEvent * event, std::string dst, bool in_mshr, uint64_t ts) {
     Addr addr = event->getBaseAddr();
-    MemEvent * fetch = new MemEvent(cachename_, addr, addr, cmd);
+    MemEvent * fetch = new MemEvent(cacheid_, addr, addr, cmd);
     fetch->copyMetadata(event);
     fetch->setDst(dst);
     fetch->setSize(line_size_);
@@ -3649,11 +3669,11 @@ void MESISharNoninclusive::invalidateSharers(MemEvent * event, DirectoryLine * t
 uint64_t MESISharNoninclusive::invalidateSharer(std::string shr, MemEvent * event, DirectoryLine * tag, bool in_mshr, Command cmd) {
     if (tag->isSharer(shr)) {
         Addr addr = tag->getAddr();
-        MemEvent * inv = new MemEvent(cachename_, addr, addr, cmd);
+        MemEvent * inv = new MemEvent(cacheid_, addr, addr, cmd);
         if (event) {
             inv->copyMetadata(event);
         } else {
-            inv->setRqstr(cachename_);
+            inv->setRqstrID(cacheid_);
         }
         inv->setDst(shr);
         inv->setSize(line_size_);
@@ -3692,11 +3712,11 @@ bool MESISharNoninclusive::invalidateOwner(MemEvent * metaEvent, DirectoryLine *
         event_debuginfo_.reason = "Inv owner";
     }
 
-    MemEvent * inv = new MemEvent(cachename_, addr, addr, cmd);
+    MemEvent * inv = new MemEvent(cacheid_, addr, addr, cmd);
     if (metaEvent) {
         inv->copyMetadata(metaEvent);
     } else {
-        inv->setRqstr(cachename_);
+        inv->setRqstrID(cacheid_);
     }
     inv->setDst(tag->getOwner());
     inv->setSize(line_size_);
@@ -3765,7 +3785,7 @@ void MESISharNoninclusive::removeSharerViaInv(MemEvent * event, DirectoryLine *
     Addr addr = event->getBaseAddr();
     tag->removeSharer(event->getSrc());
     if (!data && !mshr_->hasData(addr))
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getPayloadBuffer());
 
     if (remove) {
         responses_.find(addr)->second.erase(event->getSrc());
@@ -3778,9 +3798,9 @@ void MESISharNoninclusive::removeOwnerViaInv(MemEvent * event, DirectoryLine * t
     Addr addr = event->getBaseAddr();
     tag->removeOwner();
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer().data(), 0);
     else
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getPayloadBuffer());
 
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, &(event->getPayload()), true);
@@ -3808,6 +3828,47 @@ void MESISharNoninclusive::recordPrefetchResult(DirectoryLine * tag, Statistic<u
     }
 }
 
+/* Functional warmup. A warm directory entry has no sharers, so it keeps a data line to be worth keeping.
+ * Data lines are only taken from idle, clean entries */
+bool MESISharNoninclusive::warmupLine(MemEvent* event, WarmupVictim& victim) {
+    bool hit = warmupArray(dir_array_, event, !CommandWriteback[(int)event->getCmd()], protocol_state_, victim,
+            [this](DirectoryLine* tag) {
+                DataLine* data = data_array_->lookup(tag->getAddr(), false);
+                if (data)
+                    data_array_->deallocate(data);
+            });
+
+    DirectoryLine* tag = dir_array_->lookup(event->getBaseAddr(), false);
+    if (hit || !tag)
+        return hit;
+
+    DataLine* data = data_array_->findReplacementCandidate(tag->getAddr());
+    if (data->isAllocated()) {
+        State state = data->getState();
+        if (!isWarmupStable(state) || state == M || mshr_->exists(data->getAddr()))
+            return hit;
+        data_array_->deallocate(data);
+    }
+    data_array_->replace(tag->getAddr(), data);
+    data->setTag(tag);
+    return hit;
+}
+
+/* Data lines are filled or dropped first so that idle directory entries left without data can be dropped too */
+void MESISharNoninclusive::endWarmState(bool keep) {
+    endWarmArray(data_array_, keep);
+    for (auto it = dir_array_->begin(); it != dir_array_->end(); ++it) {
+        DirectoryLine* tag = *it;
+        State state = tag->getState();
+        if (state == I || state == M || !isWarmupStable(state) || mshr_->exists(tag->getAddr()))
+            continue;
+        if (tag->hasOwner() || tag->hasSharers())
+            continue;
+        if (!keep || !data_array_->lookup(tag->getAddr(), false))
+            dir_array_->deallocate(tag);
+    }
+}
+
 MemEventInitCoherence* MESISharNoninclusive::getInitCoherenceEvent() {
     // Source, Endpoint type, inclusive, sends WB Acks, line size, tracks block presence
     return new MemEventInitCoherence(cachename_, Endpoint::Cache, false, true, false, line_size_, true);
@@ -3944,7 +4005,7 @@ void MESISharNoninclusive::processCompleteEvent(MemEventInit* event, MemLinkBase
             event->setSrc(getName());
             lowlink->sendUntimedData(event, false, true);
         } else {
-            data->setData(event->getPayload(), 0);
+            data->setData(event->getPayloadBuffer().data(), 0);
             delete event;
             tag->setState(M); // Make sure data gets flushed
         }
@@ -263,7 +263,8 @@ public:
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"replacement", "Replacement policies, slot 0 is for cache, slot 1 is for directory (if it exists)", "SST::MemHierarchy::ReplacementPolicy"},
-            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"} )
+            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"},
+            {"compressor", "Line compressor. Overrides the 'compression' parameter", "SST::MemHierarchy::LineCompressor"} )
 
 /* Class definition */
     MESISharNoninclusive(ComponentId_t id, Params& params, Params& owner_params, bool prefetch);
@@ -303,6 +304,10 @@ public:
     /** Bank conflict detection - used by controller */
     Addr getBank(Addr addr) override { return dir_array_->getBank(addr); }
 
+    /* Functional warmup. Requests allocate a directory entry and a data line; evicted entries drop their data */
+    bool warmupLine(MemEvent* event, WarmupVictim& victim) override;
+    void endWarmState(bool keep) override;
+
     /** Configuration */
     MemEventInitCoherence* getInitCoherenceEvent() override;
     std::set<Command> getValidReceiveEvents() override;
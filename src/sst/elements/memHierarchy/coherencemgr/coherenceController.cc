@@ -87,6 +87,7 @@ CoherenceController::CoherenceController(ComponentId_t id, Params &params, Param
 
     // Get parent component's name
     cachename_ = getParentComponentName();
+    cacheid_ = EndpointTable::intern(cachename_);
 
     // Register statistics - only those that are common across all coherence managers
     // Give  all array entries a default statistic so we don't end up with segfaults during execution
@@ -129,32 +130,30 @@ CoherenceController::CoherenceController(ComponentId_t id, Params &params, Param
  * Initialization
  *******************************************************************************/
 ReplacementPolicy* CoherenceController::createReplacementPolicy(uint64_t lines, uint64_t assoc, Params& params, bool L1, int slotnum) {
+    ReplacementPolicy* policy = nullptr;
     SubComponentSlotInfo* rslots = getSubComponentSlotInfo("replacement");
-    if (rslots && rslots->isPopulated(slotnum))
-        return rslots->create<ReplacementPolicy>(slotnum, ComponentInfo::SHARE_NONE, lines, assoc);
-
-    // Default to the replacement policy that was used before all the recent memH changes
-    Params emptyparams;
-    std::string policy = params.find<std::string>("replacement_policy", "lru");
-    to_lower(policy);
-
-    if (policy == "lru") {
-        if (L1) return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.lru", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
-        else    return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.lru-opt", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
-    }
-    if (policy == "lfu") {
-        if (L1) return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.lfu", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
-        else    return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.lfu-opt", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
-    }
-    if (policy == "mru") {
-        if (L1) return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.mru", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
-        else    return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.mru-opt", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
+    if (rslots && rslots->isPopulated(slotnum)) {
+        policy = rslots->create<ReplacementPolicy>(slotnum, ComponentInfo::SHARE_NONE, lines, assoc);
+    } else {
+        // Default to the replacement policy that was used before all the recent memH changes
+        Params emptyparams;
+        std::string name = params.find<std::string>("replacement_policy", "lru");
+        to_lower(name);
+
+        std::string type;
+        if (name == "lru" || name == "lfu" || name == "mru")
+            type = L1 ? name : name + "-opt";
+        else if (name == "random" || name == "nmru" || name == "srrip" || name == "brrip" || name == "drrip" || name == "ship")
+            type = name;
+        else
+            debug_->fatal(CALL_INFO, -1, "%s, Invalid param: replacement_policy - supported policies are 'lru', 'lfu', 'random', 'mru', 'nmru', 'srrip', 'brrip', 'drrip', and 'ship'. You specified '%s'.\n", getName().c_str(), name.c_str());
+
+        policy = loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement." + type, "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
     }
-    if (policy == "random") return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.random", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
-    if (policy == "nmru")   return loadAnonymousSubComponent<ReplacementPolicy>("memHierarchy.replacement.nmru", "replacement", slotnum, ComponentInfo::SHARE_NONE, emptyparams, lines, assoc);
 
-    debug_->fatal(CALL_INFO, -1, "%s, Invalid param: replacement_policy - supported policies are 'lru', 'lfu', 'random', 'mru', and 'nmru'. You specified '%s'.\n", getName().c_str(), policy.c_str());
-    return nullptr;
+    if (policy->usesInstructionPointer())
+        ip_replacement_.push_back(policy);
+    return policy;
 }
 
 HashFunction* CoherenceController::createHashFunction(Params& params) {
@@ -172,6 +171,41 @@ HashFunction* CoherenceController::createHashFunction(Params& params) {
     }
 }
 
+/* Load the line compressor, if any, and return the factor to scale the tag array by (1 if uncompressed) */
+unsigned int CoherenceController::createCompressor(Params& params) {
+    compressor_ = loadUserSubComponent<LineCompressor>("compressor");
+    if (!compressor_) {
+        std::string name = params.find<std::string>("compression", "none");
+        to_lower(name);
+        if (name == "none")
+            return 1;
+        if (name != "bdi" && name != "fpc")
+            debug_->fatal(CALL_INFO, -1, "%s, Invalid param: compression - supported options are 'none', 'bdi', and 'fpc'. You specified '%s'.\n", getName().c_str(), name.c_str());
+
+        Params cparams;
+        cparams.insert("line_size", std::to_string(line_size_));
+        std::string latency = params.find<std::string>("decompression_latency_cycles", "");
+        if (!latency.empty())
+            cparams.insert("latency", latency);
+        compressor_ = loadAnonymousSubComponent<LineCompressor>("memHierarchy.compression." + name, "compressor", 0, ComponentInfo::SHARE_NONE, cparams);
+    }
+
+    unsigned int factor = params.find<unsigned int>("compression_tag_factor", 2);
+    if (factor == 0)
+        debug_->fatal(CALL_INFO, -1, "%s, Invalid param: compression_tag_factor - must be at least 1.\n", getName().c_str());
+    return factor;
+}
+
+uint32_t CoherenceController::getSectorSize(Params& params) {
+    uint64_t sector = params.find<uint64_t>("sector_size", 0);
+    if (sector == 0 || sector == line_size_)
+        return 0;
+    if (!isPowerOfTwo(sector) || sector > line_size_ || (line_size_ / sector) > 64)
+        debug_->fatal(CALL_INFO, -1, "%s, Invalid param: sector_size - must be a power of two that divides cache_line_size into at most 64 sectors. You specified '%" PRIu64 "' with a line size of '%" PRIu64 "'.\n",
+                getName().c_str(), sector, line_size_);
+    return sector;
+}
+
 
 /*******************************************************************************
  * Event handlers - one per event type
@@ -435,16 +469,16 @@ void CoherenceController::forwardByAddress(MemEventBase * event) {
 }
 
 void CoherenceController::forwardByAddress(MemEventBase * event, Cycle_t ts) {
-    event->setSrc(cachename_);
-    std::string dst = link_down_->findTargetDestination(event->getRoutingAddress());
-    if (dst != "") { /* Common case */
-        event->setDst(dst);
+    event->setSrcID(cacheid_);
+    EndpointID dst = link_down_->findTargetDestinationID(event->getRoutingAddress());
+    if (dst != EndpointTable::NONE_ID) { /* Common case */
+        event->setDstID(dst);
         Response forward_request = {event, ts, packet_header_bytes_ + event->getPayloadSize()};
         addToOutgoingQueue(forward_request);
     } else {
-        dst = link_up_->findTargetDestination(event->getRoutingAddress());
-        if (dst != "") {
-            event->setDst(dst);
+        dst = link_up_->findTargetDestinationID(event->getRoutingAddress());
+        if (dst != EndpointTable::NONE_ID) {
+            event->setDstID(dst);
             Response forward_request = {event, ts, packet_header_bytes_ + event->getPayloadSize()};
             addToOutgoingQueueUp(forward_request);
         } else {
@@ -464,12 +498,12 @@ void CoherenceController::forwardByDestination(MemEventBase * event) {
 
 /* Forward an event to a specific destination */
 void CoherenceController::forwardByDestination(MemEventBase * event, Cycle_t ts) {
-    event->setSrc(cachename_);
+    event->setSrcID(cacheid_);
     Response forward_request = {event, ts, packet_header_bytes_ + event->getPayloadSize()};
 
-    if (link_up_->isReachable(event->getDst())) {
+    if (link_up_->isReachable(event->getDstID())) {
         addToOutgoingQueueUp(forward_request);
-    } else if (link_down_->isReachable(event->getDst())) {
+    } else if (link_down_->isReachable(event->getDstID())) {
         addToOutgoingQueue(forward_request);
     } else {
         output_->fatal(CALL_INFO, -1, "%s, Error: Destination %s appears unreachable on both links. Event: %s\n",
@@ -481,9 +515,9 @@ void CoherenceController::forwardByDestination(MemEventBase * event, Cycle_t ts)
 int CoherenceController::broadcastMemEventToSources(Command cmd, MemEvent* metadata, Cycle_t ts) {
     std::set<MemLinkBase::EndpointInfo>* sources = link_up_->getSources();
     for (auto it = sources->begin(); it != sources->end(); it++) {
-        MemEvent* event = new MemEvent(cachename_, cmd);
+        MemEvent* event = new MemEvent(cacheid_, cmd);
         if (metadata) event->copyMetadata(metadata);
-        event->setSrc(cachename_);
+        event->setSrcID(cacheid_);
         event->setDst(it->name);
         forwardByDestination(event, ts);
     }
@@ -496,9 +530,9 @@ int CoherenceController::broadcastMemEventToPeers(Command cmd, MemEvent* metadat
     for (auto it = peers->begin(); it != peers->end(); it++) {
         if (it->name == cachename_) continue;
 
-        MemEvent* event = new MemEvent(cachename_, cmd);
+        MemEvent* event = new MemEvent(cacheid_, cmd);
         if (metadata) event->copyMetadata(metadata);
-        event->setSrc(cachename_);
+        event->setSrcID(cacheid_);
         event->setDst(it->name);
         forwardByDestination(event, ts);
         sent++;
@@ -595,24 +629,51 @@ void CoherenceController::clearRetryBuffer() {
 
 
 /* Listener callbacks */
-void CoherenceController::notifyListenerOfAccess(MemEvent * event, NotifyAccessType access_type, NotifyResultType result_type) {
+void CoherenceController::notifyListenerOfAccess(MemEvent * event, NotifyAccessType access_type, NotifyResultType result_type, const vector<uint8_t>* data) {
     if (event->isPrefetch())
         access_type = NotifyAccessType::PREFETCH;
 
     CacheListenerNotification notify(event->getAddr(), event->getBaseAddr(), event->getVirtualAddress(),
             event->getInstructionPointer(), event->getSize(), access_type, result_type);
+    notify.setData(data);
 
     for (int i = 0; i < listeners_.size(); i++)
         listeners_[i]->notifyAccess(notify);
+
+    if (throttle_)
+        throttle_->notifyAccess(event, access_type, result_type);
 }
 
 
-void CoherenceController::notifyListenerOfEvict(Addr addr, uint32_t size, Addr ip) {
+/*
+ * 'cause' is the event being handled when the eviction occurred, if known: either the request
+ * that needs the line or a NULLCMD (internal eviction) on behalf of the request at the front of
+ * the MSHR for the new address. Used to attribute evictions to prefetches for throttling.
+ */
+void CoherenceController::notifyListenerOfEvict(Addr addr, uint32_t size, Addr ip, MemEvent* cause) {
     CacheListenerNotification notify(addr, addr, 0, ip, size, EVICT, NA);
 
     for (int i = 0; i < listeners_.size(); i++) {
         listeners_[i]->notifyAccess(notify);
     }
+
+    if (!throttle_)
+        return;
+
+    bool by_prefetch = false;
+    if (cause && cause->getCmd() == Command::NULLCMD) {
+        Addr new_addr = cause->getBaseAddr();
+        cause = nullptr;
+        if (new_addr != addr && mshr_->getSize(new_addr) != 0
+                && mshr_->getFrontType(new_addr) == MSHREntryType::Event) {
+            MemEventBase* front = mshr_->getFrontEvent(new_addr);
+            if (front->getCmd() == Command::GetS)
+                cause = static_cast<MemEvent*>(front);
+        }
+    }
+    if (cause)
+        by_prefetch = cause->isPrefetch() && cause->getRqstrID() == cacheid_;
+    throttle_->notifyEvict(addr, by_prefetch);
 }
 
 
@@ -648,6 +709,54 @@ uint64_t CoherenceController::forwardMessage(MemEvent * event, unsigned int requ
     return delivery_time;
 }
 
+/* Functional warmup, see header */
+bool CoherenceController::handleWarmup(MemEvent * event) {
+    Command cmd = event->getCmd();
+    bool request = CommandClassArr[(int)cmd] == CommandClass::Request && !CommandWriteback[(int)cmd];
+    bool copy = event->queryFlag(MemEventBase::F_WARMUP);
+
+    WarmupVictim victim;
+    bool hit = warmupLine(event, victim);
+
+    if (victim.valid && !silent_evict_clean_) {
+        MemEvent * put = new MemEvent(cacheid_, victim.addr, victim.addr, victim.cmd, line_size_);
+        put->setFlag(MemEventBase::F_WARMUP);
+        put->setFlag(MemEventBase::F_NORESPONSE);
+        forwardByAddress(put, timestamp_);
+    }
+
+    /* Warm lines hold no data, so memory is the only up-to-date copy. The cache that answers a
+     * request writes the request's data there and reads the response from it */
+    if (request && !copy && event->getPayloadSize() != 0)
+        FunctionalMemory::write(event->getAddr(), event->getPayloadBuffer().data());
+
+    if (request && !copy && !event->queryFlag(MemEventBase::F_NORESPONSE)) {
+        MemEvent * response = event->makeResponse();
+        response->setSize(event->getSize());
+        if (response->getCmd() == Command::GetSResp || response->getCmd() == Command::GetXResp) {
+            std::vector<uint8_t> data(event->getSize(), 0);
+            FunctionalMemory::read(event->getAddr(), data); // Zeros if memory isn't reachable
+            response->setPayload(data);
+        }
+        forwardByDestination(response, timestamp_);
+    }
+
+    if (request && !hit) {
+        event->setFlag(MemEventBase::F_WARMUP);
+        event->setFlag(MemEventBase::F_NORESPONSE);
+        forwardByAddress(event, timestamp_);
+    } else {
+        delete event;
+    }
+    return hit;
+}
+
+bool CoherenceController::warmupLine(MemEvent * event, WarmupVictim& victim) {
+    debug_->fatal(CALL_INFO, -1, "%s, Error: Functional warmup is not supported by this coherence manager. Event: %s. Time: %" PRIu64 "ns.\n",
+            getName().c_str(), event->getVerboseString().c_str(), getCurrentSimTimeNano());
+    return false;
+}
+
 /* Send a NACK event */
 void CoherenceController::sendNACK(MemEvent * event) {
     MemEvent * nack_event = event->makeNACKResponse(event);
@@ -702,6 +811,8 @@ uint64_t CoherenceController::sendResponseUp(MemEvent * event, Command cmd, vect
 
     if (base_time < timestamp_) base_time = timestamp_;
     uint64_t delivery_time = base_time + (replay ? mshr_latency_ : access_latency_);
+    if (compressor_ && data != nullptr && !replay)
+        delivery_time += compressor_->decompressionLatency(*data);
     forwardByDestination(response_event, delivery_time);
 
     return delivery_time;
@@ -717,7 +828,7 @@ MemEventStatus CoherenceController::allocateMSHR(MemEvent * event, bool forward_
     // Screen prefetches first to ensure limits are not exceeded:
     //      - Maximum number of outstanding prefetches
     //      - MSHR too full to accept prefetches
-    if (event->isPrefetch() && event->getRqstr() == cachename_) {
+    if (event->isPrefetch() && event->getRqstrID() == cacheid_) {
         if (drop_prefetch_level_ <= mshr_->getSize()) {
             event_debuginfo_.action = "Reject";
             event_debuginfo_.reason = "Prefetch drop level";
@@ -730,7 +841,7 @@ MemEventStatus CoherenceController::allocateMSHR(MemEvent * event, bool forward_
         }
     }
 
-    int end_pos = mshr_->insertEvent(event->getBaseAddr(), event, pos, forward_request, stall_for_evict);
+    int end_pos = mshr_->insertEvent(mshrAddr(event->getBaseAddr()), event, pos, forward_request, stall_for_evict);
     if (end_pos == -1) {
         if (mem_h_is_debug_event(event)) {
             event_debuginfo_.action = "Reject";
@@ -742,13 +853,13 @@ MemEventStatus CoherenceController::allocateMSHR(MemEvent * event, bool forward_
             event_debuginfo_.action = "Stall";
             event_debuginfo_.reason = "MSHR conflict";
         }
-        if (event->isPrefetch() && event->getRqstr() == cachename_) {
+        if (event->isPrefetch() && event->getRqstrID() == cacheid_) {
             outstanding_prefetch_count_++;
         }
         return MemEventStatus::Stall;
     }
 
-    if (event->isPrefetch() && event->getRqstr() == cachename_) {
+    if (event->isPrefetch() && event->getRqstrID() == cacheid_) {
         outstanding_prefetch_count_++;
     }
     return MemEventStatus::OK;
@@ -932,6 +1043,8 @@ void CoherenceController::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(drop_prefetch_level_);
     SST_SER(outstanding_prefetch_count_);
     SST_SER(cachename_);
+    if (ser.mode() == SST::Core::Serialization::serializer::UNPACK)
+        cacheid_ = EndpointTable::intern(cachename_);
     SST_SER(output_);
     SST_SER(debug_);
     SST_SER(debug_addr_filter_);
@@ -941,6 +1054,8 @@ void CoherenceController::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(tag_latency_);
     SST_SER(mshr_latency_);
     SST_SER(line_size_);
+    SST_SER(sector_line_mask_);
+    SST_SER(compressor_);
     SST_SER(writeback_clean_blocks_);
     SST_SER(silent_evict_clean_);
     SST_SER(recv_writeback_ack_);
@@ -949,6 +1064,7 @@ void CoherenceController::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(flush_manager_);
     SST_SER(flush_helper_);
     SST_SER(flush_dest_);
+    SST_SER(ip_replacement_);
     SST_SER(retry_buffer_);
     SST_SER(stat_event_sent_);
     SST_SER(stat_evict_);
@@ -27,10 +27,14 @@
 
 #include "util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
+#include "sst/elements/memHierarchy/prefetchThrottle.h"
 #include "sst/elements/memHierarchy/mshr.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/hash.h"
+#include "sst/elements/memHierarchy/lineCompressor.h"
+#include "sst/elements/memHierarchy/cacheArray.h"
+#include "sst/elements/memHierarchy/functionalMemory.h"
 
 namespace SST { namespace MemHierarchy {
 using namespace std;
@@ -120,6 +124,23 @@ public:
     /* Get which bank an address maps to (call through to cache array) */
     virtual Addr getBank(Addr addr) = 0;
 
+    /*
+     * Functional warmup
+     * Update tags and replacement state for a request or writeback without timing or an MSHR entry.
+     * Requests from above get an immediate response (unless the event is itself a warmup copy).
+     * Misses and evictions are forwarded down as warmup copies (F_WARMUP), which lower levels
+     * handle the same way but never respond to. Warm lines are always clean and hold no data;
+     * stores write memory and loads read it through FunctionalMemory.
+     * Returns whether the line was present
+     */
+    bool handleWarmup(MemEvent* event);
+
+    /* End of warmup: kept lines are filled from memory (and dropped if memory can't be reached),
+     * other idle lines are invalidated */
+    virtual void endWarmState(bool keep) {}
+
+    bool isLastLevel() { return last_level_; }
+
 
     /*********************************************************************************
      * Initialization/finish functions used by parent
@@ -153,6 +174,9 @@ public:
         max_outstanding_prefetch_ = max_out_prefetches;
     }
 
+    /* Set prefetch throttle - owned by the controller. Not serialized, controller resets it on restart */
+    void setPrefetchThrottle(PrefetchThrottle* throttle) { throttle_ = throttle; }
+
     /* Set MSHR */
     void setMSHR(MSHR* ptr) { mshr_ = ptr; }
 
@@ -183,6 +207,12 @@ public:
 
     virtual void printDebugInfo();
 
+    /* Pass the instruction pointer of the event about to be handled to replacement policies that use it */
+    void setInstructionPointer(Addr ip) {
+        for (auto& policy : ip_replacement_)
+            policy->setInstructionPointer(ip);
+    }
+
     /*********************************************************************************
      * Statistics functions shared by parent
      *
@@ -212,8 +242,8 @@ protected:
      *********************************************************************************/
 
     /* Listener callbacks */
-    virtual void notifyListenerOfAccess(MemEvent * event, NotifyAccessType access_type, NotifyResultType result_type);
-    virtual void notifyListenerOfEvict(Addr addr, uint32_t size, uint64_t ip);
+    virtual void notifyListenerOfAccess(MemEvent * event, NotifyAccessType access_type, NotifyResultType result_type, const vector<uint8_t>* data = nullptr);
+    virtual void notifyListenerOfEvict(Addr addr, uint32_t size, uint64_t ip, MemEvent* cause = nullptr);
 
     /* Forward a message to a lower memory level (towards memory) */
     uint64_t forwardMessage(MemEvent * event, unsigned int request_size, uint64_t base_time, vector<uint8_t>* data, Command forward_command = Command::LAST_CMD);
@@ -293,6 +323,81 @@ protected:
     /* Initialization */
     ReplacementPolicy * createReplacementPolicy(uint64_t lines, uint64_t assoc, Params& params, bool L1, int slotnum = 0);
     HashFunction * createHashFunction(Params& params);
+    unsigned int createCompressor(Params& params);
+    uint32_t getSectorSize(Params& params); // 0 if lines are not sectored
+
+    /* MSHR address for a request. Managers with sectored lines key the MSHR by line, since a line holds
+     * requests for several smaller blocks (see sector_line_mask_) */
+    Addr mshrAddr(Addr addr) { return sector_line_mask_ ? (addr & sector_line_mask_) : addr; }
+
+    /* Functional warmup helpers. Managers implement warmupLine() using warmupArray() */
+    struct WarmupVictim {
+        bool valid = false;
+        Addr addr = 0;
+        Command cmd = Command::NULLCMD;
+    };
+    virtual bool warmupLine(MemEvent* event, WarmupVictim& victim);
+
+    /* Look up the line in 'array'. On a miss, if 'allocate', replace an idle victim and fill in 'fill_state' (requests)
+     * or the state implied by the writeback. 'evict' is called on the victim before it is replaced */
+    template <class T, class EvictFn>
+    bool warmupArray(CacheArray<T>* array, MemEvent* event, bool allocate, State fill_state, WarmupVictim& victim, EvictFn evict) {
+        Addr addr = event->getBaseAddr();
+        Command cmd = event->getCmd();
+
+        T* line = array->lookup(addr, true);
+        bool hit = (line != nullptr);
+        if (!line) {
+            if (!allocate)
+                return false;
+            line = array->findReplacementCandidate(addr);
+            State vstate = line->getState();
+            if (!isWarmupStable(vstate) || vstate == M || (vstate != I && mshr_->exists(line->getAddr())))
+                return false; // Victim is busy with or dirty from a timed request, don't install
+            if (vstate != I) {
+                victim.valid = true;
+                victim.addr = line->getAddr();
+                victim.cmd = (vstate == E) ? Command::PutE : Command::PutS;
+                evict(line);
+            }
+            array->replace(addr, line);
+            if (cmd == Command::PutS)
+                line->setState(S);
+            else if (cmd == Command::PutE)
+                line->setState(E);
+            else
+                line->setState(fill_state);
+        }
+        return hit;
+    }
+    template <class T>
+    bool warmupArray(CacheArray<T>* array, MemEvent* event, bool allocate, State fill_state, WarmupVictim& victim) {
+        return warmupArray(array, event, allocate, fill_state, victim, [](T*) {});
+    }
+
+    /* Fill, if 'keep', or invalidate every idle clean line in 'array' */
+    template <class T>
+    void endWarmArray(CacheArray<T>* array, bool keep) {
+        for (auto it = array->begin(); it != array->end(); ++it) {
+            T* line = *it;
+            State state = line->getState();
+            if (state == I || state == M || !isWarmupStable(state) || mshr_->exists(line->getAddr()))
+                continue;
+            if (!keep || !fillWarmLine(line))
+                array->deallocate(line);
+        }
+    }
+
+    static bool fillWarmLine(CacheLine* line) {
+        if (!FunctionalMemory::read(line->getAddr(), *line->getData()))
+            return false;
+        line->getSectors()->setValid(line->getSectors()->all());
+        return true;
+    }
+    static bool fillWarmLine(DataLine* line) { return FunctionalMemory::read(line->getAddr(), *line->getData()); }
+    static bool fillWarmLine(DirectoryLine* line) { return true; }
+
+    static bool isWarmupStable(State state) { return state == I || state == S || state == E || state == M; }
 
     /*********************************************************************************
      * Data members
@@ -306,9 +411,11 @@ protected:
     size_t max_outstanding_prefetch_;
     size_t drop_prefetch_level_;
     size_t outstanding_prefetch_count_;
+    PrefetchThrottle* throttle_ = nullptr;
 
     /* Cache name - used for identifying where events came from/are going to */
     std::string cachename_;
+    EndpointID cacheid_;    // Interned cachename_, not serialized (process-local)
 
     /* Output & debug */
     Output* output_ = nullptr;   // Output stream for warnings, notices, fatal, etc.
@@ -324,6 +431,8 @@ protected:
 
     /* Cache parameters that are often needed by coherence managers */
     uint64_t line_size_;
+    LineCompressor* compressor_ = nullptr;  // Set if the cache array is compressed
+    Addr sector_line_mask_ = 0;     // Non-zero if requests smaller than a line share the line's MSHR entry
     bool writeback_clean_blocks_;   // Writeback clean data as opposed to just a coherence msg
     bool silent_evict_clean_;       // Silently evict clean blocks (currently ok when just mem below us)
     bool recv_writeback_ack_;       // Whether we should expect writeback acks
@@ -346,6 +455,9 @@ protected:
         }
     };
 
+    /* Replacement policies that want the instruction pointer of each event (see setInstructionPointer) */
+    std::vector<ReplacementPolicy*> ip_replacement_;
+
     /* Retry buffer - filled by coherence managers and drained by parent */
     std::vector<MemEventBase*> retry_buffer_;
 
@@ -96,15 +96,14 @@ bool CoherentMemController::clock(Cycle_t cycle) {
     timestamp_++;
 
     bool debug = false;
-    while (!msgQueue_.empty() && msgQueue_.begin()->first < timestamp_) {
-        MemEventBase * sendEv = msgQueue_.begin()->second;
+    MemEventBase * sendEv;
+    while (msgQueue_.pop(timestamp_ - 1, sendEv)) {
 
         if (mem_h_is_debug_event(sendEv)) {
             mem_h_debug_output(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Send    (%s)\n",
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), sendEv->getVerboseString(dlevel).c_str());
         }
         link_->send(sendEv);
-        msgQueue_.erase(msgQueue_.begin());
     }
 
     /* Unclock if nothing is in clocked queues anywhere (link, backend, here) */
@@ -297,7 +296,7 @@ void CoherentMemController::handleFlush(MemEvent * ev) {
                     MemEvent * resp = new MemEvent(ev->getSrc(), ev->getBaseAddr(), ev->getBaseAddr(), Command::AckInv);
                     if (ev->getPayloadSize() != 0) {
                         resp->setDirty(ev->getDirty());
-                        resp->setPayload(ev->getPayload());
+                        resp->setPayload(ev->getPayloadBuffer());
                         ev->setPayload(0, nullptr);
                         ev->setDirty(false);
                         handleFetchResp(resp);
@@ -318,7 +317,7 @@ void CoherentMemController::handleFlush(MemEvent * ev) {
 
     MemEvent* put = NULL;
     if (ev->getPayloadSize() != 0) {
-        put = new MemEvent(getName(), ev->getBaseAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayload());
+        put = new MemEvent(getName(), ev->getBaseAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayloadBuffer());
         put->setFlag(MemEvent::F_NORESPONSE);
         outstandingEventList_.insert(std::make_pair(put->getID(), OutstandingEvent(put, put->getBaseAddr())));
         notifyListeners(ev);
@@ -403,7 +402,7 @@ void CoherentMemController::handleFetchResp(MemEvent * ev) {
 
     // Write dirty data if needed
     if (ev->getDirty()) {
-        MemEvent * write = new MemEvent(getName(), ev->getAddr(), baseAddr, Command::PutM, ev->getPayload());
+        MemEvent * write = new MemEvent(getName(), ev->getAddr(), baseAddr, Command::PutM, ev->getPayloadBuffer());
         write->copyMetadata(ev);
         ev->setFlag(MemEvent::F_NORESPONSE);
 
@@ -450,7 +449,7 @@ void CoherentMemController::handleNack(MemEvent * ev) {
         uint64_t backoff = (0x1 << retries);
         nackedEvent->incrementRetries();
 
-        msgQueue_.insert(std::make_pair(timestamp_ + backoff, nackedEvent));
+        msgQueue_.insert(timestamp_ + backoff, nackedEvent);
     } else {
         delete nackedEvent;
     }
@@ -505,7 +504,7 @@ bool CoherentMemController::doShootdown(Addr addr, MemEventBase * ev) {
         inv->copyMetadata(ev);
         inv->setDst(ev->getSrc());
 
-        msgQueue_.insert(std::make_pair(timestamp_, inv)); /* Send on next clock. TODO timing needed? */
+        msgQueue_.insert(timestamp_, inv); /* Send on next clock. TODO timing needed? */
         return true;
     }
     return false;
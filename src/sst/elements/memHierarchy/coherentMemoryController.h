@@ -31,6 +31,7 @@
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
+#include "sst/elements/memHierarchy/timingWheel.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -93,7 +94,7 @@ private:
 
     // Outgoing event handling
     Cycle_t timestamp_;
-    std::multimap<uint64_t, MemEventBase*> msgQueue_;
+    TimingWheel<MemEventBase*> msgQueue_;
 
     // Caching information
     bool directory_; /* Whether directory is above us, i.e., whether a PutM indicates block is no longer cached or not */
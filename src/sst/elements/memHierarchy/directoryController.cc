@@ -19,6 +19,8 @@
 
 #include <sst/core/params.h>
 
+#include <algorithm>
+
 #include "memNIC.h"
 
 /* Debug macros included from util.h */
@@ -36,6 +38,7 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     lineSize = cacheLineSize;
 
     dbg.init("", debugLevel, 0, (Output::output_location_t)params.find<int>("debug", 0));
+    dirID = EndpointTable::intern(getName());
 
     // Detect deprecated parameters and warn/fatal
     bool found;
@@ -257,6 +260,16 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
         clockLinkDown_ = false;
     clockLinkUp_ = linkUp_->isClocked();
 
+    std::string slicePolicy = params.find<std::string>("slice_allocation_policy", "rr");
+    if (slicePolicy == "xor") {
+        uint32_t sliceHashBits = params.find<uint32_t>("slice_hash_bits", 32);
+        if (sliceHashBits == 0 || sliceHashBits > 64)
+            dbg.fatal(CALL_INFO, -1, "Invalid param(%s): slice_hash_bits - must be between 1 and 64. You specified %" PRIu32 "\n", getName().c_str(), sliceHashBits);
+        linkUp_->setSliceHash(sliceHashBits);
+    } else if (slicePolicy != "rr") {
+        dbg.fatal(CALL_INFO, -1, "Invalid param(%s): slice_allocation_policy - supported policies are 'rr' (round-robin) and 'xor' (XOR slice hash). You specified '%s'\n", getName().c_str(), slicePolicy.c_str());
+    }
+
     // Requests per cycle
     maxRequestsPerCycle = params.find<int>("max_requests_per_cycle", 0);
 
@@ -336,6 +349,9 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     stat_dirEntryReads              = registerStatistic<uint64_t>("eventSent_read_directory_entry");
     stat_dirEntryWrites             = registerStatistic<uint64_t>("eventSent_write_directory_entry");
     stat_MSHROccupancy              = registerStatistic<uint64_t>("MSHR_occupancy");
+    stat_entriesReclaimed           = registerStatistic<uint64_t>("entries_reclaimed");
+    stat_entryBytesReclaimed        = registerStatistic<uint64_t>("entry_bytes_reclaimed");
+    stat_sparseEvictions            = registerStatistic<uint64_t>("sparse_evictions");
 
     // Coherence part
 
@@ -347,6 +363,22 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     entryCacheSize = 0;
     entrySize = 4; // Bytes, TODO parameterize
 
+    reclaimEntries = params.find<bool>("reclaim_invalid_entries", false);
+    uint64_t sparseEntries = params.find<uint64_t>("sparse_entries", 0);
+    sparseAssoc = 0;
+    sparseSets = 0;
+    sparseTime = 0;
+    if (sparseEntries != 0) {
+        sparseAssoc = params.find<uint32_t>("sparse_associativity", 8);
+        if (sparseAssoc == 0 || sparseEntries % sparseAssoc != 0)
+            dbg.fatal(CALL_INFO, -1, "Invalid param(%s): sparse_associativity - must be non-zero and evenly divide sparse_entries. You specified sparse_entries=%" PRIu64 ", sparse_associativity=%" PRIu32 "\n",
+                    getName().c_str(), sparseEntries, sparseAssoc);
+        sparseSets = sparseEntries / sparseAssoc;
+        sparseTags.assign(sparseEntries, NO_SPARSE_TAG);
+        sparseStamps.assign(sparseEntries, 0);
+        reclaimEntries = true;
+    }
+
     string protstr  = params.find<std::string>("coherence_protocol", "MESI");
     if (protstr == "mesi" || protstr == "MESI") protocol = CoherenceProtocol::MESI;
     else if (protstr == "msi" || protstr == "MSI") protocol = CoherenceProtocol::MSI;
@@ -366,10 +398,12 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
 
 
 DirectoryController::~DirectoryController(){
-    for(std::unordered_map<Addr, DirEntry*>::iterator i = directory.begin(); i != directory.end() ; ++i){
-        delete i->second;
-    }
     directory.clear();
+    for (std::map<DirEntry*, size_t>::iterator it = entrySlabs.begin(); it != entrySlabs.end(); it++) {
+        delete [] it->first;
+    }
+    entrySlabs.clear();
+    freeEntries.clear();
 }
 
 
@@ -381,6 +415,12 @@ void DirectoryController::handlePacket(SST::Event *event){
         turnClockOn();
     }
 
+    /* Functional warmup copies from caches are not tracked by the directory */
+    if (evb->queryFlag(MemEventBase::F_WARMUP)) {
+        delete evb;
+        return;
+    }
+
     /* Forward events that we don't handle */
     if (MemEventTypeArr[(int)evb->getCmd()] != MemEventType::Cache || evb->queryFlag(MemEvent::F_NONCACHEABLE)) {
 
@@ -588,8 +628,11 @@ bool DirectoryController::processPacket(MemEvent * ev, bool replay) {
     if (dbgevent)
         printDebugInfo();
 
-    if (retval)
+    if (retval) {
         addrsThisCycle.insert(addr);
+        if (reclaimEntries)
+            finishDirEntry(addr);
+    }
 
     return retval;
 }
@@ -603,11 +646,11 @@ bool DirectoryController::arbitrateAccess(Addr addr) {
 
 void DirectoryController::handleNoncacheableRequest(MemEventBase * ev) {
     if (!(ev->queryFlag(MemEventBase::F_NORESPONSE))) {
-        noncacheMemReqs[ev->getID()] = ev->getSrc();
+        noncacheMemReqs[ev->getID()] = ev->getSrcID();
     }
     stat_noncacheRecv[(int)ev->getCmd()]->addData(1);
 
-    ev->setSrc(getName());
+    ev->setSrcID(dirID);
     forwardByAddress(ev, timestamp + 1);
 }
 
@@ -617,8 +660,8 @@ void DirectoryController::handleNoncacheableResponse(MemEventBase * ev) {
         dbg.fatal(CALL_INFO, -1, "%s, Error: Received a noncacheable response that does not match a pending request. Event: %s\n. Time: %" PRIu64 "ns\n",
                 getName().c_str(), ev->getVerboseString(dlevel).c_str(), getCurrentSimTimeNano());
     }
-    ev->setDst(noncacheMemReqs[ev->getID()]);
-    ev->setSrc(getName());
+    ev->setDstID(noncacheMemReqs[ev->getID()]);
+    ev->setSrcID(dirID);
 
     stat_noncacheRecv[(int)ev->getCmd()]->addData(1);
 
@@ -630,6 +673,9 @@ void DirectoryController::handleNoncacheableResponse(MemEventBase * ev) {
 void DirectoryController::printStatus(Output &statusOut) {
     statusOut.output("MemHierarchy::DirectoryController %s\n", getName().c_str());
     statusOut.output("  Cached entries: %" PRIu64 "\n", entryCacheSize);
+    statusOut.output("  Live entries: %zu (%zu bytes), pooled: %zu\n", directory.size(), directory.size() * sizeof(DirEntry), freeEntries.size());
+    if (sparseAssoc != 0)
+        statusOut.output("  Sparse directory: %" PRIu64 " sets x %" PRIu32 " ways\n", sparseSets, sparseAssoc);
     statusOut.output("  Requests waiting to be handled:  %zu\n", eventBuffer.size());
 //    for(std::list<std::pair<MemEvent*,bool> >::iterator i = workQueue.begin() ; i != workQueue.end() ; ++i){
 //        statusOut.output("    %s, %s\n", i->first->getVerboseString(dlevel).c_str(), i->second ? "replay" : "new");
@@ -652,7 +698,7 @@ void DirectoryController::printStatus(Output &statusOut) {
 
     statusOut.output("  Directory entries:\n");
     for (std::unordered_map<Addr, DirEntry*>::iterator it = directory.begin(); it != directory.end(); it++) {
-        statusOut.output("    0x%" PRIx64 " %s\n", it->first, it->second->getString().c_str());
+        statusOut.output("    0x%" PRIx64 " %s\n", it->first, it->second->getString(endpointNames).c_str());
     }
     statusOut.output("End MemHierarchy::DirectoryController\n\n");
 }
@@ -688,6 +734,11 @@ void DirectoryController::init(unsigned int phase) {
     linkUp_->init(phase);
     if (linkUp_ != linkDown_) linkDown_->init(phase);
 
+    // Number the sources as they are discovered so sharer vectors are dense
+    std::set<MemLinkBase::EndpointInfo>* sources = linkUp_->getSources();
+    for (auto it = sources->begin(); it != sources->end(); it++) {
+        getEndpointIndex(EndpointTable::intern(it->name));
+    }
 
     // Must happen after network init or merlin croaks
     // InitData: Name, NULLCMD, Endpoint type, inclusive of all upper levels, will send writeback acks, line size
@@ -707,11 +758,11 @@ void DirectoryController::init(unsigned int phase) {
                 if (mEv->getType() == Endpoint::Scratchpad)
                     waitWBAck = true;
                 if (!(mEv->getTracksPresence()) && linkUp_->isSource(mEv->getSrc())) {
-                    incoherentSrc.insert(mEv->getSrc());
+                    incoherentSrc.insert(mEv->getSrcID());
                 }
             } else if (ev->getInitCmd() == MemEventInit::InitCommand::Endpoint) {
                 MemEventInit * mEv = ev->clone();
-                mEv->setSrc(getName());
+                mEv->setSrcID(dirID);
                 linkDown_->sendUntimedData(mEv);
             }
             delete ev;
@@ -724,12 +775,12 @@ void DirectoryController::init(unsigned int phase) {
                             getName().c_str(), ev->getAddr());
                     if (ev->getCmd() == Command::GetS) // Will need to route a response back to sender
                         init_requests_.insert(std::make_pair(ev->getID(), ev->getSrc()));
-                    ev->setSrc(getName());
+                    ev->setSrcID(dirID);
                     linkDown_->sendUntimedData(ev, false);
                 } else
                     delete ev;
             } else {
-                ev->setSrc(getName());
+                ev->setSrcID(dirID);
                 ev->setDst(init_requests_.find(ev->getID())->second);
                 init_requests_.erase(ev->getID());
                 linkDown_->sendUntimedData(ev, false, false);
@@ -748,7 +799,7 @@ void DirectoryController::init(unsigned int phase) {
                         waitWBAck = true;
                 } else if (ev->getInitCmd() == MemEventInit::InitCommand::Endpoint) {
                     MemEventInit * mEv = ev->clone();
-                    mEv->setSrc(getName());
+                    mEv->setSrcID(dirID);
                     linkUp_->sendUntimedData(mEv);
                 }
                 delete ev;
@@ -757,11 +808,11 @@ void DirectoryController::init(unsigned int phase) {
                     if (isRequestAddressValid(ev->getAddr())) {
                         if (ev->getCmd() == Command::GetS) // Will need to route a response back to sender
                             init_requests_.insert(std::make_pair(ev->getID(), ev->getSrc()));
-                        ev->setSrc(getName());
+                        ev->setSrcID(dirID);
                         linkUp_->sendUntimedData(ev, false);
                     } else delete ev;
                 } else {    // Response
-                    ev->setSrc(getName());
+                    ev->setSrcID(dirID);
                     ev->setDst(init_requests_.find(ev->getID())->second);
                     init_requests_.erase(ev->getID());
                     linkUp_->sendUntimedData(ev, false, false);
@@ -827,6 +878,23 @@ void DirectoryController::setup(void){
 }
 
 
+/*
+ * Return the dense index for an endpoint, assigning a new one if the endpoint has not been seen.
+ * Sources are numbered during init(); late-discovered endpoints get the next free index.
+ */
+uint32_t DirectoryController::getEndpointIndex(EndpointID id) {
+    if (id < endpointIndex.size() && endpointIndex[id] != NO_ENDPOINT_INDEX)
+        return endpointIndex[id];
+
+    if (id >= endpointIndex.size())
+        endpointIndex.resize(id + 1, NO_ENDPOINT_INDEX);
+    uint32_t index = endpointIDs.size();
+    endpointIDs.push_back(id);
+    endpointNames.push_back(EndpointTable::name(id));
+    endpointIndex[id] = index;
+    return index;
+}
+
 void DirectoryController::processCompleteEvent(MemEventInit* event) {
     if (event->getInitCmd() == MemEventInit::InitCommand::Flush) {
         MemEventUntimedFlush* flush = static_cast<MemEventUntimedFlush*>(event);
@@ -842,7 +910,7 @@ void DirectoryController::processCompleteEvent(MemEventInit* event) {
         }
         delete event;
     } else if (event->getCmd() == Command::Write ) {
-        event->setSrc(getName());
+        event->setSrcID(dirID);
         linkDown_->sendUntimedData(event, false, true);
     } else {
         delete event; // Nothing for now
@@ -869,7 +937,7 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -886,17 +954,17 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
                 if (!inMSHR)
                     out.output("ALERT (%s): mshr should NOT have data for 0x%" PRIx64 " but it does...\n", getName().c_str(), addr);
                 else {
-                    if (incoherentSrc.find(event->getSrc()) != incoherentSrc.end()) {
-                        sendDataResponse(event, entry, mshr->getData(addr), Command::GetSResp);
+                    if (incoherentSrc.find(event->getSrcID()) != incoherentSrc.end()) {
+                        sendDataResponse(event, entry, mshr->getDataBuffer(addr), Command::GetSResp);
                     } else if (protocol == CoherenceProtocol::MESI) {
                         entry->setState(M);
-                        entry->setOwner(event->getSrc());
-                        sendDataResponse(event, entry, mshr->getData(addr), Command::GetXResp);
+                        entry->setOwner(getEndpointIndex(event->getSrcID()));
+                        sendDataResponse(event, entry, mshr->getDataBuffer(addr), Command::GetXResp);
                         mshr->clearData(addr);
                     } else {
                         entry->setState(S);
-                        entry->addSharer(event->getSrc());
-                        sendDataResponse(event, entry, mshr->getData(addr), Command::GetSResp);
+                        entry->addSharer(getEndpointIndex(event->getSrcID()));
+                        sendDataResponse(event, entry, mshr->getDataBuffer(addr), Command::GetSResp);
                     }
                     if (mem_h_is_debug_event(event)) {
                         eventDI.reason = "hit";
@@ -917,10 +985,10 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
             break;
         case S:
             if (mshr->hasData(addr)) { // saved from earlier request
-                if (incoherentSrc.find(event->getSrc()) == incoherentSrc.end()) {
-                    entry->addSharer(event->getSrc());
+                if (incoherentSrc.find(event->getSrcID()) == incoherentSrc.end()) {
+                    entry->addSharer(getEndpointIndex(event->getSrcID()));
                 }
-                sendDataResponse(event, entry, mshr->getData(addr), Command::GetSResp);
+                sendDataResponse(event, entry, mshr->getDataBuffer(addr), Command::GetSResp);
                 if (mem_h_is_debug_event(event)) {
                     eventDI.reason = "hit";
                     eventDI.action = "Done";
@@ -955,7 +1023,7 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -981,7 +1049,7 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -998,16 +1066,16 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
                 if (!inMSHR) {
                     out.output("ALERT (%s): mshr should NOT have data for 0x%" PRIx64 " but it does...\n", getName().c_str(), addr);
                 } else {
-                    if (incoherentSrc.find(event->getSrc()) == incoherentSrc.end()) {
+                    if (incoherentSrc.find(event->getSrcID()) == incoherentSrc.end()) {
                         entry->setState(M);
-                        entry->setOwner(event->getSrc());
+                        entry->setOwner(getEndpointIndex(event->getSrcID()));
                     }
 
-                    auto data = mshr->getData(addr);
+                    const LineBuffer& data = mshr->getDataBuffer(addr);
                     std::stringstream value;
                     value << std::hex << std::setfill('0');
                     for (unsigned int i = 0; i < data.size(); i++) {
-                        value << std::hex << std::setw(2) << (int)data.at(i);
+                        value << std::hex << std::setw(2) << (int)data[i];
                     }
 
                     dbg.debug(_L11_, "V: %-20" PRIu64 " %-20" PRIu64 " %-20s %-13s 0x%-16" PRIx64 " B: %-3zu %s\n",
@@ -1037,13 +1105,13 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
             // Upgrade request and no other sharers -> respond & M
             // Upgrade request and other sharers -> invalidate other sharers & S_Inv
             // Otherwise need data & invalidate sharers -> invalidate other sharers, request data from Memory, SM_Inv
-            if (entry->isSharer(event->getSrc())) { // Don't need data
+            if (entry->isSharer(getEndpointIndex(event->getSrcID()))) { // Don't need data
                 if (entry->getSharerCount() == 1) { // Also don't need to invalidate
                     if (mshr->hasData(addr))
                         mshr->clearData(addr);
                     entry->setState(M);
-                    entry->removeSharer(event->getSrc());
-                    entry->setOwner(event->getSrc());
+                    entry->removeSharer(getEndpointIndex(event->getSrcID()));
+                    entry->setOwner(getEndpointIndex(event->getSrcID()));
                     sendResponse(event);
                     if (mem_h_is_debug_event(event)) {
                         eventDI.reason = "hit";
@@ -1096,7 +1164,7 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     if (status == MemEventStatus::Reject)
@@ -1121,7 +1189,7 @@ bool DirectoryController::handleWrite(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -1186,7 +1254,7 @@ bool DirectoryController::handleWrite(MemEvent * event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     if (status == MemEventStatus::Reject)
@@ -1209,7 +1277,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -1235,8 +1303,8 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (event->getEvict()) {
                     entry->removeOwner();
-                    entry->addSharer(event->getSrc());
-                    mshr->setData(addr, event->getPayload(), event->getDirty());
+                    entry->addSharer(getEndpointIndex(event->getSrcID()));
+                    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                     event->setEvict(false);
                 } else if (entry->hasOwner()) {
                     issueFetch(event, entry, Command::FetchInvX);
@@ -1250,8 +1318,8 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
         case M_Inv:
             if (event->getEvict()) {
                 entry->removeOwner();
-                entry->addSharer(event->getSrc());
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                entry->addSharer(getEndpointIndex(event->getSrcID()));
+                mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 event->setEvict(false);
                 entry->setState(S_Inv);
             }
@@ -1259,11 +1327,11 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
         case M_InvX:
             if (event->getEvict()) {
                 entry->removeOwner();
-                entry->addSharer(event->getSrc());
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                entry->addSharer(getEndpointIndex(event->getSrcID()));
+                mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 entry->setState(S);
                 mshr->decrementAcksNeeded(addr);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 retryBuffer.push_back(static_cast<MemEvent*>(mshr->getFrontEvent(addr)));
             }
@@ -1277,7 +1345,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -1298,7 +1366,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -1316,7 +1384,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case S:
             if (status == MemEventStatus::OK) {
                 if (event->getEvict()) {
-                    entry->removeSharer(event->getSrc());
+                    entry->removeSharer(getEndpointIndex(event->getSrcID()));
                     event->setEvict(false);
                 }
 
@@ -1333,7 +1401,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (event->getEvict()) {
                     entry->removeOwner();
-                    mshr->setData(addr, event->getPayload(), event->getDirty());
+                    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                     event->setEvict(false);
                 }
 
@@ -1348,7 +1416,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case S_D:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getEndpointIndex(event->getSrcID()));
                 event->setEvict(false);
                 if (!entry->hasSharers())
                     entry->setState(IS);
@@ -1356,7 +1424,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case S_B:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getEndpointIndex(event->getSrcID()));
                 event->setEvict(false);
                 if (!entry->hasSharers())
                     entry->setState(I);
@@ -1365,9 +1433,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case M_InvX:
             if (event->getEvict()) {
                 entry->removeOwner();
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
 
                 if (mshr->decrementAcksNeeded(addr)) {
@@ -1378,9 +1446,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case SD_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getEndpointIndex(event->getSrcID()));
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->hasSharers() ? entry->setState(S_D) : entry->setState(IS);
@@ -1390,9 +1458,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case SM_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getEndpointIndex(event->getSrcID()));
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->setState(IM);
@@ -1401,9 +1469,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case S_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getEndpointIndex(event->getSrcID()));
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->hasSharers() ? entry->setState(S) : entry->setState(I);
@@ -1413,9 +1481,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case M_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getEndpointIndex(event->getSrcID()));
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcID());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->setState(I);
@@ -1433,7 +1501,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -1463,9 +1531,9 @@ bool DirectoryController::handleFlushAll(MemEvent * event, bool inMSHR) {
             /* Broadcast request up, transition to FlushState::Forward */
             std::set<MemLinkBase::EndpointInfo>* sources = linkUp_->getSources();
             for (auto it = sources->begin(); it != sources->end(); it++) {
-                MemEvent* bcast_event = new MemEvent(getName(), Command::ForwardFlush);
+                MemEvent* bcast_event = new MemEvent(dirID, Command::ForwardFlush);
                 bcast_event->copyMetadata(event);
-                bcast_event->setSrc(getName());
+                bcast_event->setSrcID(dirID);
                 bcast_event->setDst(it->name);
                 forwardByDestination(bcast_event, timestamp + mshrLatency);
             }
@@ -1480,9 +1548,9 @@ bool DirectoryController::handleFlushAll(MemEvent * event, bool inMSHR) {
             sendResponse(event);
             std::set<MemLinkBase::EndpointInfo>* sources = linkUp_->getSources();
             for (auto it = sources->begin(); it != sources->end(); it++) {
-                MemEvent* bcast_event = new MemEvent(getName(), Command::UnblockFlush);
+                MemEvent* bcast_event = new MemEvent(dirID, Command::UnblockFlush);
                 bcast_event->copyMetadata(event);
-                bcast_event->setSrc(getName());
+                bcast_event->setSrcID(dirID);
                 bcast_event->setDst(it->name);
                 forwardByDestination(bcast_event, timestamp + mshrLatency);
             }
@@ -1514,7 +1582,7 @@ bool DirectoryController::handlePutS(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -1522,11 +1590,11 @@ bool DirectoryController::handlePutS(MemEvent * event, bool inMSHR) {
     if (!inMSHR)
         stat_cacheHits->addData(1);
 
-    entry->removeSharer(event->getSrc());
+    entry->removeSharer(getEndpointIndex(event->getSrcID()));
     sendAckPut(event);
 
-    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
-        responses.find(addr)->second.erase(event->getSrc());
+    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrcID()) != responses.find(addr)->second.end()) {
+        responses.find(addr)->second.erase(event->getSrcID());
         if (responses.find(addr)->second.empty()) responses.erase(addr);
     }
 
@@ -1573,7 +1641,7 @@ bool DirectoryController::handlePutS(MemEvent * event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     if (update)
@@ -1596,7 +1664,7 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -1605,7 +1673,7 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
         stat_cacheHits->addData(1);
 
     entry->removeOwner();
-    entry->addSharer(event->getSrc());
+    entry->addSharer(getEndpointIndex(event->getSrcID()));
 
     sendAckPut(event);
 
@@ -1619,14 +1687,14 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
             update = true;
             break;
         case M_Inv:
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(S_Inv);
             break;
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(S);
             break;
         default:
@@ -1636,7 +1704,7 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     cleanUpAfterRequest(event, inMSHR);
@@ -1658,7 +1726,7 @@ bool DirectoryController::handlePutE(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -1679,9 +1747,9 @@ bool DirectoryController::handlePutE(MemEvent * event, bool inMSHR) {
         case M_Inv:
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(I);
             break;
         default:
@@ -1691,7 +1759,7 @@ bool DirectoryController::handlePutE(MemEvent * event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     cleanUpAfterRequest(event, inMSHR);
@@ -1713,7 +1781,7 @@ bool DirectoryController::handlePutM(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -1735,9 +1803,9 @@ bool DirectoryController::handlePutM(MemEvent * event, bool inMSHR) {
         case M_Inv:
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcID());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(I);
             break;
         default:
@@ -1747,7 +1815,7 @@ bool DirectoryController::handlePutM(MemEvent * event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     cleanUpAfterRequest(event, inMSHR);
@@ -1771,7 +1839,7 @@ bool DirectoryController::handleFetchInv(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -1861,7 +1929,7 @@ bool DirectoryController::handleFetchInv(MemEvent * event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     if (status == MemEventStatus::Reject)
@@ -1885,7 +1953,7 @@ bool DirectoryController::handleForceInv(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR);
         if (mem_h_is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = entry->getString(endpointNames);
         }
         return ret;
     }
@@ -1910,7 +1978,7 @@ bool DirectoryController::handleForceInv(MemEvent * event, bool inMSHR) {
             if (!inMSHR)
                 status = allocateMSHR(event, true, 0);
             if (status == MemEventStatus::OK) {
-                issueInvalidation(entry->getOwner(), event, entry, Command::ForceInv);
+                issueInvalidation(endpointIDs[entry->getOwner()], event, entry, Command::ForceInv);
                 entry->setState(M_Inv);
             }
             break;
@@ -1970,7 +2038,7 @@ bool DirectoryController::handleForceInv(MemEvent * event, bool inMSHR) {
         sendNACK(event);
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -1993,22 +2061,22 @@ bool DirectoryController::handleGetSResp(MemEvent * event, bool inMSHR) {
         out.fatal(CALL_INFO, -1, "%s, Error: Received GetSResp in unhandled state '%s'. Event: %s. Time: %" PRIu64 "ns\n",
                 getName().c_str(), StateString[state], event->getVerboseString(dlevel).c_str(), getCurrentSimTimeNano());
     }
-    if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
+    if (incoherentSrc.find(reqEv->getSrcID()) == incoherentSrc.end()) {
         entry->setState(S);
-        entry->addSharer(reqEv->getSrc());
+        entry->addSharer(getEndpointIndex(reqEv->getSrcID()));
     } else if (state == IS) {
         entry->setState(I);
     } else {
         entry->setState(S);
     }
 
-    sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
-    mshr->setData(addr, event->getPayload(), false); // Save data for a subsequent GetS
+    sendDataResponse(reqEv, entry, event->getPayloadBuffer(), Command::GetSResp);
+    mshr->setData(addr, event->getPayloadBuffer(), false); // Save data for a subsequent GetS
     cleanUpAfterResponse(event, inMSHR);
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -2026,39 +2094,39 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
 
     switch (state) {
         case IS:
-            if (incoherentSrc.find(reqEv->getSrc()) != incoherentSrc.end()) {
+            if (incoherentSrc.find(reqEv->getSrcID()) != incoherentSrc.end()) {
                 entry->setState(I);
-                sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
+                sendDataResponse(reqEv, entry, event->getPayloadBuffer(), Command::GetSResp);
                 break;
             } else if (protocol == CoherenceProtocol::MESI) {
                 entry->setState(M);
-                entry->setOwner(reqEv->getSrc());
-                sendDataResponse(reqEv, entry, event->getPayload(), Command::GetXResp);
+                entry->setOwner(getEndpointIndex(reqEv->getSrcID()));
+                sendDataResponse(reqEv, entry, event->getPayloadBuffer(), Command::GetXResp);
                 break;
             }
         case S_D:
             entry->setState(S);
-            if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
-                entry->addSharer(reqEv->getSrc());
+            if (incoherentSrc.find(reqEv->getSrcID()) == incoherentSrc.end()) {
+                entry->addSharer(getEndpointIndex(reqEv->getSrcID()));
             }
-            sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
-            mshr->setData(addr, event->getPayload(), false); // So subsequent GetS can get data
+            sendDataResponse(reqEv, entry, event->getPayloadBuffer(), Command::GetSResp);
+            mshr->setData(addr, event->getPayloadBuffer(), false); // So subsequent GetS can get data
             break;
         case IM:
-            if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
+            if (incoherentSrc.find(reqEv->getSrcID()) == incoherentSrc.end()) {
                 entry->setState(M);
-                entry->setOwner(reqEv->getSrc());
+                entry->setOwner(getEndpointIndex(reqEv->getSrcID()));
             } else {
                 entry->setState(I);
             }
-            sendDataResponse(reqEv, entry, event->getPayload(), Command::GetXResp);
+            sendDataResponse(reqEv, entry, event->getPayloadBuffer(), Command::GetXResp);
             break;
         case SM_Inv:
             entry->setState(S_Inv);
-            mshr->setData(addr, event->getPayload(), false); // Save data for when the invalidations finish
+            mshr->setData(addr, event->getPayloadBuffer(), false); // Save data for when the invalidations finish
             if (mem_h_is_debug_addr(addr)) {
                 eventDI.newst = entry->getState();
-                eventDI.verboseline = entry->getString();
+                eventDI.verboseline = entry->getString(endpointNames);
             }
             delete event;
             return true;
@@ -2070,7 +2138,7 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
     cleanUpAfterResponse(event, inMSHR);
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -2098,7 +2166,7 @@ bool DirectoryController::handleWriteResp(MemEvent * event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -2131,7 +2199,7 @@ bool DirectoryController::handleFlushLineResp(MemEvent * event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     sendResponse(reqEv, event->getFlags(), event->getMemFlags());
@@ -2161,7 +2229,7 @@ bool DirectoryController::handleAckPut(MemEvent* event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     cleanUpAfterResponse(event, inMSHR);
@@ -2177,13 +2245,13 @@ bool DirectoryController::handleAckInv(MemEvent* event, bool inMSHR) {
     if (mem_h_is_debug_addr(addr))
         eventDI.prefill(event->getID(), Command::AckInv, false, addr, state);
 
-    if (entry->isSharer(event->getSrc()))
-        entry->removeSharer(event->getSrc());
+    if (entry->isSharer(getEndpointIndex(event->getSrcID())))
+        entry->removeSharer(getEndpointIndex(event->getSrcID()));
     else
         entry->removeOwner();
 
     bool done = mshr->decrementAcksNeeded(addr);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
     if (!done) {
@@ -2219,7 +2287,7 @@ bool DirectoryController::handleAckInv(MemEvent* event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -2238,13 +2306,13 @@ bool DirectoryController::handleFetchXResp(MemEvent* event, bool inMSHR) {
                 getName().c_str(), StateString[state], event->getVerboseString(dlevel).c_str(), getCurrentSimTimeNano());
 
     mshr->decrementAcksNeeded(addr);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
-    mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
+    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());       // Save data for retry
 
     entry->removeOwner();
-    entry->addSharer(event->getSrc());
+    entry->addSharer(getEndpointIndex(event->getSrcID()));
     entry->setState(S);
     retryBuffer.push_back(static_cast<MemEvent*>(mshr->getFrontEvent(addr)));
 
@@ -2252,7 +2320,7 @@ bool DirectoryController::handleFetchXResp(MemEvent* event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -2273,10 +2341,10 @@ bool DirectoryController::handleFetchResp(MemEvent* event, bool inMSHR) {
     MemEvent * reqEv = static_cast<MemEvent*>(mshr->getFrontEvent(addr));
 
     mshr->decrementAcksNeeded(addr);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcID());
     if (responses.find(addr)->second.empty())
         responses.erase(addr);
-    mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
+    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());       // Save data for retry
 
     entry->setState(I);
 
@@ -2289,7 +2357,7 @@ bool DirectoryController::handleFetchResp(MemEvent* event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -2322,8 +2390,8 @@ bool DirectoryController::handleNACK(MemEvent* event, bool inMSHR) {
         case Command::ForceInv:
             // Only retry if we still need the response)
             if (responses.find(addr) != responses.end()
-                    && responses.find(addr)->second.find(nackedEvent->getDst()) != responses.find(addr)->second.end()
-                    && responses.find(addr)->second.find(nackedEvent->getDst())->second == nackedEvent->getID())
+                    && responses.find(addr)->second.find(nackedEvent->getDstID()) != responses.find(addr)->second.end()
+                    && responses.find(addr)->second.find(nackedEvent->getDstID())->second == nackedEvent->getID())
                 break;
             delete nackedEvent;
             return true;
@@ -2336,7 +2404,7 @@ bool DirectoryController::handleNACK(MemEvent* event, bool inMSHR) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
 
     return true;
@@ -2375,7 +2443,7 @@ bool DirectoryController::handleDirEntryResponse(MemEvent* event) {
 
     if (mem_h_is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = entry->getString(endpointNames);
     }
     return true;
 }
@@ -2388,7 +2456,7 @@ DirectoryController::DirEntry* DirectoryController::getDirEntry(Addr addr) {
     std::unordered_map<Addr,DirEntry*>::iterator i = directory.find(addr);
 
     if (directory.end() == i) {
-        directory[addr] = new DirEntry(addr);
+        directory[addr] = allocateDirEntry(addr);
         i = directory.find(addr);
         i->second->cacheIter = entryCache.end();
         i->second->setCached(true);
@@ -2397,6 +2465,172 @@ DirectoryController::DirEntry* DirectoryController::getDirEntry(Addr addr) {
     return i->second;
 }
 
+DirectoryController::DirEntry* DirectoryController::allocateDirEntry(Addr addr) {
+    if (freeEntries.empty()) {
+        DirEntry* slab = new DirEntry[entrySlabSize];
+        entrySlabs.insert(std::make_pair(slab, 0));
+        for (size_t i = entrySlabSize; i > 0; i--)
+            freeEntries.push_back(&slab[i - 1]);
+    }
+    DirEntry* entry = freeEntries.back();
+    freeEntries.pop_back();
+    findEntrySlab(entry)->second++;
+    *entry = DirEntry(addr);
+    return entry;
+}
+
+/*
+ * Return an entry to the free list. A slab whose entries are all free is released
+ * as long as another slab's worth of free entries remains, so a directory hovering
+ * around a slab boundary does not repeatedly allocate and free the same slab.
+ */
+void DirectoryController::releaseDirEntry(DirEntry* entry) {
+    entry->sharerOverflow.clear();
+    entry->sharerOverflow.shrink_to_fit();
+    freeEntries.push_back(entry);
+
+    std::map<DirEntry*, size_t>::iterator slab = findEntrySlab(entry);
+    if (--slab->second != 0 || freeEntries.size() < 2 * entrySlabSize)
+        return;
+
+    DirEntry* begin = slab->first;
+    DirEntry* end = begin + entrySlabSize;
+    freeEntries.erase(std::remove_if(freeEntries.begin(), freeEntries.end(),
+                [begin, end](DirEntry* e) { return e >= begin && e < end; }), freeEntries.end());
+    delete [] begin;
+    entrySlabs.erase(slab);
+    stat_entryBytesReclaimed->addData(entrySlabSize * sizeof(DirEntry));
+}
+
+std::map<DirectoryController::DirEntry*, size_t>::iterator DirectoryController::findEntrySlab(DirEntry* entry) {
+    std::map<DirEntry*, size_t>::iterator it = entrySlabs.upper_bound(entry);
+    return --it;
+}
+
+/*
+ * Called after an event for 'addr' is handled when reclaim is enabled.
+ * An entry that is back in the default state (I, no sharers or owner, nothing in the MSHR)
+ * carries no information and is released. Otherwise, in sparse mode, a line with sharers
+ * or an owner must hold a slot in the sparse tag array.
+ */
+void DirectoryController::finishDirEntry(Addr addr) {
+    std::unordered_map<Addr,DirEntry*>::iterator it = directory.find(addr);
+    if (it == directory.end())
+        return;
+
+    DirEntry* entry = it->second;
+    if (entry->getState() == I && !entry->hasSharers() && !entry->hasOwner() && !mshr->exists(addr)) {
+        if (entry->cacheIter != entryCache.end()) {
+            entryCache.erase(entry->cacheIter);
+            --entryCacheSize;
+        }
+        directory.erase(it);
+        sparseRemove(addr);
+        releaseDirEntry(entry);
+        stat_entriesReclaimed->addData(1);
+        return;
+    }
+
+    if (sparseAssoc != 0 && (entry->hasSharers() || entry->hasOwner()))
+        sparseTrack(entry);
+}
+
+void DirectoryController::sparseTrack(DirEntry* entry) {
+    Addr addr = entry->getBaseAddr();
+    uint64_t setBegin = ((addr / lineSize) % sparseSets) * sparseAssoc;
+
+    int empty = -1;
+    for (uint32_t way = 0; way < sparseAssoc; way++) {
+        if (sparseTags[setBegin + way] == addr) {
+            sparseStamps[setBegin + way] = ++sparseTime;
+            return;
+        }
+        if (empty == -1 && sparseTags[setBegin + way] == NO_SPARSE_TAG)
+            empty = way;
+    }
+
+    if (empty == -1) {
+        // Evict the least recently used line that is in a stable state and not busy
+        uint64_t oldest = 0;
+        for (uint32_t way = 0; way < sparseAssoc; way++) {
+            Addr tag = sparseTags[setBegin + way];
+            std::unordered_map<Addr,DirEntry*>::iterator it = directory.find(tag);
+            if (it == directory.end()) {
+                empty = way;
+                break;
+            }
+            State state = it->second->getState();
+            if ((state != S && state != M) || !it->second->isCached() || mshr->exists(tag) || sparseEvicting.count(tag))
+                continue;
+            if (empty == -1 || sparseStamps[setBegin + way] < oldest) {
+                empty = way;
+                oldest = sparseStamps[setBegin + way];
+            }
+        }
+
+        // Every line in the set is busy; this line is picked up again the next time it is handled
+        if (empty == -1)
+            return;
+
+        // The victim keeps its way until its invalidation completes, then
+        // completeSparseEviction() hands the way to this line
+        Addr victim = sparseTags[setBegin + empty];
+        if (directory.find(victim) != directory.end()) {
+            MemEvent* inv = new MemEvent(dirID, victim, victim, Command::FetchInv, lineSize);
+            inv->setDstID(dirID);
+            eventBuffer.push_back(inv);
+            stat_sparseEvictions->addData(1);
+            sparseEvicting.insert(std::make_pair(victim, addr));
+            return;
+        }
+    }
+
+    sparseTags[setBegin + empty] = addr;
+    sparseStamps[setBegin + empty] = ++sparseTime;
+}
+
+void DirectoryController::sparseRemove(Addr addr) {
+    if (sparseAssoc == 0)
+        return;
+    uint64_t setBegin = ((addr / lineSize) % sparseSets) * sparseAssoc;
+    for (uint32_t way = 0; way < sparseAssoc; way++) {
+        if (sparseTags[setBegin + way] == addr) {
+            sparseTags[setBegin + way] = NO_SPARSE_TAG;
+            return;
+        }
+    }
+}
+
+/*
+ * Responses to a sparse eviction are addressed to this directory. A NACK means the MSHR was full
+ * so the eviction is retried; dirty data (normally already written back) goes to memory.
+ */
+void DirectoryController::completeSparseEviction(MemEventBase* ev) {
+    MemEvent* resp = static_cast<MemEvent*>(ev);
+    if (resp->getCmd() == Command::NACK) {
+        eventBuffer.push_back(resp->getNACKedEvent());
+        delete resp;
+        return;
+    }
+    if (resp->getCmd() == Command::FetchResp && resp->getDirty()) {
+        writebackData(resp);
+    }
+
+    // The victim's copies are gone, so its way goes to the line that was waiting for it
+    Addr victim = resp->getBaseAddr();
+    delete resp;
+    std::map<Addr, Addr>::iterator it = sparseEvicting.find(victim);
+    if (it == sparseEvicting.end())
+        return;
+    Addr waiting = it->second;
+    sparseEvicting.erase(it);
+    sparseRemove(victim);
+
+    std::unordered_map<Addr,DirEntry*>::iterator entry = directory.find(waiting);
+    if (entry != directory.end() && (entry->second->hasSharers() || entry->second->hasOwner()))
+        sparseTrack(entry->second);
+}
+
 bool DirectoryController::retrieveDirEntry(DirEntry* entry, MemEvent* event, bool inMSHR) {
     MemEventStatus status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
     if (status == MemEventStatus::Reject)
@@ -2424,7 +2658,7 @@ bool DirectoryController::retrieveDirEntry(DirEntry* entry, MemEvent* event, boo
                     getName().c_str(), StateString[state], entry->getBaseAddr(), getCurrentSimTimeNano());
     }
 
-    MemEvent* me = new MemEvent(getName(), 0, 0, Command::GetS, lineSize);
+    MemEvent* me = new MemEvent(dirID, 0, 0, Command::GetS, lineSize);
     me->setAddrGlobal(false);
     me->setSize(entrySize);
     dirMemAccesses.insert(std::make_pair(me->getID(), event->getBaseAddr()));
@@ -2432,7 +2666,7 @@ bool DirectoryController::retrieveDirEntry(DirEntry* entry, MemEvent* event, boo
     uint64_t deliveryTime = timestamp + accessLatency;
 
     // Bypass destination lookup
-    memMsgQueue.insert(std::make_pair(deliveryTime, MemMsg(me, true)));
+    memMsgQueue.insert(deliveryTime, MemMsg(me, true));
 
     return true;
 }
@@ -2506,7 +2740,9 @@ void DirectoryController::updateCache(DirEntry * entry) { // TODO replace with a
 
         if (entry->getState() == I) {
             directory.erase(entry->getBaseAddr());
-            delete entry;
+            sparseRemove(entry->getBaseAddr());
+            releaseDirEntry(entry);
+            stat_entriesReclaimed->addData(1);
             return;
         } else  {
             entryCache.push_front(entry);
@@ -2530,13 +2766,13 @@ void DirectoryController::updateCache(DirEntry * entry) { // TODO replace with a
 
 void DirectoryController::sendEntryToMemory(DirEntry *entry) {
     Addr entryAddr = 0;
-    MemEvent * me = new MemEvent(getName(), entryAddr, entryAddr, Command::PutE, lineSize);
+    MemEvent * me = new MemEvent(dirID, entryAddr, entryAddr, Command::PutE, lineSize);
     me->setSize(entrySize);
     me->setFlag(MemEventBase::F_NORESPONSE);
 
     uint64_t deliveryTime = timestamp + accessLatency;
     me->setDst(linkDown_->getTargetDestination(0));
-    memMsgQueue.insert(std::make_pair(deliveryTime, MemMsg(me, true)));
+    memMsgQueue.insert(deliveryTime, MemMsg(me, true));
 }
 
 /****************************
@@ -2545,7 +2781,7 @@ void DirectoryController::sendEntryToMemory(DirEntry *entry) {
 
 void DirectoryController::issueMemoryRequest(MemEvent* event, DirEntry* entry, bool lineGranularity) {
     MemEvent* reqEvent = new MemEvent(*event);
-    reqEvent->setSrc(getName());
+    reqEvent->setSrcID(dirID);
     if (lineGranularity)
         reqEvent->setSize(lineSize);
     uint64_t deliveryTime = timestamp + accessLatency;
@@ -2558,11 +2794,11 @@ void DirectoryController::issueMemoryRequest(MemEvent* event, DirEntry* entry, b
 void DirectoryController::issueFlush(MemEvent* event) {
     Addr addr = event->getBaseAddr();
     MemEvent * flush = new MemEvent(*event);
-    flush->setSrc(getName());
+    flush->setSrcID(dirID);
 
     if (mshr->hasData(addr) && mshr->getDataDirty(addr)) { // also writeback dirty data
         flush->setEvict(true);
-        flush->setPayload(mshr->getData(addr));
+        flush->setPayload(mshr->getDataBuffer(addr));
         flush->setDirty(true);
         mshr->clearData(addr); // Don't retain data
     } else {
@@ -2577,15 +2813,16 @@ void DirectoryController::issueFlush(MemEvent* event) {
 
 void DirectoryController::issueFetch(MemEvent* event, DirEntry* entry, Command cmd) {
     Addr addr = event->getBaseAddr();
-    MemEvent * fetch = new MemEvent(getName(), event->getAddr(), addr, cmd, lineSize);
-    fetch->setDst(entry->getOwner());
+    MemEvent * fetch = new MemEvent(dirID, event->getAddr(), addr, cmd, lineSize);
+    EndpointID owner = endpointIDs[entry->getOwner()];
+    fetch->setDstID(owner);
 
     if (responses.find(addr) == responses.end()) {
-        std::map<std::string,MemEvent::id_type> resp;
-        resp.insert(std::make_pair(entry->getOwner(), fetch->getID()));
+        std::map<EndpointID,MemEvent::id_type> resp;
+        resp.insert(std::make_pair(owner, fetch->getID()));
         responses.insert(std::make_pair(addr, resp));
     } else {
-        responses.find(addr)->second.insert(std::make_pair(entry->getOwner(), fetch->getID()));
+        responses.find(addr)->second.insert(std::make_pair(owner, fetch->getID()));
     }
 
     mshr->incrementAcksNeeded(addr);
@@ -2594,39 +2831,40 @@ void DirectoryController::issueFetch(MemEvent* event, DirEntry* entry, Command c
 }
 
 void DirectoryController::issueInvalidations(MemEvent* event, DirEntry* entry, Command cmd) {
-    std::string rqstr = (event->getSrc());
+    uint32_t rqstr = getEndpointIndex(event->getSrcID());
 
-    for (set<std::string>::iterator it = entry->getSharers()->begin(); it != entry->getSharers()->end(); it++) {
-        if (*it == rqstr) continue;
-        issueInvalidation(*it, event, entry, cmd);
+    for (uint32_t shr = entry->nextSharer(0); shr != DirEntry::NO_SHARER; shr = entry->nextSharer(shr + 1)) {
+        if (shr == rqstr) continue;
+        issueInvalidation(endpointIDs[shr], event, entry, cmd);
     }
 }
 
-void DirectoryController::issueInvalidation(std::string dst, MemEvent* event, DirEntry* entry, Command cmd) {
+void DirectoryController::issueInvalidation(EndpointID dst, MemEvent* event, DirEntry* entry, Command cmd) {
     Addr addr = entry->getBaseAddr();
-    MemEvent* inv = new MemEvent(getName(), addr, addr, cmd, lineSize);
+    MemEvent* inv = new MemEvent(dirID, addr, addr, cmd, lineSize);
     if (event) {
         inv->copyMetadata(event);
     } else {
-        inv->setRqstr(getName());
+        inv->setRqstrID(dirID);
     }
-    inv->setDst(dst);
+    inv->setDstID(dst);
 
     mshr->incrementAcksNeeded(addr);
 
+    EndpointID owner = entry->hasOwner() ? endpointIDs[entry->getOwner()] : EndpointTable::NONE_ID;
     if (responses.find(addr) == responses.end()) {
-        std::map<std::string,MemEvent::id_type> resp;
-        resp.insert(std::make_pair(entry->getOwner(), inv->getID()));
+        std::map<EndpointID,MemEvent::id_type> resp;
+        resp.insert(std::make_pair(owner, inv->getID()));
         responses.insert(std::make_pair(addr, resp));
     } else {
-        responses.find(addr)->second.insert(std::make_pair(entry->getOwner(), inv->getID()));
+        responses.find(addr)->second.insert(std::make_pair(owner, inv->getID()));
     }
 
     uint64_t deliveryTime = timestamp + accessLatency;
     forwardByDestination(inv, deliveryTime);
 }
 
-void DirectoryController::sendDataResponse(MemEvent* event, DirEntry* entry, std::vector<uint8_t>& data, Command cmd, uint32_t flags) {
+void DirectoryController::sendDataResponse(MemEvent* event, DirEntry* entry, const LineBuffer& data, Command cmd, uint32_t flags) {
     MemEvent * respEv = event->makeResponse(cmd);
     respEv->setSize(lineSize);
     respEv->setPayload(data);
@@ -2643,9 +2881,9 @@ void DirectoryController::sendResponse(MemEvent* event, uint32_t flags, uint32_t
 }
 
 void DirectoryController::writebackData(MemEvent* event) {
-    MemEvent * wb = new MemEvent(getName(), event->getBaseAddr(), event->getBaseAddr(), Command::PutM, lineSize);
+    MemEvent * wb = new MemEvent(dirID, event->getBaseAddr(), event->getBaseAddr(), Command::PutM, lineSize);
     wb->copyMetadata(event);
-    wb->setPayload(event->getPayload());
+    wb->setPayload(event->getPayloadBuffer());
     wb->setDirty(event->getDirty());
 
     if (waitWBAck)
@@ -2656,8 +2894,8 @@ void DirectoryController::writebackData(MemEvent* event) {
 }
 
 void DirectoryController::writebackDataFromMSHR(Addr addr) {
-    MemEvent * wb = new MemEvent(getName(), addr, addr, Command::PutM, lineSize);
-    wb->setPayload(mshr->getData(addr));
+    MemEvent * wb = new MemEvent(dirID, addr, addr, Command::PutM, lineSize);
+    wb->setPayload(mshr->getDataBuffer(addr));
     wb->setDirty(mshr->getDataDirty(addr));
     mshr->setDataDirty(addr, false);
 
@@ -2672,7 +2910,7 @@ void DirectoryController::sendFetchResponse(MemEvent * event) {
     Addr addr = event->getBaseAddr();
     MemEvent * ack = event->makeResponse();
 
-    ack->setPayload(mshr->getData(addr));
+    ack->setPayload(mshr->getDataBuffer(addr));
     ack->setDirty(mshr->getDataDirty(addr));
 
     mshr->clearData(addr);
@@ -2710,9 +2948,8 @@ void DirectoryController::sendNACK(MemEvent * event) {
 void DirectoryController::sendOutgoingEvents() {
 
     bool debugLine = false;
-    while (!cpuMsgQueue.empty() && cpuMsgQueue.begin()->first <= timestamp) {
-        MemEventBase * ev = cpuMsgQueue.begin()->second;
-
+    MemEventBase * ev;
+    while (cpuMsgQueue.pop(timestamp, ev)) {
         if (mem_h_is_debug_event(ev)) {
             dbg.debug(_L4_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Send    (%s)\n",
                     getCurrentSimCycle(), timestamp, getName().c_str(), ev->getBriefString().c_str());
@@ -2726,18 +2963,18 @@ void DirectoryController::sendOutgoingEvents() {
         }
         stat_eventSent[(int)ev->getCmd()]->addData(1);
         linkUp_->send(ev);
-        cpuMsgQueue.erase(cpuMsgQueue.begin());
     }
 
-    while (!memMsgQueue.empty() && memMsgQueue.begin()->first <= timestamp) {
-        MemEventBase * ev = memMsgQueue.begin()->second.event;
+    MemMsg msg;
+    while (memMsgQueue.pop(timestamp, msg)) {
+        ev = msg.event;
 
         if (mem_h_is_debug_event(ev)) {
             dbg.debug(_L4_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Send    (%s)\n",
                     getCurrentSimCycle(), timestamp, getName().c_str(), ev->getBriefString().c_str());
         }
 
-        if (memMsgQueue.begin()->second.dirAccess) {
+        if (msg.dirAccess) {
             if (ev->getCmd() == Command::GetS)
                 stat_dirEntryReads->addData(1);
             else
@@ -2746,7 +2983,6 @@ void DirectoryController::sendOutgoingEvents() {
             stat_eventSent[(int)ev->getCmd()]->addData(1);
         }
         linkDown_->send(ev);
-        memMsgQueue.erase(memMsgQueue.begin());
     }
 
 }
@@ -2755,15 +2991,15 @@ void DirectoryController::sendOutgoingEvents() {
  * dirAccess has default value of false
  */
 void DirectoryController::forwardByAddress(MemEventBase * ev, Cycle_t ts, bool dirAccess) {
-    std::string dst = linkDown_->findTargetDestination(ev->getRoutingAddress());
-    if (dst != "") { /* Common case */
-        ev->setDst(dst);
-        memMsgQueue.insert(std::make_pair(ts, MemMsg(ev, dirAccess)));
+    EndpointID dst = linkDown_->findTargetDestinationID(ev->getRoutingAddress());
+    if (dst != EndpointTable::NONE_ID) { /* Common case */
+        ev->setDstID(dst);
+        memMsgQueue.insert(ts, MemMsg(ev, dirAccess));
     } else {
-        dst = linkUp_->findTargetDestination(ev->getRoutingAddress());
-        if (dst != "") {
-            ev->setDst(dst);
-            cpuMsgQueue.insert(std::make_pair(ts, ev));
+        dst = linkUp_->findTargetDestinationID(ev->getRoutingAddress());
+        if (dst != EndpointTable::NONE_ID) {
+            ev->setDstID(dst);
+            cpuMsgQueue.insert(ts, ev);
         } else {
             std::string availableDests = "highlink:\n" + linkUp_->getAvailableDestinationsAsString();
             if (linkUp_ != linkDown_) availableDests = availableDests + "lowlink:\n" + linkDown_->getAvailableDestinationsAsString();
@@ -2777,10 +3013,12 @@ void DirectoryController::forwardByAddress(MemEventBase * ev, Cycle_t ts, bool d
  * dirAccess has default value of false
  */
 void DirectoryController::forwardByDestination(MemEventBase* ev, Cycle_t ts, bool dirAccess) {
-    if (linkUp_->isReachable(ev->getDst())) {
-        cpuMsgQueue.insert(std::make_pair(ts, ev));
-    } else if (linkDown_->isReachable(ev->getDst())) {
-        memMsgQueue.insert(std::make_pair(ts, MemMsg(ev, dirAccess)));
+    if (sparseAssoc != 0 && ev->getDstID() == dirID) {
+        completeSparseEviction(ev);
+    } else if (linkUp_->isReachable(ev->getDstID())) {
+        cpuMsgQueue.insert(ts, ev);
+    } else if (linkDown_->isReachable(ev->getDstID())) {
+        memMsgQueue.insert(ts, MemMsg(ev, dirAccess));
     } else {
         out.fatal(CALL_INFO, -1, "%s, Error: Destination %s appears unreachable on both links. Event: %s\n",
                 getName().c_str(), ev->getDst().c_str(), ev->getVerboseString(dlevel).c_str());
@@ -2840,9 +3078,12 @@ void DirectoryController::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(stat_dirEntryReads);
     SST_SER(stat_dirEntryWrites);
     SST_SER(stat_MSHROccupancy);
+    SST_SER(stat_entriesReclaimed);
+    SST_SER(stat_entryBytesReclaimed);
+    SST_SER(stat_sparseEvictions);
     SST_SER(eventBuffer);
     SST_SER(retryBuffer);
-    SST_SER(noncacheMemReqs);
+    EndpointTable::serialize(ser, noncacheMemReqs);
     SST_SER(addrsThisCycle);
     SST_SER(eventDI);
     SST_SER(evictDI);
@@ -2853,26 +3094,70 @@ void DirectoryController::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(dlevel);
     SST_SER(mshr);
     SST_SER(directory);
+    SST_SER(endpointNames);
+    if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+        // Endpoint IDs are only meaningful within a process
+        std::vector<std::string> names;
+        names.swap(endpointNames);
+        for (auto& name : names)
+            getEndpointIndex(EndpointTable::intern(name));
+    }
     SST_SER(cpuMsgQueue);
     SST_SER(memMsgQueue);
     SST_SER(entryCacheMaxSize);
     SST_SER(entryCacheSize);
     SST_SER(entrySize);
     SST_SER(entryCache);
+    SST_SER(reclaimEntries);
+    SST_SER(sparseSets);
+    SST_SER(sparseAssoc);
+    SST_SER(sparseTags);
+    SST_SER(sparseStamps);
+    SST_SER(sparseTime);
+    SST_SER(sparseEvicting);
+    EndpointTable::serialize(ser, dirID);
     SST_SER(lineSize);
     SST_SER(accessLatency);
     SST_SER(mshrLatency);
     SST_SER(flush_state_);
-    SST_SER(responses);
+    // responses is keyed by process-local endpoint IDs so save each address's map by name
+    size_t responseCount = responses.size();
+    SST_SER(responseCount);
+    if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+        for (size_t i = 0; i < responseCount; i++) {
+            Addr addr;
+            SST_SER(addr);
+            EndpointTable::serialize(ser, responses[addr]);
+        }
+    } else if (ser.mode() != SST::Core::Serialization::serializer::MAP) {
+        for (auto& it : responses) {
+            Addr addr = it.first;
+            SST_SER(addr);
+            EndpointTable::serialize(ser, it.second);
+        }
+    }
     SST_SER(dirMemAccesses);
     SST_SER(protocol);
     SST_SER(waitWBAck);
     SST_SER(sendWBAck);
-    SST_SER(incoherentSrc);
+    EndpointTable::serialize(ser, incoherentSrc);
     SST_SER(init_requests_); // Not strictly neccessary to save
 
-    // Reconstruct DirEntry iterators
+    // Move restored entries into the slab pool and reconstruct DirEntry iterators
     if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+        std::unordered_map<DirEntry*, DirEntry*> moved;
+        for (auto& x : directory) {
+            DirEntry* entry = allocateDirEntry(x.first);
+            *entry = *x.second;
+            moved[x.second] = entry;
+            delete x.second;
+            x.second = entry;
+        }
+        for (auto& x : entryCache) {
+            std::unordered_map<DirEntry*, DirEntry*>::iterator it = moved.find(x);
+            if (it != moved.end())
+                x = it->second;
+        }
         for (auto& x : directory) {
             x.second->cacheIter = std::find(entryCache.begin(), entryCache.end(), x.second);
         }
@@ -36,6 +36,7 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/timingWheel.h"
 
 using namespace std;
 
@@ -50,6 +51,10 @@ public:
     SST_ELI_DOCUMENT_PARAMS(
             {"clock",                   "Clock rate of controller.", "1GHz"},
             {"entry_cache_size",        "Size (in # of entries) the controller will cache.", "0"},
+            {"reclaim_invalid_entries", "(bool) Release directory entries that return to the invalid, unshared state instead of keeping them for the rest of the simulation. Bounds directory memory to the lines currently cached above.", "false"},
+            {"sparse_entries",          "(uint) If non-zero, model a sparse directory that tracks at most this many lines with sharers or an owner. "
+                                        "Evicting a tracked line invalidates its copies in the caches. Implies reclaim_invalid_entries.", "0"},
+            {"sparse_associativity",    "(uint) Associativity of the sparse directory. Must evenly divide sparse_entries.", "8"},
             {"debug",                   "Where to send debug output. 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE.", "0"},
             {"debug_level",             "Debugging level: 0 to 10. Must configure sst-core with '--enable-debug'. 1=info, 2-10=debug output", "0"},
             {"debug_addr",              "(comma separated uint) Address(es) to be debugged. Leave empty for all, otherwise specify one or more, comma-separated values. Start and end string with brackets",""},
@@ -65,6 +70,8 @@ public:
             {"addr_range_end",          "Highest address handled by this directory.", "uint64_t-1"},
             {"interleave_size",         "Size of interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
             {"interleave_step",         "Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
+            {"slice_allocation_policy", "How the interleaved chunks are assigned among directories. Options: rr[round-robin], xor[XOR slice hash; all directories sharing the interleaving must use it]", "rr"},
+            {"slice_hash_bits",         "For slice_allocation_policy=xor, number of address bits above the interleave step folded into the slice hash", "32"},
             {"node",					"Node number in multinode environment"},
             /* Old parameters - deprecated or moved */
             {"network_bw",                  "MOVED. Now a member of the MemNIC subcomponent.", "80GiB/s"}, // Remove SST 9.0
@@ -146,6 +153,9 @@ public:
             {"eventSent_FlushAllResp",  "Event sent: FlushAllResp", "count", 2},
             {"eventSent_UnblockFlush",  "Event sent: UnblockFlush", "count", 2},
             {"MSHR_occupancy",          "Number of events in MSHR each cycle",  "events",       1},
+            {"entries_reclaimed",       "Number of directory entries released after returning to the invalid, unshared state", "count", 1},
+            {"entry_bytes_reclaimed",   "Host memory (bytes) freed by releasing directory entry slabs whose entries were all reclaimed", "bytes", 1},
+            {"sparse_evictions",        "Number of sparse directory evictions, each of which invalidates the line in the caches", "count", 1},
             {"default_stat",            "Default statistic. If not 0 then a statistic is missing", "", 1})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -192,11 +202,14 @@ private:
     Statistic<uint64_t> * stat_dirEntryWrites;
 
     Statistic<uint64_t> * stat_MSHROccupancy;
+    Statistic<uint64_t> * stat_entriesReclaimed;
+    Statistic<uint64_t> * stat_entryBytesReclaimed;
+    Statistic<uint64_t> * stat_sparseEvictions;
 
     /* Queue of packets to work on */
     std::list<MemEvent*> eventBuffer;
     std::list<MemEvent*> retryBuffer;
-    std::map<MemEvent::id_type, std::string> noncacheMemReqs;
+    std::map<MemEvent::id_type, EndpointID> noncacheMemReqs;
 
     std::set<Addr> addrsThisCycle;
 
@@ -320,13 +333,22 @@ private:
         }
     } eventDI, evictDI;
 
+    /*
+     * Sharers and owner are tracked by endpoint index (see getEndpointIndex) rather than by name.
+     * Sharers are a bit vector; the first 64 endpoints are stored inline and
+     * any beyond that spill into 'sharerOverflow' which is only allocated when needed.
+     */
+    static const int32_t NO_OWNER = -1;
+
     struct DirEntry {
         bool                  cached;         // whether block is cached or not
         Addr                  addr;           // block address
         State                 state;          // state
         std::list<DirEntry*>::iterator cacheIter; // Location in cache (or end() if not cached)
-        std::set<std::string> sharers;        // set of sharers for block
-        std::string           owner;          // Owner of block
+        uint64_t              sharers;        // sharer bit vector, endpoints 0-63
+        std::vector<uint64_t> sharerOverflow; // sharer bit vector, endpoints 64+
+        uint32_t              sharerCount;    // number of bits set in the sharer vector
+        int32_t               owner;          // owner index or NO_OWNER
 
         DirEntry(Addr a) {
             clearEntry();
@@ -338,22 +360,22 @@ private:
         void clearEntry(){
             cached = true;
             addr = 0;
-            sharers.clear();
-            owner = "";
+            clearSharers();
+            owner = NO_OWNER;
         }
 
-        std::string getString() {
+        std::string getString(std::vector<std::string>& names) {
             std::ostringstream str;
             str << "State: " << StateString[state];
             str << " Sharers: [";
             bool comma = false;
-            for (std::set<std::string>::iterator it = sharers.begin(); it != sharers.end(); it++) {
+            for (uint32_t i = nextSharer(0); i != NO_SHARER; i = nextSharer(i + 1)) {
                 if (comma)
                     str << ",";
-                str << *it;
+                str << names[i];
                 comma = true;
             }
-            str << "] Owner: " << owner;
+            str << "] Owner: " << (owner == NO_OWNER ? "" : names[owner]);
             str << " Cached: " << (cached ? "y" : "n");
             return str.str();
         }
@@ -364,27 +386,60 @@ private:
 
         Addr getBaseAddr() { return addr; }
 
-        size_t getSharerCount() { return sharers.size(); }
+        size_t getSharerCount() { return sharerCount; }
 
-        void clearSharers() { sharers.clear(); }
+        void clearSharers() {
+            sharers = 0;
+            sharerOverflow.clear();
+            sharerCount = 0;
+        }
 
-        void addSharer(std::string shr) { sharers.insert(shr); }
+        void addSharer(uint32_t shr) {
+            uint64_t* word = sharerWord(shr, true);
+            uint64_t bit = 1ULL << (shr & 63);
+            if (!(*word & bit)) {
+                *word |= bit;
+                sharerCount++;
+            }
+        }
 
-        bool isSharer(std::string shr) { return sharers.find(shr) != sharers.end(); }
+        bool isSharer(uint32_t shr) {
+            uint64_t* word = sharerWord(shr, false);
+            return word && (*word & (1ULL << (shr & 63)));
+        }
 
-        bool hasSharers() { return !(sharers.empty()); }
+        bool hasSharers() { return sharerCount != 0; }
 
-        std::set<std::string>* getSharers() { return &sharers; }
+        void removeSharer(uint32_t shr) {
+            uint64_t* word = sharerWord(shr, false);
+            uint64_t bit = 1ULL << (shr & 63);
+            if (word && (*word & bit)) {
+                *word &= ~bit;
+                sharerCount--;
+            }
+        }
 
-        void removeSharer(std::string shr) { sharers.erase(shr); }
+        /* Return the first sharer with index >= 'from', or NO_SHARER if there are none */
+        static const uint32_t NO_SHARER = 0xFFFFFFFF;
+        uint32_t nextSharer(uint32_t from) {
+            size_t words = 1 + sharerOverflow.size();
+            for (size_t w = from >> 6; w < words; w++) {
+                uint64_t bits = (w == 0) ? sharers : sharerOverflow[w - 1];
+                if (w == (from >> 6))
+                    bits &= (~0ULL) << (from & 63);
+                if (bits)
+                    return (w << 6) + __builtin_ctzll(bits);
+            }
+            return NO_SHARER;
+        }
 
-        std::string getOwner() { return owner; }
+        int32_t getOwner() { return owner; }
 
-        bool hasOwner() { return owner != ""; }
+        bool hasOwner() { return owner != NO_OWNER; }
 
-        void removeOwner() { owner = ""; }
+        void removeOwner() { owner = NO_OWNER; }
 
-        void setOwner(std::string own) { owner = own; }
+        void setOwner(uint32_t own) { owner = own; }
 
         void setState(State nState) { state = nState; }
 
@@ -397,16 +452,39 @@ private:
             SST_SER(addr);
             SST_SER(state);
             SST_SER(sharers);
+            SST_SER(sharerOverflow);
+            SST_SER(sharerCount);
             SST_SER(owner);
             // Serialization of iterators isn't supported
             // Skip serializing and reconstruct on deserialization
         }
+
+    private:
+        uint64_t* sharerWord(uint32_t shr, bool grow) {
+            if (shr < 64)
+                return &sharers;
+            size_t w = (shr >> 6) - 1;
+            if (w >= sharerOverflow.size()) {
+                if (!grow) return nullptr;
+                sharerOverflow.resize(w + 1, 0);
+            }
+            return &sharerOverflow[w];
+        }
     };
 
+    /* EndpointID <-> dense index mapping used by DirEntry sharer/owner tracking */
+    static const uint32_t NO_ENDPOINT_INDEX = UINT32_MAX;
+    std::vector<std::string> endpointNames;     // By index, for debug output
+    std::vector<EndpointID> endpointIDs;        // By index
+    EndpointID dirID;                           // This directory
+    std::vector<uint32_t> endpointIndex;        // By EndpointID
+    uint32_t getEndpointIndex(EndpointID id);
+
     int dlevel;
     void printDebugInfo();
 
     DirEntry* getDirEntry(Addr addr); // find entry in the master list
+    void finishDirEntry(Addr addr);   // reclaim or track an entry after an event has been handled
     bool retrieveDirEntry(DirEntry* entry, MemEvent* event, bool inMSHR); // Simulate fetching entry from memory
 
     MemEventStatus allocateMSHR(MemEvent* event, bool fwdReq, int pos = -1);
@@ -421,8 +499,8 @@ private:
     void issueFlush(MemEvent* event);
     void issueFetch(MemEvent* event, DirEntry* entry, Command cmd);
     void issueInvalidations(MemEvent* event, DirEntry* entry, Command cmd);
-    void issueInvalidation(std::string dst, MemEvent* event, DirEntry* entry, Command cmd);
-    void sendDataResponse(MemEvent* event, DirEntry* entry, std::vector<uint8_t>& data, Command cmd, uint32_t flags = 0);
+    void issueInvalidation(EndpointID dst, MemEvent* event, DirEntry* entry, Command cmd);
+    void sendDataResponse(MemEvent* event, DirEntry* entry, const LineBuffer& data, Command cmd, uint32_t flags = 0);
     void sendResponse(MemEvent* event, uint32_t flags = 0, uint32_t memflags = 0);
     void writebackData(MemEvent* event);
     void writebackDataFromMSHR(Addr addr);
@@ -455,14 +533,44 @@ private:
     void forwardByDestination(MemEventBase* ev, Cycle_t timestamp, bool dirAccess = false);
     void forwardByAddress(MemEventBase* ev, Cycle_t timestamp, bool dirAccess = false);
 
-    std::multimap<uint64_t,MemEventBase*>   cpuMsgQueue;
-    std::multimap<uint64_t,MemMsg>   memMsgQueue;
+    TimingWheel<MemEventBase*>  cpuMsgQueue;
+    TimingWheel<MemMsg>         memMsgQueue;
 
     uint64_t    entryCacheMaxSize;
     uint64_t    entryCacheSize;
     uint32_t    entrySize;
     std::list<DirEntry*> entryCache;
 
+    /*
+     * Directory entries are carved out of slabs and recycled through a free list.
+     * The slabs are not checkpointed; restored entries are copied into new slabs.
+     */
+    static const size_t entrySlabSize = 1024;
+    std::map<DirEntry*, size_t> entrySlabs;    // Slab -> number of entries in use
+    std::vector<DirEntry*> freeEntries;
+    bool reclaimEntries;    // Release entries that return to I with no sharers/owner
+
+    DirEntry* allocateDirEntry(Addr addr);
+    void releaseDirEntry(DirEntry* entry);
+    std::map<DirEntry*, size_t>::iterator findEntrySlab(DirEntry* entry);
+
+    /*
+     * Sparse directory: a set-associative tag array limiting how many lines can have sharers/owners.
+     * Tags are LRU-ordered by a per-way timestamp. DirEntry still holds the coherence state;
+     * the tag array only decides which lines must be invalidated to stay within capacity.
+     */
+    static const Addr NO_SPARSE_TAG = ~(Addr)0;
+    uint64_t sparseSets;
+    uint32_t sparseAssoc;   // 0 = sparse directory disabled
+    std::vector<Addr> sparseTags;
+    std::vector<uint64_t> sparseStamps;
+    uint64_t sparseTime;
+    std::map<Addr, Addr> sparseEvicting;    // Victim being invalidated -> line waiting for its way
+
+    void sparseTrack(DirEntry* entry);
+    void sparseRemove(Addr addr);
+    void completeSparseEviction(MemEventBase* ev);
+
     uint64_t lineSize;
 
     uint64_t accessLatency;
@@ -470,7 +578,7 @@ private:
 
     FlushState flush_state_;
 
-    std::map<Addr, std::map<std::string, MemEventBase::id_type> > responses;
+    std::map<Addr, std::map<EndpointID, MemEventBase::id_type> > responses;
 
     std::map<MemEventBase::id_type, Addr> dirMemAccesses;
 
@@ -478,7 +586,7 @@ private:
     bool waitWBAck;
     bool sendWBAck;
 
-    std::set<std::string> incoherentSrc;
+    std::set<EndpointID> incoherentSrc;
 
     // During init() we need to store routing for requests that get a response
     std::map<MemEventBase::id_type, std::string> init_requests_;
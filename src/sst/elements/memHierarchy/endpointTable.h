@@ -0,0 +1,194 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_ENDPOINTTABLE_H
+#define MEMHIERARCHY_ENDPOINTTABLE_H
+
+#include <sst/core/output.h>
+#include <sst/core/serialization/serializer.h>
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace SST { namespace MemHierarchy {
+
+/* Compact identifier for a named endpoint (cache, directory, memory, etc.) */
+typedef uint32_t EndpointID;
+
+/*
+ * Process-wide table of interned endpoint names
+ *
+ * Events carry EndpointIDs for src/dst/requestor instead of names. Names are interned as
+ * components and links learn about each other during init(), so lookups during simulation
+ * hit an existing entry. IDs are only meaningful within a process: anything that leaves
+ * the process (checkpoints, events crossing ranks) must carry the name - see serialize().
+ *
+ * ID 0 is reserved for "None", the default for unset endpoints.
+ * Names are stored in fixed-size chunks that never move, so name() does not take a lock.
+ */
+class EndpointTable {
+public:
+    static const EndpointID NONE_ID = 0;
+
+    /* Return the ID for 'name', adding it to the table if needed */
+    static EndpointID intern(const std::string& name) {
+        EndpointTable& table = instance();
+        {
+            std::shared_lock<std::shared_mutex> lock(table.mutex_);
+            auto it = table.ids_.find(name);
+            if (it != table.ids_.end())
+                return it->second;
+        }
+        std::unique_lock<std::shared_mutex> lock(table.mutex_);
+        return table.insert(name);
+    }
+
+    /* Return the name for an ID returned by intern() */
+    static const std::string& name(EndpointID id) {
+        return instance().chunks_[id >> chunkBits].load(std::memory_order_acquire)[id & chunkMask];
+    }
+
+    /* Serialize an ID by name so that it can be restored in a different process */
+    static void serialize(SST::Core::Serialization::serializer& ser, EndpointID& id) {
+        switch (ser.mode()) {
+            case SST::Core::Serialization::serializer::SIZER:
+            case SST::Core::Serialization::serializer::PACK:
+                {
+                    std::string endpoint = name(id);
+                    SST_SER(endpoint);
+                    break;
+                }
+            case SST::Core::Serialization::serializer::UNPACK:
+                {
+                    std::string endpoint;
+                    SST_SER(endpoint);
+                    id = intern(endpoint);
+                    break;
+                }
+            default:
+                SST_SER(id);
+                break;
+        }
+    }
+
+    /* Serialize containers of IDs by name, as above */
+    static void serialize(SST::Core::Serialization::serializer& ser, std::set<EndpointID>& ids) {
+        if (ser.mode() == SST::Core::Serialization::serializer::MAP) {
+            SST_SER(ids);
+            return;
+        }
+        std::set<std::string> names;
+        for (auto id : ids)
+            names.insert(name(id));
+        SST_SER(names);
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            ids.clear();
+            for (auto& endpoint : names)
+                ids.insert(intern(endpoint));
+        }
+    }
+
+    template <typename K>
+    static void serialize(SST::Core::Serialization::serializer& ser, std::map<K, EndpointID>& ids) {
+        if (ser.mode() == SST::Core::Serialization::serializer::MAP) {
+            SST_SER(ids);
+            return;
+        }
+        std::map<K, std::string> names;
+        for (auto& it : ids)
+            names[it.first] = name(it.second);
+        SST_SER(names);
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            ids.clear();
+            for (auto& it : names)
+                ids[it.first] = intern(it.second);
+        }
+    }
+
+    template <typename V>
+    static void serialize(SST::Core::Serialization::serializer& ser, std::map<EndpointID, V>& ids) {
+        if (ser.mode() == SST::Core::Serialization::serializer::MAP) {
+            SST_SER(ids);
+            return;
+        }
+        std::map<std::string, V> names;
+        for (auto& it : ids)
+            names[name(it.first)] = it.second;
+        SST_SER(names);
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            ids.clear();
+            for (auto& it : names)
+                ids[intern(it.first)] = it.second;
+        }
+    }
+
+private:
+    static const unsigned int chunkBits = 10;
+    static const EndpointID chunkMask = (1 << chunkBits) - 1;
+    static const size_t maxChunks = 4096;
+
+    EndpointTable() {
+        for (auto& chunk : chunks_)
+            chunk.store(nullptr, std::memory_order_relaxed);
+        insert("None");
+    }
+
+    ~EndpointTable() {
+        for (auto& chunk : chunks_)
+            delete [] chunk.load(std::memory_order_relaxed);
+    }
+
+    static EndpointTable& instance() {
+        static EndpointTable table;
+        return table;
+    }
+
+    /* Caller holds the lock exclusively */
+    EndpointID insert(const std::string& name) {
+        auto it = ids_.find(name);
+        if (it != ids_.end())
+            return it->second;
+
+        EndpointID id = ids_.size();
+        if ((id >> chunkBits) >= maxChunks) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "MemHierarchy EndpointTable, Error: Too many endpoint names (%zu). Cannot add '%s'.\n", maxChunks << chunkBits, name.c_str());
+        }
+        std::string* chunk = chunks_[id >> chunkBits].load(std::memory_order_relaxed);
+        if (chunk == nullptr) {
+            chunk = new std::string[chunkMask + 1];
+            chunk[id & chunkMask] = name;
+            chunks_[id >> chunkBits].store(chunk, std::memory_order_release);
+        } else {
+            chunk[id & chunkMask] = name;
+        }
+        ids_.emplace(name, id);
+        return id;
+    }
+
+    std::shared_mutex mutex_;
+    std::unordered_map<std::string, EndpointID> ids_;
+    std::array<std::atomic<std::string*>, maxChunks> chunks_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_ENDPOINTTABLE_H */
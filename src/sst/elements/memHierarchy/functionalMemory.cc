@@ -0,0 +1,117 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include <algorithm>
+
+#include "functionalMemory.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+std::shared_mutex FunctionalMemory::lock_;
+std::vector<FunctionalMemory::Entry> FunctionalMemory::memories_;
+
+void FunctionalMemory::add(const MemRegion& region, Addr privateOffset, Backend::Backing* backing) {
+    std::unique_lock<std::shared_mutex> lock(lock_);
+    memories_.push_back({region, privateOffset, backing});
+}
+
+void FunctionalMemory::remove(Backend::Backing* backing) {
+    std::unique_lock<std::shared_mutex> lock(lock_);
+    for (auto it = memories_.begin(); it != memories_.end(); it++) {
+        if (it->backing == backing) {
+            memories_.erase(it);
+            return;
+        }
+    }
+}
+
+const FunctionalMemory::Entry* FunctionalMemory::find(Addr addr) {
+    for (const Entry& entry : memories_) {
+        if (entry.region.contains(addr))
+            return &entry;
+    }
+    return nullptr;
+}
+
+/* Same translation as MemController::translateToLocal() */
+Addr FunctionalMemory::toLocal(const Entry& entry, Addr addr) {
+    Addr shift = addr - entry.region.start;
+    if (entry.region.interleaveSize == 0)
+        return shift + entry.offset;
+    return (shift / entry.region.interleaveStep) * entry.region.interleaveSize + (shift % entry.region.interleaveStep) + entry.offset;
+}
+
+/* Bytes, up to 'size', from 'addr' to the end of its interleave chunk or of the region */
+size_t FunctionalMemory::spanLength(const Entry& entry, Addr addr, size_t size) {
+    Addr last = entry.region.end;
+    if (entry.region.interleaveSize != 0) {
+        Addr chunk = addr - ((addr - entry.region.start) % entry.region.interleaveStep);
+        last = std::min(last, chunk + entry.region.interleaveSize - 1);
+    }
+    return std::min((size_t)(last - addr), size - 1) + 1;
+}
+
+bool FunctionalMemory::reachable(Addr addr, size_t size) {
+    for (size_t done = 0; done < size; ) {
+        const Entry* entry = find(addr + done);
+        if (!entry)
+            return false;
+        done += spanLength(*entry, addr + done, size - done);
+    }
+    return true;
+}
+
+bool FunctionalMemory::read(Addr addr, std::vector<uint8_t>& data) {
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    if (!reachable(addr, data.size()))
+        return false;
+
+    std::vector<uint8_t> span;
+    for (size_t done = 0; done < data.size(); ) {
+        const Entry* entry = find(addr + done);
+        size_t size = spanLength(*entry, addr + done, data.size() - done);
+        if (size == data.size()) {
+            entry->backing->get(toLocal(*entry, addr), size, data);
+            break;
+        }
+        span.resize(size);
+        entry->backing->get(toLocal(*entry, addr + done), size, span);
+        std::copy(span.begin(), span.end(), data.begin() + done);
+        done += size;
+    }
+    return true;
+}
+
+bool FunctionalMemory::write(Addr addr, const std::vector<uint8_t>& data) {
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    if (!reachable(addr, data.size()))
+        return false;
+
+    for (size_t done = 0; done < data.size(); ) {
+        const Entry* entry = find(addr + done);
+        size_t size = spanLength(*entry, addr + done, data.size() - done);
+        if (size == data.size()) {
+            entry->backing->set(toLocal(*entry, addr), size, data);
+            break;
+        }
+        std::vector<uint8_t> span(data.begin() + done, data.begin() + done + size);
+        entry->backing->set(toLocal(*entry, addr + done), size, span);
+        done += size;
+    }
+    return true;
+}
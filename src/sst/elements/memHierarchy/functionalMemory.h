@@ -0,0 +1,65 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_FUNCTIONALMEMORY_H
+#define MEMHIERARCHY_FUNCTIONALMEMORY_H
+
+#include <shared_mutex>
+#include <vector>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/membackend/backing.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Untimed access to memory contents
+ *
+ * Memory controllers with a backing store register it here in setup() along with the
+ * region they own. Components in the same process can then read and write simulated
+ * memory without sending events, which functional warmup uses to keep data correct
+ * while it skips timing. The table only changes in setup and teardown, so accesses
+ * share a reader lock and look up the owning memory once per interleave-contiguous span.
+ * Memory on another rank, or without a backing store, is not reachable and read()/write()
+ * return false.
+ */
+class FunctionalMemory {
+public:
+    static void add(const MemRegion& region, Addr privateOffset, Backend::Backing* backing);
+    static void remove(Backend::Backing* backing);
+
+    /* Read or write 'data.size()' bytes at 'addr'. Return false, and do nothing, if any byte is unreachable */
+    static bool read(Addr addr, std::vector<uint8_t>& data);
+    static bool write(Addr addr, const std::vector<uint8_t>& data);
+
+private:
+    struct Entry {
+        MemRegion region;
+        Addr offset;
+        Backend::Backing* backing;
+    };
+
+    static const Entry* find(Addr addr);
+    static Addr toLocal(const Entry& entry, Addr addr);
+    static size_t spanLength(const Entry& entry, Addr addr, size_t size);
+    static bool reachable(Addr addr, size_t size);
+
+    static std::shared_mutex lock_;
+    static std::vector<Entry> memories_;
+};
+
+}}
+
+#endif // MEMHIERARCHY_FUNCTIONALMEMORY_H
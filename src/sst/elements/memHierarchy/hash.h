@@ -24,8 +24,11 @@
 #define	MEMHIERARCHY_HASH_H
 
 #include <stdint.h>
+#include <vector>
 #include <sst/core/subcomponent.h>
 
+#include "sst/elements/memHierarchy/memTypes.h"
+
 namespace SST {
 namespace MemHierarchy {
 
@@ -115,6 +118,111 @@ public:
     ImplementSerializable(SST::MemHierarchy::XorHashFunction)
 };
 
+/*
+ * XOR slice hashing for interleaved address regions
+ *
+ * A group of N slices (LLC slices, directories) interleaves 'size'-byte chunks with step N*size.
+ * Round-robin assigns chunk c to slice c % N. The slice hash instead permutes the slices within
+ * each window of N chunks by an XOR fold of the window index, so strided access patterns spread
+ * across the slices (similar to the complex addressing used for LLC slices in commodity processors).
+ * Each window still holds exactly one chunk per slice, so slice-local set indexing is unchanged.
+ *
+ * The fold is linear, so it is precomputed as one 256-entry table per byte of the window index.
+ * 'bits' is the number of window index bits folded; 0 selects plain round-robin.
+ */
+class SliceHash {
+public:
+    SliceHash() : size_(0), slices_(0), slice_(0), bits_(0), bytes_(0), pow2_(true), lo_(0), end_(0) {}
+
+    /* Configure from the region of one slice. Returns false if the region is not evenly
+     * interleaved: step must be a multiple (>1) of size and start a multiple of size */
+    bool configure(const MemRegion& region, uint32_t bits) {
+        if (region.interleaveSize == 0 || region.interleaveStep <= region.interleaveSize || bits > 64
+                || region.interleaveStep % region.interleaveSize != 0 || region.start % region.interleaveSize != 0)
+            return false;
+        size_ = region.interleaveSize;
+        slices_ = region.interleaveStep / region.interleaveSize;
+        if (slices_ > 65536)
+            return false;
+        slice_ = (region.start / size_) % slices_;
+        lo_ = region.start - slice_ * size_;
+        end_ = region.end;
+        bits_ = bits;
+
+        unsigned int out_bits = 0;
+        while (((uint64_t)1 << out_bits) < slices_) out_bits++;
+        pow2_ = ((uint64_t)1 << out_bits) == slices_;
+
+        bytes_ = (bits_ + 7) / 8;
+        table_.assign(bytes_ * 256, 0);
+        for (unsigned int b = 0; b < bytes_; b++) {
+            for (unsigned int v = 0; v < 256; v++) {
+                uint32_t h = 0;
+                for (unsigned int i = 0; i < 8; i++) {
+                    unsigned int bit = 8 * b + i;
+                    if (bit < bits_ && ((v >> i) & 1))
+                        h ^= 1 << (bit % out_bits);
+                }
+                table_[(b << 8) | v] = h;
+            }
+        }
+        return true;
+    }
+
+    /* Slice (0 to slices()-1) that owns the chunk holding 'addr' */
+    uint32_t slice(Addr addr) const {
+        Addr chunk = addr / size_;
+        uint32_t index = chunk % slices_;
+        if (bytes_ == 0)
+            return index;
+        Addr window = chunk / slices_;
+        uint32_t h = 0;
+        for (unsigned int b = 0; b < bytes_; b++) {
+            h ^= table_[(b << 8) | (window & 0xFF)];
+            window >>= 8;
+        }
+        return pow2_ ? (index ^ h) : (uint32_t)((index + h) % slices_);
+    }
+
+    /* Whether the slice this was configured from owns 'addr' */
+    bool contains(Addr addr) const {
+        return addr >= lo_ && addr <= end_ && slice(addr) == slice_;
+    }
+
+    /* Whether 'o' describes another slice of the same group */
+    bool sameGroup(const SliceHash& o) const {
+        return size_ == o.size_ && slices_ == o.slices_ && bits_ == o.bits_ && lo_ == o.lo_ && end_ == o.end_;
+    }
+
+    uint32_t slices() const { return slices_; }
+    uint32_t index() const { return slice_; }
+    Addr lo() const { return lo_; }
+    Addr end() const { return end_; }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) {
+        SST_SER(size_);
+        SST_SER(slices_);
+        SST_SER(slice_);
+        SST_SER(bits_);
+        SST_SER(bytes_);
+        SST_SER(pow2_);
+        SST_SER(lo_);
+        SST_SER(end_);
+        SST_SER(table_);
+    }
+
+private:
+    Addr size_;                     // Interleave size
+    uint32_t slices_;               // Slices in the group
+    uint32_t slice_;                // Slice this was configured from
+    uint32_t bits_;                 // Window index bits folded into the hash
+    uint32_t bytes_;                // Table rows (bytes of the window index)
+    bool pow2_;                     // Power-of-two slices: XOR the fold in, otherwise add it modulo slices_
+    Addr lo_;                       // Start of the group's first window
+    Addr end_;
+    std::vector<uint16_t> table_;   // Per-byte fold contributions
+};
+
 }}
 #endif
 /* HASH_H */
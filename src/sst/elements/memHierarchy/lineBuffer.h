@@ -0,0 +1,187 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_LINEBUFFER_H
+#define MEMHIERARCHY_LINEBUFFER_H
+
+#include <sst/core/serialization/serializer.h>
+
+#include <atomic>
+#include <stdint.h>
+#include <vector>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Reference-counted, pooled data buffer for cache lines and other event payloads
+ *
+ * Copying a LineBuffer shares the underlying bytes, so an event, its response and the MSHR
+ * can all hold the same line without copying it. Writers go through writable(), which
+ * copies the bytes first if the buffer is shared (copy-on-write). A reference returned by
+ * writable() is only safe to write through until the buffer is next shared.
+ *
+ * Buffers are recycled through a per-thread free list and keep their capacity, so
+ * steady-state fills and writebacks do not allocate. The reference count is atomic since
+ * events, and therefore buffers, may be handed between threads.
+ */
+class LineBuffer {
+public:
+    LineBuffer() : block_(nullptr) { }
+
+    /* Pooled buffer holding 'size' zero bytes */
+    explicit LineBuffer(size_t size) : block_(acquire()) { block_->bytes.assign(size, 0); }
+
+    /* Pooled buffer holding a copy of 'data' */
+    explicit LineBuffer(const std::vector<uint8_t>& data) : block_(acquire()) { block_->bytes.assign(data.begin(), data.end()); }
+
+    LineBuffer(const LineBuffer& other) : block_(other.block_) {
+        if (block_) block_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    LineBuffer(LineBuffer&& other) noexcept : block_(other.block_) { other.block_ = nullptr; }
+
+    LineBuffer& operator=(const LineBuffer& other) {
+        if (block_ != other.block_) {
+            if (other.block_) other.block_->refs.fetch_add(1, std::memory_order_relaxed);
+            release();
+            block_ = other.block_;
+        }
+        return *this;
+    }
+
+    LineBuffer& operator=(LineBuffer&& other) noexcept {
+        if (this != &other) {
+            release();
+            block_ = other.block_;
+            other.block_ = nullptr;
+        }
+        return *this;
+    }
+
+    ~LineBuffer() { release(); }
+
+    bool empty() const { return block_ == nullptr || block_->bytes.empty(); }
+    size_t size() const { return block_ ? block_->bytes.size() : 0; }
+    bool shared() const { return block_ && block_->refs.load(std::memory_order_acquire) > 1; }
+
+    /* Read-only view of the bytes; never copies */
+    const std::vector<uint8_t>& data() const { return block_ ? block_->bytes : emptyBytes(); }
+    uint8_t operator[](size_t i) const { return block_->bytes[i]; }
+
+    /* Mutable view of the bytes; copies first if the buffer is shared */
+    std::vector<uint8_t>& writable() {
+        if (!block_) {
+            block_ = acquire();
+        } else if (shared()) {
+            Block* copy = acquire();
+            copy->bytes.assign(block_->bytes.begin(), block_->bytes.end());
+            release();
+            block_ = copy;
+        }
+        return block_->bytes;
+    }
+
+    /* Replace the contents. Does not copy the old contents if the buffer is shared */
+    void assign(const std::vector<uint8_t>& data) { exclusive().assign(data.begin(), data.end()); }
+    void assign(const uint8_t* data, size_t size) { exclusive().assign(data, data + size); }
+    void assign(size_t size, uint8_t value) { exclusive().assign(size, value); }
+
+    void clear() { release(); }
+
+    /* Checkpoints carry the bytes; sharing is not preserved across a restart */
+    void serialize(SST::Core::Serialization::serializer& ser) {
+        std::vector<uint8_t> bytes;
+        if (ser.mode() != SST::Core::Serialization::serializer::UNPACK)
+            bytes = data();
+        SST_SER(bytes);
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            if (bytes.empty()) clear();
+            else assign(bytes);
+        }
+    }
+
+private:
+    struct Block {
+        std::vector<uint8_t> bytes;
+        std::atomic<uint32_t> refs;
+        Block* next;
+    };
+
+    /* Per-thread free list. Blocks may be released on a different thread than they were acquired on */
+    struct Pool {
+        static const size_t maxFree = 4096;
+        Block* head = nullptr;
+        size_t count = 0;
+        ~Pool() {
+            while (head) {
+                Block* block = head;
+                head = block->next;
+                delete block;
+            }
+        }
+    };
+
+    static Pool& pool() {
+        static thread_local Pool p;
+        return p;
+    }
+
+    static const std::vector<uint8_t>& emptyBytes() {
+        static const std::vector<uint8_t> none;
+        return none;
+    }
+
+    static Block* acquire() {
+        Pool& p = pool();
+        Block* block = p.head;
+        if (block) {
+            p.head = block->next;
+            p.count--;
+        } else {
+            block = new Block();
+        }
+        block->refs.store(1, std::memory_order_relaxed);
+        block->next = nullptr;
+        return block;
+    }
+
+    void release() {
+        if (!block_) return;
+        if (block_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Pool& p = pool();
+            if (p.count < Pool::maxFree) {
+                block_->bytes.clear();
+                block_->next = p.head;
+                p.head = block_;
+                p.count++;
+            } else {
+                delete block_;
+            }
+        }
+        block_ = nullptr;
+    }
+
+    std::vector<uint8_t>& exclusive() {
+        if (shared()) release();
+        if (!block_) block_ = acquire();
+        return block_->bytes;
+    }
+
+    Block* block_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_LINEBUFFER_H */
@@ -0,0 +1,247 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_LINECOMPRESSOR_H
+#define MEMHIERARCHY_LINECOMPRESSOR_H
+
+#include <stdint.h>
+#include <vector>
+#include <sst/core/subcomponent.h>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Cache line compressor
+ *
+ * Used by a compressed cache array to size lines from their actual contents. Compressors only
+ * compute sizes; the data is always stored uncompressed in the simulator.
+ * A compressed set holds more tags than data ways, so the array checks compressed sizes
+ * against the set's data capacity when choosing a victim (see CacheArray::findReplacementCandidate).
+ */
+class LineCompressor : public SubComponent {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_API(SST::MemHierarchy::LineCompressor)
+
+#define MEMHIERARCHY_LINECOMPRESSOR_ELI_PARAMS \
+    {"line_size",   "(uint) Line size in bytes. Set by the cache if it loads the compressor from the 'compression' parameter.", "64"}
+
+#define MEMHIERARCHY_LINECOMPRESSOR_ELI_STATS \
+    {"compression_ratio",   "Sampled at each allocation: uncompressed / compressed size (x100) of the valid lines in the set", "percent", 1},\
+    {"effective_capacity",  "Sampled at each allocation: valid lines in the set as a percentage of the set's data ways", "percent", 1},\
+    {"decompressions",      "Number of hits that read a compressed line and paid the decompression latency", "count", 1}
+
+    LineCompressor(ComponentId_t id, Params& params, uint64_t default_latency) : SubComponent(id) {
+        line_size_ = params.find<uint32_t>("line_size", 64);
+        latency_ = params.find<uint64_t>("latency", default_latency);
+        stat_ratio_ = registerStatistic<uint64_t>("compression_ratio");
+        stat_capacity_ = registerStatistic<uint64_t>("effective_capacity");
+        stat_decompressions_ = registerStatistic<uint64_t>("decompressions");
+    }
+    virtual ~LineCompressor() {}
+
+    /* Compressed size in bytes; line size if the data does not compress */
+    virtual uint32_t compressedSize(const std::vector<uint8_t>& data) = 0;
+
+    /* Latency to read a line with these contents out of the array */
+    uint64_t decompressionLatency(const std::vector<uint8_t>& data) {
+        if (latency_ == 0 || compressedSize(data) >= line_size_)
+            return 0;
+        stat_decompressions_->addData(1);
+        return latency_;
+    }
+
+    /* Record a set's contents at allocation time */
+    void recordSet(unsigned int valid_lines, uint64_t compressed_bytes, unsigned int data_ways) {
+        if (valid_lines == 0)
+            return;
+        stat_ratio_->addData((valid_lines * (uint64_t)line_size_ * 100) / (compressed_bytes ? compressed_bytes : 1));
+        stat_capacity_->addData((valid_lines * 100) / data_ways);
+    }
+
+    LineCompressor() = default;
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        SubComponent::serialize_order(ser);
+        SST_SER(line_size_);
+        SST_SER(latency_);
+        SST_SER(stat_ratio_);
+        SST_SER(stat_capacity_);
+        SST_SER(stat_decompressions_);
+    }
+    ImplementVirtualSerializable(SST::MemHierarchy::LineCompressor)
+
+protected:
+    /* Little-endian 'bytes'-byte value at 'offset' */
+    static uint64_t readValue(const std::vector<uint8_t>& data, size_t offset, unsigned int bytes) {
+        uint64_t value = 0;
+        for (unsigned int i = 0; i < bytes; i++)
+            value |= (uint64_t)data[offset + i] << (8 * i);
+        return value;
+    }
+
+    /* Whether 'value' ('bytes' wide) sign-extends from its low 'bits' bits */
+    static bool fitsSigned(uint64_t value, unsigned int bytes, unsigned int bits) {
+        int64_t v = (int64_t)(value << (64 - 8 * bytes)) >> (64 - 8 * bytes); // Sign-extend to 64 bits
+        int64_t limit = (int64_t)1 << (bits - 1);
+        return v >= -limit && v < limit;
+    }
+
+    uint32_t line_size_;
+    uint64_t latency_;
+
+private:
+    Statistic<uint64_t>* stat_ratio_;
+    Statistic<uint64_t>* stat_capacity_;
+    Statistic<uint64_t>* stat_decompressions_;
+};
+
+/*
+ * Base-Delta-Immediate compression (Pekhimenko et al., PACT 2012)
+ *
+ * The line is split into 2, 4 or 8-byte values. A line compresses to one base plus a
+ * per-value 1, 2 or 4-byte delta if every value is within that delta of either the base
+ * (the first value that is not near zero) or zero. One mask bit per value records which
+ * base it uses. All-zero and repeated-value lines are special cased.
+ */
+class BDICompressor : public LineCompressor {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(BDICompressor, "memHierarchy", "compression.bdi", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Base-Delta-Immediate cache line compression", SST::MemHierarchy::LineCompressor)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            MEMHIERARCHY_LINECOMPRESSOR_ELI_PARAMS,
+            {"latency", "(uint) Cycles added to a hit that reads a compressed line", "1"} )
+    SST_ELI_DOCUMENT_STATISTICS( MEMHIERARCHY_LINECOMPRESSOR_ELI_STATS )
+
+    BDICompressor(ComponentId_t id, Params& params) : LineCompressor(id, params, 1) {}
+
+    uint32_t compressedSize(const std::vector<uint8_t>& data) override {
+        size_t size = data.size();
+        if (size == 0 || size % 8 != 0)
+            return line_size_;
+
+        // All zero -> 1 byte, repeated 8-byte value -> 8 bytes
+        uint64_t first = readValue(data, 0, 8);
+        bool repeated = true;
+        for (size_t i = 8; i < size && repeated; i += 8)
+            repeated = (readValue(data, i, 8) == first);
+        if (repeated)
+            return (first == 0) ? 1 : 8;
+
+        static const unsigned int encodings[6][2] = { {8,1}, {8,2}, {8,4}, {4,1}, {4,2}, {2,1} }; // {base bytes, delta bytes}
+        uint32_t best = line_size_;
+        for (unsigned int e = 0; e < 6; e++) {
+            unsigned int base_bytes = encodings[e][0];
+            unsigned int delta_bytes = encodings[e][1];
+            size_t count = size / base_bytes;
+            uint32_t encoded = base_bytes + count * delta_bytes + (count + 7) / 8;
+            if (encoded < best && fits(data, base_bytes, delta_bytes))
+                best = encoded;
+        }
+        return best;
+    }
+
+    BDICompressor() = default;
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        LineCompressor::serialize_order(ser);
+    }
+    ImplementSerializable(SST::MemHierarchy::BDICompressor)
+
+private:
+    bool fits(const std::vector<uint8_t>& data, unsigned int base_bytes, unsigned int delta_bytes) {
+        uint64_t mask = (base_bytes == 8) ? ~(uint64_t)0 : (((uint64_t)1 << (8 * base_bytes)) - 1);
+        bool have_base = false;
+        uint64_t base = 0;
+        for (size_t i = 0; i < data.size(); i += base_bytes) {
+            uint64_t value = readValue(data, i, base_bytes);
+            if (fitsSigned(value, base_bytes, 8 * delta_bytes))
+                continue; // Immediate (delta from zero)
+            if (!have_base) {
+                base = value;
+                have_base = true;
+                continue;
+            }
+            if (!fitsSigned((value - base) & mask, base_bytes, 8 * delta_bytes))
+                return false;
+        }
+        return true;
+    }
+};
+
+/*
+ * Frequent Pattern Compression (Alameldeen & Wood, 2004)
+ *
+ * Each 32-bit word is encoded with a 3-bit prefix and 0-32 data bits: runs of up to 8 zero
+ * words, 4/8/16-bit sign-extended values, a halfword padded with zeros, two sign-extended
+ * bytes, a repeated byte, or the uncompressed word.
+ */
+class FPCCompressor : public LineCompressor {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(FPCCompressor, "memHierarchy", "compression.fpc", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Frequent Pattern Compression for cache lines", SST::MemHierarchy::LineCompressor)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            MEMHIERARCHY_LINECOMPRESSOR_ELI_PARAMS,
+            {"latency", "(uint) Cycles added to a hit that reads a compressed line", "5"} )
+    SST_ELI_DOCUMENT_STATISTICS( MEMHIERARCHY_LINECOMPRESSOR_ELI_STATS )
+
+    FPCCompressor(ComponentId_t id, Params& params) : LineCompressor(id, params, 5) {}
+
+    uint32_t compressedSize(const std::vector<uint8_t>& data) override {
+        size_t size = data.size();
+        if (size == 0 || size % 4 != 0)
+            return line_size_;
+
+        uint64_t bits = 0;
+        unsigned int zero_run = 0;
+        for (size_t i = 0; i < size; i += 4) {
+            uint32_t word = (uint32_t)readValue(data, i, 4);
+            if (word == 0) {
+                if (zero_run == 0)
+                    bits += 3 + 3;
+                if (++zero_run == 8)
+                    zero_run = 0;
+                continue;
+            }
+            zero_run = 0;
+            bits += 3 + patternBits(word);
+        }
+        uint32_t bytes = (bits + 7) / 8;
+        return bytes < line_size_ ? bytes : line_size_;
+    }
+
+    FPCCompressor() = default;
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        LineCompressor::serialize_order(ser);
+    }
+    ImplementSerializable(SST::MemHierarchy::FPCCompressor)
+
+private:
+    unsigned int patternBits(uint32_t word) {
+        if (fitsSigned(word, 4, 4)) return 4;
+        if (fitsSigned(word, 4, 8)) return 8;
+        if (fitsSigned(word, 4, 16)) return 16;
+        if ((word & 0xFFFF) == 0) return 16;   // Halfword padded with a zero halfword
+        if (fitsSigned(word & 0xFFFF, 2, 8) && fitsSigned(word >> 16, 2, 8)) return 16;   // Two sign-extended bytes
+        uint32_t byte = word & 0xFF;
+        if (word == (byte | (byte << 8) | (byte << 16) | (byte << 24))) return 8;   // Repeated byte
+        return 32;
+    }
+};
+
+}
+}
+
+#endif	/* MEMHIERARCHY_LINECOMPRESSOR_H */
@@ -35,6 +35,9 @@ namespace SST { namespace MemHierarchy {
  * - getString() for debug
  * - getAddr() for identifying a line
  * - getReplacementInfo() for returning the information that a replacement policy might need
+ * - ReplacementInfoType, the type of that information. The cache array owns it in a contiguous
+ *   array and passes each line a pointer to its entry in the constructor (size, index, info)
+ *   and through setReplacementInfo() on restart
  * - isAllocated() to determine whether the line is currently allocated/valid
  */
 
@@ -53,8 +56,11 @@ class DirectoryLine {
         bool was_prefetch_;
 
     public:
-        DirectoryLine(uint32_t size, unsigned int index) : index_(index) {
-            info_ = new CoherenceReplacementInfo(index, I, false, false);
+        typedef CoherenceReplacementInfo ReplacementInfoType;
+
+        DirectoryLine(uint32_t size, unsigned int index, CoherenceReplacementInfo* info) : index_(index) {
+            info_ = info;
+            info_->setIndex(index);
             reset();
         }
         ~DirectoryLine() = default;
@@ -118,6 +124,7 @@ class DirectoryLine {
 
         // Replacement
         ReplacementInfo* getReplacementInfo() { return info_; }
+        void setReplacementInfo(CoherenceReplacementInfo* info) { info_ = info; }
 
         // Validity
         bool isAllocated() { return state_ != I; }
@@ -143,7 +150,6 @@ class DirectoryLine {
             SST_SER(sharers_);
             SST_SER(owner_);
             SST_SER(last_send_timestamp_);
-            SST_SER(info_);
             SST_SER(was_prefetch_);
         }
 };
@@ -157,9 +163,12 @@ class DataLine {
         DirectoryLine* tag_;
         CoherenceReplacementInfo* info_;
     public:
-        DataLine(uint8_t size, unsigned int index) : index_(index) {
+        typedef CoherenceReplacementInfo ReplacementInfoType;
+
+        DataLine(uint8_t size, unsigned int index, CoherenceReplacementInfo* info) : index_(index) {
             data_.resize(size);
-            info_ = new CoherenceReplacementInfo(index, I, false, false);
+            info_ = info;
+            info_->setIndex(index);
             reset();
         }
         ~DataLine() { }
@@ -186,12 +195,13 @@ class DataLine {
 
         // Data
         vector<uint8_t>* getData() { return &data_; }
-        void setData(vector<uint8_t> data, uint32_t offset) {
+        void setData(const vector<uint8_t>& data, uint32_t offset) {
             std::copy(data.begin(), data.end(), data_.begin() + offset);
         }
 
         // Replacement
         ReplacementInfo* getReplacementInfo() { return (tag_ != nullptr ? tag_->getReplacementInfo() : info_); }
+        void setReplacementInfo(CoherenceReplacementInfo* info) { info_ = info; }
 
         // Validity
         bool isAllocated() { return tag_ != nullptr; }
@@ -207,7 +217,83 @@ class DataLine {
             SST_SER(addr_);
             SST_SER(data_);
             SST_SER(tag_);
-            SST_SER(info_);
+        }
+};
+
+/*
+ * Per-sector valid/dirty bits for sectored lines
+ * A line is divided into at most 64 equal, power-of-two sized sectors. With one sector (the
+ * default) sectoring is disabled, the line's coherence state alone determines validity and
+ * updates are ignored. Masks have bit i set for sector i.
+ */
+class LineSectors {
+    private:
+        uint32_t shift_;    // log2(sector size)
+        uint32_t count_;    // Sectors per line
+        uint64_t valid_;
+        uint64_t dirty_;
+
+    public:
+        LineSectors() : shift_(0), count_(1), valid_(0), dirty_(0) { }
+
+        /* Caller checks that sector_size is a power of two that divides line_size into at most 64 sectors */
+        void configure(uint32_t line_size, uint32_t sector_size) {
+            shift_ = log2Of(sector_size);
+            count_ = line_size >> shift_;
+            reset();
+        }
+
+        void reset() { if (enabled()) { valid_ = 0; dirty_ = 0; } }
+
+        bool enabled() const { return count_ > 1; }
+        uint32_t count() const { return count_; }
+        uint32_t sectorSize() const { return 1u << shift_; }
+        uint64_t all() const { return count_ == 64 ? ~0ULL : ((1ULL << count_) - 1); }
+
+        /* Sectors touched by the bytes [offset, offset + bytes) of the line */
+        uint64_t mask(uint64_t offset, uint64_t bytes) const {
+            if (bytes == 0) return 0;
+            uint64_t first = offset >> shift_;
+            uint64_t last = (offset + bytes - 1) >> shift_;
+            if (last >= count_) last = count_ - 1;
+            uint64_t upper = (last == 63) ? ~0ULL : ((1ULL << (last + 1)) - 1);
+            return upper & ~((1ULL << first) - 1);
+        }
+
+        // Valid & dirty
+        uint64_t getValid() const { return valid_; }
+        uint64_t getDirty() const { return dirty_; }
+        bool isValid(uint64_t mask) const { return (valid_ & mask) == mask; }
+        void setValid(uint64_t mask) { if (enabled()) valid_ |= mask; }
+        void setDirty(uint64_t mask) { if (enabled()) { dirty_ |= mask; valid_ |= mask; } }
+        void invalidate(uint64_t mask) { if (enabled()) { valid_ &= ~mask; dirty_ &= ~mask; } }
+        void clean(uint64_t mask) { if (enabled()) dirty_ &= ~mask; }
+
+        /* Find the next run of contiguous sectors in 'mask' starting at or after 'first'.
+         * On success, 'first' is the first sector of the run and 'n' its length */
+        bool nextRun(uint64_t mask, uint32_t& first, uint32_t& n) const {
+            if (first >= 64) return false;
+            mask &= ~((1ULL << first) - 1);
+            if (!mask) return false;
+            first = __builtin_ctzll(mask);
+            uint64_t rest = ~(mask >> first);
+            n = rest ? __builtin_ctzll(rest) : 64 - first;
+            return true;
+        }
+
+        static uint32_t popcount(uint64_t mask) { return __builtin_popcountll(mask); }
+
+        std::string getString() const {
+            std::ostringstream str;
+            str << std::hex << "V: 0x" << valid_ << " D: 0x" << dirty_;
+            return str.str();
+        }
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) {
+            SST_SER(shift_);
+            SST_SER(count_);
+            SST_SER(valid_);
+            SST_SER(dirty_);
         }
 };
 
@@ -218,6 +304,7 @@ class CacheLine : public SST::Core::Serialization::serializable {
         Addr addr_;
         State state_;
         vector<uint8_t> data_;
+        LineSectors* sectors_;  // Per-sector state if sectored (see LineSectors), otherwise unsectored()
 
         // Timing
         uint64_t lastSendTimestamp_;
@@ -227,17 +314,27 @@ class CacheLine : public SST::Core::Serialization::serializable {
 
         virtual void updateReplacement() = 0;
     public:
-        CacheLine(uint32_t size, unsigned int index) : index_(index) {
+        CacheLine(uint32_t size, unsigned int index) : index_(index), sectors_(unsectored()) {
             reset();
             data_.resize(size);
         }
-        virtual ~CacheLine() { }
+        virtual ~CacheLine() {
+            if (sectors_ != unsectored())
+                delete sectors_;
+        }
+
+        /* Shared by lines that are not sectored; LineSectors ignores updates when disabled */
+        static LineSectors* unsectored() {
+            static LineSectors none;
+            return &none;
+        }
 
         void reset() {
             addr_ = NO_ADDR;
             state_ = I;
             lastSendTimestamp_ = 0;
             wasPrefetch_ = false;
+            sectors_->reset();
         }
 
         // Index
@@ -253,10 +350,25 @@ class CacheLine : public SST::Core::Serialization::serializable {
 
         // Data
         vector<uint8_t>* getData() { return &data_; }
-        void setData(vector<uint8_t> in, uint32_t offset) {
+        void setData(const vector<uint8_t>& in, uint32_t offset) {
             std::copy(in.begin(), in.end(), std::next(data_.begin(), offset));
         }
 
+        /* Write dirty data, e.g., from a PutM. The sectors it covers are marked dirty */
+        void setDirtyData(const vector<uint8_t>& in, uint32_t offset) {
+            sectors_->setDirty(sectors_->mask(offset, in.size()));
+            setData(in, offset);
+        }
+
+        // Sectors
+        /* Only allocate per-sector state for sectored lines */
+        void setSectored(uint32_t line_size, uint32_t sector_size) {
+            if (sectors_ == unsectored())
+                sectors_ = new LineSectors();
+            sectors_->configure(line_size, sector_size);
+        }
+        LineSectors* getSectors() { return sectors_; }
+
         // Timestamp
         uint64_t getTimestamp() { return lastSendTimestamp_; }
         void setTimestamp(uint64_t timestamp) { lastSendTimestamp_ = timestamp; }
@@ -275,15 +387,24 @@ class CacheLine : public SST::Core::Serialization::serializable {
             std::ostringstream str;
             str << std::hex << "0x" << addr_;
             str << " State: " << StateString[state_];
+            if (sectors_->enabled())
+                str << " " << sectors_->getString();
             return str.str();
         }
 
-        CacheLine() : index_(0) {}
+        CacheLine() : index_(0), sectors_(unsectored()) {}
         virtual void serialize_order(SST::Core::Serialization::serializer& ser) override {
             SST_SER(const_cast<unsigned int&>(index_));
             SST_SER(addr_);
             SST_SER(state_);
             SST_SER(data_);
+            bool sectored = sectors_->enabled();
+            SST_SER(sectored);
+            if (sectored) {
+                if (ser.mode() == SST::Core::Serialization::serializer::UNPACK)
+                    sectors_ = new LineSectors();
+                SST_SER(*sectors_);
+            }
             SST_SER(lastSendTimestamp_);
             SST_SER(wasPrefetch_);
         }
@@ -304,12 +425,14 @@ class L1CacheLine : public CacheLine {
     protected:
         void updateReplacement() override { info_->setState(state_); }
     public:
-        L1CacheLine(uint32_t size, unsigned int index) : CacheLine(size, index), LLSC_(false), LLSCTime_(0), userLock_(0), eventsWaitingForLock_(false) {
-            info_ = new ReplacementInfo(index, I);
-        }
-        virtual ~L1CacheLine() {
-            delete info_;
+        typedef ReplacementInfo ReplacementInfoType;
+
+        L1CacheLine(uint32_t size, unsigned int index, ReplacementInfo* info) : CacheLine(size, index), LLSC_(false), LLSCTime_(0), userLock_(0), eventsWaitingForLock_(false) {
+            info_ = info;
+            info_->setIndex(index);
+            info_->setState(I);
         }
+        virtual ~L1CacheLine() { }
 
         void reset() {
             CacheLine::reset();
@@ -352,6 +475,7 @@ class L1CacheLine : public CacheLine {
         void setEventsWaitingForLock(bool eventsWaiting) { eventsWaitingForLock_ = eventsWaiting; }
 
         ReplacementInfo * getReplacementInfo() override { return info_; }
+        void setReplacementInfo(ReplacementInfo* info) { info_ = info; }
 
         // String-ify for debugging
         std::string getString() {
@@ -375,7 +499,6 @@ class L1CacheLine : public CacheLine {
             SST_SER(LLSCTidBuf_);
             SST_SER(userLock_);
             SST_SER(eventsWaitingForLock_);
-            SST_SER(info_);
       }
       ImplementSerializable(SST::MemHierarchy::L1CacheLine);
 };
@@ -389,14 +512,16 @@ class SharedCacheLine : public CacheLine {
     protected:
         virtual void updateReplacement() override { info_->setState(state_); }
     public:
-        SharedCacheLine(uint32_t size, unsigned int index) : CacheLine(size, index), owner_("") {
-            info_ = new CoherenceReplacementInfo(index, I, false, false);
-        }
+        typedef CoherenceReplacementInfo ReplacementInfoType;
 
-        virtual ~SharedCacheLine() {
-             delete info_;
+        SharedCacheLine(uint32_t size, unsigned int index, CoherenceReplacementInfo* info) : CacheLine(size, index), owner_("") {
+            info_ = info;
+            info_->setIndex(index);
+            info_->reset();
         }
 
+        virtual ~SharedCacheLine() { }
+
         void reset() {
             CacheLine::reset();
             sharers_.clear();
@@ -433,6 +558,7 @@ class SharedCacheLine : public CacheLine {
 
         // Replacement
         ReplacementInfo * getReplacementInfo() override { return info_; }
+        void setReplacementInfo(CoherenceReplacementInfo* info) { info_ = info; }
 
         // String-ify for debugging
         std::string getString() {
@@ -452,7 +578,6 @@ class SharedCacheLine : public CacheLine {
             CacheLine::serialize_order(ser);
             SST_SER(sharers_);
             SST_SER(owner_);
-            SST_SER(info_);
         }
         ImplementSerializable(SST::MemHierarchy::SharedCacheLine);
 
@@ -467,8 +592,12 @@ class PrivateCacheLine : public CacheLine {
     protected:
         virtual void updateReplacement() override { info_->setState(state_); }
     public:
-        PrivateCacheLine(uint32_t size, unsigned int index) : CacheLine(size, index), shared_(false), owned_(false) {
-            info_ = new CoherenceReplacementInfo(index, I, false, false);
+        typedef CoherenceReplacementInfo ReplacementInfoType;
+
+        PrivateCacheLine(uint32_t size, unsigned int index, CoherenceReplacementInfo* info) : CacheLine(size, index), shared_(false), owned_(false) {
+            info_ = info;
+            info_->setIndex(index);
+            info_->reset();
         }
 
         virtual ~PrivateCacheLine() { }
@@ -490,6 +619,7 @@ class PrivateCacheLine : public CacheLine {
 
         // Replacement
         ReplacementInfo * getReplacementInfo() override { return info_; }
+        void setReplacementInfo(CoherenceReplacementInfo* info) { info_ = info; }
 
         // String-ify for debugging
         std::string getString() {
@@ -505,7 +635,6 @@ class PrivateCacheLine : public CacheLine {
             CacheLine::serialize_order(ser);
             SST_SER(shared_);
             SST_SER(owned_);
-            SST_SER(info_);
         }
         ImplementSerializable(SST::MemHierarchy::PrivateCacheLine);
 };
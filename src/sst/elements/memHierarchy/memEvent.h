@@ -25,6 +25,7 @@
 
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/lineBuffer.h"
 #include "sst/elements/memHierarchy/memTypes.h"
 
 namespace SST { namespace MemHierarchy {
@@ -44,32 +45,46 @@ class MemEvent : public MemEventBase  {
 public:
 
     /* Constructor - Coherence control */
-    MemEvent(std::string src, Addr addr, Addr baseAddr, Command cmd) : MemEventBase(src, cmd) {
+    MemEvent(EndpointID src, Addr addr, Addr baseAddr, Command cmd) : MemEventBase(src, cmd) {
         initialize();
         addr_ = addr;
         baseAddr_ = baseAddr;
     }
     /* Constructor - Events that request data */
-    MemEvent(std::string src, Addr addr, Addr baseAddr, Command cmd, uint32_t size) : MemEventBase(src, cmd) {
+    MemEvent(EndpointID src, Addr addr, Addr baseAddr, Command cmd, uint32_t size) : MemEventBase(src, cmd) {
         initialize();
         addr_ = addr;
         baseAddr_ = baseAddr;
         size_ = size;
     }
     /* Constructor - Events that carry data */
-    MemEvent(std::string src, Addr addr, Addr baseAddr, Command cmd, std::vector<uint8_t>& data) : MemEventBase(src, cmd) {
+    MemEvent(EndpointID src, Addr addr, Addr baseAddr, Command cmd, const std::vector<uint8_t>& data) : MemEventBase(src, cmd) {
+        initialize();
+        addr_ = addr;
+        baseAddr_ = baseAddr;
+        setPayload(data);
+    }
+    /* Constructor - Events that carry data shared with another event or the MSHR */
+    MemEvent(EndpointID src, Addr addr, Addr baseAddr, Command cmd, const LineBuffer& data) : MemEventBase(src, cmd) {
         initialize();
         addr_ = addr;
         baseAddr_ = baseAddr;
         setPayload(data);
     }
     /* Constructor - Events that are not routed by address */
-    MemEvent(std::string src, Command cmd) : MemEventBase(src, cmd) {
+    MemEvent(EndpointID src, Command cmd) : MemEventBase(src, cmd) {
         initialize();
         addr_ = 0;
         baseAddr_ = 0;
     }
 
+    /* String versions of the above, these intern 'src' on every call so prefer the EndpointID versions during simulation */
+    MemEvent(std::string src, Addr addr, Addr baseAddr, Command cmd) : MemEvent(EndpointTable::intern(src), addr, baseAddr, cmd) { }
+    MemEvent(std::string src, Addr addr, Addr baseAddr, Command cmd, uint32_t size) : MemEvent(EndpointTable::intern(src), addr, baseAddr, cmd, size) { }
+    MemEvent(std::string src, Addr addr, Addr baseAddr, Command cmd, const std::vector<uint8_t>& data) : MemEvent(EndpointTable::intern(src), addr, baseAddr, cmd, data) { }
+    MemEvent(std::string src, Addr addr, Addr baseAddr, Command cmd, const LineBuffer& data) : MemEvent(EndpointTable::intern(src), addr, baseAddr, cmd, data) { }
+    MemEvent(std::string src, Command cmd) : MemEvent(EndpointTable::intern(src), cmd) { }
+
     ~MemEvent() { }
 
     /** Create a new MemEvent instance, pre-configured to act as a NACK response */
@@ -182,18 +197,36 @@ public:
     void setSuccess(bool b) { b ? clearFlag(MemEventBase::F_FAIL) : setFlag(MemEventBase::F_FAIL); }
     bool success() { return !queryFlag(MemEventBase::F_FAIL); }
 
-    /** @return  the data payload. */
+    /** @return  the data payload, for modification.
+     * Copies the payload first if it is shared with another event or the MSHR.
+     * Use getPayloadBuffer() to read or share the payload without copying.
+     */
     dataVec& getPayload(void) {
         /* Lazily allocate space for payload */
-        if ( payload_.size() < size_ )  payload_.resize(size_);
-        return payload_;
+        dataVec& payload = payload_.writable();
+        if ( payload.size() < size_ )  payload.resize(size_);
+        return payload;
     }
 
+    /** @return  the data payload as a shareable buffer. getPayloadBuffer().data() reads it as a dataVec. */
+    const LineBuffer& getPayloadBuffer(void) {
+        /* Lazily allocate space for payload */
+        if ( payload_.size() < size_ )  payload_.writable().resize(size_);
+        return payload_;
+    }
 
     /** Sets the data payload and payload size.
      * @param[in] data  Vector from which to copy data
      */
-    void setPayload(std::vector<uint8_t>& data) {
+    void setPayload(const std::vector<uint8_t>& data) {
+        setSize(data.size());
+        payload_.assign(data);
+    }
+
+    /** Sets the data payload and payload size without copying.
+     * @param[in] data  Buffer to share
+     */
+    void setPayload(const LineBuffer& data) {
         setSize(data.size());
         payload_ = data;
     }
@@ -204,16 +237,12 @@ public:
      */
     void setPayload(uint32_t size, uint8_t* data) {
         setSize(size);
-        payload_.resize(size);
-        for ( uint32_t i = 0 ; i < size ; i++ ) {
-            payload_[i] = data[i];
-        }
+        payload_.assign(data, size);
     }
 
     void setZeroPayload(uint32_t size) {
         setSize(size);
-        payload_.clear();
-        payload_.resize(size, 0);
+        payload_.assign(size, 0);
     }
 
     size_t getPayloadSize() override {
@@ -304,7 +333,7 @@ private:
     bool      addrGlobal_;        // Whether address is a local or global address
     MemEvent* NACKedEvent_;       // For a NACK, pointer to the NACKed event
     int       retries_;           // For NACKed events, how many times a retry has been sent
-    dataVec   payload_;           // Data
+    LineBuffer payload_;          // Data, shared with responses and the MSHR where possible
     bool      prefetch_;          // Whether this request came from a prefetcher
     bool      dirty_;             // For a replacement, whether the data is dirty or not
     bool      isEvict_;           // Whether an event is an eviction
@@ -322,7 +351,7 @@ public:
         SST_SER(addrGlobal_);
         SST_SER(NACKedEvent_);
         SST_SER(retries_);
-        SST_SER(payload_);
+        payload_.serialize(ser);
         SST_SER(prefetch_);
         SST_SER(dirty_);
         SST_SER(isEvict_);
@@ -22,6 +22,7 @@
 
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/endpointTable.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -42,21 +43,24 @@ public:
     static const uint32_t F_LLSC            = 0x00000100;
     static const uint32_t F_FAIL            = 0x00001000;
     static const uint32_t F_NORESPONSE      = 0x00010000;
+    static const uint32_t F_WARMUP          = 0x00100000; // Functional warmup copy, see CoherenceController::handleWarmup()
 
 
     /** Creates a new MemEventBase */
-    MemEventBase(std::string src, Command cmd) : SST::Event() {
+    MemEventBase(EndpointID src, Command cmd) : SST::Event() {
         setDefaults();
         cmd_ = cmd;
         src_ = src;
     }
+    /** Creates a new MemEventBase, interning 'src'. Prefer the EndpointID version during simulation */
+    MemEventBase(std::string src, Command cmd) : MemEventBase(EndpointTable::intern(src), cmd) { }
 
     virtual void setDefaults() {
         eventID_        = generateUniqueId();  // Defined in SST::Event
         responseToID_   = NO_ID;
-        dst_            = NONE;
-        src_            = NONE;
-        rqstr_          = NONE;
+        dst_            = EndpointTable::NONE_ID;
+        src_            = EndpointTable::NONE_ID;
+        rqstr_          = EndpointTable::NONE_ID;
         cmd_            = Command::NULLCMD;
         flags_          = 0;
         memFlags_       = 0;
@@ -98,19 +102,27 @@ public:
     void setCmd(Command newcmd) { cmd_ = newcmd; }
 
     /** @return the source string - who sent this MemEvent */
-    const std::string& getSrc(void) const { return src_; }
+    const std::string& getSrc(void) const { return EndpointTable::name(src_); }
     /** Sets the source string - who sent this MemEvent */
-    void setSrc(const std::string& src) { src_ = src; }
+    void setSrc(const std::string& src) { src_ = EndpointTable::intern(src); }
 
     /** @return the destination string - who receives this MemEvent */
-    const std::string& getDst(void) const { return dst_; }
+    const std::string& getDst(void) const { return EndpointTable::name(dst_); }
     /** Sets the destination string - who received this MemEvent */
-    void setDst(const std::string& dst) { dst_ = dst; }
+    void setDst(const std::string& dst) { dst_ = EndpointTable::intern(dst); }
 
     /** @return the requestor string - whose original request caused this MemEvent */
-    const std::string& getRqstr(void) const { return rqstr_; }
+    const std::string& getRqstr(void) const { return EndpointTable::name(rqstr_); }
     /** Sets the requestor string - whose original request caused this MemEvent */
-    void setRqstr(const std::string& rqstr) { rqstr_ = rqstr; }
+    void setRqstr(const std::string& rqstr) { rqstr_ = EndpointTable::intern(rqstr); }
+
+    /** Interned (EndpointTable) versions of the above - prefer these during simulation */
+    EndpointID getSrcID(void) const { return src_; }
+    void setSrcID(EndpointID src) { src_ = src; }
+    EndpointID getDstID(void) const { return dst_; }
+    void setDstID(EndpointID dst) { dst_ = dst; }
+    EndpointID getRqstrID(void) const { return rqstr_; }
+    void setRqstrID(EndpointID rqstr) { rqstr_ = rqstr; }
 
     /** @return the thread ID that originated the original request */
     [[deprecated("Use getThreadID() instead (with capital 'D')")]]
@@ -168,6 +180,11 @@ public:
             str += "F_NORESPONSE";
             addComma = true;
         }
+        if (flags_ & F_WARMUP) {
+            if (addComma) str += ", ";
+            str += "F_WARMUP";
+            addComma = true;
+        }
         str += "]";
         return str;
     }
@@ -182,7 +199,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream str;
         str << " Flags: " << getFlagString();
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Rq: " + rqstr_ + " Tid: " + std::to_string(tid_) + str.str();
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Rq: " + getRqstr() + " Tid: " + std::to_string(tid_) + str.str();
     }
 
     /** Get brief print of the event */
@@ -190,7 +207,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream idstring;
         idstring << "<" << eventID_.first << "," << eventID_.second << "> ";
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Tid: " + std::to_string(tid_);
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Tid: " + std::to_string(tid_);
     }
 
     /** Get brief print of the event */
@@ -198,7 +215,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream idstring;
         idstring << "<" << eventID_.first << "," << eventID_.second << "> ";
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Tid: " + std::to_string(tid_);
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Tid: " + std::to_string(tid_);
     }
 
     virtual bool doDebug(std::set<Addr> &UNUSED(addr)) {
@@ -220,9 +237,9 @@ public:
 protected:
     id_type         eventID_;           // Unique ID for this event
     id_type         responseToID_;      // For responses, holds the ID to which this event matches
-    string          src_;               // Source ID
-    string          dst_;               // Destination ID
-    string          rqstr_;             // Cache that originated this request
+    EndpointID      src_;               // Source ID
+    EndpointID      dst_;               // Destination ID
+    EndpointID      rqstr_;             // Cache that originated this request
     uint32_t        tid_;               // Thread ID that originated this request
     Command         cmd_;               // Command
     uint32_t        flags_;
@@ -235,9 +252,9 @@ public:
         Event::serialize_order(ser);
         SST_SER(eventID_);
         SST_SER(responseToID_);
-        SST_SER(src_);
-        SST_SER(dst_);
-        SST_SER(rqstr_);
+        EndpointTable::serialize(ser, src_);
+        EndpointTable::serialize(ser, dst_);
+        EndpointTable::serialize(ser, rqstr_);
         SST_SER(tid_);
         SST_SER(cmd_);
         SST_SER(flags_);
@@ -469,10 +486,11 @@ public:
 
     enum class ReachableGroup { Source, Dest, Peer, Unknown };
 
-    MemEventInitRegion(std::string src, MemRegion region, ReachableGroup group = ReachableGroup::Unknown) :
-        MemEventInit(src, InitCommand::Region), region_(region), group_(group) { }
+    MemEventInitRegion(std::string src, MemRegion region, ReachableGroup group = ReachableGroup::Unknown, uint32_t sliceHash = 0) :
+        MemEventInit(src, InitCommand::Region), region_(region), group_(group), sliceHash_(sliceHash) { }
 
     MemRegion getRegion() { return region_; }
+    uint32_t getSliceHash() { return sliceHash_; }
 
     ReachableGroup getGroup() { return group_; }
     void setGroup(ReachableGroup group) { group_ = group; }
@@ -486,12 +504,14 @@ public:
         if (group_ == ReachableGroup::Source) groupstr = "Source";
         else if (group_ == ReachableGroup::Dest) groupstr = "Dest";
         else if (group_ == ReachableGroup::Peer) groupstr = "Peer";
-        return MemEventInit::getVerboseString(level) + region_.toString() + " Group: " + groupstr.c_str();
+        return MemEventInit::getVerboseString(level) + region_.toString() + " Group: " + groupstr.c_str()
+            + (sliceHash_ ? " SliceHash: " + std::to_string(sliceHash_) : "");
     }
 
 private:
     MemRegion region_;  // MemRegion for source
     ReachableGroup group_; // Whether sent from a source/dest/peer or something else (unknown)
+    uint32_t sliceHash_ = 0; // Non-zero if region_ is assigned by slice hash (see SliceHash)
 
     MemEventInitRegion() {} // For serialization only
 
@@ -500,6 +520,7 @@ public:
         MemEventInit::serialize_order(ser);
         SST_SER(region_);
         SST_SER(group_);
+        SST_SER(sliceHash_);
     }
 
     ImplementSerializable(SST::MemHierarchy::MemEventInitRegion);
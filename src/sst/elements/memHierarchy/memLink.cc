@@ -49,7 +49,7 @@ void MemLink::init(unsigned int phase) {
         // the bus will update the group to the correct one since it has a notion of "high" (source) vs "low" (dest) ports.
         // Otherwise, the group will be incorrect if this MemLink is loaded into a 'highlink' subcomponent slot.
         // Not a problem unless we start treating source & dest differently.
-        MemEventInitRegion * ev = new MemEventInitRegion(info.name, info.region, MemEventInitRegion::ReachableGroup::Dest);
+        MemEventInitRegion * ev = new MemEventInitRegion(info.name, info.region, MemEventInitRegion::ReachableGroup::Dest, info.sliceHash);
         dbg.debug(_L10_, "%s sending region init message: %s\n", getName().c_str(), ev->getVerboseString().c_str());
         link_->sendUntimedData(ev);
     }
@@ -68,6 +68,7 @@ void MemLink::init(unsigned int phase) {
                     ep_info.addr = 0;
                     ep_info.id = 0;
                     ep_info.region = mEvRegion->getRegion();
+                    ep_info.sliceHash = mEvRegion->getSliceHash();
                     addRemote(ep_info);
                 } else {
                     EndpointInfo ep_info;
@@ -76,7 +77,7 @@ void MemLink::init(unsigned int phase) {
                     ep_info.id = 0;
                     ep_info.region = mEvRegion->getRegion();
                     peers_.insert(ep_info);
-                    reachable_names_.insert(ep_info.name);
+                    addReachable(ep_info.name);
                     peer_names_.insert(ep_info.name);
 
                 }
@@ -190,7 +191,25 @@ MemEventInit * MemLink::recvUntimedData() {
 
 void MemLink::addRemote(EndpointInfo info) {
     remotes_.insert(info);
-    reachable_names_.insert(info.name);
+    addReachable(info.name);
+    buildRemoteIDs();
+}
+
+void MemLink::addReachable(const std::string& name) {
+    reachable_names_.insert(name);
+    reachable_ids_.insert(EndpointTable::intern(name));
+}
+
+/* Remotes are only added during init so rebuilding on each add is fine */
+void MemLink::buildRemoteIDs() {
+    remote_ids_.clear();
+    for (std::set<EndpointInfo>::const_iterator it = remotes_.begin(); it != remotes_.end(); it++) {
+        RemoteRoute route;
+        route.region = it->region;
+        route.hashed = (it->sliceHash != 0) && route.hash.configure(it->region, it->sliceHash);
+        route.id = EndpointTable::intern(it->name);
+        remote_ids_.push_back(route);
+    }
 }
 
 void MemLink::addEndpoint(EndpointInfo info) {
@@ -257,16 +276,25 @@ std::string MemLink::getTargetDestination(Addr addr) {
 }
 
 std::string MemLink::findTargetDestination(Addr addr) {
-    for (std::set<EndpointInfo>::const_iterator it = remotes_.begin(); it != remotes_.end(); it++) {
-        if (it->region.contains(addr)) return it->name;
-    }
-    return "";
+    EndpointID dst = findTargetDestinationID(addr);
+    return dst == EndpointTable::NONE_ID ? "" : EndpointTable::name(dst);
 }
 
 bool MemLink::isReachable(std::string dst) {
    return reachable_names_.find(dst) != reachable_names_.end();
 }
 
+EndpointID MemLink::findTargetDestinationID(Addr addr) {
+    for (auto it = remote_ids_.begin(); it != remote_ids_.end(); it++) {
+        if (it->contains(addr)) return it->id;
+    }
+    return EndpointTable::NONE_ID;
+}
+
+bool MemLink::isReachable(EndpointID dst) {
+    return reachable_ids_.find(dst) != reachable_ids_.end();
+}
+
 std::string MemLink::getAvailableDestinationsAsString() {
     std::stringstream str;
     for (std::set<EndpointInfo>::const_iterator it = endpoints_.begin(); it != endpoints_.end(); it++) {
@@ -285,4 +313,10 @@ void MemLink::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(reachable_names_);
     SST_SER(peer_names_);
     SST_SER(init_send_queue_); // Doesn't actually need to be included
+
+    if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+        buildRemoteIDs();
+        for (auto it = reachable_names_.begin(); it != reachable_names_.end(); it++)
+            reachable_ids_.insert(EndpointTable::intern(*it));
+    }
 }
@@ -109,6 +109,8 @@ public:
     virtual std::string findTargetDestination(Addr addr) override;
     virtual std::string getTargetDestination(Addr addr) override;
     virtual bool isReachable(std::string dst) override;
+    virtual EndpointID findTargetDestinationID(Addr addr) override;
+    virtual bool isReachable(EndpointID dst) override;
 
     /* Send and receive functions for MemLink */
     virtual void sendUntimedData(MemEventInit * ev, bool broadcast, bool lookup_dst) override;
@@ -130,6 +132,8 @@ public:
 protected:
     void addRemote(EndpointInfo info);
     void addEndpoint(EndpointInfo info);
+    void addReachable(const std::string& name);
+    void buildRemoteIDs();
 
     // Link
     SST::Link* link_;
@@ -141,6 +145,17 @@ protected:
     std::set<std::string> reachable_names_;     // Tracks reachable names for faster lookup than iterating via remotes/peers
     std::set<std::string> peer_names_;          // Tracks peer names for faster lookup than iterating via peers
 
+    // Interned versions of remotes_ (in the same order) and reachable_names_, rebuilt rather than serialized
+    struct RemoteRoute {
+        MemRegion region;
+        bool hashed;        // Region is assigned by slice hash
+        SliceHash hash;
+        EndpointID id;
+        bool contains(Addr addr) const { return hashed ? hash.contains(addr) : region.contains(addr); }
+    };
+    std::vector<RemoteRoute> remote_ids_;
+    std::unordered_set<EndpointID> reachable_ids_;
+
     // For events that require destination names during init
     std::set<MemEventInit*> init_send_queue_;
 
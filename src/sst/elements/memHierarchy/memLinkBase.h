@@ -30,6 +30,7 @@
 #include "sst/elements/memHierarchy/memEventBase.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/hash.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -55,6 +56,7 @@ public:
         uint64_t addr;      /* Component address */
         uint32_t id;        /* Which memory level or group this component belongs to - for determining which components are sources or destinations */
         MemRegion region;   /* Address region associated with this component */
+        uint32_t sliceHash = 0; /* If non-zero, the region's interleaved chunks are assigned by an XOR slice hash over this many bits (see SliceHash) */
 
         bool operator<(const EndpointInfo &o) const {
             if (region != o.region) {
@@ -69,6 +71,7 @@ public:
             std::stringstream str;
             str << "Name: " << name << std::hex << " Addr: " << addr;
             str << std::dec << " ID: " << id << " Region: " << region.toString();
+            if (sliceHash) str << " SliceHash: " << sliceHash;
             return str.str();
         }
 
@@ -77,6 +80,7 @@ public:
             SST_SER(addr);
             SST_SER(id);
             SST_SER(region);
+            SST_SER(sliceHash);
         }
     };
 
@@ -172,8 +176,25 @@ public:
     virtual std::string findTargetDestination(Addr addr) =0;    /* Return destination and return "" if none found */
     virtual std::string getTargetDestination(Addr addr) =0;     /* Return destination and error if none found */
 
+    /* Interned (EndpointTable) version of findTargetDestination(), returns EndpointTable::NONE_ID if none found.
+     * Links that can answer without building a string should override this */
+    virtual EndpointID findTargetDestinationID(Addr addr) {
+        std::string dst = findTargetDestination(addr);
+        return dst.empty() ? EndpointTable::NONE_ID : EndpointTable::intern(dst);
+    }
+
+    /* Interned version of getTargetDestination(), errors if none found */
+    EndpointID getTargetDestinationID(Addr addr) {
+        EndpointID dst = findTargetDestinationID(addr);
+        if (dst == EndpointTable::NONE_ID)
+            getTargetDestination(addr); // Reports the error
+        return dst;
+    }
+
     /* Check if a request address maps to our region */
-    virtual bool isRequestAddressValid(Addr addr) { return info.region.contains(addr); }
+    virtual bool isRequestAddressValid(Addr addr) {
+        return info.sliceHash ? slice_hash_.contains(addr) : info.region.contains(addr);
+    }
 
     /* Get a string-ized list of available destinations on this link */
     virtual std::string getAvailableDestinationsAsString() =0; // For debug
@@ -186,9 +207,20 @@ public:
     virtual bool isSource(std::string str) =0;     // Check whether a component is a source on this link. May be slow (for init() only)
     virtual bool isPeer(std::string str) =0;       // Check whether a component is a peer on this link. May be slow (for init() only)
     virtual bool isReachable(std::string dst) =0;  // Check whether a component is reachable on this link. Should be fast - used during simulation
+    virtual bool isReachable(EndpointID dst) { return isReachable(EndpointTable::name(dst)); }
 
     MemRegion getRegion() { return info.region; }
-    void setRegion(MemRegion region) { info.region = region; }
+    void setRegion(MemRegion region) {
+        info.region = region;
+        if (info.sliceHash) configureSliceHash();
+    }
+
+    /* Own the region's interleaved chunks by XOR slice hash over 'bits' bits instead of round-robin.
+     * Advertised to the rest of the system in this link's EndpointInfo */
+    void setSliceHash(uint32_t bits) {
+        info.sliceHash = bits;
+        if (info.sliceHash) configureSliceHash();
+    }
 
     EndpointInfo getEndpointInfo() { return info; }
     void setEndpointInfo(EndpointInfo i) { info = i; }
@@ -206,6 +238,7 @@ public:
         SST_SER(debug_addr_filter_);
         SST_SER(dlevel);
         SST_SER(info);
+        SST_SER(slice_hash_);
         SST_SER(recvHandler);
         SST_SER(untimed_receive_queue_);
     }
@@ -227,6 +260,15 @@ protected:
     std::queue<MemEventInit*> untimed_receive_queue_;     // queue for messages received during init/complete
 
 private:
+    void configureSliceHash() {
+        if (!slice_hash_.configure(info.region, info.sliceHash)) {
+            dbg.fatal(CALL_INFO, -1, "%s, Error: slice hashing requires an evenly interleaved region (interleave_step a multiple of interleave_size, addr_range_start a multiple of interleave_size) "
+                    "and at most 64 hash bits. Region: %s, hash bits: %" PRIu32 "\n",
+                    getName().c_str(), info.region.toString().c_str(), info.sliceHash);
+        }
+    }
+
+    SliceHash slice_hash_;  // Ownership check for info.region when info.sliceHash is set
 
 };
 
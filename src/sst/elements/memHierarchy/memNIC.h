@@ -76,6 +76,7 @@ public:
     /* Functions called by parent for handling events */
     void send(MemEventBase * ev) override;
     MemEventBase * recv();
+    EndpointID findTargetDestinationID(Addr addr) override { return findDestinationIDByRegion(addr); }
     bool isClocked() override { return false; }
 
     /* Callback to notify when link_control receives a message */
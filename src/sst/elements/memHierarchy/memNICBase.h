@@ -18,6 +18,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <queue>
 
 #include <sst/core/event.h>
@@ -153,7 +154,7 @@ class MemNICBase : public MemLinkBase {
             if (broadcast) {
                 req->dest = SST::Interfaces::SimpleNetwork::INIT_BROADCAST_ADDR;
             } else {
-                req->dest = lookupNetworkAddress(ev->getDst());
+                req->dest = lookupNetworkAddress(ev->getDstID());
             }
             req->givePayload(mre);
             if (!linkcontrol->isNetworkInitialized()) {
@@ -202,10 +203,8 @@ class MemNICBase : public MemLinkBase {
         virtual std::set<EndpointInfo>* getPeers() { return &peerEndpointInfo; }
 
         virtual std::string findTargetDestination(Addr addr) {
-            for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
-                if (it->region.contains(addr)) return it->name;
-            }
-            return "";
+            EndpointID dst = findDestinationIDByRegion(addr);
+            return dst == EndpointTable::NONE_ID ? "" : EndpointTable::name(dst);
         }
 
         virtual std::string getTargetDestination(Addr addr) {
@@ -228,6 +227,10 @@ class MemNICBase : public MemLinkBase {
             return reachableNames.find(dst) != reachableNames.end();
         }
 
+        virtual bool isReachable(EndpointID dst) {
+            return reachableIDs.find(dst) != reachableIDs.end();
+        }
+
         virtual std::string getAvailableDestinationsAsString() {
             stringstream str;
             for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
@@ -241,10 +244,13 @@ class MemNICBase : public MemLinkBase {
         virtual void addSource(EndpointInfo info) {
             sourceEndpointInfo.insert(info);
             reachableNames.insert(info.name);
+            reachableIDs.insert(EndpointTable::intern(info.name));
         }
         virtual void addDest(EndpointInfo info) {
             destEndpointInfo.insert(info);
+            destRoutesValid = false;
             reachableNames.insert(info.name);
+            reachableIDs.insert(EndpointTable::intern(info.name));
         }
 
         virtual void addPeer(EndpointInfo info) {
@@ -334,7 +340,7 @@ class MemNICBase : public MemLinkBase {
                 InitMemRtrEvent * imre = dynamic_cast<InitMemRtrEvent*>(payload);
                 if (imre) {
                     // Record name->address map for all other endpoints
-                    networkAddressMap.insert(std::make_pair(imre->info.name, imre->info.addr));
+                    networkAddressMap.insert(std::make_pair(EndpointTable::intern(imre->info.name), imre->info.addr));
                     processInitMemRtrEvent(imre);
                     delete imre;
                 } else {
@@ -465,6 +471,7 @@ class MemNICBase : public MemLinkBase {
                                 epInfo.addr = it->addr;
                                 epInfo.id = it->id;
                                 epInfo.region = (*mt);
+                                epInfo.sliceHash = it->sliceHash;
                                 newDests.insert(epInfo);
                             }
                     }
@@ -473,6 +480,7 @@ class MemNICBase : public MemLinkBase {
                 }
             }
             destEndpointInfo = newDests;
+            destRoutesValid = false;
 #ifdef __SST_DEBUG_OUTPUT__
             dbg.debug(_L10_, "    Endpoint Info Size after merge: %zu\n",destEndpointInfo.size());
             for (auto it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
@@ -507,7 +515,7 @@ class MemNICBase : public MemLinkBase {
             }
 #ifdef __SST_DEBUG_OUTPUT__
             for (auto it = networkAddressMap.begin(); it != networkAddressMap.end(); it++) {
-                dbg.debug(_L10_, "    Address: %s -> %" PRIu64 "\n", it->first.c_str(), it->second);
+                dbg.debug(_L10_, "    Address: %s -> %" PRIu64 "\n", EndpointTable::name(it->first).c_str(), it->second);
             }
             for (auto it = sourceEndpointInfo.begin(); it != sourceEndpointInfo.end(); it++) {
                 dbg.debug(_L10_, "    Source: %s\n", it->toString().c_str());
@@ -534,14 +542,62 @@ class MemNICBase : public MemLinkBase {
         }
 
         // Lookup the network address for a given endpoint
-        virtual uint64_t lookupNetworkAddress(const std::string &dst) const {
-            std::unordered_map<std::string,uint64_t>::const_iterator it = networkAddressMap.find(dst);
+        virtual uint64_t lookupNetworkAddress(EndpointID dst) const {
+            std::unordered_map<EndpointID,uint64_t>::const_iterator it = networkAddressMap.find(dst);
             if (it == networkAddressMap.end()) {
-                dbg.fatal(CALL_INFO, -1, "%s (MemNICBase), Network address for destination '%s' not found in networkAddressMap.\n", getName().c_str(), dst.c_str());
+                dbg.fatal(CALL_INFO, -1, "%s (MemNICBase), Network address for destination '%s' not found in networkAddressMap.\n", getName().c_str(), EndpointTable::name(dst).c_str());
             }
             return it->second;
         }
 
+        uint64_t lookupNetworkAddress(const std::string &dst) const {
+            return lookupNetworkAddress(EndpointTable::intern(dst));
+        }
+
+        // Map an address to the destination that owns it
+        // Evenly interleaved destinations (round-robin or slice hashed) are grouped and resolved with a
+        // slice -> endpoint table so routing does not scale with the number of slices; everything else
+        // is searched by region. Destinations only change during init/setup, the tables are rebuilt after
+        EndpointID findDestinationIDByRegion(Addr addr) {
+            if (!destRoutesValid)
+                buildDestinationRoutes();
+            for (auto it = destSliceGroups.begin(); it != destSliceGroups.end(); it++) {
+                if (addr < it->hash.lo() || addr > it->hash.end()) continue;
+                EndpointID dst = it->slices[it->hash.slice(addr)];
+                if (dst != EndpointTable::NONE_ID) return dst;
+            }
+            for (auto it = destRegionIDs.begin(); it != destRegionIDs.end(); it++) {
+                if (it->first.contains(addr)) return it->second;
+            }
+            return EndpointTable::NONE_ID;
+        }
+
+        void buildDestinationRoutes() {
+            destSliceGroups.clear();
+            destRegionIDs.clear();
+            for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
+                EndpointID dst = EndpointTable::intern(it->name);
+                SliceHash hash;
+                if (!hash.configure(it->region, it->sliceHash)) {
+                    if (it->sliceHash) // Destination validated its own region, filtering in setup() must have split it
+                        dbg.fatal(CALL_INFO, -1, "%s, Error: Cannot route to slice-hashed destination whose reachable region is not evenly interleaved: %s\n",
+                                getName().c_str(), it->toString().c_str());
+                    destRegionIDs.push_back(std::make_pair(it->region, dst));
+                    continue;
+                }
+                auto group = destSliceGroups.begin();
+                while (group != destSliceGroups.end() && !group->hash.sameGroup(hash)) group++;
+                if (group == destSliceGroups.end()) {
+                    destSliceGroups.push_back(DestSliceGroup());
+                    group = std::prev(destSliceGroups.end());
+                    group->hash = hash;
+                    group->slices.assign(hash.slices(), EndpointTable::NONE_ID);
+                }
+                group->slices[hash.index()] = dst;
+            }
+            destRoutesValid = true;
+        }
+
         /*
          * Some helper functions to avoid needing to repeat code everywhere
          */
@@ -590,7 +646,7 @@ class MemNICBase : public MemLinkBase {
                     return mre;
                 } else {
                     InitMemRtrEvent * imre = static_cast<InitMemRtrEvent*>(mre);
-                    if (networkAddressMap.find(imre->info.name) == networkAddressMap.end()) {
+                    if (networkAddressMap.find(EndpointTable::intern(imre->info.name)) == networkAddressMap.end()) {
                         dbg.fatal(CALL_INFO, -1, "%s received information about previously unknown endpoint. This case is not handled. Endpoint name: %s\n",
                                 getName().c_str(), imre->info.name.c_str());
                     }
@@ -613,12 +669,21 @@ class MemNICBase : public MemLinkBase {
         bool initMsgSent;
 
         // Data structures
-        std::unordered_map<std::string,uint64_t> networkAddressMap; // Map of name -> address for everything reachable on the network
+        std::unordered_map<EndpointID,uint64_t> networkAddressMap; // Map of name (interned) -> address for everything reachable on the network
         std::set<EndpointInfo> sourceEndpointInfo; // Region, network address, name, etc. of sources on the network
         std::set<EndpointInfo> destEndpointInfo;   // Region, network address, name, etc. of destinations on the network
         std::set<EndpointInfo> peerEndpointInfo;   // Region, network address, name, etc. of peers on the network
         std::map<std::string, std::set<MemRegion>> known_endpoints_;
         std::set<std::string> reachableNames;      // All reachable names on the network
+        std::unordered_set<EndpointID> reachableIDs;  // Interned reachableNames
+        // Routing tables for destEndpointInfo, see findDestinationIDByRegion()
+        struct DestSliceGroup {
+            SliceHash hash;
+            std::vector<EndpointID> slices; // Slice index -> destination, NONE_ID if not (yet) known
+        };
+        bool destRoutesValid = false;
+        std::vector<DestSliceGroup> destSliceGroups;
+        std::vector<std::pair<MemRegion, EndpointID>> destRegionIDs; // Destinations that are not part of a slice group
 
         // Untimed and init event queues
         std::queue<MemRtrEvent*> untimed_receive_queue_; // Queue for received untimed events
@@ -96,6 +96,7 @@ public:
     /* Functions called by parent for handling events */
     bool isClocked() override { return false; }
     void send(MemEventBase * ev) override;
+    EndpointID findTargetDestinationID(Addr addr) override { return findDestinationIDByRegion(addr); }
     bool recvNotifyReq(int);
     bool recvNotifyAck(int);
     bool recvNotifyFwd(int);
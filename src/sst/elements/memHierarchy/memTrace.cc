@@ -0,0 +1,119 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "memTrace.h"
+
+#include <string.h>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+using namespace SST::MemHierarchy;
+
+bool MemTraceWriter::open(const std::string& path, bool compress, size_t buffer_records, uint64_t tick_fs) {
+    if (compress) {
+#ifdef HAVE_LIBZ
+        gzfile_ = gzopen(path.c_str(), "wb");
+        if (!gzfile_)
+            return false;
+#else
+        return false;
+#endif
+    } else {
+        file_ = fopen(path.c_str(), "wb");
+        if (!file_)
+            return false;
+    }
+
+    MemTraceHeader header;
+    memset(&header, 0, sizeof(header));
+    strncpy(header.magic, MEMTRACE_MAGIC, sizeof(header.magic));
+    header.version = MEMTRACE_VERSION;
+    header.record_size = sizeof(MemTraceRecord);
+    header.tick_fs = tick_fs;
+    write(&header, sizeof(header));
+
+    capacity_ = buffer_records ? buffer_records : 1;
+    active_.reserve(capacity_);
+    flush_.reserve(capacity_);
+    stop_ = false;
+    flushing_ = false;
+    thread_ = std::thread(&MemTraceWriter::flushLoop, this);
+    return true;
+}
+
+/* Hand the active buffer to the flush thread, waiting for the previous one to be written */
+void MemTraceWriter::swap() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return !flushing_; });
+    active_.swap(flush_);
+    flushing_ = true;
+    lock.unlock();
+    cv_.notify_all();
+}
+
+void MemTraceWriter::flushLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this] { return flushing_ || stop_; });
+        if (flushing_) {
+            lock.unlock();
+            write(flush_.data(), flush_.size() * sizeof(MemTraceRecord));
+            flush_.clear();
+            lock.lock();
+            flushing_ = false;
+            cv_.notify_all();
+        } else if (stop_) {
+            return;
+        }
+    }
+}
+
+void MemTraceWriter::close() {
+    if (!isOpen())
+        return;
+
+    if (!active_.empty())
+        swap();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    thread_.join(); // Thread drains flush_ before it sees stop_
+
+#ifdef HAVE_LIBZ
+    if (gzfile_)
+        gzclose((gzFile)gzfile_);
+#endif
+    if (file_)
+        fclose(file_);
+    file_ = nullptr;
+    gzfile_ = nullptr;
+}
+
+void MemTraceWriter::write(const void* data, size_t bytes) {
+    if (bytes == 0)
+        return;
+#ifdef HAVE_LIBZ
+    if (gzfile_) {
+        gzwrite((gzFile)gzfile_, data, bytes);
+        return;
+    }
+#endif
+    fwrite(data, 1, bytes, file_);
+}
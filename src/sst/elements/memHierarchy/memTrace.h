@@ -0,0 +1,130 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_MEMTRACE_H
+#define MEMHIERARCHY_MEMTRACE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Binary memory access trace
+ *
+ * A trace is a MemTraceHeader followed by fixed-size MemTraceRecords, one per request. Records
+ * are in issue order; a record is written once its request and all earlier ones complete. Times are in ticks
+ * of the recording simulation's core time base; the header gives the tick length so a trace can
+ * be replayed under a different time base.
+ * Files written with compression are gzip streams; zlib reads both forms transparently.
+ * Fields are in host byte order.
+ */
+#define MEMTRACE_MAGIC      "MHTRACE"
+#define MEMTRACE_VERSION    1
+
+enum class MemTraceOp : uint8_t {
+    Read = 0,
+    Write,
+    ReadLock,
+    WriteUnlock,
+    LoadLink,
+    StoreConditional,
+    FlushLine,
+    FlushLineInv,
+    FlushAll,
+    Custom,
+    Other
+};
+
+/* Record flags */
+#define MEMTRACE_F_NONCACHEABLE 0x1 /* Request was noncacheable */
+#define MEMTRACE_F_NORESPONSE   0x2 /* Request did not need a response, latency is 0 */
+#define MEMTRACE_F_FAIL         0x4 /* Response indicated failure (e.g., store-conditional) */
+
+struct MemTraceHeader {
+    char magic[8];      // MEMTRACE_MAGIC
+    uint32_t version;   // MEMTRACE_VERSION
+    uint32_t record_size;
+    uint64_t tick_fs;   // Length of a time tick in femtoseconds
+};
+
+struct MemTraceRecord {
+    uint64_t time;      // Issue time (ticks)
+    uint64_t addr;      // Request address
+    uint64_t latency;   // Issue to response (ticks)
+    uint32_t size;      // Request size in bytes
+    uint8_t op;         // MemTraceOp
+    uint8_t flags;      // MEMTRACE_F_*
+    uint16_t reserved;
+};
+
+static_assert(sizeof(MemTraceHeader) == 24, "MemTraceHeader layout changed");
+static_assert(sizeof(MemTraceRecord) == 32, "MemTraceRecord layout changed");
+
+/*
+ * Trace writer
+ *
+ * Records are appended to one of two buffers. When the active buffer fills, the buffers are
+ * swapped and a background thread compresses and writes the full one, so the simulation thread
+ * only blocks if it fills a buffer before the previous one is on disk.
+ */
+class MemTraceWriter {
+public:
+    MemTraceWriter() : file_(nullptr), gzfile_(nullptr), flushing_(false), stop_(false) {}
+    ~MemTraceWriter() { close(); }
+
+    /* Open 'path' and write the header. Returns false if the file cannot be opened or
+     * compression was requested without zlib support */
+    bool open(const std::string& path, bool compress, size_t buffer_records, uint64_t tick_fs);
+
+    void record(const MemTraceRecord& rec) {
+        active_.push_back(rec);
+        if (active_.size() >= capacity_)
+            swap();
+    }
+
+    /* Write any buffered records, stop the flush thread and close the file */
+    void close();
+
+    bool isOpen() const { return file_ != nullptr || gzfile_ != nullptr; }
+
+private:
+    void swap();
+    void flushLoop();
+    void write(const void* data, size_t bytes);
+
+    FILE* file_;
+    void* gzfile_;              // gzFile if compressing
+    size_t capacity_;
+    std::vector<MemTraceRecord> active_;    // Appended to by the simulation thread
+    std::vector<MemTraceRecord> flush_;     // Written by the flush thread
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool flushing_;             // flush_ holds records not yet written
+    bool stop_;
+};
+
+}
+}
+
+#endif /* MEMHIERARCHY_MEMTRACE_H */
@@ -19,6 +19,9 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/mman.h>
+#include <algorithm>
+#include <cstdio>
+#include <vector>
 #include <sst/core/serialization/serializable.h>
 #include <sst/core/util/filesystem.h>
 #include "sst/elements/memHierarchy/util.h"
@@ -38,7 +41,7 @@ public:
     virtual void set( Addr addr, uint8_t value ) = 0;
 
     // Set 'size' bytes starting at 'addr' to 'data'
-    virtual void set( Addr addr, size_t size, std::vector<uint8_t>& data ) = 0;
+    virtual void set( Addr addr, size_t size, const std::vector<uint8_t>& data ) = 0;
 
     // Get the value of the byte at 'addr'
     virtual uint8_t get( Addr addr ) = 0;
@@ -57,74 +60,47 @@ public:
 /*
  * Old - mmap a file in rdwr
  * New - mmap the output file, initialize from input file if present
+ *
+ * Writes are tracked per 4KiB page in a bitmap of pages written since the last checkpoint.
+ * Each checkpoint adds one delta (those pages and their contents) to a chain that starts
+ * at the base image (the input file, or zeros) and clears the bitmap. Earlier deltas are
+ * kept in an unnamed temporary file and copied inline into every checkpoint so each one
+ * is self-contained; restart maps a fresh buffer, loads the input file and applies the
+ * chain in order.
+ * If the output file is also the input file, the base image is overwritten as the
+ * simulation runs and cannot be reloaded, so the first delta is a snapshot of every page.
+ *
  * Throws:
  * 1: Unable to open mmapfile
  * 2: Unable to mmap mmapfile
  * 3: Unable to open infile
  * 4: Unable to mmap infile
+ * 5: Unable to create checkpoint delta log
  */
 class BackingMMAP : public Backing {
 public:
     BackingMMAP( std::string mmapfile, std::string infile, size_t size, size_t offset = 0 ) :
-        Backing(), size_(size), offset_(offset), mmapfile_(mmapfile) {
+        Backing(), size_(size), offset_(offset), mmapfile_(mmapfile), infile_(infile) {
 
         // mmapfile = file to write out to, place in output dir *IF* not the same as infile
         // infile = file to initialize from
-
-        int flags = MAP_SHARED;
-        int fd = -1;
-        if ( mmapfile != "" ) {
-            int fd_flags = O_RDWR | O_CREAT;
-            if (mmapfile != infile) {
-                fd_flags |= O_TRUNC; // Overwrite output file if it exists
-            }
-
-            fd = open(mmapfile.c_str(), fd_flags, S_IRUSR | S_IWUSR);
-            if (fd < 0) {
-                Output out("", 1, 0, Output::STDOUT);
-                out.output("Error: fd=%d, %s\n", fd, strerror(errno));
-                throw 1;
-            }
-            (void) !ftruncate(fd, size); // Extend file to needed size
-        } else {
-            flags |= MAP_ANON;
-        }
-
-        buffer_ = (uint8_t*)mmap(NULL, size, PROT_READ|PROT_WRITE, flags, fd, 0);
-
-        if ( mmapfile != "" ) {
-            close(fd);
-        }
-
-        if ( buffer_ == MAP_FAILED) {
-            throw 2;
-        }
-
-        if ( infile != "" && infile != mmapfile ) {
-            fd = open(infile.c_str(), O_RDONLY);
-            if (fd < 0) { throw 3; }
-
-            uint8_t* tmp_buffer = (uint8_t*)mmap(NULL, size, PROT_READ, flags, fd, 0);
-            close(fd);
-
-            if ( tmp_buffer == MAP_FAILED ) { throw 4; }
-
-            memcpy(buffer_, tmp_buffer, size);
-            munmap(tmp_buffer, size);
-        }
+        mapBuffer(mmapfile != infile);
+        dirty_.assign(((pageCount() + 63) >> 6), 0);
     }
 
     ~BackingMMAP() {
         munmap( buffer_, size_ );
+        if (log_) fclose(log_);
     }
 
     void set( Addr addr, uint8_t value ) override {
         buffer_[addr - offset_ ] = value;
+        markDirty(addr - offset_, 1);
     }
 
-    void set ( Addr addr, size_t size, std::vector<uint8_t> &data ) override {
-        for (size_t i = 0; i < size; i++)
-            buffer_[addr + i] = data[i];
+    void set ( Addr addr, size_t size, const std::vector<uint8_t> &data ) override {
+        memcpy(buffer_ + (addr - offset_), data.data(), size);
+        markDirty(addr - offset_, size);
     }
 
     uint8_t get( Addr addr ) override {
@@ -132,8 +108,7 @@ public:
     }
 
     void get( Addr addr, size_t size, std::vector<uint8_t> &data ) override {
-        for (size_t i = 0; i < size; i++)
-            data[i] = buffer_[addr + i];
+        memcpy(data.data(), buffer_ + (addr - offset_), size);
     }
 
     void printToFile( std::string UNUSED(outfile) ) override { }
@@ -177,106 +152,214 @@ public:
     // For serialization
     BackingMMAP() = default;
 
+    /*
+     * The buffer is serialized as a chain of deltas, each a page count followed by (page, contents) pairs.
+     * Earlier deltas are copied from the delta log, the newest is streamed straight from the buffer.
+     * On UNPACK the buffer is rebuilt from infile_ and the chain, which also refills the delta log.
+     */
     void serialize_order(SST::Core::Serialization::serializer& ser) override {
         Backing::serialize_order(ser);
-        SST_SER(buffer_);
         SST_SER(size_);
         SST_SER(offset_);
         SST_SER(mmapfile_);
+        SST_SER(infile_);
 
-     /*   if ( ser.mode() == SST::Core::Serialization::serializer::PACK ) {
-            // If mmap is anonymous -> we need to write the whole thing to a file
-            // Register mmap filename with manifest under memHierarchy_backing_mmap_outfile
+        switch (ser.mode()) {
+        case SST::Core::Serialization::serializer::SIZER:
+        case SST::Core::Serialization::serializer::PACK:
+        {
+            bool pack = ser.mode() == SST::Core::Serialization::serializer::PACK;
+            // Base image is overwritten in place, snapshot it in full the first time
+            bool all = chain_.empty() && mmapfile_ != "" && mmapfile_ == infile_;
+            size_t deltas = chain_.size() + 1;
+            SST_SER(deltas);
+
+            // Earlier deltas
+            std::vector<uint8_t> scratch(pageSize);
+            uint8_t* data = scratch.data();
+            if (pack && log_) fseek(log_, 0, SEEK_SET);
+            for (auto count : chain_) {
+                SST_SER(count);
+                for (uint64_t i = 0; i < count; i++) {
+                    uint64_t page = 0;
+                    if (pack) (void) !fread(&page, sizeof(page), 1, log_);
+                    uint64_t len = pageLength(page);
+                    if (pack) (void) !fread(data, sizeof(uint8_t), len, log_);
+                    SST_SER(page);
+                    SST_SER(SST::Core::Serialization::array(data, len));
+                }
+            }
 
-            std::string outputfile = addFileToCheckpoint(getName() + "_backing_mmap", mmapfile_);
-            if ( mmapfile == "" ) {
-                // Copy buffer_ to outputfile
+            // Pages written since the last checkpoint
+            uint64_t count = 0;
+            if (all) {
+                count = pageCount();
+            } else {
+                for (auto word : dirty_) count += __builtin_popcountll(word);
             }
+            SST_SER(count);
+            for (uint64_t page = 0; page < pageCount(); page++) {
+                if (!all && !(dirty_[page >> 6] & (1ULL << (page & 63)))) continue;
+                uint64_t len = pageLength(page);
+                data = buffer_ + (page << pageShift);
+                SST_SER(page);
+                SST_SER(SST::Core::Serialization::array(data, len));
+                if (pack) appendLog(page);
+            }
+
+            if (pack && count != 0) {
+                chain_.push_back(count);
+                dirty_.assign(dirty_.size(), 0);
+            }
+            break;
         }
-        if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
-        */
-            // get the file associated with memHierarchy_backing_mmap_outfile; use as infile
-            // create a new output file => use mmapfile if relative, otherwise?
-                    /*
-        mmap="" -> push buffer to a new file in cpt, reload from it into anon mapping
-        mmap!="", mmap != infile -> cp mmap file to new file in cpt, reload from it into a new file on restart
-        mmap == infile -> cp mmap file to new file in cpt, reload from it into a new file on restart
-        if mmap file == infile or mmap file is a relative path - need to make up a new name for restart
-        */
-       /*
-            int flags = MAP_SHARED;
-            int fd = -1;
-            if ( mmapfile_ != "" ) {
-                    int fd_flags = O_RDWR | O_CREAT;
-                    if (mmapfile != infile)
-                        fd_flags |= O_TRUNC; // Overwrite output file if it exists
-                    fd = open(mmapfile.c_str(), fd_flags, S_IRUSR | S_IWUSR);
-                    if (fd < 0) {
-                        Output out("", 1, 0, Output::STDOUT);
-                        out.output("Error: fd=%d, %s\n", fd, strerror(errno));
-                        throw 1;
-                    }
-                    (void) !ftruncate(fd, size); // Extend file to needed size
-                } else {
-                    flags |= MAP_ANON;
+        case SST::Core::Serialization::serializer::UNPACK:
+        {
+            // If the output file is the base image the chain starts with a full snapshot, so map it as is and overwrite it
+            mapBuffer(mmapfile_ != infile_);
+            dirty_.assign(((pageCount() + 63) >> 6), 0);
+            size_t deltas;
+            SST_SER(deltas);
+            for (size_t delta = 0; delta < deltas; delta++) {
+                uint64_t count;
+                SST_SER(count);
+                for (uint64_t i = 0; i < count; i++) {
+                    uint64_t page;
+                    SST_SER(page);
+                    uint64_t len = pageLength(page);
+                    uint8_t* data = buffer_ + (page << pageShift);
+                    SST_SER(SST::Core::Serialization::array(data, len));
+                    appendLog(page);
                 }
+                if (count != 0) chain_.push_back(count);
+            }
+            break;
+        }
+        case SST::Core::Serialization::serializer::MAP:
+            break; // Nothing to do
+        }
+    }
+    ImplementSerializable(SST::MemHierarchy::Backend::BackingMMAP)
 
-                buffer_ = (uint8_t*)mmap(NULL, size, PROT_READ|PROT_WRITE, flags, fd, 0);
+private:
+    static const uint64_t pageShift = 12;
+    static const uint64_t pageSize = 1 << pageShift;
 
-                if ( mmapfile != "" ) {
-                    close(fd);
-                }
+    size_t pageCount() { return (size_ + pageSize - 1) >> pageShift; }
 
-                if ( buffer_ == MAP_FAILED) {
-                    throw 2;
-                }
+    uint64_t pageLength( uint64_t page ) { return std::min((uint64_t)pageSize, (uint64_t)(size_ - (page << pageShift))); }
+
+    /* Append a page's current contents to the delta log, creating the log on first use */
+    void appendLog( uint64_t page ) {
+        if (!log_) {
+            log_ = tmpfile();
+            if (!log_) throw 5;
+        }
+        fseek(log_, 0, SEEK_END);
+        fwrite(&page, sizeof(page), 1, log_);
+        fwrite(buffer_ + (page << pageShift), sizeof(uint8_t), pageLength(page), log_);
+    }
+
+    inline void markDirty( size_t off, size_t size ) {
+        if (size == 0) return;
+        for (size_t page = off >> pageShift; page <= ((off + size - 1) >> pageShift); page++)
+            dirty_[page >> 6] |= (1ULL << (page & 63));
+    }
 
-                if ( infile != "" && infile != mmapfile ) {
-                    fd = open(infile.c_str(), O_RDONLY);
-                    if (fd < 0) { throw 3; }
+    /* Map buffer_ and initialize it from infile_. 'truncate' overwrites an existing output file. */
+    void mapBuffer( bool truncate ) {
+        int flags = MAP_SHARED;
+        int fd = -1;
+        if ( mmapfile_ != "" ) {
+            int fd_flags = O_RDWR | O_CREAT;
+            if (truncate) {
+                fd_flags |= O_TRUNC; // Overwrite output file if it exists
+            }
 
-                    uint8_t* tmp_buffer = (uint8_t*)mmap(NULL, size, PROT_READ, flags, fd, 0);
-                    close(fd);
+            fd = open(mmapfile_.c_str(), fd_flags, S_IRUSR | S_IWUSR);
+            if (fd < 0) {
+                Output out("", 1, 0, Output::STDOUT);
+                out.output("Error: fd=%d, %s\n", fd, strerror(errno));
+                throw 1;
+            }
+            (void) !ftruncate(fd, size_); // Extend file to needed size
+        } else {
+            flags |= MAP_ANON;
+        }
 
-                    if ( tmp_buffer == MAP_FAILED ) { throw 4; }
+        buffer_ = (uint8_t*)mmap(NULL, size_, PROT_READ|PROT_WRITE, flags, fd, 0);
 
-                    memcpy(buffer_, tmp_buffer, size);
-                    munmap(tmp_buffer, size);
-                }
+        if ( mmapfile_ != "" ) {
+            close(fd);
         }
-                */
 
+        if ( buffer_ == MAP_FAILED) {
+            throw 2;
+        }
+
+        if ( infile_ != "" && infile_ != mmapfile_ ) {
+            fd = open(infile_.c_str(), O_RDONLY);
+            if (fd < 0) { throw 3; }
+
+            uint8_t* tmp_buffer = (uint8_t*)mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+
+            if ( tmp_buffer == MAP_FAILED ) { throw 4; }
 
+            memcpy(buffer_, tmp_buffer, size_);
+            munmap(tmp_buffer, size_);
+        }
     }
-    ImplementSerializable(SST::MemHierarchy::Backend::BackingMMAP)
 
-private:
     uint8_t* buffer_;
     size_t size_;
     size_t offset_;
 
     // Needed for checkpoint/restart only
-    std::string mmapfile_; // Name of output file
+    std::string mmapfile_;              // Name of output file
+    std::string infile_;                // Name of input file (base image for restart)
+    std::vector<uint64_t> dirty_;       // One bit per page written since the last checkpoint
+    std::vector<uint64_t> chain_;       // Page count of each delta already in the delta log
+    FILE* log_ = nullptr;               // Earlier deltas as (page, contents) records
 
 };
 
 /*
+ * Malloc'd backing store, allocated in 'alloc_unit_' sized chunks on first write
+ *
+ * Chunks are located through a two-level radix table indexed by chunk number:
+ * a growable top-level directory of fixed-size leaf arrays of chunk pointers.
+ * Reads of chunks that have never been written return zero from a shared
+ * zero chunk so they do not allocate. Multi-byte accesses copy a span at a time.
+ *
+ * Chunks can optionally be backed by huge pages:
+ *  HugePages::Madvise - chunks are 2MiB-aligned and marked MADV_HUGEPAGE (transparent huge pages)
+ *  HugePages::TLB     - chunks are mmap'd with MAP_HUGETLB; requires alloc unit to be a multiple of 2MiB
+ *                       and a reserved hugetlbfs pool
+ *
  * Throws:
  * 1: Unable to open infile
  */
 class BackingMalloc : public Backing {
 public:
-    BackingMalloc( size_t size, bool init = false ) : init_(init) {
+    enum class HugePages { None, Madvise, TLB };
+
+    BackingMalloc( size_t size, bool init = false, HugePages huge = HugePages::None ) : init_(init), huge_(huge) {
         alloc_unit_ = size;
         /* Alloc unit needs to be pwr-2 */
         if (!isPowerOfTwo(alloc_unit_)) {
             Output out("", 1, 0, Output::STDOUT);
             out.fatal(CALL_INFO, -1, "BackingMalloc, ERROR: Size must be a power of two. Got: %zu.\n", size);
         }
+        if (huge_ == HugePages::TLB && (alloc_unit_ % hugePageSize) != 0) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "BackingMalloc, ERROR: MAP_HUGETLB backing requires the allocation unit to be a multiple of 2MiB. Got: %zu.\n", size);
+        }
         shift_ = log2Of(alloc_unit_);
+        zero_ = (uint8_t*) calloc(alloc_unit_, sizeof(uint8_t));
     }
 
-    BackingMalloc( std::string infile ) {
+    BackingMalloc( std::string infile ) : huge_(HugePages::None) {
         auto fp = fopen(infile.c_str(),"rb");
         if (!fp) throw 1;
 
@@ -285,40 +368,44 @@ public:
         (void) !fread(&alloc_unit_, sizeof(unsigned int), 1, fp);
         (void) !fread(&shift_, sizeof(unsigned int), 1, fp);
         (void) !fread(&init_, sizeof(bool), 1, fp);
+        zero_ = (uint8_t*) calloc(alloc_unit_, sizeof(uint8_t));
         Addr addr;
         for ( size_t i = 0; i < buffer_size; i++ ) {
-            auto buf = (uint8_t*) malloc( alloc_unit_);
             (void) !fread(&addr, sizeof(addr), 1, fp);
-            (void) !fread(buf, sizeof(uint8_t), alloc_unit_, fp);
-            buffer_[addr] = buf;
+            (void) !fread(chunk(addr, true), sizeof(uint8_t), alloc_unit_, fp);
+        }
+        fclose(fp);
+    }
+
+    ~BackingMalloc() {
+        for ( auto leaf : table_ ) {
+            if (!leaf) continue;
+            for ( size_t i = 0; i < leafSize; i++ ) {
+                if (leaf[i]) freeChunk(leaf[i]);
+            }
+            delete [] leaf;
         }
+        free(zero_);
     }
 
     void set( Addr addr, uint8_t value ) override {
         Addr bAddr = addr >> shift_;
         Addr offset = addr - (bAddr << shift_);
-        allocIfNeeded(bAddr);
-        buffer_[bAddr][offset] = value;
+        chunk(bAddr, true)[offset] = value;
     }
 
-    void set( Addr addr, size_t size, std::vector<uint8_t> &data ) override {
+    void set( Addr addr, size_t size, const std::vector<uint8_t> &data ) override {
         /* Account for size exceeding alloc unit size */
         Addr bAddr = addr >> shift_;
         Addr offset = addr - (bAddr << shift_);
         size_t dataOffset = 0;
 
-        allocIfNeeded(bAddr);
-
         while (dataOffset != size) {
-            buffer_[bAddr][offset] = data[dataOffset];
-            offset++;
-            dataOffset++;
-
-            if (offset == alloc_unit_) {
-                offset = 0;
-                bAddr++;
-                allocIfNeeded(bAddr);
-            }
+            size_t span = std::min((size_t)(alloc_unit_ - offset), size - dataOffset);
+            memcpy(chunk(bAddr, true) + offset, data.data() + dataOffset, span);
+            dataOffset += span;
+            offset = 0;
+            bAddr++;
         }
     }
 
@@ -327,52 +414,50 @@ public:
         Addr offset = addr - (bAddr << shift_);
         size_t dataOffset = 0;
 
-        allocIfNeeded(bAddr);
         assert( data.size() == size );
 
-        assert( buffer_.find(bAddr) != buffer_.end() );
-        auto buf = buffer_[bAddr];
         while (dataOffset != size) {
-
-            data[dataOffset] = buf[offset];
-            offset++;
-            dataOffset++;
-            if (offset == alloc_unit_) {
-                bAddr++;
-                offset = 0;
-                allocIfNeeded(bAddr);
-            }
+            size_t span = std::min((size_t)(alloc_unit_ - offset), size - dataOffset);
+            memcpy(data.data() + dataOffset, chunk(bAddr, false) + offset, span);
+            dataOffset += span;
+            offset = 0;
+            bAddr++;
         }
     }
 
     uint8_t get( Addr addr ) override {
         Addr bAddr = addr >> shift_;
         Addr offset = addr - (bAddr << shift_);
-        allocIfNeeded(bAddr);
-        return buffer_[bAddr][offset];
+        return chunk(bAddr, false)[offset];
     }
 
 
     void printToFile( std::string outfile ) override {
         auto fp = fopen(outfile.c_str(),"wb+");
         if (!fp) { throw 1; }
-        size_t count = buffer_.size();
+        size_t count = chunk_count_;
         fwrite(&count, sizeof(count), 1, fp);
         fwrite(&alloc_unit_, sizeof(alloc_unit_), 1, fp);
         fwrite(&shift_, sizeof(shift_), 1, fp);
         fwrite(&init_, sizeof(init_), 1, fp);
 
-        for ( auto const& x : buffer_ ) {
-            fwrite(&(x.first), sizeof(Addr), 1, fp);
-            fwrite(x.second, sizeof(uint8_t), alloc_unit_, fp);
+        for ( size_t top = 0; top < table_.size(); top++ ) {
+            if (!table_[top]) continue;
+            for ( size_t i = 0; i < leafSize; i++ ) {
+                if (!table_[top][i]) continue;
+                Addr key = (top << leafBits) + i;
+                fwrite(&key, sizeof(Addr), 1, fp);
+                fwrite(table_[top][i], sizeof(uint8_t), alloc_unit_, fp);
+            }
         }
+        fclose(fp);
     }
 
     void printToScreen(Addr addr_offset, Addr addr_start, Addr addr_interleave_size, Addr addr_interleave_step) override {
         Output out("", 1, 0, Output::STDOUT);
         out.output("==================================================================================================\n");
         out.output("Printing contents of dynamically allocated memory backing buffer\n");
-        out.output("Number of buffer chunks: %zu\n", buffer_.size());
+        out.output("Number of buffer chunks: %zu\n", chunk_count_);
         out.output("Chunk size: %d B\n", alloc_unit_);
         out.output("==================================================================================================\n");
         out.output("Address    | Value (hex)\n");
@@ -380,30 +465,34 @@ public:
         Addr output_unit = (alloc_unit_ % 64 == 0) ? 64 : (alloc_unit_ % 32 == 0) ? 32 : alloc_unit_;
         Addr units_per_buffer = alloc_unit_ / output_unit;
 
-        for ( auto const& x : buffer_ ) {
-            Addr local_addr = x.first << shift_;
-            uint8_t* value_ptr = x.second;
-            for (Addr line = 0; line < units_per_buffer; line++) {
-                Addr global_addr = local_addr - addr_offset;
-                if (addr_interleave_size == 0) {
-                    global_addr += addr_start;
-                } else {
-                    Addr tmp = global_addr % addr_interleave_size;
-                    global_addr -= tmp;
-                    global_addr = global_addr / addr_interleave_size;
-                    global_addr = global_addr * addr_interleave_step + tmp + addr_start;
-                }
-                out.output("%#-10" PRIx64 " | ",global_addr);
-
-                // Print output_unit # bytes, with a space between every 8 for readability
-                std::stringstream value;
-                for (size_t byte = 0; byte < output_unit; byte++) {
-                    if (byte % 8 == 0 && byte != 0) value << " ";
-                    value << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(*(value_ptr));
-                    value_ptr++;
+        for ( size_t top = 0; top < table_.size(); top++ ) {
+            if (!table_[top]) continue;
+            for ( size_t i = 0; i < leafSize; i++ ) {
+                if (!table_[top][i]) continue;
+                Addr local_addr = ((top << leafBits) + i) << shift_;
+                uint8_t* value_ptr = table_[top][i];
+                for (Addr line = 0; line < units_per_buffer; line++) {
+                    Addr global_addr = local_addr - addr_offset;
+                    if (addr_interleave_size == 0) {
+                        global_addr += addr_start;
+                    } else {
+                        Addr tmp = global_addr % addr_interleave_size;
+                        global_addr -= tmp;
+                        global_addr = global_addr / addr_interleave_size;
+                        global_addr = global_addr * addr_interleave_step + tmp + addr_start;
+                    }
+                    out.output("%#-10" PRIx64 " | ",global_addr);
+
+                    // Print output_unit # bytes, with a space between every 8 for readability
+                    std::stringstream value;
+                    for (size_t byte = 0; byte < output_unit; byte++) {
+                        if (byte % 8 == 0 && byte != 0) value << " ";
+                        value << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(*(value_ptr));
+                        value_ptr++;
+                    }
+                    out.output("%s\n", value.str().c_str());
+                    local_addr += output_unit;
                 }
-                out.output("%s\n", value.str().c_str());
-                local_addr += output_unit;
             }
         }
         out.output("==================================================================================================\n");
@@ -417,31 +506,39 @@ public:
         SST_SER(alloc_unit_);
         SST_SER(shift_);
         SST_SER(init_);
+        SST_SER(huge_);
 
-        // Manually serialize buffer_ because the uint8_t* array isn't automatically serializable
+        // Manually serialize the chunks because the uint8_t* arrays aren't automatically serializable
+        // Format is a count followed by (chunk number, data) pairs
         switch (ser.mode()) {
         case SST::Core::Serialization::serializer::SIZER:
         case SST::Core::Serialization::serializer::PACK:
-            SST_SER(buffer_.size());
-            for ( auto& x : buffer_ ) { // Serialize each key/value pair
-                Addr key = x.first;
-                uint8_t* value = x.second;
-                SST_SER(key);
-                SST_SER(SST::Core::Serialization::array(value, alloc_unit_));
+            SST_SER(chunk_count_);
+            for ( size_t top = 0; top < table_.size(); top++ ) {
+                if (!table_[top]) continue;
+                for ( size_t i = 0; i < leafSize; i++ ) {
+                    if (!table_[top][i]) continue;
+                    Addr key = (top << leafBits) + i;
+                    uint8_t* value = table_[top][i];
+                    SST_SER(key);
+                    SST_SER(SST::Core::Serialization::array(value, alloc_unit_));
+                }
             }
             break;
         case SST::Core::Serialization::serializer::UNPACK:
+        {
             size_t buffer_size;
             Addr key;
 
+            zero_ = (uint8_t*) calloc(alloc_unit_, sizeof(uint8_t));
             SST_SER(buffer_size);
             for ( size_t i = 0; i < buffer_size; i++ ) {
-                uint8_t* value = (uint8_t*) malloc(sizeof(uint8_t)*alloc_unit_);
                 SST_SER(key);
+                uint8_t* value = chunk(key, true);
                 SST_SER(SST::Core::Serialization::array(value, alloc_unit_));
-                buffer_[key] = value;
             }
             break;
+        }
         case SST::Core::Serialization::serializer::MAP:
             break; // Nothing to do
         }
@@ -450,24 +547,76 @@ public:
     ImplementSerializable(SST::MemHierarchy::Backend::BackingMalloc)
 
 private:
-    void allocIfNeeded( Addr bAddr ) {
-        if (buffer_.find(bAddr) == buffer_.end()) {
-            uint8_t* data = (uint8_t*) malloc(sizeof(uint8_t)*alloc_unit_);
-            if ( init_ ) {
-                bzero( data, alloc_unit_ );
-            }
-            if (!data) {
-                Output out("", 1, 0, Output::STDOUT);
-                out.fatal(CALL_INFO, -1, "BackingMalloc: Error - malloc failed.\n");
+    static const unsigned int leafBits = 9;
+    static const size_t leafSize = 1 << leafBits;
+    static const size_t hugePageSize = 2 * 1024 * 1024;
+
+    /* Return the chunk for chunk number 'bAddr'. If it has not been written yet, allocate it if 'write', otherwise return the zero chunk. */
+    inline uint8_t* chunk( Addr bAddr, bool write ) {
+        Addr top = bAddr >> leafBits;
+        if (top < table_.size() && table_[top]) {
+            uint8_t* data = table_[top][bAddr & (leafSize - 1)];
+            if (data) return data;
+        }
+        if (!write) return zero_;
+        return allocChunk(bAddr);
+    }
+
+    uint8_t* allocChunk( Addr bAddr ) {
+        Addr top = bAddr >> leafBits;
+        if (top >= table_.size())
+            table_.resize(top + 1, nullptr);
+        if (!table_[top])
+            table_[top] = new uint8_t*[leafSize]();
+
+        uint8_t* data = nullptr;
+        switch (huge_) {
+            case HugePages::TLB:
+                data = (uint8_t*) mmap(NULL, alloc_unit_, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+                if (data == MAP_FAILED) {
+                    Output out("", 1, 0, Output::STDOUT);
+                    out.fatal(CALL_INFO, -1, "BackingMalloc: Error - MAP_HUGETLB mmap failed (%s). Check the reserved huge page pool or use madvise instead.\n", strerror(errno));
+                }
+                break; // Anonymous mappings are zero-filled
+            case HugePages::Madvise:
+            {
+                size_t align = (alloc_unit_ >= hugePageSize) ? hugePageSize : (size_t)sysconf(_SC_PAGESIZE);
+                if (posix_memalign((void**)&data, align, alloc_unit_) != 0)
+                    data = nullptr;
+                if (data) {
+                    madvise(data, alloc_unit_, MADV_HUGEPAGE);
+                    bzero(data, alloc_unit_);
+                }
+                break;
             }
-            buffer_[bAddr] = data;
+            default:
+                // calloc so reads of unwritten bytes in a written chunk match the zero chunk
+                data = (uint8_t*) calloc(alloc_unit_, sizeof(uint8_t));
+                break;
         }
+        if (!data) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "BackingMalloc: Error - malloc failed.\n");
+        }
+        table_[top][bAddr & (leafSize - 1)] = data;
+        chunk_count_++;
+        return data;
+    }
+
+    void freeChunk( uint8_t* data ) {
+        if (huge_ == HugePages::TLB)
+            munmap(data, alloc_unit_);
+        else
+            free(data);
     }
 
-    std::map<Addr,uint8_t*> buffer_;
+    std::vector<uint8_t**> table_;  // Radix table: table_[chunk >> leafBits][chunk & (leafSize-1)], nullptr = not allocated
+    size_t chunk_count_ = 0;        // Number of allocated chunks
+    uint8_t* zero_ = nullptr;       // Shared all-zero chunk returned for reads of unallocated chunks
     unsigned int alloc_unit_;
     unsigned int shift_;
-    bool init_;
+    bool init_;                     // Retained for file compatibility; chunks are always zero-filled
+    HugePages huge_ = HugePages::None;
 };
 
 }
@@ -55,6 +55,13 @@ bool DRAMSim3Memory::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned ){
 
 bool DRAMSim3Memory::clock(Cycle_t cycle){
     memSystem->ClockTick();
+
+    // Report everything that finished this tick at once
+    if (!completed.empty()) {
+        std::vector<ReqId> done;
+        done.swap(completed);
+        completeBatch(done);
+    }
     return false;
 }
 
@@ -78,5 +85,5 @@ void DRAMSim3Memory::dramSimDone(unsigned int id, uint64_t addr, uint64_t clockc
     if(0 == reqs.size())
         dramReqs.erase(addr);
 
-    handleMemResponse(reqId);
+    completed.push_back(reqId);
 }
@@ -60,6 +60,7 @@ protected:
 
     dramsim3::MemorySystem *memSystem;
     std::map<uint64_t, std::deque<ReqId> > dramReqs;
+    std::vector<ReqId> completed;   // Responses collected during ClockTick(), reported together
 
 private:
     std::function<void(uint64_t)> readCB;
@@ -132,16 +132,45 @@ class SimpleMemBackend : public MemBackend {
     SimpleMemBackend() : MemBackend() {}
     SimpleMemBackend(ComponentId_t id, Params &params) : MemBackend(id,params) {}
 
+    typedef MemBackendConvertor::BatchReq BatchReq;
+
     virtual bool issueRequest( ReqId, Addr, bool isWrite, unsigned numBytes ) = 0;
 
+    /* Issue several requests in one call. Returns how many were accepted; the accepted
+     * requests are a prefix of 'reqs'. Backends that can take many commands per cycle
+     * should override this, the default issues one at a time until a request is rejected. */
+    virtual size_t issueBatch( const std::vector<BatchReq>& reqs ) {
+        size_t accepted = 0;
+        for (std::vector<BatchReq>::const_iterator it = reqs.begin(); it != reqs.end(); it++, accepted++) {
+            if (!issueRequest(it->id, it->addr, it->isWrite, it->numBytes))
+                break;
+        }
+        return accepted;
+    }
+
     void handleMemResponse( ReqId id ) {
         m_respFunc( id );
     }
 
+    /* Report several completed requests at once */
+    void completeBatch( const std::vector<ReqId>& ids ) {
+        if (m_completeBatchFunc) {
+            m_completeBatchFunc( ids );
+        } else {
+            for (std::vector<ReqId>::const_iterator it = ids.begin(); it != ids.end(); it++)
+                m_respFunc( *it );
+        }
+    }
+
     virtual void setResponseHandler( std::function<void(ReqId)> func ) {
         m_respFunc = func;
     }
 
+    /* Optional; without it completeBatch() reports through the response handler */
+    virtual void setCompleteBatchHandler( std::function<void(const std::vector<ReqId>&)> func ) {
+        m_completeBatchFunc = func;
+    }
+
     virtual std::string getBackendConvertorType() override {
         return "memHierarchy.simpleMemBackendConvertor";
     }
@@ -153,6 +182,7 @@ class SimpleMemBackend : public MemBackend {
 
   private:
     std::function<void(ReqId)> m_respFunc;
+    std::function<void(const std::vector<ReqId>&)> m_completeBatchFunc;
 };
 
 /* MemBackend - timing and passes request/response flags */
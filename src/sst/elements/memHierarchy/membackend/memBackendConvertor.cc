@@ -31,7 +31,7 @@ using namespace SST::MemHierarchy;
 
 
 MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBackend* backend, uint32_t request_width) :
-    SubComponent(id), m_cycleCount(0), m_reqId(0), m_backend(backend)
+    SubComponent(id), m_cycleCount(0), m_reqId(0), m_backend(backend), m_batchIssue(false)
 {
     m_dbg.init("",
             params.find<uint32_t>("debug_level", 0),
@@ -91,7 +91,7 @@ void MemBackendConvertor::handleCustomEvent( Interfaces::StandardMem::CustomData
     uint32_t id = genReqId();
     CustomReq* req = new CustomReq( info, evId, rqstr, id );
     m_requestQueue.push_back( req );
-    m_pendingRequests[id] = req;
+    m_pendingRequests.insert( id, req );
 }
 
 bool MemBackendConvertor::clock(Cycle_t cycle) {
@@ -105,6 +105,20 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
         }
 
         BaseReq* req = m_requestQueue.front();
+
+        if ( m_batchIssue && req->isMemEv() ) {
+            int limit = m_backend->getMaxReqPerCycle() < 0 ? -1 : m_backend->getMaxReqPerCycle() - reqsThisCycle;
+            bool rejected = false;
+            size_t issued = issueMemBatch( limit, rejected );
+            reqsThisCycle += issued;
+            cycleWithIssue = issued != 0 && !rejected;
+            if ( rejected ) {
+                stat_cyclesAttemptIssueButRejected->addData(1);
+                break;
+            }
+            continue;
+        }
+
         Debug(_L10_, "Processing request: %s\n", req->getString().c_str());
 
         if ( issue( req ) ) {
@@ -142,6 +156,40 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
     return false;
 }
 
+/*
+ * Issue the run of memory requests at the front of the queue as one batch
+ * limit = max backend-width requests to issue, -1 for no limit
+ * rejected = set if the backend did not accept the whole batch
+ * Returns the number of backend-width requests accepted
+ */
+size_t MemBackendConvertor::issueMemBatch( int limit, bool& rejected ) {
+    m_batch.clear();
+    for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
+        if ( !(*it)->isMemEv() || (limit >= 0 && m_batch.size() >= (size_t)limit) )
+            break;
+        MemReq* req = static_cast<MemReq*>(*it);
+        uint32_t offset = req->processed();
+        do {
+            m_batch.push_back( { req->id(offset), req->baseAddr() + offset, req->isWrite(), m_backendRequestWidth } );
+            offset += m_backendRequestWidth;
+        } while ( offset < req->size() && (limit < 0 || m_batch.size() < (size_t)limit) );
+    }
+
+    size_t accepted = issueBatch( m_batch );
+    rejected = accepted < m_batch.size();
+
+    Debug(_L10_, "Issued batch: %zu of %zu requests accepted\n", accepted, m_batch.size());
+
+    for (size_t i = 0; i < accepted; i++) {
+        BaseReq* req = m_requestQueue.front();
+        req->increment( m_backendRequestWidth );
+        if ( req->issueDone() ) {
+            m_requestQueue.pop_front();
+        }
+    }
+    return accepted;
+}
+
 /*
  * Called by MemController to turn the clock back on
  * cycle = current cycle
@@ -169,14 +217,12 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
     }
 
     uint32_t id = BaseReq::getBaseId(reqId);
-    MemEvent* resp = NULL;
 
-    if ( m_pendingRequests.find( id ) == m_pendingRequests.end() ) {
+    BaseReq* req = m_pendingRequests.find( id );
+    if ( req == nullptr ) {
         m_dbg.fatal(CALL_INFO, -1, "memory request not found; id=%" PRId32 "\n", id);
     }
 
-    BaseReq* req = m_pendingRequests[id];
-
     req->decrement( );
 
     if ( req->isDone() ) {
@@ -219,6 +265,11 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
     }
 }
 
+void MemBackendConvertor::doResponses( const std::vector<ReqId>& reqIds ) {
+    for (std::vector<ReqId>::const_iterator it = reqIds.begin(); it != reqIds.end(); it++)
+        doResponse( *it );
+}
+
 void MemBackendConvertor::sendResponse( SST::Event::id_type id, uint32_t flags ) {
 
     m_notifyResponse( id, flags );
@@ -253,6 +304,7 @@ void MemBackendConvertor::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(m_backend);
     SST_SER(m_backendRequestWidth);
     SST_SER(m_clockBackend);
+    SST_SER(m_batchIssue);
     SST_SER(m_dbg);
     SST_SER(m_cycleCount);
     SST_SER(m_clockOn);
@@ -61,6 +61,14 @@ class MemBackendConvertor : public SubComponent {
 
     typedef uint64_t ReqId;
 
+    /* One backend-width request, as passed to SimpleMemBackend::issueBatch() */
+    struct BatchReq {
+        ReqId id;
+        Addr addr;
+        bool isWrite;
+        unsigned numBytes;
+    };
+
     class BaseReq : public SST::Core::Serialization::serializable {
     public:
 
@@ -70,6 +78,7 @@ class MemBackendConvertor : public SubComponent {
         virtual ~BaseReq() { }
 
         static uint32_t getBaseId( ReqId id) { return id >> 32; }
+        uint32_t baseId()       { return m_reqId; }
         virtual uint64_t id()   { return ((uint64_t)m_reqId << 32); }
         virtual void decrement() { }
         virtual void increment( uint32_t UNUSED(bytes) ) { }
@@ -139,6 +148,7 @@ class MemBackendConvertor : public SubComponent {
 
         uint32_t processed()    { return m_offset; }
         uint64_t id()           { return ((uint64_t)m_reqId << 32) | m_offset; }
+        uint64_t id( uint32_t offset ) { return ((uint64_t)m_reqId << 32) | offset; }
         MemEvent* getMemEvent() { return m_event; }
         bool isWrite()          { return (m_event->getCmd() == Command::PutM || m_event->getCmd() == Command::Write); }
         uint32_t size()         { return m_event->getSize(); }
@@ -191,12 +201,12 @@ class MemBackendConvertor : public SubComponent {
     virtual bool isBackendClocked() { return m_clockBackend; }
 
     virtual const std::string getRequestor( ReqId reqId ) {
-        uint32_t id = BaseReq::getBaseId(reqId);
-        if ( m_pendingRequests.find( id ) == m_pendingRequests.end() ) {
+        BaseReq* req = m_pendingRequests.find( BaseReq::getBaseId(reqId) );
+        if ( req == nullptr ) {
             m_dbg.fatal(CALL_INFO, -1, "memory request not found\n");
         }
 
-        return m_pendingRequests[id]->getRqstr();
+        return req->getRqstr();
     }
 
     virtual void setCallbackHandlers(std::function<void(Event::id_type,uint32_t)> responseCB, std::function<Cycle_t()> clockenableCB);
@@ -219,16 +229,22 @@ protected:
     }
 
     void doResponse( ReqId reqId, uint32_t flags = 0 );
+    void doResponses( const std::vector<ReqId>& reqIds );
     inline void sendResponse( SST::Event::id_type id, uint32_t flags );
 
     MemBackend* m_backend;
     uint32_t    m_backendRequestWidth;
 
     bool m_clockBackend;
+    bool m_batchIssue;  // Set by convertors that implement issueBatch()
 
   private:
     virtual bool issue(BaseReq*) = 0;
 
+    /* Issue a batch of backend-width requests and return how many were accepted. Accepted requests must be a prefix of 'reqs' */
+    virtual size_t issueBatch( const std::vector<BatchReq>& UNUSED(reqs) ) { return 0; }
+
+    size_t issueMemBatch( int limit, bool& rejected );
 
 
 
@@ -261,7 +277,7 @@ protected:
         uint32_t id = genReqId();
         MemReq* req = new MemReq( ev, id );
         m_requestQueue.push_back( req );
-        m_pendingRequests[id] = req;
+        m_pendingRequests.insert( id, req );
         return true;
     }
 
@@ -327,10 +343,67 @@ protected:
 
     uint32_t m_reqId;
 
-    typedef std::map<uint32_t,BaseReq*> PendingRequests;
+    /*
+     * Outstanding requests indexed by request ID
+     * Request IDs are allocated sequentially so a ring indexed by the low bits of the ID
+     * is dense. The ring doubles if a new ID lands on a slot still held by an older request.
+     */
+    class PendingRequests {
+    public:
+        PendingRequests() : m_slots(64, nullptr), m_count(0) { }
+
+        BaseReq* find( uint32_t id ) {
+            BaseReq* req = m_slots[id & (m_slots.size() - 1)];
+            return (req != nullptr && req->baseId() == id) ? req : nullptr;
+        }
+
+        void insert( uint32_t id, BaseReq* req ) {
+            while (m_slots[id & (m_slots.size() - 1)] != nullptr)
+                grow();
+            m_slots[id & (m_slots.size() - 1)] = req;
+            m_count++;
+        }
+
+        void erase( uint32_t id ) {
+            m_slots[id & (m_slots.size() - 1)] = nullptr;
+            m_count--;
+        }
+
+        size_t size() { return m_count; }
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) {
+            // Checkpoint as a map so the ring size need not match on restart
+            if (ser.mode() == SST::Core::Serialization::serializer::MAP)
+                return;
+            std::map<uint32_t, BaseReq*> requests;
+            for (BaseReq* req : m_slots) {
+                if (req != nullptr) requests[req->baseId()] = req;
+            }
+            SST_SER(requests);
+            if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+                m_slots.assign(64, nullptr);
+                m_count = 0;
+                for (auto it = requests.begin(); it != requests.end(); it++)
+                    insert(it->first, it->second);
+            }
+        }
+
+    private:
+        void grow() {
+            std::vector<BaseReq*> slots(m_slots.size() * 2, nullptr);
+            for (BaseReq* req : m_slots) {
+                if (req != nullptr) slots[req->baseId() & (slots.size() - 1)] = req;
+            }
+            m_slots.swap(slots);
+        }
+
+        std::vector<BaseReq*> m_slots;  // Size is a power of two
+        size_t m_count;
+    };
 
     std::deque<BaseReq*>    m_requestQueue;
     PendingRequests         m_pendingRequests;
+    std::vector<BatchReq>   m_batch;    // Scratch space for issueMemBatch()
     uint32_t                m_frontendRequestWidth;
 
     std::map<MemEvent*, std::set<SST::Event::id_type> > m_waitingFlushes; // Set of request IDs for each flush
@@ -49,31 +49,13 @@ bool ramulator2Memory::issueRequest(ReqId reqId, Addr addr, bool isWrite, unsign
         enqueue_success = ramulator2_frontend->receive_external_requests(1, addr, 0,
             [this](Ramulator::Request& req) {});
         if (enqueue_success) {
-            writes.insert(reqId);
+            writes.push_back(reqId);
         }
     } else {
         enqueue_success = ramulator2_frontend->receive_external_requests(0, addr, 0,
-            [this](Ramulator::Request& req) {
-                output->debug(_L10_, "Ramulator2Backend: Read callback\n");
-                std::deque<ReqId> &reqs = dramReqs[req.addr];
-
-                if (reqs.empty())
-                    output->fatal(CALL_INFO, -1, "Ramulator2Backend: Error - ramulator2Done called but dramReqs[addr] is empty. Addr: %" PRIx64 "\n", (Addr)req.addr);
-
-                ReqId memreq = reqs.front();
-                reqs.pop_front();
-                if(0 == reqs.size())
-                    dramReqs.erase(req.addr);
-
-                handleMemResponse(memreq);
-        });
+            [this](Ramulator::Request& req) { readDone(req); });
         if (enqueue_success) {
-            if (dramReqs.find(addr) != dramReqs.end()) dramReqs[addr].push_back(reqId);
-            else {
-                std::deque<ReqId> reqs;
-                reqs.push_back(reqId);
-                dramReqs.insert(std::make_pair(addr,reqs));
-            }
+            dramReqs[addr].push_back(reqId);
         }
     }
     output->debug(_L10_, "Ramulator2Backend: enqueue %s\n", enqueue_success ? "successful" : "unsuccessful");
@@ -81,15 +63,33 @@ bool ramulator2Memory::issueRequest(ReqId reqId, Addr addr, bool isWrite, unsign
     return enqueue_success;
 }
 
+void ramulator2Memory::readDone(Ramulator::Request& req) {
+    output->debug(_L10_, "Ramulator2Backend: Read callback\n");
+    std::map<uint64_t, std::deque<ReqId> >::iterator it = dramReqs.find(req.addr);
+
+    if (it == dramReqs.end() || it->second.empty())
+        output->fatal(CALL_INFO, -1, "Ramulator2Backend: Error - ramulator2Done called but dramReqs[addr] is empty. Addr: %" PRIx64 "\n", (Addr)req.addr);
+
+    completed.push_back(it->second.front());
+    it->second.pop_front();
+    if (it->second.empty())
+        dramReqs.erase(it);
+}
+
 bool ramulator2Memory::clock(Cycle_t cycle){
 #ifdef __SST_DEBUG_OUTPUT__
     output->debug(_L10_, "Ramulator2Backend: Ticking memory system.\n");
 #endif
     ramulator2_frontend->tick();
     // Ack writes since ramulator won't
-    while (!writes.empty()) {
-        handleMemResponse(*writes.begin());
-        writes.erase(writes.begin());
+    completed.insert(completed.end(), writes.begin(), writes.end());
+    writes.clear();
+
+    // Report everything that finished this tick at once
+    if (!completed.empty()) {
+        std::vector<ReqId> done;
+        done.swap(completed);
+        completeBatch(done);
     }
     return false;
 }
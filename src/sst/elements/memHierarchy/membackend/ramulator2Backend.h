@@ -57,7 +57,10 @@ protected:
 
     // Track outstanding requests
     std::map<uint64_t, std::deque<ReqId> > dramReqs;
-    std::set<ReqId> writes;
+    std::vector<ReqId> writes;      // Writes accepted this cycle, acked after the next tick
+    std::vector<ReqId> completed;   // Responses collected during a tick, reported together
+
+    void readDone(Ramulator::Request& req);
 
 private:
 };
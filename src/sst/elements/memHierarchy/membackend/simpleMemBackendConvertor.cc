@@ -29,6 +29,8 @@ SimpleMemBackendConvertor::SimpleMemBackendConvertor(ComponentId_t id, Params &p
 {
     using std::placeholders::_1;
     static_cast<SimpleMemBackend*>(m_backend)->setResponseHandler( std::bind( &SimpleMemBackendConvertor::handleMemResponse, this, _1 ) );
+    static_cast<SimpleMemBackend*>(m_backend)->setCompleteBatchHandler( std::bind( &SimpleMemBackendConvertor::handleMemResponses, this, _1 ) );
+    m_batchIssue = true;
 }
 
 bool SimpleMemBackendConvertor::issue( BaseReq* req ) {
@@ -41,11 +43,16 @@ bool SimpleMemBackendConvertor::issue( BaseReq* req ) {
     }
 }
 
+size_t SimpleMemBackendConvertor::issueBatch( const std::vector<BatchReq>& reqs ) {
+    return static_cast<SimpleMemBackend*>(m_backend)->issueBatch( reqs );
+}
+
 void SimpleMemBackendConvertor::serialize_order(SST::Core::Serialization::serializer& ser) {
     MemBackendConvertor::serialize_order(ser);
 
     if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
         using std::placeholders::_1;
         static_cast<SimpleMemBackend*>(m_backend)->setResponseHandler( std::bind( &SimpleMemBackendConvertor::handleMemResponse, this, _1 ) );
+        static_cast<SimpleMemBackend*>(m_backend)->setCompleteBatchHandler( std::bind( &SimpleMemBackendConvertor::handleMemResponses, this, _1 ) );
     }
 }
@@ -39,11 +39,16 @@ public:
     SimpleMemBackendConvertor(ComponentId_t id, Params &params, MemBackend* backend, uint32_t);
 
     virtual bool issue( BaseReq* req ) override;
+    virtual size_t issueBatch( const std::vector<BatchReq>& reqs ) override;
 
     virtual void handleMemResponse( ReqId reqId ) {
         doResponse(reqId);
     }
 
+    virtual void handleMemResponses( const std::vector<ReqId>& reqIds ) {
+        doResponses(reqIds);
+    }
+
     SimpleMemBackendConvertor() { }
     virtual void serialize_order(SST::Core::Serialization::serializer& ser) override;
     ImplementSerializable(SST::MemHierarchy::SimpleMemBackendConvertor)
@@ -27,6 +27,7 @@
 #include "cacheListener.h"
 #include "memNIC.h"
 #include "memLink.h"
+#include "functionalMemory.h"
 
 #define NO_STRING_DEFINED "N/A"
 
@@ -50,6 +51,10 @@ MemCacheController::MemCacheController(ComponentId_t id, Params &params) : Compo
 
     lineSize_ = params.find<uint64_t>("cache_line_size", 64);
 
+    memID_ = EndpointTable::intern(getName());
+
+    UnitAlgebra warmupEnd = params.find<UnitAlgebra>("warmup_end", UnitAlgebra("0s"));
+
     // Output for debug
     dbg.init("", dlevel, 0, (Output::output_location_t)params.find<int>("debug", 0));
 
@@ -69,6 +74,11 @@ MemCacheController::MemCacheController(ComponentId_t id, Params &params) : Compo
     if (!(clock_ua.hasUnits("Hz") || clock_ua.hasUnits("s")) || clock_ua.getRoundedValue() <= 0) {
         out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: clock. Must have units of Hz or s and be > 0. (SI prefixes ok). You specified '%s'\n", getName().c_str(), clockfreq.c_str());
     }
+    if (!warmupEnd.hasUnits("s"))
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: warmup_end. Must have units of s (SI prefixes ok). You specified '%s'\n", getName().c_str(), warmupEnd.toString().c_str());
+    warmupEnd *= UnitAlgebra("1GHz");
+    warmupEndNs_ = warmupEnd.getRoundedValue();
+
     clockHandler_ = new Clock::Handler2<MemCacheController, &MemCacheController::clock>(this);
     clockTimeBase_ = registerClock(clockfreq, clockHandler_);
     clockOn_ = true;
@@ -192,11 +202,25 @@ MemCacheController::MemCacheController(ComponentId_t id, Params &params) : Compo
                 getName().c_str(), memSize_, lineSize_);
     cache_.resize(cachesize, CacheState(0,I));
 
+    sectorSize_ = params.find<uint64_t>("sector_size", 0);
+    if (sectorSize_ == lineSize_)
+        sectorSize_ = 0;
+    if (sectorSize_ && (!isPowerOfTwo(sectorSize_) || sectorSize_ > lineSize_ || lineSize_ / sectorSize_ > 64))
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: sector_size. Must be a power of two that divides cache_line_size into at most 64 sectors. You specified %" PRIu64 " with a line size of %" PRIu64 "\n",
+                getName().c_str(), sectorSize_, lineSize_);
+    sectorOffset_ = sectorSize_ ? log2Of(sectorSize_) : 0;
+
     /* Statistics */
     statReadHit = registerStatistic<uint64_t>("CacheHits_Read");
     statReadMiss = registerStatistic<uint64_t>("CacheMisses_Read");
     statWriteHit = registerStatistic<uint64_t>("CacheHits_Write");
     statWriteMiss = registerStatistic<uint64_t>("CacheMisses_Write");
+    statSectorMiss = statSectorsFetched = statSectorsWrittenBack = nullptr;
+    if (sectorSize_) {
+        statSectorMiss = registerStatistic<uint64_t>("SectorMisses");
+        statSectorsFetched = registerStatistic<uint64_t>("SectorsFetched");
+        statSectorsWrittenBack = registerStatistic<uint64_t>("SectorsWrittenBack");
+    }
 
 }
 
@@ -221,6 +245,12 @@ void MemCacheController::handleEvent(SST::Event* event) {
 
     MemEvent * ev = static_cast<MemEvent*>(meb);
 
+    bool warmupCmd = (cmd == Command::GetS || cmd == Command::GetSX || cmd == Command::GetX || cmd == Command::Write || CommandWriteback[(int)cmd]);
+    if (ev->queryFlag(MemEventBase::F_WARMUP) || (warmupCmd && warmupEndNs_ > getCurrentSimTimeNano() && !ev->queryFlag(MemEventBase::F_NONCACHEABLE))) {
+        handleWarmup(ev);
+        return;
+    }
+
     // Notify our listeners that we have received an event
     notifyListeners( ev );
 
@@ -284,11 +314,17 @@ void MemCacheController::handleRead(MemEvent* event, bool replay) {
         if (mem_h_is_debug_event(event))
             mem_h_debug_output(_L3_, "%" PRIu64 " (%s) StateTransition %" PRIu64 ", STALL\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
         return;
-    } else if (blockState == I || blockAddr != event->getBaseAddr()) {      // MISS
+    } else if (blockState == I || blockAddr != lineAddr(event->getBaseAddr())) {      // MISS
         it->second.status = (blockState == M) ? AccessStatus::MISS_WB : AccessStatus::MISS;
         statReadMiss->addData(1);
         if (mem_h_is_debug_event(event))
             mem_h_debug_output(_L3_, "%" PRIu64 " (%s) StateTransition %" PRIu64 ", %s\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first, (blockState == M) ? "MISS_WB" : "MISS");
+    } else if (sectorSize_ && needSectors(event, cacheIndex)) {             // MISS, line present but not all requested sectors
+        it->second.status = AccessStatus::MISS;
+        statReadMiss->addData(1);
+        statSectorMiss->addData(1);
+        if (mem_h_is_debug_event(event))
+            mem_h_debug_output(_L3_, "%" PRIu64 " (%s) StateTransition %" PRIu64 ", MISS (sector)\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
     } else {                                                                // HIT
         statReadHit->addData(1);
         it->second.status = AccessStatus::HIT;
@@ -325,12 +361,18 @@ void MemCacheController::handleWrite(MemEvent* event, bool replay) {
         if (mem_h_is_debug_event(event))
             mem_h_debug_output(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", STALL\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
         return;
-    } else if (blockState == I || blockAddr != event->getBaseAddr()) {      // MISS
+    } else if (blockState == I || blockAddr != lineAddr(event->getBaseAddr())) {      // MISS
         // Do a read to time the state lookup
         statWriteMiss->addData(1);
         it->second.status = (blockState == M ) ? AccessStatus::MISS_WB : AccessStatus::MISS;
         if (mem_h_is_debug_event(event))
             mem_h_debug_output(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", %s\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first, (blockState == M) ? "MISS_WB" : "MISS");
+    } else if (sectorSize_ && needSectors(event, cacheIndex)) {             // MISS, write partially covers a sector that is not present
+        statWriteMiss->addData(1);
+        statSectorMiss->addData(1);
+        it->second.status = AccessStatus::MISS;
+        if (mem_h_is_debug_event(event))
+            mem_h_debug_output(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", MISS (sector)\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
     } else {                                                                // HIT
         statWriteHit->addData(1);
         it->second.status = AccessStatus::HIT_TAG;
@@ -349,6 +391,103 @@ void MemCacheController::handleWrite(MemEvent* event, bool replay) {
 
 
 
+/*
+ * Functional warmup: update the line like a timed access would, without a backend access,
+ * and answer requests immediately. Lines with timed accesses in progress are left alone.
+ */
+/* Functional warmup. Memory's backing store holds the data: writes update it directly and lines
+ * are installed clean, filled from it. A dirty line from a timed request is written back to it
+ * before it is replaced; if memory is not reachable the line is left in place. */
+void MemCacheController::handleWarmup(MemEvent* event) {
+    Command cmd = event->getCmd();
+    Addr cacheIndex = toLocalAddr(event->getBaseAddr());
+    if (cacheIndex >= cache_.size())
+        out.fatal(CALL_INFO, -1, "%s, Error: cache index exceeds cache size, try again!\n", getName().c_str());
+
+    CacheState& line = cache_[cacheIndex];
+    Addr addr = lineAddr(event->getBaseAddr());
+    bool present = (line.state != I && line.addr == addr);
+    bool request = (cmd == Command::GetS || cmd == Command::GetSX || cmd == Command::GetX || cmd == Command::Write);
+
+    if ((cmd == Command::Write || cmd == Command::PutM) && event->getPayloadSize() != 0) {
+        FunctionalMemory::write(event->getAddr(), event->getPayloadBuffer().data());
+        if (present && backing_)
+            writeData(event);
+    }
+
+    if ((request || cmd == Command::PutM) && mshr_.find(cacheIndex) == mshr_.end()) {
+        if (present) {
+            if (sectorSize_ && fillWarm(line, ~line.valid & sectorMask(event)))
+                line.valid |= sectorMask(event);
+        } else if (line.state != M || writebackWarm(line)) {
+            uint64_t sectors = lineSize_ >> sectorOffset_;
+            CacheState fill(addr, E);
+            fill.valid = !sectorSize_ ? 0 : (sectors == 64) ? ~0ULL : ((1ULL << sectors) - 1);
+            if (fillWarm(fill, fill.valid))
+                line = fill;
+        }
+    }
+
+    if (request && !event->queryFlag(MemEventBase::F_WARMUP) && !event->queryFlag(MemEventBase::F_NORESPONSE)) {
+        bool cached = backing_ && line.state != I && line.addr == addr && !(sectorSize_ && (sectorMask(event) & ~line.valid));
+        if (cached) {
+            sendResponse(event, 0);
+        } else {
+            MemEvent * resp = event->makeResponse();
+            if (resp->getCmd() == Command::GetSResp || resp->getCmd() == Command::GetXResp) {
+                std::vector<uint8_t> data(event->getSize(), 0);
+                FunctionalMemory::read(event->getAddr(), data); // Zeros if memory isn't reachable
+                resp->setPayload(data);
+                resp->setCmd(Command::GetXResp);
+            }
+            link_->send(resp);
+        }
+    }
+    delete event;
+}
+
+/* Functional warmup: copy 'sectors' of a line (all of it if lines are not sectored) from memory
+ * into the backing store. Fails if memory is not reachable */
+bool MemCacheController::fillWarm(CacheState& line, uint64_t sectors) {
+    if (!backing_)
+        return true;
+    std::vector<uint8_t> data(lineSize_, 0);
+    if (!FunctionalMemory::read(line.addr, data))
+        return false;
+    if (!sectorSize_) {
+        backing_->set(toBackingAddr(line.addr), lineSize_, data);
+        return true;
+    }
+    for (uint64_t sector = 0; sectors; sector++, sectors >>= 1) {
+        if (sectors & 1) {
+            Addr offset = sector << sectorOffset_;
+            backing_->set(toBackingAddr(line.addr + offset), sectorSize_,
+                    std::vector<uint8_t>(data.begin() + offset, data.begin() + offset + sectorSize_));
+        }
+    }
+    return true;
+}
+
+/* Functional warmup: write a dirty line's data (its dirty sectors if lines are sectored) to memory.
+ * Fails, and writes nothing, if memory is not reachable */
+bool MemCacheController::writebackWarm(CacheState& line) {
+    if (!backing_)
+        return true;
+    std::vector<uint8_t> data(lineSize_, 0);
+    if (!FunctionalMemory::read(line.addr, data))
+        return false;
+    std::vector<uint8_t> block(sectorSize_ ? sectorSize_ : lineSize_);
+    uint64_t dirty = sectorSize_ ? line.dirty : 1;
+    for (uint64_t sector = 0; dirty; sector++, dirty >>= 1) {
+        if (dirty & 1) {
+            Addr offset = sector * block.size();
+            backing_->get(toBackingAddr(line.addr + offset), block.size(), block);
+            std::copy(block.begin(), block.end(), data.begin() + offset);
+        }
+    }
+    return FunctionalMemory::write(line.addr, data);
+}
+
 void MemCacheController::handleFlush(MemEvent* event) {
     out.fatal(CALL_INFO, -1, "%s, MemoryCache encountered unhandled event: %s\n",
             getName().c_str(), event->getVerboseString(dlevel).c_str());
@@ -365,16 +504,28 @@ void MemCacheController::handleDataResponse(MemEvent* event) {
         mem_h_debug_output(_L3_, "\n%" PRIu64 " (%s) handleDataResponse, Line: %" PRIu64 ", 0x%" PRIx64 ", %s\n",
                 getCurrentSimTimeNano(), getName().c_str(), cacheIndex, blockAddr, StateString[blockState]);
 
-    // update the backing store from the remote memory response
-    if (backing_)
+    // update the backing store from the remote memory response. Sectored lines only take the sectors
+    // they were missing; the read may have covered sectors that are present and possibly dirty.
+    if (backing_ && sectorSize_) {
+        Addr start = event->getBaseAddr() - lineAddr(event->getBaseAddr());
+        for (uint64_t sector = 0; sector < (lineSize_ >> sectorOffset_); sector++) {
+            if (!(it->second.fill & (1ULL << sector)))
+                continue;
+            Addr offset = sector << sectorOffset_;
+            const std::vector<uint8_t>& data = event->getPayloadBuffer().data();
+            backing_->set(toBackingAddr(blockAddr + offset), sectorSize_,
+                    std::vector<uint8_t>(data.begin() + (offset - start), data.begin() + (offset - start + sectorSize_)));
+        }
+    } else if (backing_) {
         writeData(event);
+    }
 
     // Update local memory
     it->second.reqev = new MemEvent(*it->second.event);
     it->second.reqev->setAddr(cacheIndex);
     it->second.reqev->setBaseAddr(cacheIndex);
     it->second.reqev->setCmd(Command::PutM);
-    it->second.reqev->setPayload(event->getPayload());
+    it->second.reqev->setPayload(event->getPayloadBuffer());
     it->second.reqev->clearFlag();
     it->second.reqev->setFlag(MemEvent::F_NORESPONSE);
     it->second.status = AccessStatus::FIN;
@@ -385,11 +536,17 @@ void MemCacheController::handleDataResponse(MemEvent* event) {
     // Update backing store from the request that missed if it was a write
     if (it->second.event->getCmd() == Command::PutM || it->second.event->getCmd() == Command::Write) {
         cache_[cacheIndex].state = M;
+        if (sectorSize_)
+            cache_[cacheIndex].dirty |= sectorMask(it->second.event);
         if (backing_)
             writeData(it->second.event);
     } else {
         cache_[cacheIndex].state = E;
     }
+    if (sectorSize_) {
+        cache_[cacheIndex].valid |= it->second.fill | cache_[cacheIndex].dirty;
+        cache_[cacheIndex].state = cache_[cacheIndex].dirty ? M : E;
+    }
 
     // Respond to requestor
     if (!(it->second.event->queryFlag(MemEvent::F_NORESPONSE))) {
@@ -437,27 +594,51 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
     switch (it->second.status) {
         case AccessStatus::MISS_WB:
             /* Write back data to memory */
-            remoteWr = new MemEvent(getName(), blockAddr, blockAddr, Command::PutM, lineSize_);
-            readData(remoteWr);
-            remoteWr->setFlag(MemEvent::F_NORESPONSE); // Don't send a response to this
-            remoteWr->setDst(link_->getTargetDestination(remoteWr->getBaseAddr()));
-            link_->send(remoteWr);
+            if (sectorSize_) {
+                writebackSectors(cacheIndex);
+            } else {
+                remoteWr = new MemEvent(memID_, blockAddr, blockAddr, Command::PutM, lineSize_);
+                readData(remoteWr);
+                remoteWr->setFlag(MemEvent::F_NORESPONSE); // Don't send a response to this
+                remoteWr->setDstID(link_->getTargetDestinationID(remoteWr->getBaseAddr()));
+                link_->send(remoteWr);
+            }
         case AccessStatus::MISS:
-            /* Read new data from memory */
-            remoteRd = new MemEvent(*ev);
-            remoteRd->setCmd(Command::GetS);
-            remoteRd->setSrc(getName());
-            remoteRd->setDst(link_->getTargetDestination(remoteRd->getBaseAddr()));
-            if (remoteRd->queryFlag(MemEvent::F_NORESPONSE))
-                remoteRd->clearFlag(MemEvent::F_NORESPONSE);
-            it->second.reqev = remoteRd;
-            link_->send(remoteRd);
-            it->second.status = AccessStatus::DATA; // We've request data, waiting for response
-            if (mem_h_is_debug_event(it->second.event))
-                mem_h_debug_output(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", DATA\n", getCurrentSimTimeNano(), getName().c_str(), it->second.event->getID().first);
-            cache_[cacheIndex].addr = ev->getBaseAddr();
-            cache_[cacheIndex].state = IM;
-            break;
+            if (sectorSize_) {
+                if (blockState == I || blockAddr != lineAddr(ev->getBaseAddr())) {
+                    cache_[cacheIndex].valid = 0;
+                    cache_[cacheIndex].dirty = 0;
+                }
+                cache_[cacheIndex].addr = lineAddr(ev->getBaseAddr());
+                it->second.fill = needSectors(ev, cacheIndex);
+            }
+            if (!sectorSize_ || it->second.fill) {
+                /* Read new data from memory */
+                remoteRd = new MemEvent(*ev);
+                remoteRd->setCmd(Command::GetS);
+                remoteRd->setSrcID(memID_);
+                if (sectorSize_) { // Read the smallest range that covers the missing sectors
+                    Addr first = __builtin_ctzll(it->second.fill);
+                    Addr last = 63 - __builtin_clzll(it->second.fill);
+                    Addr addr = lineAddr(ev->getBaseAddr()) + (first << sectorOffset_);
+                    remoteRd->setBaseAddr(addr);
+                    remoteRd->setAddr(addr);
+                    remoteRd->setSize((last - first + 1) << sectorOffset_);
+                    statSectorsFetched->addData(__builtin_popcountll(it->second.fill));
+                }
+                remoteRd->setDstID(link_->getTargetDestinationID(remoteRd->getBaseAddr()));
+                if (remoteRd->queryFlag(MemEvent::F_NORESPONSE))
+                    remoteRd->clearFlag(MemEvent::F_NORESPONSE);
+                it->second.reqev = remoteRd;
+                link_->send(remoteRd);
+                it->second.status = AccessStatus::DATA; // We've request data, waiting for response
+                if (mem_h_is_debug_event(it->second.event))
+                    mem_h_debug_output(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", DATA\n", getCurrentSimTimeNano(), getName().c_str(), it->second.event->getID().first);
+                cache_[cacheIndex].addr = lineAddr(ev->getBaseAddr());
+                cache_[cacheIndex].state = IM;
+                break;
+            }
+            /* Sectored write that fully covers every sector it touches that is not present, nothing to read */
         case AccessStatus::HIT_TAG: // tag hit, issue write
             it->second.reqev = new MemEvent(*ev);
             it->second.status = AccessStatus::HIT;
@@ -465,6 +646,10 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
                 mem_h_debug_output(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", HIT\n", getCurrentSimTimeNano(), getName().c_str(), it->second.event->getID().first);
             memBackendConvertor_->handleMemEvent(ev);
             cache_[cacheIndex].state = M;
+            if (sectorSize_) {
+                cache_[cacheIndex].dirty |= sectorMask(ev);
+                cache_[cacheIndex].valid |= cache_[cacheIndex].dirty;
+            }
             break;
         case AccessStatus::HIT:
             /* Write data. Here instead of receive to try to match backing access order to backend execute order */
@@ -527,6 +712,58 @@ void MemCacheController::sendResponse(MemEvent* ev, uint32_t flags) {
 }
 
 
+/* Sectors of the line touched by a request. If 'full' is given, it gets the touched sectors
+ * that the request covers completely */
+uint64_t MemCacheController::sectorMask(MemEvent* ev, uint64_t* full) {
+    Addr start = ev->getBaseAddr() - lineAddr(ev->getBaseAddr());
+    Addr end = std::min(start + ev->getSize(), (Addr)lineSize_);
+    auto range = [](Addr first, Addr last) { // Sectors [first, last)
+        if (last <= first) return (uint64_t)0;
+        uint64_t bits = (last - first == 64) ? ~0ULL : ((1ULL << (last - first)) - 1);
+        return bits << first;
+    };
+    if (full)
+        *full = range((start + sectorSize_ - 1) >> sectorOffset_, end >> sectorOffset_);
+    return range(start >> sectorOffset_, (end + sectorSize_ - 1) >> sectorOffset_);
+}
+
+/* Sectors that must be read from remote memory before 'ev' can complete. Writes only need
+ * the sectors they cover partially */
+uint64_t MemCacheController::needSectors(MemEvent* ev, Addr cacheIndex) {
+    uint64_t full = 0;
+    uint64_t need = sectorMask(ev, &full);
+    if (ev->getCmd() == Command::PutM || ev->getCmd() == Command::Write)
+        need &= ~full;
+    if (cache_[cacheIndex].state != I && cache_[cacheIndex].addr == lineAddr(ev->getBaseAddr()))
+        need &= ~cache_[cacheIndex].valid;
+    return need;
+}
+
+/* Write back each run of dirty sectors in a line with its own PutM, then clear the line's sectors */
+void MemCacheController::writebackSectors(Addr cacheIndex) {
+    CacheState& line = cache_[cacheIndex];
+    uint64_t dirty = line.dirty;
+    statSectorsWrittenBack->addData(__builtin_popcountll(dirty));
+
+    while (dirty) {
+        uint64_t first = __builtin_ctzll(dirty);
+        uint64_t rest = ~(dirty >> first);
+        uint64_t count = rest ? __builtin_ctzll(rest) : 64 - first;
+        Addr addr = line.addr + (first << sectorOffset_);
+
+        MemEvent * remoteWr = new MemEvent(memID_, addr, addr, Command::PutM, count << sectorOffset_);
+        readData(remoteWr);
+        remoteWr->setFlag(MemEvent::F_NORESPONSE); // Don't send a response to this
+        remoteWr->setDstID(link_->getTargetDestinationID(remoteWr->getBaseAddr()));
+        link_->send(remoteWr);
+
+        dirty &= ~(((count == 64) ? ~0ULL : ((1ULL << count) - 1)) << first);
+    }
+    line.valid = 0;
+    line.dirty = 0;
+}
+
+
 bool MemCacheController::clock(Cycle_t cycle) {
     bool unclockLink = true;
     if (clockLink_) {
@@ -589,12 +826,12 @@ void MemCacheController::writeData(MemEvent* event) {
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
     Addr addr = noncacheable ? event->getAddr() : event->getBaseAddr();
 
-    addr = toLocalAddr(addr);
+    addr = toBackingAddr(addr);
 
     if (event->getCmd() == Command::PutM) { /* Write request to memory */
         if (mem_h_is_debug_event(event)) { mem_h_debug_output(_L4_, "\tUpdate backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize()); }
 
-        backing_->set(addr, event->getSize(), event->getPayload());
+        backing_->set(addr, event->getSize(), event->getPayloadBuffer().data());
 
         return;
     }
@@ -602,7 +839,7 @@ void MemCacheController::writeData(MemEvent* event) {
     if (event->getCmd() == Command::Write) {
         if (mem_h_is_debug_event(event)) { mem_h_debug_output(_L4_, "\tUpdate backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize()); }
 
-        backing_->set(addr, event->getSize(), event->getPayload());
+        backing_->set(addr, event->getSize(), event->getPayloadBuffer().data());
 
         return;
     }
@@ -614,13 +851,12 @@ void MemCacheController::readData(MemEvent* event) {
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
     Addr localAddr = noncacheable ? event->getAddr() : event->getBaseAddr();
 
-    localAddr = toLocalAddr(localAddr);
+    localAddr = toBackingAddr(localAddr);
 
-    vector<uint8_t> payload;
-    payload.resize(event->getSize(), 0);
+    LineBuffer payload(event->getSize());
 
     if (backing_)
-        backing_->get(localAddr, event->getSize(), payload);
+        backing_->get(localAddr, event->getSize(), payload.writable());
 
     event->setPayload(payload);
 }
@@ -659,6 +895,13 @@ Addr MemCacheController::toLocalAddr(Addr addr) {
 }
 
 
+/* Sectored lines are stored at byte granularity so that sectors of a line do not overlap */
+Addr MemCacheController::toBackingAddr(Addr addr) {
+    if (!sectorSize_)
+        return toLocalAddr(addr);
+    return (toLocalAddr(addr) << lineOffset_) + (addr & (lineSize_ - 1));
+}
+
 
 void MemCacheController::processInitEvent( MemEventInit* me ) {
     /* Forward data to remote memory */
@@ -42,9 +42,11 @@ public:
             {"num_caches",          "(uint) Total number of memory caches", "1"},\
             {"cache_num",           "(uint) Index of this cache between 0 and num_caches-1", "0"}, \
             {"cache_line_size",     "(uint) Cache line size in bytes", "64"}, \
+            {"sector_size",         "(uint) Sector size in bytes. Lines are fetched from and written back to remote memory a sector at a time. Must be a power of two that divides cache_line_size into at most 64 sectors. 0 or cache_line_size disables sectoring.", "0"}, \
             {"backing",             "(string) Type of backing store to use. Options: 'none' - no backing store (only use if simulation does not require correct memory values), 'malloc', or 'mmap'", "mmap"},\
             {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity", "1MiB"},\
             {"memory_file",         "(string) Optional backing-store file to pre-load memory, or store resulting state", "N/A"},\
+            {"warmup_end",          "(string) Functional warmup: until this simulated time (with units), requests update the cache state and are answered immediately, with data read from and written to the backing store of memory on the same rank. Warmup copies from caches above are always handled this way. '0s' disables warmup.", "0s"},\
             {"verbose",             "(uint) Output verbosity for warnings/errors. 0[fatal error only], 1[warnings], 2[full state dump on fatal error]","1"},\
             {"debug",               "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE.", "0"},\
             {"debug_level",         "(uint) Debugging level: 0 to 10. Must configure sst-core with '--enable-debug'. 1=info, 2-10=debug output", "0"},\
@@ -57,6 +59,9 @@ public:
             {"CacheHits_Write",  "Number of write hits", "count", 1},
             {"CacheMisses_Read",  "Number of read misses", "count", 1},
             {"CacheMisses_Write",  "Number of write misses", "count", 1},
+            {"SectorMisses",  "Sectored lines: misses to a present line that lacked some requested sectors", "count", 1},
+            {"SectorsFetched",  "Sectored lines: sectors fetched from remote memory", "sectors", 1},
+            {"SectorsWrittenBack",  "Sectored lines: dirty sectors written back to remote memory", "sectors", 1},
             )
 
 #define MEMCACHE_ELI_SUBCOMPONENTSLOTS {"backend", "Memory controller and/or memory timing model.", "SST::MemHierarchy::MemBackend"},\
@@ -104,24 +109,32 @@ protected:
         MemEvent* event;
         AccessStatus status;
         MemEvent* reqev;
+        uint64_t fill;      // Sectored lines: sectors that the remote read will fill
 
-        MemAccessRecord() : event(nullptr), status(AccessStatus::MISS), reqev(nullptr) { }
-        MemAccessRecord(MemEvent* ev, AccessStatus stat) : event(ev), status(stat), reqev(nullptr) { }
+        MemAccessRecord() : event(nullptr), status(AccessStatus::MISS), reqev(nullptr), fill(0) { }
+        MemAccessRecord(MemEvent* ev, AccessStatus stat) : event(ev), status(stat), reqev(nullptr), fill(0) { }
     };
 
     std::map<SST::Event::id_type, MemAccessRecord> outstandingEvents_;
 
     std::map<uint64_t, std::queue<SST::Event::id_type> > mshr_;
 
+    /* With sectored lines, 'valid' and 'dirty' have one bit per sector and state is M iff any sector is dirty */
     struct CacheState {
         Addr addr;
         State state;
-        CacheState(Addr a, State s) : addr(a), state(s) { }
+        uint64_t valid;
+        uint64_t dirty;
+        CacheState(Addr a, State s) : addr(a), state(s), valid(0), dirty(0) { }
     };
 
     std::vector<CacheState> cache_;
+    EndpointID memID_;      // Interned getName()
     Addr lineSize_;
     Addr lineOffset_;
+    uint64_t sectorSize_;   // 0 if lines are not sectored
+    Addr sectorOffset_;
+    uint64_t warmupEndNs_;  // Functional warmup until this time
 
     void notifyListeners( MemEvent* ev ) {
         if (  ! listeners_.empty()) {
@@ -143,11 +156,20 @@ protected:
     void handleRead(MemEvent* ev, bool replay);
     void handleWrite(MemEvent* ev, bool replay);
     void handleFlush(MemEvent* ev);
+    void handleWarmup(MemEvent* ev);
+    bool fillWarm(CacheState& line, uint64_t sectors);
+    bool writebackWarm(CacheState& line);
     void handleDataResponse(MemEvent* ev);
     void retry(Addr cacheIndex);
 
     void sendResponse(MemEvent* ev, uint32_t flags);
 
+    /* Sectored lines */
+    Addr lineAddr(Addr addr) { return sectorSize_ ? (addr & ~(lineSize_ - 1)) : addr; }
+    uint64_t sectorMask(MemEvent* ev, uint64_t* full = nullptr);
+    uint64_t needSectors(MemEvent* ev, Addr cacheIndex);
+    void writebackSectors(Addr cacheIndex);
+
     Output out;
     Output dbg;
     std::set<Addr> debug_addr_filter_;
@@ -174,6 +196,7 @@ protected:
 
     MemRegion region_; // Which address region we are, for translating to local addresses
     Addr toLocalAddr(Addr addr);
+    Addr toBackingAddr(Addr addr);
 
     Clock::HandlerBase* clockHandler_;
     TimeConverter       clockTimeBase_;
@@ -188,6 +211,9 @@ protected:
     Statistic<uint64_t>* statReadMiss;
     Statistic<uint64_t>* statWriteHit;
     Statistic<uint64_t>* statWriteMiss;
+    Statistic<uint64_t>* statSectorMiss;
+    Statistic<uint64_t>* statSectorsFetched;
+    Statistic<uint64_t>* statSectorsWrittenBack;
 
 private:
     void handleCustomEvent(MemEventBase* ev);
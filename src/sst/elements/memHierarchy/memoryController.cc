@@ -74,7 +74,6 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
         checkpoint_ = NO_CHECKPOINT;
     }
 
-    bool initBacking = params.find<bool>("backing_init_zero", false);
     // Debug address
     std::vector<Addr> addrArr;
     params.find_array<Addr>("debug_addr", addrArr);
@@ -287,6 +286,16 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
         sizeBytes = 1 << log2Of(memBackendConvertor_->getMemSize());
     }
 
+    std::string hugePages = params.find<std::string>("backing_huge_pages", "none");
+    Backend::BackingMalloc::HugePages hugeMode = Backend::BackingMalloc::HugePages::None;
+    if (hugePages == "madvise")
+        hugeMode = Backend::BackingMalloc::HugePages::Madvise;
+    else if (hugePages == "hugetlb")
+        hugeMode = Backend::BackingMalloc::HugePages::TLB;
+    else if (hugePages != "none")
+        out.fatal(CALL_INFO, -1, "%s, ERROR - Invalid parameter: 'backing_huge_pages'. Must be one of 'none', 'madvise', or 'hugetlb'. You specified: %s\n",
+                getName().c_str(), hugePages.c_str());
+
     /* Create the backing store */
     std::string infile = params.find<std::string>("backing_in_file", "");
     backing_outfile_ = params.find<std::string>("backing_out_file", "", found);
@@ -316,7 +325,7 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
             else if ( e == 2 ) {
                 if ( backing_outfile_ == "" && infile == "" ) {
                     out.verbose(CALL_INFO, 1, 0, "%s, WARNING: Could not MMAP backing store (likely, simulated memory exceeds available memory space). Creating malloc based store instead.\n", getName().c_str());
-                    backing_ = new Backend::BackingMalloc(sizeBytes,initBacking);
+                    backing_ = new Backend::BackingMalloc(sizeBytes, false, hugeMode);
                 } else if ( infile != "" ) {
                     out.fatal(CALL_INFO, -1, "%s, ERROR: Could not MMAP backing store (likely, simulated memory exceeds available memory). Cannot initialize malloc based store from provided mmap input file %s.\n", getName().c_str(), infile.c_str());
                 } else {
@@ -338,7 +347,7 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
                     out.fatal(CALL_INFO, -1, "%s, ERROR: Unable to create backing store. Exception thrown is %d.\n", getName().c_str(), e);
             }
         } else {
-            backing_ = new Backend::BackingMalloc(sizeBytes,initBacking);
+            backing_ = new Backend::BackingMalloc(sizeBytes, false, hugeMode);
         }
         // Test outfile to find issues before simulation begins
         if ( backing_outfile_ != "" ) {
@@ -385,6 +394,12 @@ void MemController::handleEvent(SST::Event* event) {
         return;
     }
 
+    // Warmup copies from caches are untimed and need no response
+    if (meb->queryFlag(MemEventBase::F_WARMUP)) {
+        delete meb;
+        return;
+    }
+
     MemEvent * ev = static_cast<MemEvent*>(meb);
 
 #ifdef __SST_DEBUG_OUTPUT__
@@ -449,7 +464,7 @@ void MemController::handleEvent(SST::Event* event) {
             {
                 MemEvent* put = NULL;
                 if ( ev->getPayloadSize() != 0 ) {
-                    put = new MemEvent(getName(), ev->getBaseAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayload());
+                    put = new MemEvent(getName(), ev->getBaseAddr(), ev->getBaseAddr(), Command::PutM, ev->getPayloadBuffer());
                     put->setFlag(MemEvent::F_NORESPONSE);
                     outstandingEvents_.insert(std::make_pair(put->getID(), put));
                     if (mem_h_is_debug_event(put)) {
@@ -620,6 +635,10 @@ void MemController::init(unsigned int phase) {
 void MemController::setup(void) {
     memBackendConvertor_->setup();
     link_->setup();
+
+    // Region is final after init; let functional warmup in caches reach our contents
+    if (backing_)
+        FunctionalMemory::add(region_, privateMemOffset_, backing_);
 }
 
 void MemController::complete(unsigned int phase) {
@@ -660,10 +679,10 @@ void MemController::writeData(MemEvent* event) {
         Addr addr = event->queryFlag(MemEvent::F_NONCACHEABLE) ? event->getAddr() : event->getBaseAddr();
         if (mem_h_is_debug_event(event)) {
             mem_h_debug_output(_L8_, "S: Update backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize());
-            printDataValue(addr, &(event->getPayload()), true);
+            printDataValue(addr, &(event->getPayloadBuffer().data()), true);
         }
 
-        backing_->set(addr, event->getSize(), event->getPayload());
+        backing_->set(addr, event->getSize(), event->getPayloadBuffer().data());
 
         return;
     }
@@ -672,10 +691,10 @@ void MemController::writeData(MemEvent* event) {
         Addr addr = event->getAddr();
         if (mem_h_is_debug_event(event)) {
             mem_h_debug_output(_L8_, "S: Update backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize());
-            printDataValue(addr, &(event->getPayload()), true);
+            printDataValue(addr, &(event->getPayloadBuffer().data()), true);
         }
 
-        backing_->set(addr, event->getSize(), event->getPayload());
+        backing_->set(addr, event->getSize(), event->getPayloadBuffer().data());
 
         return;
     }
@@ -687,13 +706,12 @@ void MemController::readData(MemEvent* event) {
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
     Addr localAddr = noncacheable ? event->getAddr() : event->getBaseAddr();
 
-    vector<uint8_t> payload;
-    payload.resize(event->getSize(), 0);
+    LineBuffer payload(event->getSize());
 
     if (backing_) {
-        backing_->get(localAddr, event->getSize(), payload);
+        backing_->get(localAddr, event->getSize(), payload.writable());
         if (mem_h_is_debug_addr(localAddr))
-            printDataValue(localAddr, &(payload), false);
+            printDataValue(localAddr, &(payload.data()), false);
     }
 
     event->setPayload(payload);
@@ -870,7 +888,7 @@ void MemController::emergencyShutdown() {
     }
 }
 
-void MemController::printDataValue(Addr addr, std::vector<uint8_t>* data, bool set) {
+void MemController::printDataValue(Addr addr, const std::vector<uint8_t>* data, bool set) {
     if (dlevel < 11) return;
 
     std::string action = set ? "WRITE" : "READ";
@@ -25,6 +25,7 @@
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
+#include "sst/elements/memHierarchy/functionalMemory.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
 
 namespace SST {
@@ -55,7 +56,8 @@ public:
             {"listener%(listenercount)d", "(string) Loads a listener module into the controller", ""},\
             {"backing",             "(string) Type of backing store to use. Options: 'none' - no backing store (only use if simulation does not require correct memory values), 'malloc', or 'mmap'", "mmap"},\
             {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity", "1MiB"},\
-            {"backing_init_zero",   "(string) For 'malloc' backing stores, whether to initialize memory values to 0", "false"},\
+            {"backing_init_zero",   "(bool) DEPRECATED and ignored: 'malloc' backing stores always read unwritten memory as 0", "false"},\
+            {"backing_huge_pages",  "(string) For 'malloc' backing stores, back allocation units with huge pages. Options: 'none', 'madvise' (transparent huge pages), 'hugetlb' (MAP_HUGETLB, requires backing_size_unit to be a multiple of 2MiB and a reserved huge page pool)", "none"},\
             {"memory_file",         "(string) DEPRECATED: Use 'backing_in_file' and/or 'backing_out_file' instead. Optional backing-store file to pre-load memory and/or store resulting state. If file does not exist, the backing-store will create it.", "N/A"},\
             {"backing_in_file",     "(string) An optional file to pre-load memory contents from.", ""},\
             {"backing_out_file",    "(string) An optional file to write out memory contents to. Setting this will also trigger a flush of cache contents prior to writing the file. May be the same as 'backing_in_file'.", ""},\
@@ -107,8 +109,10 @@ public:
 
 protected:
     virtual ~MemController() {
-        if (backing_)
+        if (backing_) {
+            FunctionalMemory::remove(backing_);
             delete backing_;
+        }
     }
 
     void notifyListeners( MemEvent* ev ) {
@@ -173,7 +177,7 @@ protected:
     virtual void printStatus(Output &out) override;
     virtual void emergencyShutdown() override;
 
-    void printDataValue(Addr addr, std::vector<uint8_t>* data, bool set);
+    void printDataValue(Addr addr, const std::vector<uint8_t>* data, bool set);
 
 private:
 
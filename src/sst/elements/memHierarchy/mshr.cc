@@ -36,8 +36,195 @@ MSHR::MSHR(ComponentId_t cid, Output* debug, int maxSize, string cacheName, std:
 
     flush_acks_needed_ = 0;
     flush_all_in_mshr_count_ = 0;
+
+    // Size the table for the expected number of addresses; it grows if evictions/writebacks push it further
+    uint32_t capacity = 64;
+    while (maxSize > 0 && capacity < (uint32_t)maxSize * 2)
+        capacity <<= 1;
+    table_.assign(capacity, MSHR_NIL);
+    table_mask_ = capacity - 1;
+    table_used_ = 0;
+}
+
+/*******************************************************************************
+ * Hash table & pool management
+ *******************************************************************************/
+
+MSHRSlot* MSHR::findSlot(Addr addr) {
+    uint32_t pos = home(addr);
+    while (table_[pos] != MSHR_NIL) {
+        MSHRSlot* slot = &slots_[table_[pos]];
+        if (slot->addr_ == addr)
+            return slot;
+        pos = (pos + 1) & table_mask_;
+    }
+    return nullptr;
+}
+
+MSHRSlot* MSHR::createSlot(Addr addr) {
+    if ((table_used_ + 1) * 2 > table_.size())
+        growTable();
+
+    uint32_t index;
+    if (free_slots_.empty()) {
+        index = slots_.size();
+        slots_.emplace_back();
+    } else {
+        index = free_slots_.back();
+        free_slots_.pop_back();
+    }
+    MSHRSlot* slot = &slots_[index];
+    slot->addr_ = addr;
+    slot->head_ = slot->tail_ = MSHR_NIL;
+    slot->count_ = 0;
+    slot->acks_needed_ = 0;
+    slot->data_buffer_.clear();
+    slot->data_dirty_ = false;
+    slot->pending_retries_ = 0;
+    slot->valid_ = true;
+
+    uint32_t pos = home(addr);
+    while (table_[pos] != MSHR_NIL)
+        pos = (pos + 1) & table_mask_;
+    table_[pos] = index;
+    table_used_++;
+    return slot;
+}
+
+/* Remove an address from the table using backward-shift deletion so no tombstones are needed */
+void MSHR::eraseSlot(Addr addr) {
+    uint32_t pos = home(addr);
+    while (table_[pos] != MSHR_NIL && slots_[table_[pos]].addr_ != addr)
+        pos = (pos + 1) & table_mask_;
+    if (table_[pos] == MSHR_NIL)
+        return;
+
+    uint32_t index = table_[pos];
+    MSHRSlot* slot = &slots_[index];
+    while (slot->head_ != MSHR_NIL)
+        unlink(slot, slot->head_);
+    slot->valid_ = false;
+    slot->data_buffer_.clear();
+    free_slots_.push_back(index);
+
+    table_[pos] = MSHR_NIL;
+    table_used_--;
+    uint32_t next = (pos + 1) & table_mask_;
+    while (table_[next] != MSHR_NIL) {
+        uint32_t h = home(slots_[table_[next]].addr_);
+        // Move the entry back if its home is not cyclically within (pos, next]
+        bool inRange = (pos <= next) ? (h > pos && h <= next) : (h > pos || h <= next);
+        if (!inRange) {
+            table_[pos] = table_[next];
+            table_[next] = MSHR_NIL;
+            pos = next;
+        }
+        next = (next + 1) & table_mask_;
+    }
+}
+
+void MSHR::growTable() {
+    std::vector<uint32_t> old;
+    old.swap(table_);
+    table_.assign(old.size() * 2, MSHR_NIL);
+    table_mask_ = table_.size() - 1;
+    for (uint32_t index : old) {
+        if (index == MSHR_NIL) continue;
+        uint32_t pos = home(slots_[index].addr_);
+        while (table_[pos] != MSHR_NIL)
+            pos = (pos + 1) & table_mask_;
+        table_[pos] = index;
+    }
+}
+
+uint32_t MSHR::allocNode(const MSHREntry& entry) {
+    uint32_t index;
+    if (free_nodes_.empty()) {
+        index = nodes_.size();
+        nodes_.emplace_back();
+    } else {
+        index = free_nodes_.back();
+        free_nodes_.pop_back();
+    }
+    nodes_[index].entry_ = entry;
+    nodes_[index].prev_ = nodes_[index].next_ = MSHR_NIL;
+    return index;
+}
+
+/* Return the entry at position 'index' in a slot's list, or nullptr if the list is too short */
+MSHREntry* MSHR::nodeAt(MSHRSlot* slot, size_t index, uint32_t* nodeIndex) {
+    if (index >= slot->count_)
+        return nullptr;
+    uint32_t node = slot->head_;
+    while (index-- > 0)
+        node = nodes_[node].next_;
+    if (nodeIndex)
+        *nodeIndex = node;
+    return &nodes_[node].entry_;
+}
+
+void MSHR::pushBack(MSHRSlot* slot, const MSHREntry& entry) {
+    uint32_t node = allocNode(entry);
+    nodes_[node].prev_ = slot->tail_;
+    if (slot->tail_ != MSHR_NIL)
+        nodes_[slot->tail_].next_ = node;
+    else
+        slot->head_ = node;
+    slot->tail_ = node;
+    slot->count_++;
+}
+
+void MSHR::pushFront(MSHRSlot* slot, const MSHREntry& entry) {
+    uint32_t node = allocNode(entry);
+    nodes_[node].next_ = slot->head_;
+    if (slot->head_ != MSHR_NIL)
+        nodes_[slot->head_].prev_ = node;
+    else
+        slot->tail_ = node;
+    slot->head_ = node;
+    slot->count_++;
+}
+
+void MSHR::insertBefore(MSHRSlot* slot, uint32_t before, const MSHREntry& entry) {
+    if (before == slot->head_) {
+        pushFront(slot, entry);
+        return;
+    }
+    uint32_t node = allocNode(entry);
+    uint32_t prev = nodes_[before].prev_;
+    nodes_[node].prev_ = prev;
+    nodes_[node].next_ = before;
+    nodes_[prev].next_ = node;
+    nodes_[before].prev_ = node;
+    slot->count_++;
+}
+
+void MSHR::unlink(MSHRSlot* slot, uint32_t node) {
+    uint32_t prev = nodes_[node].prev_;
+    uint32_t next = nodes_[node].next_;
+    if (prev != MSHR_NIL) nodes_[prev].next_ = next;
+    else slot->head_ = next;
+    if (next != MSHR_NIL) nodes_[next].prev_ = prev;
+    else slot->tail_ = prev;
+    slot->count_--;
+
+    nodes_[node].entry_.getPointers()->clear();
+    free_nodes_.push_back(node);
 }
 
+void MSHR::removeNode(Addr addr, MSHRSlot* slot, uint32_t node) {
+    unlink(slot, node);
+    if (slot->count_ == 0) {
+        if (mem_h_is_debug_addr(addr))
+            printDebug(10, "Erase", addr, "");
+        eraseSlot(addr);
+    }
+}
+
+/*******************************************************************************
+ * MSHR API
+ *******************************************************************************/
+
 int MSHR::getMaxSize() {
     return max_size_;
 }
@@ -47,10 +234,8 @@ int MSHR::getSize() {
 }
 
 unsigned int MSHR::getSize(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
-        return 0;
-    else
-        return mshr_.find(addr)->second.entries_.size();
+    MSHRSlot* slot = findSlot(addr);
+    return slot ? slot->count_ : 0;
 }
 
 int MSHR::getFlushSize() {
@@ -58,148 +243,122 @@ int MSHR::getFlushSize() {
 }
 
 bool MSHR::exists(Addr addr) {
-    return mshr_.find(addr) != mshr_.end();
+    return findSlot(addr) != nullptr;
 }
 
 MSHREntry MSHR::getEntry(Addr addr, size_t index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr, index);
     }
-    if (mshr_.find(addr)->second.entries_.size() <= index) {
-        dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Entry list size is %zu.\n", owner_name_.c_str(), addr, index, mshr_.find(addr)->second.entries_.size());
+    if (slot->count_ <= index) {
+        dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Entry list size is %zu.\n", owner_name_.c_str(), addr, index, (size_t)slot->count_);
     }
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin();
-    std::advance(it, index);
-    return *it;
+    return *nodeAt(slot, index);
 }
 
 MSHREntry MSHR::getFront(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFront(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr);
     }
 
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (slot->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFront(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries_.front();
+    return nodes_[slot->head_].entry_;
 }
 
 void MSHR::removeEntry(Addr addr, size_t index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEntry(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr, index);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
-    if (reg->entries_.size() <= index) {
+    if (slot->count_ <= index) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEntry(0x%" PRIx64 ", %zu). Entry list is shorter than requested index.\n", owner_name_.c_str(), addr, index);
     }
 
-    std::list<MSHREntry>::iterator entry = reg->entries_.begin();
-    std::advance(entry, index);
+    uint32_t node;
+    MSHREntry* entry = nodeAt(slot, index, &node);
 
     if (entry->getType() == MSHREntryType::Event)
         size_--;
 
     if (mem_h_is_debug_addr(addr))
-        printDebug(10, "Remove", addr, (*entry).getString().c_str());
+        printDebug(10, "Remove", addr, entry->getString().c_str());
 
-    reg->entries_.erase(entry);
-    if (reg->entries_.empty()) {
-        if (mem_h_is_debug_addr(addr))
-            printDebug(10, "Erase", addr, "");
-            //dbg_->debug(_L10_, "M: %-41" PRIu64 " %-20s Erase        0x%-16" PRIx64 " %-10d\n",
-            //        getCurrentSimCycle(), owner_name_.c_str(), addr, size_);
-            //dbg_->debug(_L10_, "    MSHR: erasing 0x%" PRIx64 " from MSHR\n", addr);
-        mshr_.erase(addr);
-    }
+    removeNode(addr, slot, node);
 }
 
 void MSHR::removeFront(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeFront(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
-    if (reg->entries_.empty()) {
+    if (slot->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeFront(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
 
-   // if (mem_h_is_debug_addr(addr))
-   //     dbg_->debug(_L10_, "    MSHR::removeFront(0x%" PRIx64 ", %s)\n", addr, reg->entries_.front().getString().c_str());
-
-    if (getFrontType(addr) == MSHREntryType::Event)
+    MSHREntry* entry = &nodes_[slot->head_].entry_;
+    if (entry->getType() == MSHREntryType::Event)
         size_--;
 
     if (mem_h_is_debug_addr(addr))
-        printDebug(10, "RemFr", addr, (reg->entries_.front()).getString().c_str());
+        printDebug(10, "RemFr", addr, entry->getString().c_str());
 
-    reg->entries_.pop_front();
-    if (reg->entries_.empty()) {
-        if (mem_h_is_debug_addr(addr))
-            printDebug(10, "Erase", addr, "");
-            //dbg_->debug(_L10_, "    MSHR: erasing 0x%" PRIx64 " from MSHR\n", addr);
-        mshr_.erase(addr);
-    }
+    removeNode(addr, slot, slot->head_);
 }
 
 MSHREntryType MSHR::getEntryType(Addr addr, size_t index) {
-    //if (mem_h_is_debug_addr(addr))
-    //    dbg_->debug(_L20_, "    MSHR::getEntryType(0x%" PRIx64 ", %zu)\n", addr, index);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntryType(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr, index);
     }
-    if (mshr_.find(addr)->second.entries_.size() <= index) {
+    if (slot->count_ <= index) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntryType(0x%" PRIx64 ", %zu). Entry list is shoerter than index.\n", owner_name_.c_str(), addr, index);
     }
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin();
-    std::advance(it, index);
-    return it->getType();
+    return nodeAt(slot, index)->getType();
 }
 
 MSHREntryType MSHR::getFrontType(Addr addr) {
-    //if (mem_h_is_debug_addr(addr))
-    //    dbg_->debug(_L20_, "    MSHR::getFrontType(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFrontType(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (slot->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFrontType(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries_.front().getType();
+    return nodes_[slot->head_].entry_.getType();
 }
 
 MemEventBase* MSHR::getEntryEvent(Addr addr, size_t index) {
-    //if (mem_h_is_debug_addr(addr))
-    //    dbg_->debug(_L20_, "    MSHR::getEntryEvent(0x%" PRIx64 ", %zu)\n", addr, index);
-
-    if (mshr_.find(addr) == mshr_.end() || mshr_.find(addr)->second.entries_.size() <= index)
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot)
         return nullptr;
 
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin();
-    std::advance(it, index);
-    if (it->getType() != MSHREntryType::Event)
+    MSHREntry* entry = nodeAt(slot, index);
+    if (!entry || entry->getType() != MSHREntryType::Event)
         return nullptr;
-    return it->getEvent();
+    return entry->getEvent();
 }
 
 
 MemEventBase* MSHR::getFrontEvent(Addr addr) {
-    //if (mem_h_is_debug_addr(addr))
-    //    dbg_->debug(_L20_, "    MSHR::getFrontEvent(0x%" PRIx64 ")\n", addr);
     if (getFrontType(addr) != MSHREntryType::Event) {
         return nullptr;
     }
-    return mshr_.find(addr)->second.entries_.front().getEvent();
+    return nodes_[findSlot(addr)->head_].entry_.getEvent();
 }
 
 MemEventBase* MSHR::getFirstEventEntry(Addr addr, Command cmd) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L20_, "    MSHR::getFirstEventEntry(0x%" PRIx64 ", %s)\n", addr, CommandString[(int)cmd]);
-
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot)
         return nullptr;
 
-    for (std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin(); it != mshr_.find(addr)->second.entries_.end(); it++) {
-        if (it->getType() == MSHREntryType::Event && it->getEvent()->getCmd() == cmd)
-            return it->getEvent();
+    for (uint32_t node = slot->head_; node != MSHR_NIL; node = nodes_[node].next_) {
+        MSHREntry* entry = &nodes_[node].entry_;
+        if (entry->getType() == MSHREntryType::Event && entry->getEvent()->getCmd() == cmd)
+            return entry->getEvent();
     }
     return nullptr;
 }
@@ -224,7 +383,7 @@ std::list<Addr>* MSHR::getEvictPointers(Addr addr) {
     if (getFrontType(addr) != MSHREntryType::Evict)
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEvictPointers(0x%" PRIx64 "). Entry type is not Evict.\n", owner_name_.c_str(), addr);
 
-    return mshr_.find(addr)->second.entries_.front().getPointers();
+    return nodes_[findSlot(addr)->head_].entry_.getPointers();
 }
 
 // Return whether we should retry a new event or not
@@ -238,21 +397,22 @@ bool MSHR::removeEvictPointer(Addr addr, Addr addrPtr) {
         printDebug(10, "RemPtr", addr, reason.str());
     }
 
+    MSHRSlot* slot = findSlot(addr);
+
     // Sometimes we insert a WB before the Evict & then remove the Evict pointer, othertimes the Evict is front
     if (getFrontType(addr) == MSHREntryType::Evict) {
-        MSHREntry * entry = &(mshr_.find(addr)->second.entries_.front());
+        MSHREntry * entry = &nodes_[slot->head_].entry_;
         entry->getPointers()->remove(addrPtr);
         if (entry->getPointers()->empty()) {
             removeFront(addr);
             return true;
         }
     } else {
-        std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin();
-        it++;
-        if (it->getType() != MSHREntryType::Evict)
+        MSHREntry * entry = nodeAt(slot, 1);
+        if (!entry || entry->getType() != MSHREntryType::Evict)
             dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEvictPointer(0x%" PRIx64 ", 0x%" PRIx64 "). Entry type is not Evict.\n", owner_name_.c_str(), addr, addrPtr);
-        it->getPointers()->remove(addrPtr);
-        if (it->getPointers()->empty()) {
+        entry->getPointers()->remove(addrPtr);
+        if (entry->getPointers()->empty()) {
             removeEntry(addr, 1);
         }
     }
@@ -265,7 +425,7 @@ bool MSHR::pendingWriteback(Addr addr) {
 
 bool MSHR::pendingWritebackIsDowngrade(Addr addr) {
     if (pendingWriteback(addr))
-        return mshr_.find(addr)->second.entries_.front().getDowngrade();
+        return nodes_[findSlot(addr)->head_].entry_.getDowngrade();
     return false;
 }
 
@@ -282,11 +442,11 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
     // Success
     size_++;
 
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        reg.entries_.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
+        slot = createSlot(addr);
+        pushBack(slot, MSHREntry(event, stallEvict, getCurrentSimCycle()));
 
-        mshr_.insert(std::make_pair(addr, reg));
         if (mem_h_is_debug_addr(addr)) {
             stringstream reason;
             reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=0";
@@ -296,18 +456,18 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
 
         return 0;
     } else {
-        if (pos == -1 || pos > mshr_.find(addr)->second.entries_.size()) {
-            mshr_.find(addr)->second.entries_.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
+        if (pos == -1 || pos >= (int)slot->count_) {
+            pushBack(slot, MSHREntry(event, stallEvict, getCurrentSimCycle()));
             if (mem_h_is_debug_addr(addr)) {
                 stringstream reason;
-                reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (mshr_.find(addr)->second.entries_.size() - 1);
+                reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (slot->count_ - 1);
                 printDebug(10, "InsEv", addr, reason.str());
             }
-            return (mshr_.find(addr)->second.entries_.size() - 1);
+            return (slot->count_ - 1);
         } else {
-            std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin();
-            std::advance(it, pos);
-            mshr_.find(addr)->second.entries_.insert(it, MSHREntry(event, stallEvict, getCurrentSimCycle()));
+            uint32_t node;
+            nodeAt(slot, pos, &node);
+            insertBefore(slot, node, MSHREntry(event, stallEvict, getCurrentSimCycle()));
             if (mem_h_is_debug_addr(addr)) {
                 stringstream reason;
                 reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << pos;
@@ -326,7 +486,8 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
  *      -1 = conflict, not inserted
  */
 int MSHR::insertEventIfConflict(Addr addr, MemEventBase* event) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot)
         return 0;
 
     if (size_ == max_size_-1) { /* Assuming fwdEvent == false */
@@ -338,61 +499,70 @@ int MSHR::insertEventIfConflict(Addr addr, MemEventBase* event) {
         return -1;
     }
     size_++;
-    mshr_.find(addr)->second.entries_.push_back(MSHREntry(event, false, getCurrentSimCycle()));
+    pushBack(slot, MSHREntry(event, false, getCurrentSimCycle()));
     if (mem_h_is_debug_addr(addr)) {
         stringstream reason;
-        reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (mshr_.find(addr)->second.entries_.size() - 1);
+        reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (slot->count_ - 1);
         printDebug(10, "InsEv", addr, reason.str());
     }
-    return (mshr_.find(addr)->second.entries_.size() - 1);
+    return (slot->count_ - 1);
 }
 
 MemEventBase* MSHR::swapFrontEvent(Addr addr, MemEventBase* event) {
     if (mem_h_is_debug_addr(addr))
         printDebug(10, "SwpEv", addr, "");
 
-    if (mshr_.find(addr)->second.entries_.empty())
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot || slot->count_ == 0)
         return nullptr;
 
-    return  mshr_.find(addr)->second.entries_.front().swapEvent(event, getCurrentSimCycle());
+    return nodes_[slot->head_].entry_.swapEvent(event, getCurrentSimCycle());
 }
 
 void MSHR::moveEntryToFront(Addr addr, unsigned int index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::moveEntryToFront(0x%" PRIx64 ", %u). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr, index);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
-    if (reg->entries_.size() <= index) {
+    if (slot->count_ <= index) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::moveEntryToFront(0x%" PRIx64 ", %u). Entry list is shorter than requested index.\n", owner_name_.c_str(), addr, index);
     }
 
-    std::list<MSHREntry>::iterator entry = reg->entries_.begin();
-    std::advance(entry, index);
-
-    MSHREntry tmpEntry = *entry;
+    uint32_t node;
+    MSHREntry* entry = nodeAt(slot, index, &node);
 
     if (mem_h_is_debug_addr(addr))
         printDebug(10, "MvEnt", addr, entry->getString());
-    reg->entries_.erase(entry);
-    reg->entries_.push_front(tmpEntry);
+
+    if (node == slot->head_)
+        return;
+
+    // Relink the node at the head without copying the entry
+    uint32_t prev = nodes_[node].prev_;
+    uint32_t next = nodes_[node].next_;
+    nodes_[prev].next_ = next;
+    if (next != MSHR_NIL) nodes_[next].prev_ = prev;
+    else slot->tail_ = prev;
+
+    nodes_[node].prev_ = MSHR_NIL;
+    nodes_[node].next_ = slot->head_;
+    nodes_[slot->head_].prev_ = node;
+    slot->head_ = node;
 }
 
 bool MSHR::insertWriteback(Addr addr, bool downgrade) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L10_, "    MSHR::insertWriteback(0x%" PRIx64 ")\n", addr);
-
     if (mem_h_is_debug_addr(addr)) {
         stringstream reason;
         reason << "Downgrade: " << (downgrade ? "T" : "F");
         printDebug(10, "InsWB", addr, reason.str());
     }
 
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        reg.entries_.push_back(MSHREntry(downgrade, getCurrentSimCycle()));
-        mshr_.insert(std::make_pair(addr, reg));
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
+        slot = createSlot(addr);
+        pushBack(slot, MSHREntry(downgrade, getCurrentSimCycle()));
     } else {
-        mshr_.find(addr)->second.entries_.push_front(MSHREntry(downgrade, getCurrentSimCycle()));
+        pushFront(slot, MSHREntry(downgrade, getCurrentSimCycle()));
     }
 
     return true;
@@ -400,25 +570,21 @@ bool MSHR::insertWriteback(Addr addr, bool downgrade) {
 
 
 bool MSHR::insertEviction(Addr oldAddr, Addr newAddr) {
-//    if (mem_h_is_debug_addr(oldAddr) || mem_h_is_debug_addr(newAddr))
-//        dbg_->debug(_L10_, "    MSHR::insertEviction(0x%" PRIx64 ", 0x%" PRIx64 ")\n", oldAddr, newAddr);
-
     if (mem_h_is_debug_addr(oldAddr) || mem_h_is_debug_addr(newAddr)) {
         stringstream reason;
         reason << "to 0x" << std::hex << newAddr;
         printDebug(10, "InsPtr", oldAddr, reason.str());
     }
 
-    if (mshr_.find(oldAddr) == mshr_.end()) {  // No MSHR entry for oldAddr
-        MSHRRegister reg;
-        reg.entries_.push_back(MSHREntry(newAddr, getCurrentSimCycle()));
-        mshr_.insert(std::make_pair(oldAddr, reg));
+    MSHRSlot* slot = findSlot(oldAddr);
+    if (!slot) {  // No MSHR entry for oldAddr
+        slot = createSlot(oldAddr);
+        pushBack(slot, MSHREntry(newAddr, getCurrentSimCycle()));
     } else {
-        list<MSHREntry>* entries = &(mshr_.find(oldAddr)->second.entries_);
-        if (!entries->empty() && entries->back().getType() == MSHREntryType::Evict) { // MSHR entry for oldAddr is an Evict
-            entries->back().getPointers()->push_back(newAddr);
+        if (slot->count_ != 0 && nodes_[slot->tail_].entry_.getType() == MSHREntryType::Evict) { // MSHR entry for oldAddr is an Evict
+            nodes_[slot->tail_].entry_.getPointers()->push_back(newAddr);
         } else { // MSHR entry for oldAddr is not an Evict (or no entry exists)
-            entries->push_back(MSHREntry(newAddr, getCurrentSimCycle()));
+            pushBack(slot, MSHREntry(newAddr, getCurrentSimCycle()));
         }
     }
     return true;
@@ -468,53 +634,53 @@ void MSHR::addPendingRetry(Addr addr) {
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "IncRetry", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::addPendingRetry(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.addPendingRetry();
+    slot->pending_retries_++;
 }
 
 void MSHR::removePendingRetry(Addr addr) {
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "DecRetry", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removePendingRetry(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.removePendingRetry();
+    slot->pending_retries_--;
 }
 
 uint32_t MSHR::getPendingRetries(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot)
         return 0;
 
-    return mshr_.find(addr)->second.getPendingRetries();
+    return slot->pending_retries_;
 }
 
 
 void MSHR::setInProgress(Addr addr, bool value) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L10_, "    MSHR::setInProgress(0x%" PRIx64 ")\n", addr);
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "InProg", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setInProgress(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (slot->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setInProgress(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries_.front().setInProgress(value);
+    nodes_[slot->head_].entry_.setInProgress(value);
 }
 
 bool MSHR::getInProgress(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot || slot->count_ == 0) {
         return false;
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
-        return false;
-    }
-    return mshr_.find(addr)->second.entries_.front().getInProgress();
+    return nodes_[slot->head_].entry_.getInProgress();
 }
 
 void MSHR::setStalledForEvict(Addr addr, bool set) {
@@ -525,58 +691,59 @@ void MSHR::setStalledForEvict(Addr addr, bool set) {
             printDebug(20, "Unstall", addr, "");
     }
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setStalledForEvict(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (slot->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setStalledForEvict(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries_.front().setStalledForEvict(set);
+    nodes_[slot->head_].entry_.setStalledForEvict(set);
 }
 
 bool MSHR::getStalledForEvict(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
-        return false;
-    }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot || slot->count_ == 0) {
         return false;
     }
-    return mshr_.find(addr)->second.entries_.front().getStalledForEvict();
+    return nodes_[slot->head_].entry_.getStalledForEvict();
 }
 
 void MSHR::setProfiled(Addr addr) {
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "Profile", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setProfiled(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (slot->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s Error: MSHR::setProfiled(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries_.front().setProfiled();
+    nodes_[slot->head_].entry_.setProfiled();
 }
 
 bool MSHR::getProfiled(Addr addr) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L20_, "    MSHR::getProfiled(0x%" PRIx64 "\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (slot->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries_.front().getProfiled();
+    return nodes_[slot->head_].entry_.getProfiled();
 }
 
 bool MSHR::getProfiled(Addr addr, SST::Event::id_type id) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot)
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Address does not exist in MSHR.\n", owner_name_.c_str(), addr, id.first, id.second);
-    if (mshr_.find(addr)->second.entries_.empty())
+    if (slot->count_ == 0)
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Entry list is empty.\n", owner_name_.c_str(), addr, id.first, id.second);
-    for (list<MSHREntry>::iterator jt = mshr_.find(addr)->second.entries_.begin(); jt != mshr_.find(addr)->second.entries_.end(); jt++) {
-        if (jt->getType() == MSHREntryType::Event && jt->getEvent()->getID() == id) {
-            return jt->getProfiled();
+    for (uint32_t node = slot->head_; node != MSHR_NIL; node = nodes_[node].next_) {
+        MSHREntry* entry = &nodes_[node].entry_;
+        if (entry->getType() == MSHREntryType::Event && entry->getEvent()->getID() == id) {
+            return entry->getProfiled();
         }
     }
     return true; // default so we don't attempt to profile what isn't there
@@ -586,146 +753,160 @@ void MSHR::setProfiled(Addr addr, SST::Event::id_type id) {
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "Profile", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Address does not exist in MSHR.\n", owner_name_.c_str(), addr, id.first, id.second);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (slot->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s Error: MSHR::setProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Entry list is empty.\n", owner_name_.c_str(), addr, id.first, id.second);
     }
-    for (list<MSHREntry>::iterator jt = mshr_.find(addr)->second.entries_.begin(); jt != mshr_.find(addr)->second.entries_.end(); jt++) {
-        if (jt->getType() == MSHREntryType::Event && jt->getEvent()->getID() == id) {
-            jt->setProfiled();
+    for (uint32_t node = slot->head_; node != MSHR_NIL; node = nodes_[node].next_) {
+        MSHREntry* entry = &nodes_[node].entry_;
+        if (entry->getType() == MSHREntryType::Event && entry->getEvent()->getID() == id) {
+            entry->setProfiled();
             return;
         }
     }
 }
 
+/* Return the event entry that has been waiting the longest. Ties go to the lowest address. */
 MSHREntry* MSHR::getOldestEntry() {
-    bool first = false;
-    MSHREntry* entry = nullptr;
-    uint64_t time;
-
-    for (MSHRBlock::iterator it = mshr_.begin(); it != mshr_.end(); it++) {
-        for (list<MSHREntry>::iterator jt = it->second.entries_.begin(); jt != it->second.entries_.end(); jt++) {
-            if (jt->getType() == MSHREntryType::Event) {
-                if (!first) {
-                    entry = &(*jt);
-                    time = jt->getStartTime();
-                } else if (jt->getStartTime() < time) {
-                    entry = &(*jt);
-                    time = jt->getStartTime();
-                }
+    MSHREntry* oldest = nullptr;
+    Addr oldestAddr = 0;
+
+    for (MSHRSlot& slot : slots_) {
+        if (!slot.valid_) continue;
+        for (uint32_t node = slot.head_; node != MSHR_NIL; node = nodes_[node].next_) {
+            MSHREntry* entry = &nodes_[node].entry_;
+            if (entry->getType() != MSHREntryType::Event)
+                continue;
+            if (!oldest || entry->getStartTime() < oldest->getStartTime() ||
+                    (entry->getStartTime() == oldest->getStartTime() && slot.addr_ < oldestAddr)) {
+                oldest = entry;
+                oldestAddr = slot.addr_;
             }
         }
     }
-    return entry;
+    return oldest;
 }
 
 void MSHR::incrementAcksNeeded(Addr addr) {
-   // if (mem_h_is_debug_addr(addr))
-   //     dbg_->debug(_L10_, "    MSHR::incrementAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        mshr_.insert(std::make_pair(addr, reg));
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
+        slot = createSlot(addr);
     }
-    mshr_.find(addr)->second.acks_needed_++;
+    slot->acks_needed_++;
 
     if (mem_h_is_debug_addr(addr)) {
         std::stringstream reason;
-        reason << mshr_.find(addr)->second.acks_needed_ << " acks";
+        reason << slot->acks_needed_ << " acks";
         printDebug(10, "IncAck", addr, reason.str());
     }
 }
 
 /* Decrement acks needed and return if we're done waiting (acks_needed_ == 0) */
 bool MSHR::decrementAcksNeeded(Addr addr) {
-   // if (mem_h_is_debug_addr(addr))
-   //     dbg_->debug(_L10_, "    MSHR::decrementAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::decrementAcksNeeded(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.acks_needed_ == 0) {
+    if (slot->acks_needed_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::decrementAcksNeeded(0x%" PRIx64 "). AcksNeeded is already 0.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.acks_needed_--;
+    slot->acks_needed_--;
 
     if (mem_h_is_debug_addr(addr)) {
         std::stringstream reason;
-        reason << mshr_.find(addr)->second.acks_needed_ << " acks";
+        reason << slot->acks_needed_ << " acks";
         printDebug(10, "DecAck", addr, reason.str());
     }
 
-    return (mshr_.find(addr)->second.acks_needed_ == 0);
+    return (slot->acks_needed_ == 0);
 }
 
 uint32_t MSHR::getAcksNeeded(Addr addr) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L20_, "    MSHR::getAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         return 0;
     }
-    return (mshr_.find(addr)->second.acks_needed_);
+    return slot->acks_needed_;
 }
 
-void MSHR::setData(Addr addr, vector<uint8_t>& data, bool dirty) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L10_, "    MSHR::setData(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+void MSHR::setData(Addr addr, const vector<uint8_t>& data, bool dirty) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setData(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
 
     if (mem_h_is_debug_addr(addr))
         printDebug(10, "SetData", addr, (dirty ? "Dirty" : "Clean"));
 
-    mshr_.find(addr)->second.data_buffer_ = data;
-    mshr_.find(addr)->second.data_dirty_ = dirty;
+    slot->data_buffer_.assign(data);
+    slot->data_dirty_ = dirty;
+}
+
+void MSHR::setData(Addr addr, const LineBuffer& data, bool dirty) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
+        dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setData(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
+    }
+
+    if (mem_h_is_debug_addr(addr))
+        printDebug(10, "SetData", addr, (dirty ? "Dirty" : "Clean"));
+
+    slot->data_buffer_ = data;
+    slot->data_dirty_ = dirty;
 }
 
 void MSHR::clearData(Addr addr) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L10_, "    MSHR::clearData(0x%" PRIx64 ")\n", addr);
     if (mem_h_is_debug_addr(addr))
         printDebug(10, "ClrData", addr, "");
 
-    mshr_.find(addr)->second.data_buffer_.clear();
-    mshr_.find(addr)->second.data_dirty_ = false;
+    MSHRSlot* slot = findSlot(addr);
+    slot->data_buffer_.clear();
+    slot->data_dirty_ = false;
 }
 
 vector<uint8_t>& MSHR::getData(Addr addr) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L20_, "    MSHR::getData(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getData(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.data_buffer_;
+    return slot->data_buffer_.writable();
+}
+
+const LineBuffer& MSHR::getDataBuffer(Addr addr) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
+        dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getDataBuffer(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
+    }
+    return slot->data_buffer_;
 }
 
 bool MSHR::hasData(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot)
         return false;
-    return !(mshr_.find(addr)->second.data_buffer_.empty());
+    return !(slot->data_buffer_.empty());
 }
 
 bool MSHR::getDataDirty(Addr addr) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L20_, "    MSHR::getDataDirty(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getDataDirty(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.data_dirty_;
+    return slot->data_dirty_;
 }
 
 void MSHR::setDataDirty(Addr addr, bool dirty) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L10_, "    MSHR::setDataDirty(0x%" PRIx64 ")\n", addr);
-
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "SetDirt", addr, (dirty ? "Dirty" : "Clean"));
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRSlot* slot = findSlot(addr);
+    if (!slot) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setDataDirty(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.data_dirty_ = dirty;
+    slot->data_dirty_ = dirty;
 
 }
 
@@ -751,19 +932,65 @@ void MSHR::printDebug(uint32_t lev, std::string action, Addr addr, std::string r
 // Print status. Called by cache controller on EmergencyShutdown and printStatus()
 void MSHR::printStatus(Output &out) {
     out.output("    MSHR Status for %s. Size: %u. Prefetches: %u\b", owner_name_.c_str(), size_, prefetch_count_);
-    for (std::map<Addr,MSHRRegister>::iterator it = mshr_.begin(); it != mshr_.end(); it++) {   // Iterate over addresses
-        out.output("      Entry: Addr = 0x%" PRIx64 "\n", (it->first));
-        for (std::list<MSHREntry>::iterator it2 = it->second.entries_.begin(); it2 != it->second.entries_.end(); it2++) { // Iterate over entries for each address
-            out.output("        %s\n", it2->getString().c_str());
+    std::vector<Addr> addrs;    // Print in address order
+    for (MSHRSlot& slot : slots_) {
+        if (slot.valid_) addrs.push_back(slot.addr_);
+    }
+    std::sort(addrs.begin(), addrs.end());
+    for (Addr addr : addrs) {   // Iterate over addresses
+        out.output("      Entry: Addr = 0x%" PRIx64 "\n", addr);
+        MSHRSlot* slot = findSlot(addr);
+        for (uint32_t node = slot->head_; node != MSHR_NIL; node = nodes_[node].next_) { // Iterate over entries for each address
+            out.output("        %s\n", nodes_[node].entry_.getString().c_str());
         }
     }
     out.output("    End MSHR Status for %s\n", owner_name_.c_str());
 }
 
+void MSHR::exportBlock(MSHRBlock& block) {
+    for (MSHRSlot& slot : slots_) {
+        if (!slot.valid_) continue;
+        MSHRRegister& reg = block[slot.addr_];
+        for (uint32_t node = slot.head_; node != MSHR_NIL; node = nodes_[node].next_)
+            reg.entries_.push_back(nodes_[node].entry_);
+        reg.acks_needed_ = slot.acks_needed_;
+        reg.data_buffer_ = slot.data_buffer_.data();
+        reg.data_dirty_ = slot.data_dirty_;
+        reg.pending_retries_ = slot.pending_retries_;
+    }
+}
+
+void MSHR::importBlock(MSHRBlock& block) {
+    uint32_t capacity = 64;
+    while (capacity < block.size() * 2 || (max_size_ > 0 && capacity < (uint32_t)max_size_ * 2))
+        capacity <<= 1;
+    table_.assign(capacity, MSHR_NIL);
+    table_mask_ = capacity - 1;
+    table_used_ = 0;
+    slots_.clear();
+    free_slots_.clear();
+    nodes_.clear();
+    free_nodes_.clear();
+
+    for (MSHRBlock::iterator it = block.begin(); it != block.end(); it++) {
+        MSHRSlot* slot = createSlot(it->first);
+        for (MSHREntry& entry : it->second.entries_)
+            pushBack(slot, entry);
+        slot->acks_needed_ = it->second.acks_needed_;
+        slot->data_buffer_.assign(it->second.data_buffer_);
+        slot->data_dirty_ = it->second.data_dirty_;
+        slot->pending_retries_ = it->second.pending_retries_;
+    }
+}
+
+/* The pooled table is checkpointed in the same address-ordered form as the original std::map MSHR */
 void MSHR::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST::ComponentExtension::serialize_order(ser);
 
-    SST_SER(mshr_);
+    MSHRBlock mshr;
+    if (ser.mode() != SST::Core::Serialization::serializer::UNPACK)
+        exportBlock(mshr);
+    SST_SER(mshr);
     SST_SER(flushes_);
     SST_SER(flush_all_in_mshr_count_);
     SST_SER(flush_acks_needed_);
@@ -773,4 +1000,7 @@ void MSHR::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(prefetch_count_);
     SST_SER(owner_name_);
     SST_SER(debug_addr_filter_);
+
+    if (ser.mode() == SST::Core::Serialization::serializer::UNPACK)
+        importBlock(mshr);
 }
@@ -17,7 +17,8 @@
 #define _MSHR_H_
 
 #include <list>
-
+#include <deque>
+#include <vector>
 #include <map>
 #include <string>
 #include <sstream>
@@ -201,8 +202,37 @@ struct MSHRRegister {
     }
 };
 
+/* Checkpoint representation of the MSHR; the live structure is the pooled table below */
 typedef map<Addr, MSHRRegister> MSHRBlock;
 
+/*
+ * Pooled MSHR storage
+ *  - Each address with outstanding state has an MSHRSlot, located through an open-addressed
+ *    (linear probing) hash table of slot indices
+ *  - A slot's entries are MSHRNodes linked by index (intrusive list) rather than a std::list
+ *  - Slots and nodes are recycled through free lists so steady-state inserts/removes do not allocate.
+ *    Both pools are deques so references to entries remain valid while the pools grow.
+ */
+static const uint32_t MSHR_NIL = 0xFFFFFFFF;
+
+struct MSHRNode {
+    MSHREntry entry_;
+    uint32_t prev_ = MSHR_NIL;
+    uint32_t next_ = MSHR_NIL;
+};
+
+struct MSHRSlot {
+    Addr addr_ = 0;
+    uint32_t head_ = MSHR_NIL;
+    uint32_t tail_ = MSHR_NIL;
+    uint32_t count_ = 0;
+    uint32_t acks_needed_ = 0;
+    LineBuffer data_buffer_;    // Shared with the event that supplied the data where possible
+    bool data_dirty_ = false;
+    uint32_t pending_retries_ = 0;
+    bool valid_ = false;
+};
+
 /**
  *  Implements an MSHR with entries of type mshrEntry
  */
@@ -311,9 +341,11 @@ public:
     uint32_t getAcksNeeded(Addr addr);
 
 // Functions to manage temporary data storage for an address
-    void setData(Addr addr, vector<uint8_t>& data, bool dirty = false);
+    void setData(Addr addr, const vector<uint8_t>& data, bool dirty = false);
+    void setData(Addr addr, const LineBuffer& data, bool dirty = false); // Shares data, no copy
     void clearData(Addr addr);
-    vector<uint8_t>& getData(Addr addr);
+    vector<uint8_t>& getData(Addr addr);                // Copies first if the data is still shared
+    const LineBuffer& getDataBuffer(Addr addr);         // Read or share without copying
     bool hasData(Addr addr);
     bool getDataDirty(Addr addr);
     void setDataDirty(Addr addr, bool dirty);
@@ -330,7 +362,33 @@ private:
 
     void printDebug(uint32_t level, std::string action, Addr addr, std::string reason);
 
-    MSHRBlock mshr_;                                    // MSHR maps each address to a list of events/evictions/etc
+    /* Hash table & pool management */
+    MSHRSlot* findSlot(Addr addr);
+    MSHRSlot* createSlot(Addr addr);
+    void eraseSlot(Addr addr);
+    void growTable();
+    inline uint32_t home(Addr addr) { return (uint32_t)((addr * 0x9E3779B97F4A7C15ULL) >> 32) & table_mask_; }
+
+    /* Per-slot entry list management */
+    uint32_t allocNode(const MSHREntry& entry);
+    MSHREntry* nodeAt(MSHRSlot* slot, size_t index, uint32_t* nodeIndex = nullptr);
+    void pushBack(MSHRSlot* slot, const MSHREntry& entry);
+    void pushFront(MSHRSlot* slot, const MSHREntry& entry);
+    void insertBefore(MSHRSlot* slot, uint32_t before, const MSHREntry& entry);
+    void unlink(MSHRSlot* slot, uint32_t node);
+    void removeNode(Addr addr, MSHRSlot* slot, uint32_t node); // unlink + erase slot if empty
+
+    /* Convert to/from the std::map form used for checkpoints */
+    void exportBlock(MSHRBlock& block);
+    void importBlock(MSHRBlock& block);
+
+    std::vector<uint32_t> table_;                       // Open-addressed hash table of slot indices, MSHR_NIL = empty
+    uint32_t table_mask_ = 0;                           // table_.size() - 1, table size is a power of two
+    uint32_t table_used_ = 0;                           // Number of occupied table positions
+    std::deque<MSHRSlot> slots_;                        // Slot pool
+    std::vector<uint32_t> free_slots_;                  // Free slot indices
+    std::deque<MSHRNode> nodes_;                        // Entry pool
+    std::vector<uint32_t> free_nodes_;                  // Free node indices
     std::list<MemEventBase*> flushes_;                  // Flushes are not linked to a particular address so are stored outside the mshr_ structure
     int flush_all_in_mshr_count_ = 0;                   // Number of FlushAll (vs ForwardFlush) in the flushes_ list
     int flush_acks_needed_ = 0;                         // Number of things that need to complete before flush can retry
@@ -0,0 +1,203 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include "prefetchThrottle.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+void PrefetchThrottle::configure(Output* out, const std::string& owner, Params& params, uint64_t lines, uint64_t line_size) {
+    enabled_ = params.find<bool>("prefetch_throttle", false);
+    if (!enabled_)
+        return;
+
+    line_size_ = line_size;
+    max_degree_ = params.find<uint32_t>("prefetch_throttle_max_degree", 4);
+    epoch_length_ = params.find<uint64_t>("prefetch_throttle_epoch", lines / 2);
+    accuracy_high_ = params.find<double>("prefetch_throttle_accuracy_high", 0.75);
+    accuracy_low_ = params.find<double>("prefetch_throttle_accuracy_low", 0.40);
+    lateness_threshold_ = params.find<double>("prefetch_throttle_lateness", 0.01);
+    pollution_threshold_ = params.find<double>("prefetch_throttle_pollution", 0.005);
+    uint64_t filter_bits = params.find<uint64_t>("prefetch_throttle_filter_bits", lines);
+
+    if (max_degree_ == 0)
+        out->fatal(CALL_INFO, -1, "%s, Invalid param: prefetch_throttle_max_degree - must be at least 1.\n", owner.c_str());
+    if (epoch_length_ == 0)
+        out->fatal(CALL_INFO, -1, "%s, Invalid param: prefetch_throttle_epoch - must be at least 1.\n", owner.c_str());
+    if (accuracy_low_ > accuracy_high_)
+        out->fatal(CALL_INFO, -1, "%s, Invalid param combo: prefetch_throttle_accuracy_low (%f) must not be greater than prefetch_throttle_accuracy_high (%f).\n",
+                owner.c_str(), accuracy_low_, accuracy_high_);
+    if (filter_bits == 0)
+        out->fatal(CALL_INFO, -1, "%s, Invalid param: prefetch_throttle_filter_bits - must be at least 1.\n", owner.c_str());
+
+    tracker_addr_.assign(lines ? lines : 1, 0);
+    tracker_owner_.assign(tracker_addr_.size(), NO_PREFETCHER);
+    pollution_filter_.assign(filter_bits, false);
+
+    evictions_ = 0;
+    demand_misses_ = 0;
+    pollution_misses_ = 0;
+    pollution_ = 0.0;
+}
+
+void PrefetchThrottle::addPrefetcher(CacheListener* prefetcher, Statistic<uint64_t>* degree, Statistic<uint64_t>* accuracy,
+        Statistic<uint64_t>* lateness, Statistic<uint64_t>* pollution) {
+    PrefetcherState state;
+    state.listener = prefetcher;
+    state.degree = (max_degree_ + 1) / 2; // Start in the middle
+    state.last_cycle = 0;
+    state.admitted = 0;
+    state.issued = 0;
+    state.useful = 0;
+    state.late = 0;
+    state.accuracy = 0.0;
+    state.lateness = 0.0;
+    state.stat_degree = degree;
+    state.stat_accuracy = accuracy;
+    state.stat_lateness = lateness;
+    state.stat_pollution = pollution;
+    prefetchers_.push_back(state);
+
+    prefetcher->setPrefetchDegree(state.degree);
+}
+
+bool PrefetchThrottle::admit(uint32_t prefetcher, MemEventBase* event, SimTime_t cycle) {
+    PrefetcherState& state = prefetchers_[prefetcher];
+    if (state.last_cycle != cycle) {
+        state.last_cycle = cycle;
+        state.admitted = 0;
+    }
+    if (state.admitted == state.degree)
+        return false;
+    state.admitted++;
+    pending_[event->getID()] = prefetcher;
+    return true;
+}
+
+void PrefetchThrottle::notifyAccess(MemEvent* event, NotifyAccessType access, NotifyResultType result) {
+    Addr addr = event->getBaseAddr();
+    size_t slot = trackerSlot(addr);
+
+    if (access == NotifyAccessType::PREFETCH) {
+        std::map<SST::Event::id_type, uint32_t>::iterator it = pending_.find(event->getID());
+        if (it == pending_.end())
+            return;
+        if (result == NotifyResultType::MISS) { // Sent to memory
+            prefetchers_[it->second].issued++;
+            tracker_addr_[slot] = addr;
+            tracker_owner_[slot] = it->second;
+        }
+        pending_.erase(it);
+        return;
+    }
+
+    bool tracked = tracker_owner_[slot] != NO_PREFETCHER && tracker_addr_[slot] == addr;
+    if (tracked) {
+        PrefetcherState& state = prefetchers_[tracker_owner_[slot]];
+        state.useful++;
+        if (result == NotifyResultType::MISS)
+            state.late++;
+        tracker_owner_[slot] = NO_PREFETCHER;
+    } else if (result == NotifyResultType::MISS) {
+        demand_misses_++;
+        size_t bit = filterSlot(addr);
+        if (pollution_filter_[bit]) {
+            pollution_misses_++;
+            pollution_filter_[bit] = false;
+        }
+    }
+}
+
+void PrefetchThrottle::notifyEvict(Addr addr, bool by_prefetch) {
+    size_t slot = trackerSlot(addr);
+    if (tracker_addr_[slot] == addr)
+        tracker_owner_[slot] = NO_PREFETCHER; // Unused prefetch
+
+    if (by_prefetch)
+        pollution_filter_[filterSlot(addr)] = true;
+
+    if (++evictions_ >= epoch_length_)
+        endEpoch();
+}
+
+void PrefetchThrottle::endEpoch() {
+    if (demand_misses_ != 0)
+        pollution_ = (pollution_ + (double)pollution_misses_ / (double)demand_misses_) / 2.0;
+    bool polluting = pollution_ > pollution_threshold_;
+
+    for (std::vector<PrefetcherState>::iterator it = prefetchers_.begin(); it != prefetchers_.end(); it++) {
+        if (it->issued != 0)
+            it->accuracy = (it->accuracy + (double)it->useful / (double)it->issued) / 2.0;
+        if (it->useful != 0)
+            it->lateness = (it->lateness + (double)it->late / (double)it->useful) / 2.0;
+
+        bool late = it->lateness > lateness_threshold_;
+        int change = 0;
+        if (it->accuracy >= accuracy_high_) {
+            if (late) change = 1;
+            else if (polluting) change = -1;
+        } else if (it->accuracy >= accuracy_low_) {
+            if (late && !polluting) change = 1;
+            else if (polluting) change = -1;
+        } else {
+            if (!late || polluting) change = -1; // Late but clean prefetches may still become useful
+        }
+
+        uint32_t degree = it->degree;
+        if (change > 0 && degree < max_degree_) degree++;
+        if (change < 0 && degree > 1) degree--;
+        if (degree != it->degree) {
+            it->degree = degree;
+            it->listener->setPrefetchDegree(degree);
+        }
+
+        if (it->stat_degree) it->stat_degree->addData(it->degree);
+        if (it->stat_accuracy) it->stat_accuracy->addData((uint64_t)(it->accuracy * 100.0));
+        if (it->stat_lateness) it->stat_lateness->addData((uint64_t)(it->lateness * 100.0));
+        if (it->stat_pollution) it->stat_pollution->addData((uint64_t)(pollution_ * 100.0));
+
+        it->issued = 0;
+        it->useful = 0;
+        it->late = 0;
+    }
+
+    evictions_ = 0;
+    demand_misses_ = 0;
+    pollution_misses_ = 0;
+}
+
+void PrefetchThrottle::serialize_order(SST::Core::Serialization::serializer& ser) {
+    SST_SER(enabled_);
+    if (!enabled_)
+        return;
+    SST_SER(line_size_);
+    SST_SER(max_degree_);
+    SST_SER(epoch_length_);
+    SST_SER(accuracy_high_);
+    SST_SER(accuracy_low_);
+    SST_SER(lateness_threshold_);
+    SST_SER(pollution_threshold_);
+    SST_SER(prefetchers_);
+    SST_SER(pending_);
+    SST_SER(tracker_addr_);
+    SST_SER(tracker_owner_);
+    SST_SER(pollution_filter_);
+    SST_SER(evictions_);
+    SST_SER(demand_misses_);
+    SST_SER(pollution_misses_);
+    SST_SER(pollution_);
+}
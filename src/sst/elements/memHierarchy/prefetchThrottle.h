@@ -0,0 +1,147 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_PREFETCHTHROTTLE_H
+#define MEMHIERARCHY_PREFETCHTHROTTLE_H
+
+#include <sst/core/output.h>
+#include <sst/core/params.h>
+#include <sst/core/serialization/serializer.h>
+
+#include <map>
+#include <vector>
+
+#include "sst/elements/memHierarchy/memEvent.h"
+#include "sst/elements/memHierarchy/cacheListener.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Feedback-directed prefetch throttling (Srinath et al., HPCA 2007)
+ *
+ * Each prefetcher attached to a cache runs at a degree between 1 and max_degree. The prefetcher
+ * is told its degree through CacheListener::setPrefetchDegree() and scales the prefetches it
+ * issues per trigger (or its distance) to match; as a backstop for prefetchers that do not, the
+ * cache admits at most 'degree' prefetches per cycle from each. At the end of each epoch (a fixed number
+ * of evictions) the degree is raised or lowered based on smoothed measures of:
+ *  - accuracy:  prefetched lines used by a demand access / prefetches sent to memory
+ *  - lateness:  used prefetches whose demand access still missed (fill in progress) / used prefetches
+ *  - pollution: demand misses to lines evicted by a prefetch / demand misses
+ * Lines evicted by prefetch fills are recorded in a single-hash bloom filter; pollution is
+ * measured for the cache as a whole and applied to every prefetcher.
+ *
+ * The cache controller calls admit()/drop() for prefetch events and the coherence manager
+ * forwards its listener notifications. State is fixed-size apart from prefetches waiting to be
+ * handled by the cache, which are bounded by the prefetch buffer and MSHR.
+ */
+class PrefetchThrottle {
+public:
+    PrefetchThrottle() : enabled_(false) { }
+
+    /* Read the 'prefetch_throttle*' parameters. 'lines' is the number of lines in the cache */
+    void configure(Output* out, const std::string& owner, Params& params, uint64_t lines, uint64_t line_size);
+
+    /* Add a prefetcher. Prefetchers are numbered in the order they are added. Statistics may be null */
+    void addPrefetcher(CacheListener* prefetcher, Statistic<uint64_t>* degree, Statistic<uint64_t>* accuracy,
+            Statistic<uint64_t>* lateness, Statistic<uint64_t>* pollution);
+
+    bool enabled() const { return enabled_; }
+
+    /* Called when a prefetch arrives from a prefetcher.
+     * Returns false if the prefetcher has already used its degree this cycle */
+    bool admit(uint32_t prefetcher, MemEventBase* event, SimTime_t cycle);
+
+    /* A previously admitted prefetch was dropped by the cache */
+    void drop(SST::Event::id_type id) { pending_.erase(id); }
+
+    /* Listener notifications from the coherence manager */
+    void notifyAccess(MemEvent* event, NotifyAccessType access, NotifyResultType result);
+    void notifyEvict(Addr addr, bool by_prefetch);
+
+    void serialize_order(SST::Core::Serialization::serializer& ser);
+
+private:
+    static constexpr uint32_t NO_PREFETCHER = ~((uint32_t)0);
+
+    struct PrefetcherState {
+        CacheListener* listener;
+        uint32_t degree;
+        SimTime_t last_cycle;       // Cycle of the last admitted prefetch
+        uint32_t admitted;          // Prefetches admitted in last_cycle
+        /* Epoch counters */
+        uint64_t issued;
+        uint64_t useful;
+        uint64_t late;
+        /* Smoothed ratios */
+        double accuracy;
+        double lateness;
+        /* Per-epoch statistics */
+        Statistic<uint64_t>* stat_degree;
+        Statistic<uint64_t>* stat_accuracy;
+        Statistic<uint64_t>* stat_lateness;
+        Statistic<uint64_t>* stat_pollution;
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) {
+            SST_SER(listener);
+            SST_SER(degree);
+            SST_SER(last_cycle);
+            SST_SER(admitted);
+            SST_SER(issued);
+            SST_SER(useful);
+            SST_SER(late);
+            SST_SER(accuracy);
+            SST_SER(lateness);
+            SST_SER(stat_degree);
+            SST_SER(stat_accuracy);
+            SST_SER(stat_lateness);
+            SST_SER(stat_pollution);
+        }
+    };
+
+    void endEpoch();
+    size_t trackerSlot(Addr addr) { return (addr / line_size_) % tracker_addr_.size(); }
+    size_t filterSlot(Addr addr) {
+        Addr line = addr / line_size_;
+        return (line ^ (line >> 12)) % pollution_filter_.size();
+    }
+
+    bool enabled_;
+    uint64_t line_size_;
+    uint32_t max_degree_;
+    uint64_t epoch_length_;     // Evictions per epoch
+    double accuracy_high_;
+    double accuracy_low_;
+    double lateness_threshold_;
+    double pollution_threshold_;
+
+    std::vector<PrefetcherState> prefetchers_;
+    std::map<SST::Event::id_type, uint32_t> pending_;   // Admitted prefetch -> prefetcher index
+
+    /* Prefetched lines not yet used by a demand access, direct-mapped */
+    std::vector<Addr> tracker_addr_;
+    std::vector<uint32_t> tracker_owner_;
+
+    std::vector<bool> pollution_filter_;
+
+    /* Epoch counters */
+    uint64_t evictions_;
+    uint64_t demand_misses_;
+    uint64_t pollution_misses_;
+    double pollution_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_PREFETCHTHROTTLE_H */
@@ -17,6 +17,7 @@
 #define	MEMHIERARCHY_REPLACEMENT_POLICY_H
 
 #include "sst/core/subcomponent.h"
+#include "sst/core/output.h"
 #include "sst/core/rng/marsaglia.h"
 
 #include "memEvent.h"
@@ -104,6 +105,20 @@ class ReplacementPolicy : public SubComponent{
         virtual uint64_t getBestCandidate() = 0;
         virtual uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) = 0;
 
+        /* Find a candidate among 'setSize' contiguous entries of a set, as stored by the cache array.
+         * Policies in this file override this to avoid building a vector per miss; the default
+         * forwards to the vector interface so that other policies need not implement it */
+        virtual uint64_t findBestCandidate(ReplacementInfo** rInfo, unsigned int setSize) {
+            std::vector<ReplacementInfo*> setInfo(rInfo, rInfo + setSize);
+            return findBestCandidate(setInfo);
+        }
+
+        /* Policies that learn from the requesting instruction (e.g., SHiP) return true here. The owning
+         * coherence controller then calls setInstructionPointer() with each event's instruction
+         * pointer before handling it, so that subsequent update() calls can be attributed to it */
+        virtual bool usesInstructionPointer() { return false; }
+        virtual void setInstructionPointer(Addr ip) { }
+
         ReplacementPolicy() = default;
         void serialize_order(SST::Core::Serialization::serializer& ser) override {
             SST::SubComponent::serialize_order(ser);
@@ -142,13 +157,15 @@ public:
      * 3. If shared, try to keep
      * 4. If timestamp is the oldest (smallest), then evict
      */
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override {
+    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override { return findBestCandidate(rInfo.data(), rInfo.size()); }
+
+    uint64_t findBestCandidate(ReplacementInfo** rInfo, unsigned int setSize) override {
         bestCandidate = rInfo[0]->getIndex();
         uint64_t bestTS = array[rInfo[0]->getIndex()];
         if (rInfo[0]->getState() == I) {
             return bestCandidate;
         }
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (unsigned int i = 1; i < setSize; i++) {
             if (rInfo[i]->getState() == I) {
                 bestCandidate = rInfo[i]->getIndex();
                 return bestCandidate;
@@ -215,7 +232,9 @@ public:
      * 3. If shared, try to keep
      * 4. If timestamp is the oldest (smallest), then evict
      */
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override {
+    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override { return findBestCandidate(rInfo.data(), rInfo.size()); }
+
+    uint64_t findBestCandidate(ReplacementInfo** rInfo, unsigned int setSize) override {
         bestCandidate = rInfo[0]->getIndex();
         Rank bestRank = {array[rInfo[0]->getIndex()],
             static_cast<CoherenceReplacementInfo*>(rInfo[0])->getShared(),
@@ -224,7 +243,7 @@ public:
         if (rInfo[0]->getState() == I)
             return bestCandidate;
 
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (unsigned int i = 1; i < setSize; i++) {
             if (rInfo[i]->getState() == I) {
                 bestCandidate = rInfo[i]->getIndex();
                 return bestCandidate;
@@ -311,13 +330,15 @@ public:
         timestamp += 1000;
     }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) override {
+    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override { return findBestCandidate(rInfo.data(), rInfo.size()); }
+
+    uint64_t findBestCandidate(ReplacementInfo** rInfo, unsigned int setSize) override {
         bestCandidate = rInfo[0]->getIndex();
         LFUInfo bestLFU = array[rInfo[0]->getIndex()];
 
         if (rInfo[0]->getState() == I) { return bestCandidate; }
 
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (unsigned int i = 1; i < setSize; i++) {
             if (rInfo[i]->getState() == I)  {
                 bestCandidate = rInfo[i]->getIndex();
                 return bestCandidate;
@@ -403,7 +424,9 @@ public:
         timestamp += 1000;
     }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) override {
+    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override { return findBestCandidate(rInfo.data(), rInfo.size()); }
+
+    uint64_t findBestCandidate(ReplacementInfo** rInfo, unsigned int setSize) override {
         bestCandidate = rInfo[0]->getIndex();
         Rank bestRank = {array[rInfo[0]->getIndex()],
             static_cast<CoherenceReplacementInfo*>(rInfo[0])->getShared(),
@@ -412,7 +435,7 @@ public:
         if (rInfo[0]->getState() == I)
             return bestCandidate;
 
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (unsigned int i = 1; i < setSize; i++) {
             if (rInfo[i]->getState() == I) {
                 bestCandidate = rInfo[i]->getIndex();
                 return bestCandidate;
@@ -549,13 +572,15 @@ public:
 
     void replaced(uint64_t id) override { array[id] = 0; }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) override {
+    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override { return findBestCandidate(rInfo.data(), rInfo.size()); }
+
+    uint64_t findBestCandidate(ReplacementInfo** rInfo, unsigned int setSize) override {
         bestCandidate = rInfo[0]->getIndex();
         Rank bestRank = {array[rInfo[0]->getIndex()], rInfo[0]->getState() };
         if (rInfo[0]->getState() == I)
             return bestCandidate;
 
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (unsigned int i = 1; i < setSize; i++) {
             if (rInfo[i]->getState() == I) {
                 bestCandidate = rInfo[i]->getIndex();
                 return bestCandidate;
@@ -640,7 +665,9 @@ public:
 
     void replaced(uint64_t id) override { array[id] = 0; }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) override {
+    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override { return findBestCandidate(rInfo.data(), rInfo.size()); }
+
+    uint64_t findBestCandidate(ReplacementInfo** rInfo, unsigned int setSize) override {
         bestCandidate = rInfo[0]->getIndex();
         Rank bestRank = {array[rInfo[0]->getIndex()],
             static_cast<CoherenceReplacementInfo*>(rInfo[0])->getShared(),
@@ -649,7 +676,7 @@ public:
         if (rInfo[0]->getState() == I)
             return bestCandidate;
 
-        for (int i = 1; i < rInfo.size(); i++) {
+        for (unsigned int i = 1; i < setSize; i++) {
             if (rInfo[i]->getState() == I) {
                 bestCandidate = rInfo[i]->getIndex();
                 return bestCandidate;
@@ -715,15 +742,17 @@ public:
     void replaced(uint64_t id) override {}
 
     // Return an empty slot if one exists, otherwise return a random candidate
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override {
+    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override { return findBestCandidate(rInfo.data(), rInfo.size()); }
+
+    uint64_t findBestCandidate(ReplacementInfo** rInfo, unsigned int setSize) override {
         // Check for empty line
-        for (uint64_t i = 0; i < rInfo.size(); i++) {
+        for (uint64_t i = 0; i < setSize; i++) {
             if (rInfo[i]->getState() == I) {
                 bestCandidate = rInfo[i]->getIndex();
                 return bestCandidate;
             }
         }
-        bestCandidate = rInfo[(gen->generateNextUInt64() % ways)]->getIndex();
+        bestCandidate = rInfo[(gen->generateNextUInt64() % setSize)]->getIndex();
         return bestCandidate;
     }
 
@@ -788,19 +817,35 @@ public:
     void replaced(uint64_t id) override { }
 
     // Return an empty slot if one exists, otherwise return any slot that is not the most-recently used in the set
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override {
-        for (uint64_t i = 0; i < ways; i++) {
+    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override { return findBestCandidate(rInfo.data(), rInfo.size()); }
+
+    uint64_t findBestCandidate(ReplacementInfo** rInfo, unsigned int setSize) override {
+        for (uint64_t i = 0; i < setSize; i++) {
             if (rInfo[i]->getState() == I) {
                 bestCandidate = rInfo[i]->getIndex();
                 return bestCandidate;
             }
         }
-        uint64_t setBegin = rInfo[0]->getIndex();
-        uint64_t index = gen->generateNextUInt64() % (ways-1);
-        if (index < array[setBegin/ways])
-            bestCandidate = setBegin + index;
-        else
-            bestCandidate = setBegin + index + 1;
+        // The candidates may be a subset of the set (e.g., the valid lines of a compressed set),
+        // so locate the MRU line among them rather than assuming contiguous indices
+        uint64_t set = rInfo[0]->getIndex() / ways;
+        uint64_t mru = set * ways + array[set];
+        unsigned int mruPos = setSize;
+        for (unsigned int i = 0; i < setSize; i++) {
+            if (rInfo[i]->getIndex() == mru) {
+                mruPos = i;
+                break;
+            }
+        }
+        unsigned int choices = (mruPos < setSize) ? setSize - 1 : setSize;
+        if (choices == 0) {
+            bestCandidate = rInfo[0]->getIndex();
+            return bestCandidate;
+        }
+        unsigned int pick = gen->generateNextUInt64() % choices;
+        if (pick >= mruPos)
+            pick++;
+        bestCandidate = rInfo[pick]->getIndex();
 
         return bestCandidate;
     }
@@ -819,9 +864,336 @@ public:
 };
 
 
+/* ------------------------------------------------------------------------------------------
+ *  Re-reference interval prediction (RRIP) family
+ *  - Each line holds an M-bit re-reference prediction value (RRPV) in a byte array
+ *  - Lines are inserted with a long or distant RRPV and promoted to 0 on a hit
+ *  - The victim is the first line with a distant (maximum) RRPV; if none exists the set is aged
+ *  - Replacement algorithm assumes indices are contiguous for the set
+ *  Jaleel et al., "High Performance Cache Replacement Using Re-Reference Interval Prediction", ISCA 2010
+ *  Wu et al., "SHiP: Signature-based Hit Predictor for High Performance Caching", MICRO 2011
+ * ------------------------------------------------------------------------------------------*/
+class RRIPBase : public ReplacementPolicy {
+public:
+    RRIPBase(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), bestCandidate(0) {
+        ways = associativity;
+        uint32_t bits = params.find<uint32_t>("rrpv_bits", 2);
+        if (bits == 0 || bits > 6) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "%s, Invalid param: rrpv_bits - must be between 1 and 6. You specified '%" PRIu32 "'.\n", getName().c_str(), bits);
+        }
+        maxRRPV = (1 << bits) - 1;
+        rrpv.resize(lines, FILL | maxRRPV);
+    }
+
+    virtual ~RRIPBase() = default;
+
+    /* Too expensive to constantly dynamic_cast. Check once during construction instead. */
+    bool checkCompatibility(ReplacementInfo * rInfo) override { return true; } // No cast
+
+    /* A line that has been replaced since it was last touched is being filled, otherwise this is a hit */
+    void update(uint64_t id, ReplacementInfo * rInfo) override {
+        if (rrpv[id] & FILL)
+            rrpv[id] = insert(id);
+        else
+            rrpv[id] = hit(id);
+    }
+
+    void replaced(uint64_t id) override {
+        if (!(rrpv[id] & FILL))
+            evicted(id);
+        rrpv[id] = FILL | maxRRPV;
+    }
+
+    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override { return findBestCandidate(rInfo.data(), rInfo.size()); }
+
+    /* Return an empty slot if one exists, otherwise the first line with a distant RRPV after aging the set */
+    uint64_t findBestCandidate(ReplacementInfo** rInfo, unsigned int setSize) override {
+        uint8_t oldest = 0;
+        unsigned int oldestWay = 0;
+        for (unsigned int i = 0; i < setSize; i++) {
+            if (rInfo[i]->getState() == I) {
+                bestCandidate = rInfo[i]->getIndex();
+                return bestCandidate;
+            }
+            uint8_t value = rrpv[rInfo[i]->getIndex()] & VALUE;
+            if (value > oldest) {
+                oldest = value;
+                oldestWay = i;
+            }
+        }
+        bestCandidate = rInfo[oldestWay]->getIndex();
+
+        /* Age the set by enough that the oldest line reaches the distant RRPV */
+        if (oldest < maxRRPV) {
+            uint8_t age = maxRRPV - oldest;
+            for (unsigned int i = 0; i < setSize; i++)
+                rrpv[rInfo[i]->getIndex()] += age;
+        }
+        return bestCandidate;
+    }
+
+    uint64_t getBestCandidate() override { return bestCandidate; }
+
+    RRIPBase() = default;
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        ReplacementPolicy::serialize_order(ser);
+        SST_SER(bestCandidate);
+        SST_SER(ways);
+        SST_SER(maxRRPV);
+        SST_SER(rrpv);
+    }
+    ImplementVirtualSerializable(SST::MemHierarchy::RRIPBase);
+
+protected:
+    /* RRPV byte layout: low bits hold the RRPV, FILL marks a line that has been replaced but not yet re-inserted,
+     * REUSED is available to policies that track whether a line was hit since insertion */
+    static const uint8_t FILL = 0x80;
+    static const uint8_t REUSED = 0x40;
+    static const uint8_t VALUE = 0x3F;
+
+    /* Return the RRPV byte for a line being inserted or hit */
+    virtual uint8_t insert(uint64_t id) = 0;
+    virtual uint8_t hit(uint64_t id) { return 0; }
+
+    /* Called when a valid line is replaced */
+    virtual void evicted(uint64_t id) { }
+
+    uint64_t bestCandidate;
+    uint64_t ways;
+    uint8_t maxRRPV;
+    std::vector<uint8_t> rrpv;
+};
+
+
+/* ------------------------------------------------------------------------------------------
+ *  Static RRIP (srrip) - insert with a long re-reference interval (maximum RRPV - 1)
+ * ------------------------------------------------------------------------------------------*/
+class SRRIP : public RRIPBase {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(SRRIP, "memHierarchy", "replacement.srrip", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "static re-reference interval prediction, a scan-resistant replacement policy", SST::MemHierarchy::ReplacementPolicy);
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"rrpv_bits", "Number of bits in each line's re-reference prediction value (1-6)", "2"} )
+
+    SRRIP(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : RRIPBase(id, params, lines, associativity) { }
+
+    virtual ~SRRIP() = default;
+
+    SRRIP() = default;
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        RRIPBase::serialize_order(ser);
+    }
+    ImplementSerializable(SST::MemHierarchy::SRRIP)
+
+protected:
+    uint8_t insert(uint64_t id) override { return maxRRPV - 1; }
+};
+
+
+/* ------------------------------------------------------------------------------------------
+ *  Bimodal RRIP (brrip) - insert with a distant re-reference interval except for an
+ *  infrequent long insertion, which protects thrashing working sets
+ * ------------------------------------------------------------------------------------------*/
+class BRRIP : public RRIPBase {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(BRRIP, "memHierarchy", "replacement.brrip", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "bimodal re-reference interval prediction, a thrash-resistant replacement policy", SST::MemHierarchy::ReplacementPolicy);
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"rrpv_bits",       "Number of bits in each line's re-reference prediction value (1-6)", "2"},
+            {"brrip_epsilon",   "One in 'brrip_epsilon' insertions uses a long rather than distant re-reference interval", "32"},
+            {"seed_a",          "Seed for random number generator", "1"},
+            {"seed_b",          "Seed for random number generator", "1"} )
+
+    BRRIP(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : RRIPBase(id, params, lines, associativity) {
+        epsilon = params.find<uint64_t>("brrip_epsilon", 32);
+        if (epsilon == 0) epsilon = 1;
+        uint64_t seeda = params.find<uint64_t>("seed_a", 1);
+        uint64_t seedb = params.find<uint64_t>("seed_b", 1);
+        gen = new SST::RNG::MarsagliaRNG(seeda, seedb);
+    }
+
+    virtual ~BRRIP() {
+        delete gen;
+    }
+
+    BRRIP() = default;
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        RRIPBase::serialize_order(ser);
+        SST_SER(epsilon);
+        SST_SER(gen);
+    }
+    ImplementSerializable(SST::MemHierarchy::BRRIP)
+
+protected:
+    uint8_t insert(uint64_t id) override {
+        return (gen->generateNextUInt64() % epsilon == 0) ? maxRRPV - 1 : maxRRPV;
+    }
+
+    uint64_t epsilon;
+    SST::RNG::MarsagliaRNG* gen;
+};
+
+
+/* ------------------------------------------------------------------------------------------
+ *  Dynamic RRIP (drrip) - set dueling between SRRIP and BRRIP
+ *  - A few leader sets always use SRRIP or BRRIP and a saturating counter (PSEL) records
+ *    which leader group misses less. The remaining (follower) sets use the winner.
+ * ------------------------------------------------------------------------------------------*/
+class DRRIP : public BRRIP {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(DRRIP, "memHierarchy", "replacement.drrip", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "dynamic re-reference interval prediction, set dueling between SRRIP and BRRIP", SST::MemHierarchy::ReplacementPolicy);
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"rrpv_bits",       "Number of bits in each line's re-reference prediction value (1-6)", "2"},
+            {"brrip_epsilon",   "One in 'brrip_epsilon' BRRIP insertions uses a long rather than distant re-reference interval", "32"},
+            {"psel_bits",       "Width of the policy selection counter", "10"},
+            {"leader_sets",     "Number of leader sets dedicated to each of SRRIP and BRRIP. Reduced if the cache has too few sets.", "32"},
+            {"seed_a",          "Seed for random number generator", "1"},
+            {"seed_b",          "Seed for random number generator", "1"} )
+
+    DRRIP(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : BRRIP(id, params, lines, associativity) {
+        uint32_t bits = params.find<uint32_t>("psel_bits", 10);
+        if (bits == 0 || bits > 31) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "%s, Invalid param: psel_bits - must be between 1 and 31. You specified '%" PRIu32 "'.\n", getName().c_str(), bits);
+        }
+        pselMax = (1u << bits) - 1;
+        psel = (pselMax + 1) / 2;
+
+        /* Spread leaders evenly: the first set of each constituency leads for SRRIP, the middle set for BRRIP */
+        uint64_t sets = lines / associativity;
+        uint64_t leaders = params.find<uint64_t>("leader_sets", 32);
+        if (leaders > sets / 2) leaders = sets / 2;
+        constituency = leaders ? sets / leaders : 0;
+    }
+
+    virtual ~DRRIP() = default;
+
+    DRRIP() = default;
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        BRRIP::serialize_order(ser);
+        SST_SER(psel);
+        SST_SER(pselMax);
+        SST_SER(constituency);
+    }
+    ImplementSerializable(SST::MemHierarchy::DRRIP)
+
+protected:
+    /* Insertions are misses; a miss in a leader set counts against that leader's policy */
+    uint8_t insert(uint64_t id) override {
+        if (constituency == 0)
+            return (psel > pselMax / 2) ? BRRIP::insert(id) : maxRRPV - 1;
+
+        uint64_t offset = (id / ways) % constituency;
+        if (offset == 0) {
+            if (psel < pselMax) psel++;
+            return maxRRPV - 1;
+        }
+        if (offset == constituency / 2) {
+            if (psel > 0) psel--;
+            return BRRIP::insert(id);
+        }
+        return (psel > pselMax / 2) ? BRRIP::insert(id) : maxRRPV - 1;
+    }
+
+    uint32_t psel;
+    uint32_t pselMax;
+    uint64_t constituency;
+};
+
+
+/* ------------------------------------------------------------------------------------------
+ *  Signature-based hit predictor (ship) - SRRIP with insertion guided by the requesting instruction
+ *  - A table of saturating counters (SHCT) indexed by a hash of the instruction pointer learns
+ *    whether lines inserted by an instruction are re-referenced before eviction
+ *  - Lines from instructions with no observed reuse are inserted with a distant RRPV
+ *  - Instruction pointers are supplied by the cache via setInstructionPointer(); events without one share signature 0
+ * ------------------------------------------------------------------------------------------*/
+class SHiP : public RRIPBase {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(SHiP, "memHierarchy", "replacement.ship", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "signature-based hit predictor, RRIP with insertion predicted from the requesting instruction pointer", SST::MemHierarchy::ReplacementPolicy);
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"rrpv_bits",       "Number of bits in each line's re-reference prediction value (1-6)", "2"},
+            {"shct_size",       "Number of entries in the signature history counter table. Must be a power of two no larger than 65536.", "16384"},
+            {"shct_bits",       "Width of each signature history counter (1-8)", "3"} )
+
+    SHiP(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : RRIPBase(id, params, lines, associativity), signature(0) {
+        uint64_t size = params.find<uint64_t>("shct_size", 16384);
+        if (size == 0 || size > 65536 || (size & (size - 1)) != 0) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "%s, Invalid param: shct_size - must be a power of two no larger than 65536. You specified '%" PRIu64 "'.\n", getName().c_str(), size);
+        }
+        uint32_t bits = params.find<uint32_t>("shct_bits", 3);
+        if (bits == 0 || bits > 8) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "%s, Invalid param: shct_bits - must be between 1 and 8. You specified '%" PRIu32 "'.\n", getName().c_str(), bits);
+        }
+        shctMask = size - 1;
+        shctMax = (1u << bits) - 1;
+        shct.resize(size, 1); // Weakly predict reuse until trained
+        lineSignature.resize(lines, 0);
+    }
+
+    virtual ~SHiP() = default;
+
+    bool usesInstructionPointer() override { return true; }
+
+    void setInstructionPointer(Addr ip) override {
+        uint64_t h = ip >> 2;
+        h ^= h >> 17;
+        h ^= h >> 31;
+        signature = h & shctMask;
+    }
+
+    SHiP() = default;
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        RRIPBase::serialize_order(ser);
+        SST_SER(signature);
+        SST_SER(shctMask);
+        SST_SER(shctMax);
+        SST_SER(shct);
+        SST_SER(lineSignature);
+    }
+    ImplementSerializable(SST::MemHierarchy::SHiP)
+
+protected:
+    uint8_t insert(uint64_t id) override {
+        lineSignature[id] = signature;
+        return shct[signature] == 0 ? maxRRPV : maxRRPV - 1;
+    }
+
+    /* Train on the first hit since insertion */
+    uint8_t hit(uint64_t id) override {
+        if (!(rrpv[id] & REUSED)) {
+            uint8_t& counter = shct[lineSignature[id]];
+            if (counter < shctMax) counter++;
+        }
+        return REUSED;
+    }
+
+    /* Lines evicted without reuse train their signature towards 'no reuse' */
+    void evicted(uint64_t id) override {
+        if (!(rrpv[id] & REUSED)) {
+            uint8_t& counter = shct[lineSignature[id]];
+            if (counter > 0) counter--;
+        }
+    }
+
+    uint16_t signature;
+    uint64_t shctMask;
+    uint8_t shctMax;
+    std::vector<uint8_t> shct;
+    std::vector<uint16_t> lineSignature;
+};
+
 }}
 
 
 
 #endif	/* REPLACEMENT_PROTOCOL_H */
-
@@ -20,6 +20,7 @@
 
 #include <sst/core/component.h>
 #include <sst/core/link.h>
+#include <sst/core/unitAlgebra.h>
 
 #include "sst/elements/memHierarchy/memEventBase.h"
 #include "sst/elements/memHierarchy/memEvent.h"
@@ -103,6 +104,21 @@ StandardInterface::StandardInterface(SST::ComponentId_t id, Params &params, Time
         reg.end = noncache[i+1];
         noncacheable_regions_.insert(std::make_pair(reg.start, reg));
     }
+
+    std::string traceFile = params.find<std::string>("trace_file", "");
+    if (!traceFile.empty()) {
+        bool compress = params.find<bool>("trace_compress", true);
+#ifndef HAVE_LIBZ
+        if (compress) {
+            output_.verbose(CALL_INFO, 1, 0, "%s, Warning: trace_compress requires libz which SST Elements was not configured with. Writing an uncompressed trace.\n", getName().c_str());
+            compress = false;
+        }
+#endif
+        uint64_t tickFs = (getCoreTimeBase() / UnitAlgebra("1fs")).getRoundedValue();
+        tracer_ = new MemTraceWriter();
+        if (!tracer_->open(traceFile, compress, params.find<size_t>("trace_buffer_records", 65536), tickFs))
+            output_.fatal(CALL_INFO, -1, "%s, Error: unable to open trace_file '%s'\n", getName().c_str(), traceFile.c_str());
+    }
 }
 
 void StandardInterface::setMemoryMappedAddressRegion(Addr start, Addr size) {
@@ -231,7 +247,14 @@ void StandardInterface::complete(unsigned int phase) {
     link_->complete(phase);
 }
 
-void StandardInterface::finish() { }
+void StandardInterface::finish() {
+    if (tracer_) {
+        traceDrain(true);
+        tracer_->close();
+        delete tracer_;
+        tracer_ = nullptr;
+    }
+}
 
 /* Writes are allowed during init() but nothing else */
 void StandardInterface::sendUntimedData(StandardMem::Request *req) {
@@ -275,6 +298,9 @@ void StandardInterface::send(StandardMem::Request* req) {
     fflush(stdout);
 #endif
 
+    if (tracer_)
+        traceRequest(me, req->needsResponse());
+
     if (req->needsResponse())
         requests_[me->getID()] = std::make_pair(req,me->getCmd());   /* Save this request so we can use it when a response is returned */
     else
@@ -312,6 +338,8 @@ void StandardInterface::receive(SST::Event* ev) {
         if (origCmd == Command::GetS || origCmd == Command::GetSX)
             cmd = Command::GetSResp;
         requests_.erase(reqit);
+        if (tracer_ && cmd != Command::NACK)
+            traceResponse(me);
         switch (cmd) {
             case Command::GetSResp:
                 deliverReq = convertResponseGetSResp(origReq, me);
@@ -913,6 +941,84 @@ void StandardInterface::handleNACK(MemEventBase* ev) {
     link_->send(nackedEvent);
 }
 
+/********************************************************************************************
+ * Tracing
+ ********************************************************************************************/
+void StandardInterface::traceRequest(MemEventBase* me, bool needsResponse) {
+    MemTraceRecord rec;
+    rec.time = getCurrentSimCycle();
+    rec.addr = me->getRoutingAddress();
+    rec.latency = 0;
+    rec.size = 0;
+    rec.flags = me->queryFlag(MemEventBase::F_NONCACHEABLE) ? MEMTRACE_F_NONCACHEABLE : 0;
+    rec.reserved = 0;
+
+    MemTraceOp op = MemTraceOp::Other;
+    switch (me->getCmd()) {
+        case Command::GetS:
+            op = MemTraceOp::Read;
+            break;
+        case Command::GetSX:
+            op = me->queryFlag(MemEventBase::F_LLSC) ? MemTraceOp::LoadLink : MemTraceOp::ReadLock;
+            break;
+        case Command::Write:
+            if (me->queryFlag(MemEventBase::F_LLSC)) op = MemTraceOp::StoreConditional;
+            else if (me->queryFlag(MemEventBase::F_LOCKED)) op = MemTraceOp::WriteUnlock;
+            else op = MemTraceOp::Write;
+            break;
+        case Command::FlushLine:
+            op = MemTraceOp::FlushLine;
+            break;
+        case Command::FlushLineInv:
+            op = MemTraceOp::FlushLineInv;
+            break;
+        case Command::FlushAll:
+            op = MemTraceOp::FlushAll;
+            break;
+        case Command::CustomReq:
+            op = MemTraceOp::Custom;
+            break;
+        default:
+            break;
+    }
+    rec.op = (uint8_t)op;
+    if (op != MemTraceOp::FlushAll && op != MemTraceOp::Custom && op != MemTraceOp::Other) {
+        MemEvent* mev = static_cast<MemEvent*>(me);
+        rec.addr = mev->getAddr();
+        rec.size = mev->getSize();
+    }
+
+    if (needsResponse)
+        trace_pending_[me->getID()] = trace_front_ + trace_order_.size();
+    else
+        rec.flags |= MEMTRACE_F_NORESPONSE;
+    trace_order_.push_back({rec, !needsResponse});
+    traceDrain(false);
+}
+
+void StandardInterface::traceResponse(MemEventBase* me) {
+    std::map<MemEventBase::id_type, uint64_t>::iterator it = trace_pending_.find(me->getResponseToID());
+    if (it == trace_pending_.end())
+        return; // Sent before tracing started
+    TraceEntry& entry = trace_order_[it->second - trace_front_];
+    entry.rec.latency = getCurrentSimCycle() - entry.rec.time;
+    if (me->queryFlag(MemEventBase::F_FAIL))
+        entry.rec.flags |= MEMTRACE_F_FAIL;
+    entry.done = true;
+    trace_pending_.erase(it);
+    traceDrain(false);
+}
+
+/* Write records from the front of trace_order_ until one is still waiting for its response,
+ * or all of them if 'all' (end of simulation; unanswered requests have latency 0) */
+void StandardInterface::traceDrain(bool all) {
+    while (!trace_order_.empty() && (all || trace_order_.front().done)) {
+        tracer_->record(trace_order_.front().rec);
+        trace_order_.pop_front();
+        trace_front_++;
+    }
+}
+
 /********************************************************************************************
  * Debug functions
  ********************************************************************************************/
@@ -22,6 +22,7 @@
 #include <utility>
 #include <map>
 #include <queue>
+#include <deque>
 
 #include <sst/core/sst_types.h>
 #include <sst/core/link.h>
@@ -29,6 +30,7 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/memTrace.h"
 
 namespace SST {
 
@@ -80,7 +82,10 @@ public:
         {"debug",       "(uint) Where to send debug output. Options: 0[none], 1[stdout], 2[stderr], 3[file]", "0"},
         {"debug_level", "(uint) Debugging level: 0 to 10. Must configure sst-core with '--enable-debug'. 1=info, 2-10=debug output", "0"},
         {"port",        "(string) port name to use for interfacing to the memory system. This must be provided if this subcomponent is being loaded anonymously. Otherwise this should not be specified and either the 'lowlink' port should be connected or the 'lowlink' subcomponent slot should be filled"},
-        {"noncacheable_regions", "(string) vector of (start, end) address pairs for noncacheable address ranges. Vector format should be [start0, end0, start1, end1, ...].", "[]"}
+        {"noncacheable_regions", "(string) vector of (start, end) address pairs for noncacheable address ranges. Vector format should be [start0, end0, start1, end1, ...].", "[]"},
+        {"trace_file",  "(string) If set, write a binary trace of the requests sent through this interface (issue time, address, size, command, latency) to this file. See memTrace.h for the format and miranda.TraceReplayGenerator to replay it.", ""},
+        {"trace_compress", "(bool) Compress the trace with gzip. Requires SST Elements to be configured with libz; otherwise the trace is written uncompressed.", "true"},
+        {"trace_buffer_records", "(uint) Records per trace buffer. Two buffers are used; a full buffer is written by a background thread while the other fills.", "65536"}
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -142,6 +147,20 @@ protected:
     MemRegion region_;   // For MMIO
     Endpoint endpoint_type_;    // Endpoint type -> CPU or MMIO
 
+    /* Request tracing, not checkpointed. Records are written in issue order: a completed request's
+     * record waits in trace_order_ until every request issued before it has completed */
+    struct TraceEntry {
+        MemTraceRecord rec;
+        bool done;
+    };
+    void traceRequest(MemEventBase* me, bool needsResponse);
+    void traceResponse(MemEventBase* me);
+    void traceDrain(bool all);
+    MemTraceWriter* tracer_ = nullptr;
+    std::deque<TraceEntry> trace_order_;    /* Traced requests in issue order, not yet written */
+    uint64_t trace_front_ = 0;              /* Issue number of trace_order_.front() */
+    std::map<MemEventBase::id_type, uint64_t> trace_pending_;   /* Issue number of traced requests waiting for a response */
+
     class MemEventConverter : public Interfaces::StandardMem::RequestConverter {
     public:
         MemEventConverter(StandardInterface* iface) : iface(iface) {}
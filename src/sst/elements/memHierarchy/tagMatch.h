@@ -0,0 +1,105 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_TAGMATCH_H
+#define MEMHIERARCHY_TAGMATCH_H
+
+#include <stdint.h>
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Set-associative tag match over a packed per-set tag vector (see CacheArray)
+ * Returns the way holding 'tag' or -1 if it is not present.
+ *
+ * The vector path is selected at build time from the compiler's target flags:
+ * AVX2 compares 4 tags per instruction, SSE4.1 compares 2, otherwise scalar.
+ * Tags do not need to be aligned.
+ */
+namespace TagMatch {
+
+typedef int (*MatchFunction)(const uint64_t* tags, unsigned int ways, uint64_t tag);
+
+#if defined(__AVX2__)
+inline const char* isa() { return "avx2"; }
+#elif defined(__SSE4_1__)
+inline const char* isa() { return "sse4.1"; }
+#else
+inline const char* isa() { return "scalar"; }
+#endif
+
+inline int matchScalar(const uint64_t* tags, unsigned int ways, uint64_t tag) {
+    for (unsigned int i = 0; i < ways; i++) {
+        if (tags[i] == tag)
+            return i;
+    }
+    return -1;
+}
+
+/* Vector compare of the first (ways rounded down to the vector width) tags, scalar for the remainder */
+inline int matchVector(const uint64_t* tags, unsigned int ways, uint64_t tag) {
+    unsigned int i = 0;
+#if defined(__AVX2__)
+    const __m256i key = _mm256_set1_epi64x((long long)tag);
+    for (; i + 4 <= ways; i += 4) {
+        __m256i cmp = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(tags + i)), key);
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(cmp));
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+#elif defined(__SSE4_1__)
+    const __m128i key = _mm_set1_epi64x((long long)tag);
+    for (; i + 2 <= ways; i += 2) {
+        __m128i cmp = _mm_cmpeq_epi64(_mm_loadu_si128((const __m128i*)(tags + i)), key);
+        int mask = _mm_movemask_pd(_mm_castsi128_pd(cmp));
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+#endif
+    for (; i < ways; i++) {
+        if (tags[i] == tag)
+            return i;
+    }
+    return -1;
+}
+
+/* Fixed associativity so the compiler can fully unroll the compare */
+template <unsigned int Ways>
+inline int matchFixed(const uint64_t* tags, unsigned int ways, uint64_t tag) {
+    return matchVector(tags, Ways, tag);
+}
+
+/* Pick a match function for an associativity; power-of-two associativities up to 64 get a specialized version */
+inline MatchFunction select(unsigned int ways) {
+    switch (ways) {
+        case 1:  return &matchScalar;
+        case 2:  return &matchFixed<2>;
+        case 4:  return &matchFixed<4>;
+        case 8:  return &matchFixed<8>;
+        case 16: return &matchFixed<16>;
+        case 32: return &matchFixed<32>;
+        case 64: return &matchFixed<64>;
+        default: return &matchVector;
+    }
+}
+
+} /* namespace TagMatch */
+}}
+
+#endif /* MEMHIERARCHY_TAGMATCH_H */
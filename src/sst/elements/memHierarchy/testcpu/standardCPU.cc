@@ -138,7 +138,8 @@ standardCPU::standardCPU(ComponentId_t id, Params& params) :
     if (flushinvf != 0) {
         stat_num_flushinvs_issued_ = registerStatistic<uint64_t>("flushinvs");
     }
-    if (flushcachef != 0) {
+    flush_at_end_ = params.find<bool>("flushcache_at_end", false);
+    if (flushcachef != 0 || flush_at_end_) {
         stat_num_flushcache_issued_ = registerStatistic<uint64_t>("flushcaches");
     }
     if (customf != 0) {
@@ -287,6 +288,13 @@ bool standardCPU::clockTic( Cycle_t )
 
     // Check whether to end the simulation
     if ( 0 == op_count_ && requests_.empty() ) {
+        if (flush_at_end_) {
+            flush_at_end_ = false;
+            StandardMem::Request* req = createFlushCache();
+            requests_[req->getID()] = std::make_pair(getCurrentSimTime(), "FlushCache");
+            memory_->send(req);
+            return false;
+        }
         out_.verbose(CALL_INFO, 1, 0, "StandardCPU: Test Completed Successfuly\n");
         primaryComponentOKToEndSim();
         return true;    // Turn our clock off while we wait for any other CPUs to end
@@ -309,6 +317,7 @@ void standardCPU::serialize_order(SST::Core::Serialization::serializer& ser) {
 
     SST_SER(out_);
     SST_SER(op_count_);
+    SST_SER(flush_at_end_);
     SST_SER(mem_freq_);
     SST_SER(max_addr_);
     SST_SER(mmio_addr_);
@@ -64,7 +64,8 @@ public:
         {"noncacheableRangeStart",  "(uint) Beginning of range of addresses that are noncacheable.", "0x0"},
         {"noncacheableRangeEnd",    "(uint) End of range of addresses that are noncacheable.", "0x0"},
         {"addressoffset",           "(uint) Apply an offset to a calculated address to check for non-alignment issues", "0"},
-        {"test_init",               "(uint) Number of write messages to initialize memory with", "0"} )
+        {"test_init",               "(uint) Number of write messages to initialize memory with", "0"},
+        {"flushcache_at_end",       "(bool) Issue a FlushCache after the last operation completes so that memory holds all written data at the end of simulation", "false"} )
 
     SST_ELI_DOCUMENT_STATISTICS(
         {"pendCycle", "Number of pending requests per cycle", "count", 1},
@@ -132,6 +133,7 @@ private:
     Statistic<uint64_t>* stat_noncacheable_writes_ = nullptr;
 
     bool ll_issued_;
+    bool flush_at_end_;
     Interfaces::StandardMem::Addr ll_addr_;
 
     std::map<Interfaces::StandardMem::Request::id_t, std::pair<SimTime_t, std::string>> requests_;
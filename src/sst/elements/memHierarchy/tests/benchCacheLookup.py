@@ -0,0 +1,100 @@
+import argparse
+import re
+import subprocess
+import sys
+import time
+
+# Lookup microbenchmark for the cache array
+#  A tiny L1 filters almost nothing so nearly every access is a tag lookup in a highly
+#  associative L2 whose capacity covers the CPU's footprint (hits, few evictions).
+#  Run it with python to time an sst run and print the L2's lookup throughput, e.g.
+#  'python3 benchCacheLookup.py --assoc 32', and compare across builds or associativities;
+#  the simulated results do not change. Each event the L2 receives is one tag lookup.
+#  'sst benchCacheLookup.py --model-options="..."' runs the model alone.
+#  --fast-path does change timing: uncontended hits skip the event buffer and return a cycle sooner.
+
+parser = argparse.ArgumentParser()
+parser.add_argument("-a", "--assoc", help="L2 associativity", type=int, default=16)
+parser.add_argument("-s", "--size", help="L2 size", default="4MiB")
+parser.add_argument("-n", "--ops", help="number of CPU operations", type=int, default=2000000)
+parser.add_argument("-r", "--replacement", help="L2 replacement policy", default="lru")
+parser.add_argument("-f", "--fast-path", help="enable the cache fast path for uncontended requests", action="store_true")
+args = parser.parse_args()
+
+try:
+    import sst
+except ImportError:
+    # Not under sst: run the model in sst and report lookups per second of wall-clock
+    start = time.time()
+    run = subprocess.run(["sst", __file__, "--model-options=" + " ".join(sys.argv[1:])], stdout=subprocess.PIPE, universal_newlines=True)
+    elapsed = time.time() - start
+    if run.returncode != 0:
+        sys.exit("sst exited with %d" % run.returncode)
+    match = re.search(r"l2cache\.TotalEventsReceived.*?Sum\.u64 = (\d+)", run.stdout)
+    if not match:
+        sys.exit("TotalEventsReceived not found for l2cache in sst output")
+    lookups = int(match.group(1))
+    print("assoc %d, %s: %d L2 lookups in %.2f s, %.0f lookups/s" % (args.assoc, args.replacement, lookups, elapsed, lookups / elapsed))
+    sys.exit(0)
+
+cpu = sst.Component("core", "memHierarchy.standardCPU")
+cpu.addParams({
+    "memFreq" : 1,
+    "memSize" : args.size,   # Footprint equals L2 capacity
+    "clock" : "2GHz",
+    "maxOutstanding" : 16,
+    "opCount" : args.ops,
+    "reqsPerIssue" : 4,
+    "write_freq" : 25,
+    "read_freq" : 75,
+    "rngseed" : 15,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "1",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "2",
+    "cache_line_size" : "64",
+    "L1" : "1",
+    "cache_size" : "1KiB",
+    "fast_path" : args.fast_path,
+})
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "4",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : args.replacement,
+    "coherence_protocol" : "MESI",
+    "associativity" : args.assoc,
+    "cache_line_size" : "64",
+    "cache_size" : args.size,
+    "mshr_num_entries" : 64,
+    "fast_path" : args.fast_path,
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "addr_range_end" : 1024*1024*1024-1,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "1GiB",
+})
+
+sst.setStatisticLoadLevel(1)
+sst.setStatisticOutput("sst.statOutputConsole")
+sst.enableAllStatisticsForComponentType("memHierarchy.Cache")
+
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "lowlink", "500ps"), (l1cache, "highlink", "500ps") )
+link_l1_l2 = sst.Link("link_l1_l2")
+link_l1_l2.connect( (l1cache, "lowlink", "500ps"), (l2cache, "highlink", "500ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2cache, "lowlink", "500ps"), (memctrl, "highlink", "500ps") )
@@ -0,0 +1,101 @@
+import sst
+import argparse
+
+# Directory throughput microbenchmark
+#  Several cores with private L1s share a small footprint through a directory, so most
+#  accesses are coherence misses and nearly every simulated cycle the directory queues
+#  invalidations, fetches and responses on its outgoing event queues.
+#  Run with e.g. 'time sst benchDirectoryQueue.py --model-options="--cores 16"' and compare
+#  wall-clock across builds; the simulated results do not change.
+#  --coherent-mem puts a CoherentMemController behind the directory instead of a MemController.
+
+parser = argparse.ArgumentParser()
+parser.add_argument("-c", "--cores", help="number of cores", type=int, default=8)
+parser.add_argument("-n", "--ops", help="number of operations per core", type=int, default=200000)
+parser.add_argument("-s", "--footprint", help="shared footprint", default="16KiB")
+parser.add_argument("-m", "--coherent-mem", help="use memHierarchy.CoherentMemController", action="store_true")
+args = parser.parse_args()
+
+network = sst.Component("network", "merlin.hr_router")
+network.addParams({
+    "xbar_bw" : "50GB/s",
+    "link_bw" : "50GB/s",
+    "input_buf_size" : "2KiB",
+    "output_buf_size" : "2KiB",
+    "flit_size" : "72B",
+    "num_ports" : args.cores + 1,
+    "id" : 0,
+})
+network.setSubComponent("topology", "merlin.singlerouter")
+
+for core in range(args.cores):
+    cpu = sst.Component("core" + str(core), "memHierarchy.standardCPU")
+    cpu.addParams({
+        "memFreq" : 1,
+        "memSize" : args.footprint,     # Every core uses the same addresses
+        "clock" : "2GHz",
+        "maxOutstanding" : 16,
+        "opCount" : args.ops,
+        "reqsPerIssue" : 2,
+        "write_freq" : 40,
+        "read_freq" : 60,
+        "rngseed" : 7 + core,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1cache = sst.Component("l1cache" + str(core), "memHierarchy.Cache")
+    l1cache.addParams({
+        "access_latency_cycles" : "2",
+        "cache_frequency" : "2GHz",
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "associativity" : "4",
+        "cache_line_size" : "64",
+        "L1" : "1",
+        "cache_size" : "8KiB",
+    })
+    l1nic = l1cache.setSubComponent("lowlink", "memHierarchy.MemNIC")
+    l1nic.addParams({
+        "group" : 1,
+        "network_bw" : "50GB/s",
+    })
+
+    link_cpu_l1 = sst.Link("link_cpu_l1_" + str(core))
+    link_cpu_l1.connect( (iface, "lowlink", "500ps"), (l1cache, "highlink", "500ps") )
+    link_l1_net = sst.Link("link_l1_net_" + str(core))
+    link_l1_net.connect( (l1nic, "port", "500ps"), (network, "port" + str(core), "500ps") )
+
+dirctrl = sst.Component("directory", "memHierarchy.DirectoryController")
+dirctrl.addParams({
+    "clock" : "2GHz",
+    "coherence_protocol" : "MESI",
+    "entry_cache_size" : 32768,
+    "mshr_num_entries" : 64,
+    "addr_range_start" : 0,
+    "addr_range_end" : 1024*1024*1024-1,
+})
+dirnic = dirctrl.setSubComponent("highlink", "memHierarchy.MemNIC")
+dirnic.addParams({
+    "group" : 2,
+    "network_bw" : "50GB/s",
+})
+
+memctrl = sst.Component("memory", "memHierarchy.CoherentMemController" if args.coherent_mem else "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "addr_range_end" : 1024*1024*1024-1,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "1GiB",
+})
+
+sst.setStatisticLoadLevel(1)
+sst.setStatisticOutput("sst.statOutputConsole")
+sst.enableAllStatisticsForComponentType("memHierarchy.DirectoryController")
+
+link_dir_net = sst.Link("link_dir_net")
+link_dir_net.connect( (dirnic, "port", "500ps"), (network, "port" + str(args.cores), "500ps") )
+link_dir_mem = sst.Link("link_dir_mem")
+link_dir_mem.connect( (dirctrl, "lowlink", "500ps"), (memctrl, "highlink", "500ps") )
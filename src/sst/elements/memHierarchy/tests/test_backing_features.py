@@ -0,0 +1,123 @@
+import sst
+import sys
+
+# Check that a cache feature does not change what ends up in memory
+#
+# Two cores write and read a small memory through private L1s and a shared L2.
+# Each store writes its own address as data, so the final memory contents only
+# depend on which addresses were written, not on the order. The cores flush the
+# caches at the end and memory is written to <outfile>, which the testsuite
+# compares against a run with feature 'none'.
+#
+# Features:
+#   none:        plain caches
+#   compression: L2 compresses lines (bdi) with twice as many tags as data ways
+#   warmup:      the first part of the run is functional warmup in both cache levels
+#   sectoring:   L2 tracks valid/dirty state per 16B sector
+
+DEBUG_L1 = 0
+DEBUG_L2 = 0
+DEBUG_MEM = 0
+
+if len(sys.argv) < 3:
+    print("Argument count is incorrect. Required: <feature> <outfile>")
+    exit(0)
+
+feature = sys.argv[1]
+outfile = sys.argv[2]
+
+if feature not in ["none", "compression", "warmup", "sectoring"]:
+    print("Unknown feature '%s'"%feature)
+    exit(1)
+
+cpu_params = {
+    "memFreq" : 1,
+    "memSize" : "64KiB",
+    "verbose" : 0,
+    "clock" : "2GHz",
+    "maxOutstanding" : 16,
+    "opCount" : 4000,
+    "reqsPerIssue" : 2,
+    "write_freq" : 45,
+    "read_freq" : 55,
+    "flushcache_at_end" : True,
+}
+
+l1_params = {
+    "access_latency_cycles" : 1,
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "mesi",
+    "associativity" : 4,
+    "cache_line_size" : 64,
+    "cache_size" : "1KiB",
+    "L1" : 1,
+    "debug" : DEBUG_L1,
+    "debug_level" : 10,
+}
+
+l2_params = {
+    "access_latency_cycles" : 5,
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "mesi",
+    "associativity" : 4,
+    "cache_line_size" : 64,
+    "cache_size" : "4KiB",
+    "mshr_num_entries" : 32,
+    "debug" : DEBUG_L2,
+    "debug_level" : 10,
+}
+
+if feature == "compression":
+    l2_params["compression"] = "bdi"
+    l2_params["compression_tag_factor"] = 2
+
+if feature == "sectoring":
+    l2_params["sector_size"] = 16
+
+if feature == "warmup":
+    l1_params["warmup_end"] = "1us"
+    l2_params["warmup_end"] = "1us"
+
+l2 = sst.Component("l2cache", "memHierarchy.Cache")
+l2.addParams(l2_params)
+
+l2_bus = sst.Component("l2bus", "memHierarchy.Bus")
+l2_bus.addParams({ "bus_frequency" : "2GHz" })
+
+for i in range(2):
+    cpu = sst.Component("core%d"%i, "memHierarchy.standardCPU")
+    cpu.addParams(cpu_params)
+    cpu.addParams({ "rngseed" : 11 + i })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1 = sst.Component("l1cache%d"%i, "memHierarchy.Cache")
+    l1.addParams(l1_params)
+
+    cpu_l1_link = sst.Link("link_cpu_l1_%d"%i)
+    cpu_l1_link.connect( (iface, "lowlink", "100ps"), (l1, "highlink", "100ps") )
+    l1_bus_link = sst.Link("link_l1_bus_%d"%i)
+    l1_bus_link.connect( (l1, "lowlink", "100ps"), (l2_bus, "highlink%d"%i, "100ps") )
+
+bus_l2_link = sst.Link("link_bus_l2")
+bus_l2_link.connect( (l2_bus, "lowlink0", "100ps"), (l2, "highlink", "100ps") )
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "addr_range_end" : 64*1024-1,
+    "backing" : "malloc",
+    "backing_init_zero" : True,
+    "backing_out_file" : outfile,
+    "debug" : DEBUG_MEM,
+    "debug_level" : 10,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "64KiB",
+})
+
+l2_mem_link = sst.Link("link_l2_mem")
+l2_mem_link.connect( (l2, "lowlink", "100ps"), (memctrl, "highlink", "100ps") )
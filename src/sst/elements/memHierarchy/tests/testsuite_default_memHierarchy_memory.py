@@ -79,6 +79,17 @@ class testcase_memHierarchy_memory(SSTTestCase):
 
         self.memh_template_backing(teststr="init", testnum=5, seed0=20, seed1=21, seed2=22, seed3=23, backing_infile=None, backing_reffile=ref_file, backing_outfile=out_file)
 
+    # Test that a compressed L2 leaves the same memory contents as an uncompressed one
+    # Pass if output malloc file matches the file from a run without compression
+    def test_memory_backing_6_compression(self):
+        self.memh_template_backing_feature("compression")
+
+    def test_memory_backing_7_warmup(self):
+        self.memh_template_backing_feature("warmup")
+
+    def test_memory_backing_8_sectoring(self):
+        self.memh_template_backing_feature("sectoring")
+
 
 #####
 
@@ -117,4 +128,38 @@ class testcase_memHierarchy_memory(SSTTestCase):
         self.assertFalse(os_test_file(test_err, "-s"), "Error file is non-empty {}".format(test_err))
 
 
+    def memh_template_backing_feature(self, feature, testtimeout=240):
+
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        test_run_dir = self.get_test_output_run_dir()
+
+        test_config = "{}/test_backing_features.py".format(test_path)
+
+        outfiles = []
+        for run in ["none", feature]:
+            test_output = "{}/test_memHierarchy_memory_backing_{}_{}.out".format(test_run_dir, feature, run)
+            test_err    = "{}/test_memHierarchy_memory_backing_{}_{}.err".format(test_run_dir, feature, run)
+            test_mpi_output = "{}/test_memHierarchy_memory_backing_{}_{}.testfile".format(test_run_dir, feature, run)
+            backing_outfile = "{}/test_memHierarchy_memory_backing_{}_{}.malloc.mem".format(test_run_dir, feature, run)
+
+            args = '--model-options="{} {}"'.format(run, backing_outfile)
+
+            log_debug("testcase = test_backing_{}_{}".format(feature, run))
+            log_debug("sdl file = {}".format(test_config))
+
+            self.run_sst(test_config, test_output, test_err, other_args=args, set_cwd=test_path,
+                         timeout_sec=testtimeout, mpi_out_files=test_mpi_output)
+
+            # Check that simulation completed
+            with open(test_output) as fn:
+                self.assertIn("Simulation is complete", fn.read(), "No end of simulation detected in output file {}".format(test_output))
+
+            # Check that the simulation generated no stderr output
+            self.assertFalse(os_test_file(test_err, "-s"), "Error file is non-empty {}".format(test_err))
+
+            outfiles.append(backing_outfile)
 
+        # Check that memory contents match the run without the feature
+        memcheck = filecmp.cmp(outfiles[0], outfiles[1], shallow=False)
+        self.assertTrue(memcheck, "Output memory contents {} do not match the contents without {}, {}".format(outfiles[1], feature, outfiles[0]))
@@ -58,7 +58,7 @@ def build_sweep_test_matrix():
     L2_mshr_size_list = ["8", "64"]
 
     # Both Cache Replacment Policy
-    replacement_policy_list = ["mru", "random", "nmru"]
+    replacement_policy_list = ["mru", "random", "nmru", "srrip", "drrip", "ship"]
 
     # Test type options
     test_type_list = ["MSI", "MESI"]
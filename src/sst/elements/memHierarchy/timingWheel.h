@@ -0,0 +1,185 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_TIMINGWHEEL_H
+#define MEMHIERARCHY_TIMINGWHEEL_H
+
+#include <stdint.h>
+#include <cstddef>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <sst/core/serialization/serializer.h>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Timestamp-ordered queue for outgoing events
+ *
+ * Drop-in for the std::multimap<uint64_t, T> send queues used by controllers: entries come out
+ * in timestamp order and, for equal timestamps, in insertion order. Send delays are a few
+ * fixed latencies, so entries are kept in a ring of per-cycle FIFOs ('slots') that covers the
+ * next 'slots' cycles, which makes insert and pop O(1). Entries further out than that wait in
+ * an overflow map until the ring reaches them. Entries scheduled before the last drained cycle
+ * are sent on the next pop, in the order they were scheduled.
+ * List nodes come from a pool so steady-state operation does not allocate.
+ */
+template <typename T>
+class TimingWheel {
+public:
+    explicit TimingWheel(uint32_t slots = 256) {
+        uint32_t size = 1;
+        while (size < slots) size <<= 1;
+        slots_.resize(size);
+        mask_ = size - 1;
+    }
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    void insert(uint64_t time, const T& value) {
+        uint32_t node = allocate(time, value);
+        size_++;
+        if (time < cursor_) {
+            append(due_, node);
+        } else if (time - cursor_ <= mask_) {
+            append(slots_[time & mask_], node);
+            wheel_size_++;
+        } else {
+            overflow_.insert(std::make_pair(time, node));
+        }
+    }
+
+    /* Remove the next entry with a timestamp at or before 'now'. Returns false if there is none */
+    bool pop(uint64_t now, T& value) {
+        if (due_.head != NIL) {
+            value = release(due_);
+            return true;
+        }
+        while (size_ && cursor_ <= now) {
+            List& slot = slots_[cursor_ & mask_];
+            if (slot.head != NIL) {
+                value = release(slot);
+                wheel_size_--;
+                return true;
+            }
+            if (wheel_size_ == 0)       // Skip ahead to the earliest overflow entry
+                advance(std::min(overflow_.begin()->first, now + 1));
+            else
+                advance(cursor_ + 1);
+        }
+        if (!size_ && cursor_ <= now)
+            cursor_ = now + 1;
+        return false;
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) {
+        SST_SER(nodes_);
+        SST_SER(slots_);
+        SST_SER(due_);
+        SST_SER(overflow_);
+        SST_SER(free_);
+        SST_SER(mask_);
+        SST_SER(cursor_);
+        SST_SER(size_);
+        SST_SER(wheel_size_);
+    }
+
+private:
+    static const uint32_t NIL = 0xFFFFFFFF;
+
+    struct Node {
+        uint64_t time;
+        T value;
+        uint32_t next;
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) {
+            SST_SER(time);
+            SST_SER(value);
+            SST_SER(next);
+        }
+    };
+
+    struct List {
+        uint32_t head = NIL;
+        uint32_t tail = NIL;
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) {
+            SST_SER(head);
+            SST_SER(tail);
+        }
+    };
+
+    uint32_t allocate(uint64_t time, const T& value) {
+        uint32_t node;
+        if (free_ != NIL) {
+            node = free_;
+            free_ = nodes_[node].next;
+        } else {
+            node = nodes_.size();
+            nodes_.emplace_back();
+        }
+        nodes_[node].time = time;
+        nodes_[node].value = value;
+        nodes_[node].next = NIL;
+        return node;
+    }
+
+    void append(List& list, uint32_t node) {
+        if (list.tail == NIL)
+            list.head = node;
+        else
+            nodes_[list.tail].next = node;
+        list.tail = node;
+    }
+
+    T release(List& list) {
+        uint32_t node = list.head;
+        list.head = nodes_[node].next;
+        if (list.head == NIL)
+            list.tail = NIL;
+        nodes_[node].next = free_;
+        free_ = node;
+        size_--;
+        return nodes_[node].value;
+    }
+
+    /* Move the ring to 'time' and pull in overflow entries that now fall within it */
+    void advance(uint64_t time) {
+        cursor_ = time;
+        while (!overflow_.empty() && overflow_.begin()->first - cursor_ <= mask_) {
+            append(slots_[overflow_.begin()->first & mask_], overflow_.begin()->second);
+            wheel_size_++;
+            overflow_.erase(overflow_.begin());
+        }
+    }
+
+    std::vector<Node> nodes_;               // Node pool
+    std::vector<List> slots_;               // Slot i holds entries for cycles equal to i modulo the ring size
+    List due_;                              // Entries scheduled before cursor_
+    std::multimap<uint64_t, uint32_t> overflow_;
+    uint32_t free_ = NIL;                   // Free list through Node::next
+    uint64_t mask_ = 0;
+    uint64_t cursor_ = 0;                   // Earliest cycle not yet drained
+    size_t size_ = 0;
+    size_t wheel_size_ = 0;                 // Entries in slots_
+};
+
+}
+}
+
+#endif /* MEMHIERARCHY_TIMINGWHEEL_H */
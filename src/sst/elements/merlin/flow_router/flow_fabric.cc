@@ -0,0 +1,311 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "flow_router/flow_fabric.h"
+#include "flow_router/flow_router.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "merlin.h"
+
+using namespace SST::Merlin;
+
+std::map<std::string, FlowFabric*> FlowFabric::fabrics;
+
+FlowFabric*
+FlowFabric::attach(const std::string& name, flow_router* rtr, int id, int num_ports, uint32_t& link_base)
+{
+    FlowFabric*& fabric = fabrics[name];
+    if ( !fabric ) fabric = new FlowFabric(name);
+
+    if ( !fabric->routers.emplace(id, rtr).second ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router: more than one router with id %d in network '%s'.  "
+                           "Routers in different networks need different network_name values\n", id, name.c_str());
+    }
+    if ( !fabric->timer_rtr ) fabric->timer_rtr = rtr;
+    fabric->ref_count++;
+
+    link_base = fabric->links.size();
+    Link link = { 0.0, std::vector<uint32_t>(), 0, 0.0, 0, 0 };
+    fabric->links.resize(link_base + 2 * num_ports, link);
+    return fabric;
+}
+
+void
+FlowFabric::detach(FlowFabric* fabric)
+{
+    if ( --fabric->ref_count > 0 ) return;
+
+    for ( Flow& flow : fabric->flows ) {
+        if ( flow.active ) delete flow.ev;
+    }
+    fabrics.erase(fabric->name);
+    delete fabric;
+}
+
+flow_router*
+FlowFabric::getRouter(int id)
+{
+    auto it = routers.find(id);
+    if ( it == routers.end() ) return nullptr;
+    return it->second;
+}
+
+SimTime_t
+FlowFabric::now()
+{
+    return timer_rtr->getCurrentSimCycle();
+}
+
+void
+FlowFabric::startFlow(flow_router* rtr, int port, RtrEvent* ev)
+{
+    uint32_t id;
+    if ( free_flows.empty() ) {
+        id = flows.size();
+        flows.emplace_back();
+        flows[id].version = 0;
+        flows[id].mark = 0;
+    }
+    else {
+        id = free_flows.back();
+        free_flows.pop_back();
+    }
+
+    Flow& flow = flows[id];
+    flow.src = rtr;
+    flow.src_port = port;
+    flow.vn = ev->getRouteVN();
+    flow.flits = ev->getSizeInFlits();
+    flow.remaining = ev->getSizeInBits();
+    flow.rate = 0.0;
+    flow.updated = now();
+    flow.latency = 0;
+    flow.frozen = false;
+    flow.active = true;
+    flow.links.clear();
+    flow.hops.clear();
+    flow.links.push_back(rtr->link_base + rtr->num_ports + port);
+
+    // Walk the route through the topology object of each router on
+    // the path, the same way the packet would be routed hop by hop
+    internal_router_event* ire = rtr->topo->process_input(ev);
+    flow_router* curr = rtr;
+    int in_port = port;
+    while ( true ) {
+        curr->topo->route_packet(in_port, ire->getVC(), ire);
+        int out_port = ire->getNextPort();
+        flow.links.push_back(curr->link_base + out_port);
+        flow.latency += curr->hop_latency;
+
+        Hop hop = { curr, out_port, ire->getVC() };
+        flow.hops.push_back(hop);
+        int idx = out_port * curr->num_vcs + hop.vc;
+        curr->output_credits[idx] -= flow.flits;
+        curr->output_queue_lengths[idx] += flow.flits;
+
+        if ( curr->topo->getPortState(out_port) == Topology::R2N ) break;
+
+        flow_router* next = curr->remote_rtr[out_port];
+        if ( !next || flow.hops.size() > routers.size() * 4 ) {
+            merlin_abort.fatal(CALL_INFO, -1, "flow_router %d: no route from endpoint %lld to endpoint %lld\n",
+                               rtr->id, (long long)ev->getTrustedSrc(), (long long)ev->getDest());
+        }
+        in_port = curr->remote_port[out_port];
+        curr = next;
+    }
+    flow.dst = curr;
+    flow.dst_port = ire->getNextPort();
+
+    flow.ev = ire->getEncapsulatedEvent();
+    ire->setEncapsulatedEvent(nullptr);
+    delete ire;
+
+    for ( uint32_t link : flow.links ) links[link].flows.push_back(id);
+
+    rebalance(flow.links);
+    rtr->flow_rate_updates->addData(comp_flows.size());
+    schedule();
+}
+
+void
+FlowFabric::progress()
+{
+    SimTime_t time = now();
+    if ( time >= next_wakeup ) next_wakeup = MAX_SIMTIME_T;
+
+    std::vector<uint32_t> seeds;
+    while ( !completions.empty() && completions.top().time <= time ) {
+        Completion c = completions.top();
+        completions.pop();
+        Flow& flow = flows[c.flow];
+        if ( !flow.active || flow.version != c.version ) continue;
+
+        seeds.insert(seeds.end(), flow.links.begin(), flow.links.end());
+        finish(c.flow);
+    }
+
+    if ( !seeds.empty() ) rebalance(seeds);
+    schedule();
+}
+
+void
+FlowFabric::finish(uint32_t id)
+{
+    Flow& flow = flows[id];
+    uint64_t bits = flow.ev->getSizeInBits();
+
+    for ( uint32_t link : flow.links ) {
+        std::vector<uint32_t>& list = links[link].flows;
+        for ( size_t i = 0; i < list.size(); i++ ) {
+            if ( list[i] == id ) {
+                list[i] = list.back();
+                list.pop_back();
+                break;
+            }
+        }
+    }
+
+    for ( const Hop& hop : flow.hops ) {
+        int idx = hop.port * hop.rtr->num_vcs + hop.vc;
+        hop.rtr->output_credits[idx] += flow.flits;
+        hop.rtr->output_queue_lengths[idx] -= flow.flits;
+        hop.rtr->send_bit_count[hop.port]->addData(bits);
+        hop.rtr->send_packet_count[hop.port]->addData(1);
+    }
+
+    // The tail has left the source, so its buffer space goes back to
+    // the endpoint.  The head reaches the destination one path
+    // latency after the tail left, which is when the packet is
+    // delivered.
+    flow.src->ports[flow.src_port]->send(new credit_event(flow.vn, flow.flits));
+    flow.dst->ports[flow.dst_port]->send(flow.latency, flow.ev);
+
+    flow.ev = nullptr;
+    flow.active = false;
+    flow.version++;
+    free_flows.push_back(id);
+}
+
+void
+FlowFabric::rebalance(const std::vector<uint32_t>& seeds)
+{
+    SimTime_t time = now();
+
+    // Collect the flows that share links, directly or through other
+    // flows, with the seed links.  Rates outside this set cannot change.
+    epoch++;
+    comp_links.clear();
+    comp_flows.clear();
+    stack.clear();
+    for ( uint32_t link : seeds ) {
+        if ( links[link].mark == epoch ) continue;
+        links[link].mark = epoch;
+        stack.push_back(link);
+    }
+    while ( !stack.empty() ) {
+        uint32_t link = stack.back();
+        stack.pop_back();
+        comp_links.push_back(link);
+        for ( uint32_t f : links[link].flows ) {
+            Flow& flow = flows[f];
+            if ( flow.mark == epoch ) continue;
+            flow.mark = epoch;
+            comp_flows.push_back(f);
+            for ( uint32_t other : flow.links ) {
+                if ( links[other].mark == epoch ) continue;
+                links[other].mark = epoch;
+                stack.push_back(other);
+            }
+        }
+    }
+
+    // Bring the set up to date at the old rates
+    for ( uint32_t f : comp_flows ) {
+        Flow& flow = flows[f];
+        flow.remaining -= flow.rate * (time - flow.updated);
+        if ( flow.remaining < 0.0 ) flow.remaining = 0.0;
+        flow.updated = time;
+        flow.frozen = false;
+    }
+
+    // Progressive filling: repeatedly find the link with the smallest
+    // fair share among its unfrozen flows and fix those flows at that
+    // share.  Entries in the heap go stale when a link's share changes.
+    std::priority_queue<Share, std::vector<Share>, std::greater<Share> > shares;
+    for ( uint32_t l : comp_links ) {
+        Link& link = links[l];
+        link.residual = link.capacity;
+        link.unfrozen = link.flows.size();
+        link.stamp++;
+        if ( link.unfrozen ) {
+            Share s = { link.residual / link.unfrozen, l, link.stamp };
+            shares.push(s);
+        }
+    }
+    while ( !shares.empty() ) {
+        Share s = shares.top();
+        shares.pop();
+        Link& link = links[s.link];
+        if ( s.stamp != link.stamp || link.unfrozen == 0 ) continue;
+
+        // Guard against rounding leaving a bottleneck with nothing
+        double share = std::max(s.share, link.capacity * 1e-9);
+        for ( uint32_t f : link.flows ) {
+            Flow& flow = flows[f];
+            if ( flow.frozen ) continue;
+            flow.frozen = true;
+            flow.rate = share;
+            for ( uint32_t other : flow.links ) {
+                Link& ol = links[other];
+                ol.residual -= share;
+                ol.unfrozen--;
+                if ( other != s.link && ol.unfrozen > 0 ) {
+                    ol.stamp++;
+                    Share os = { std::max(ol.residual, 0.0) / ol.unfrozen, other, ol.stamp };
+                    shares.push(os);
+                }
+            }
+        }
+    }
+
+    for ( uint32_t f : comp_flows ) {
+        Flow& flow = flows[f];
+        flow.version++;
+        Completion c = { time + (SimTime_t)std::ceil(flow.remaining / flow.rate), flow.version, f };
+        completions.push(c);
+    }
+}
+
+void
+FlowFabric::schedule()
+{
+    // Drop stale completions so the wakeup goes to the next real one
+    while ( !completions.empty() ) {
+        const Completion& c = completions.top();
+        const Flow& flow = flows[c.flow];
+        if ( flow.active && flow.version == c.version ) break;
+        completions.pop();
+    }
+    if ( completions.empty() ) return;
+
+    SimTime_t time = completions.top().time;
+    if ( time >= next_wakeup ) return;
+
+    SimTime_t curr = now();
+    timer_rtr->timer->send(time > curr ? time - curr : 0, nullptr);
+    next_wakeup = time;
+}
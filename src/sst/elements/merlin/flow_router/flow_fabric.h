@@ -0,0 +1,156 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_FLOW_ROUTER_FLOW_FABRIC_H
+#define COMPONENTS_MERLIN_FLOW_ROUTER_FLOW_FABRIC_H
+
+#include <sst/core/sst_types.h>
+
+#include <functional>
+#include <map>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+class RtrEvent;
+class flow_router;
+
+/*
+ * Flow-level model of a network built from flow_routers
+ *
+ * Every packet is a flow that holds its injection link, each router
+ * output link on its route and the ejection link for its whole
+ * lifetime.  Links are shared max-min fairly between the flows
+ * crossing them.  Rates are recomputed by progressive filling when a
+ * flow starts or finishes, but only for the flows that are connected
+ * to it through shared links; flows elsewhere in the network keep
+ * their rates and completion times.
+ *
+ * All flow_routers with the same network_name share one fabric.  The
+ * routers call into each other directly, so the whole network must be
+ * on a single rank and thread.
+ */
+class FlowFabric {
+public:
+    /* Add a router to the named fabric, creating the fabric if needed.
+       The router owns 2*num_ports links starting at link_base: one
+       output link per port, then one injection link per port */
+    static FlowFabric* attach(const std::string& name, flow_router* rtr, int id, int num_ports, uint32_t& link_base);
+    static void detach(FlowFabric* fabric);
+
+    flow_router* getRouter(int id);
+
+    void setLinkCapacity(uint32_t link, double bits_per_cycle) { links[link].capacity = bits_per_cycle; }
+
+    /* Start a flow for a packet that arrived on host port 'port' of 'rtr' */
+    void startFlow(flow_router* rtr, int port, RtrEvent* ev);
+
+    /* Finish all flows that are done by the current time */
+    void progress();
+
+private:
+    FlowFabric(const std::string& name) : name(name), ref_count(0), timer_rtr(nullptr), epoch(0),
+                                          next_wakeup(MAX_SIMTIME_T) {}
+
+    struct Link {
+        double capacity;                // bits per core cycle
+        std::vector<uint32_t> flows;
+        // Progressive filling state
+        uint64_t mark;
+        double residual;
+        int unfrozen;
+        uint32_t stamp;
+    };
+
+    struct Hop {
+        flow_router* rtr;
+        int port;
+        int vc;
+    };
+
+    struct Flow {
+        RtrEvent* ev;
+        flow_router* src;
+        int src_port;
+        flow_router* dst;
+        int dst_port;
+        int vn;
+        int flits;
+        SimTime_t latency;              // Head latency across the routers on the path
+        std::vector<uint32_t> links;
+        std::vector<Hop> hops;          // Router output ports, for the topology's congestion view
+        double remaining;               // bits left as of 'updated'
+        double rate;                    // bits per core cycle
+        SimTime_t updated;
+        uint64_t version;
+        uint64_t mark;
+        bool frozen;
+        bool active;
+    };
+
+    struct Completion {
+        SimTime_t time;
+        uint64_t version;
+        uint32_t flow;
+        bool operator>(const Completion& other) const {
+            if ( time != other.time ) return time > other.time;
+            return flow > other.flow;
+        }
+    };
+
+    struct Share {
+        double share;
+        uint32_t link;
+        uint32_t stamp;
+        bool operator>(const Share& other) const { return share > other.share; }
+    };
+
+    SimTime_t now();
+    void rebalance(const std::vector<uint32_t>& seeds);
+    void finish(uint32_t flow);
+    void schedule();
+
+    static std::map<std::string, FlowFabric*> fabrics;
+
+    std::string name;
+    int ref_count;
+    std::map<int, flow_router*> routers;
+    flow_router* timer_rtr;
+
+    std::vector<Link> links;
+    std::vector<Flow> flows;
+    std::vector<uint32_t> free_flows;
+
+    std::priority_queue<Completion, std::vector<Completion>, std::greater<Completion> > completions;
+
+    // Scratch space for rebalance()
+    uint64_t epoch;
+    std::vector<uint32_t> comp_links;
+    std::vector<uint32_t> comp_flows;
+    std::vector<uint32_t> stack;
+
+    SimTime_t next_wakeup;
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_FLOW_ROUTER_FLOW_FABRIC_H
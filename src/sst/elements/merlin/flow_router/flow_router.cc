@@ -0,0 +1,368 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "flow_router/flow_router.h"
+#include "flow_router/flow_fabric.h"
+
+#include <sst/core/params.h>
+#include <sst/core/output.h>
+
+#include <string>
+
+#include "merlin.h"
+
+using namespace SST::Merlin;
+using namespace SST::Interfaces;
+
+static UnitAlgebra getLinkBW(const Params& params, Topology* topo, int port)
+{
+    // Link bandwidth can be overridden per logical group, as for hr_router
+    std::string key = std::string("link_bw:") + topo->getPortLogicalGroup(port);
+    std::string value = params.find<std::string>(key);
+    if ( value == "" ) value = params.find<std::string>("link_bw");
+    if ( value == "" ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router requires link_bw to be specified\n");
+    }
+
+    UnitAlgebra ua(value);
+    if ( ua.hasUnits("B/s") ) ua *= UnitAlgebra("8b/B");
+    if ( !ua.hasUnits("b/s") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router: link_bw must be specified in either b/s or B/s: %s\n",
+                           value.c_str());
+    }
+    return ua;
+}
+
+static UnitAlgebra getBits(const Params& params, const std::string& param, const std::string& default_val)
+{
+    std::string value = params.find<std::string>(param, default_val);
+    if ( value == "" ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router requires %s to be specified\n", param.c_str());
+    }
+
+    UnitAlgebra ua(value);
+    if ( ua.hasUnits("B") ) ua *= UnitAlgebra("8b/B");
+    if ( !ua.hasUnits("b") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router: %s must be specified in either b or B: %s\n",
+                           param.c_str(), value.c_str());
+    }
+    return ua;
+}
+
+flow_router::~flow_router()
+{
+    delete [] output_credits;
+    delete [] output_queue_lengths;
+    if ( fabric ) FlowFabric::detach(fabric);
+}
+
+flow_router::flow_router(ComponentId_t cid, Params& params) :
+    Component(cid),
+    num_vcs(0),
+    topo(nullptr),
+    fabric(nullptr),
+    link_base(0),
+    timer(nullptr),
+    output_credits(nullptr),
+    output_queue_lengths(nullptr)
+{
+    id = params.find<int>("id",-1);
+    if ( id == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router requires id to be specified\n");
+    }
+
+    num_ports = params.find<int>("num_ports",-1);
+    if ( num_ports == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router requires num_ports to be specified\n");
+    }
+
+    // Routers call into each other directly, so the network cannot be
+    // split across ranks or threads
+    if ( getNumRanks().rank > 1 || getNumRanks().thread > 1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router only supports serial simulations\n");
+    }
+
+    num_vns = params.find<int>("num_vns",2);
+    vcs_per_vn.resize(num_vns);
+
+    topo = loadUserSubComponent<SST::Merlin::Topology>
+        ("topology", ComponentInfo::SHARE_NONE, num_ports, id, num_vns);
+
+    if ( !topo ) {
+        merlin_abort.fatal(CALL_INFO_LONG, 1, "flow_router requires topology to be specified in input file\n");
+    }
+
+    topo->getVCsPerVN(vcs_per_vn);
+    for ( int vcs : vcs_per_vn ) num_vcs += vcs;
+
+    flit_size = getBits(params, "flit_size", "");
+    UnitAlgebra input_buf_size = getBits(params, "input_buf_size", "");
+    UnitAlgebra output_buf_size = getBits(params, "output_buf_size", params.find<std::string>("input_buf_size"));
+    input_buf_credits = (input_buf_size / flit_size).getRoundedValue();
+    int output_buf_credits = (output_buf_size / flit_size).getRoundedValue();
+
+    UnitAlgebra hop_lat = params.find<UnitAlgebra>("hop_latency", "20ns");
+    if ( !hop_lat.hasUnits("s") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router: hop_latency must be specified in s: %s\n",
+                           hop_lat.toStringBestSI().c_str());
+    }
+    hop_latency = (hop_lat / getCoreTimeBase()).getRoundedValue();
+
+    // Configure the links.  Everything runs on the core time base so
+    // the fabric can schedule in core cycles.
+    ports.resize(num_ports, nullptr);
+    link_bw.resize(num_ports);
+    for ( int i = 0; i < num_ports; i++ ) {
+        std::string port_name = std::string("port") + std::to_string(i);
+        ports[i] = configureLink(port_name, getCoreTimeBase().toString(),
+                                 new Event::Handler2<flow_router,&flow_router::handle_input,int>(this, i));
+        link_bw[i] = getLinkBW(params, topo, i);
+    }
+    timer = configureSelfLink("flow_timer", getCoreTimeBase().toString(),
+                              new Event::Handler2<flow_router,&flow_router::handle_timer>(this));
+
+    remote_rtr_id.resize(num_ports, -1);
+    remote_port.resize(num_ports, -1);
+    remote_rtr.resize(num_ports, nullptr);
+    credits_sent.resize(num_ports, false);
+
+    // The topology sees output credits that shrink and queue lengths
+    // that grow with the data of the flows currently using each port
+    output_credits = new int[num_ports * num_vcs];
+    output_queue_lengths = new int[num_ports * num_vcs];
+    for ( int i = 0; i < num_ports * num_vcs; i++ ) {
+        output_credits[i] = output_buf_credits;
+        output_queue_lengths[i] = 0;
+    }
+    topo->setOutputBufferCreditArray(output_credits, num_vcs);
+    topo->setOutputQueueLengthsArray(output_queue_lengths, num_vcs);
+
+    std::string network_name = params.find<std::string>("network_name", "network");
+    fabric = FlowFabric::attach(network_name, this, id, num_ports, link_base);
+
+    for ( int i = 0; i < num_ports; i++ ) {
+        std::string port_name = std::string("port") + std::to_string(i);
+        send_bit_count.push_back(registerStatistic<uint64_t>("send_bit_count", port_name));
+        send_packet_count.push_back(registerStatistic<uint64_t>("send_packet_count", port_name));
+    }
+    flow_rate_updates = registerStatistic<uint64_t>("flow_rate_updates");
+}
+
+void
+flow_router::init(unsigned int phase)
+{
+    RtrInitEvent* init_ev;
+
+    switch ( phase ) {
+    case 0:
+        // Same link negotiation as PortControl
+        for ( int i = 0; i < num_ports; i++ ) {
+            if ( !ports[i] ) continue;
+
+            init_ev = new RtrInitEvent();
+            init_ev->command = RtrInitEvent::REPORT_BW;
+            init_ev->ua_value = link_bw[i];
+            ports[i]->sendUntimedData(init_ev);
+
+            if ( topo->isHostPort(i) ) {
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_FLIT_SIZE;
+                init_ev->ua_value = flit_size;
+                ports[i]->sendUntimedData(init_ev);
+
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_ID;
+                init_ev->int_value = topo->getEndpointID(i);
+                ports[i]->sendUntimedData(init_ev);
+            }
+            else {
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_ID;
+                init_ev->int_value = id;
+                ports[i]->sendUntimedData(init_ev);
+
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_PORT;
+                init_ev->int_value = i;
+                ports[i]->sendUntimedData(init_ev);
+            }
+        }
+        break;
+    case 1:
+        for ( int i = 0; i < num_ports; i++ ) {
+            if ( !ports[i] ) continue;
+
+            Event* ev = ports[i]->recvUntimedData();
+            init_ev = dynamic_cast<RtrInitEvent*>(ev);
+            if ( !init_ev || init_ev->command != RtrInitEvent::REPORT_BW ) {
+                merlin_abort.fatal(CALL_INFO, -1, "flow_router %d: protocol error during init on port %d\n", id, i);
+            }
+            if ( link_bw[i] > init_ev->ua_value ) link_bw[i] = init_ev->ua_value;
+            delete ev;
+
+            // The output link and, on host ports, the injection link
+            // run at the negotiated rate
+            double bits_per_cycle = link_bw[i].getDoubleValue() * getCoreTimeBase().getDoubleValue();
+            fabric->setLinkCapacity(link_base + i, bits_per_cycle);
+            fabric->setLinkCapacity(link_base + num_ports + i, bits_per_cycle);
+
+            if ( topo->isHostPort(i) ) {
+                ev = ports[i]->recvUntimedData();
+                init_ev = dynamic_cast<RtrInitEvent*>(ev);
+                if ( !init_ev || init_ev->command != RtrInitEvent::REQUEST_VNS ) {
+                    merlin_abort.fatal(CALL_INFO, -1, "flow_router %d: protocol error during init on port %d\n", id, i);
+                }
+                int req_vns = init_ev->int_value;
+                delete ev;
+
+                // Report the number of VNs, then map each requested
+                // VN onto itself
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REQUEST_VNS;
+                init_ev->int_value = num_vns;
+                ports[i]->sendUntimedData(init_ev);
+
+                for ( int j = 0; j < req_vns; ++j ) {
+                    init_ev = new RtrInitEvent();
+                    init_ev->command = RtrInitEvent::REQUEST_VNS;
+                    init_ev->int_value = j;
+                    ports[i]->sendUntimedData(init_ev);
+                }
+            }
+            else {
+                ev = ports[i]->recvUntimedData();
+                init_ev = dynamic_cast<RtrInitEvent*>(ev);
+                if ( !init_ev || init_ev->command != RtrInitEvent::REPORT_ID ) {
+                    merlin_abort.fatal(CALL_INFO, -1, "flow_router %d: protocol error during init on port %d\n", id, i);
+                }
+                remote_rtr_id[i] = init_ev->int_value;
+                delete ev;
+
+                ev = ports[i]->recvUntimedData();
+                init_ev = dynamic_cast<RtrInitEvent*>(ev);
+                if ( !init_ev || init_ev->command != RtrInitEvent::REPORT_PORT ) {
+                    merlin_abort.fatal(CALL_INFO, -1, "flow_router %d: protocol error during init on port %d\n", id, i);
+                }
+                remote_port[i] = init_ev->int_value;
+                delete ev;
+            }
+        }
+        break;
+    default:
+        // Give each endpoint its credits once; they bound how much
+        // data it can have in flows at a time
+        for ( int i = 0; i < num_ports; i++ ) {
+            if ( !ports[i] || credits_sent[i] || !topo->isHostPort(i) ) continue;
+            for ( int j = 0; j < num_vns; ++j ) {
+                ports[i]->sendUntimedData(new credit_event(j, input_buf_credits));
+            }
+            credits_sent[i] = true;
+        }
+        drainUntimedData();
+        break;
+    }
+}
+
+void
+flow_router::complete(unsigned int phase)
+{
+    drainUntimedData();
+}
+
+void
+flow_router::drainUntimedData()
+{
+    for ( int i = 0; i < num_ports; i++ ) {
+        if ( !ports[i] ) continue;
+        Event* ev;
+        while ( (ev = ports[i]->recvUntimedData()) != nullptr ) {
+            switch ( static_cast<BaseRtrEvent*>(ev)->getType() ) {
+            case BaseRtrEvent::CREDIT:
+            case BaseRtrEvent::INITIALIZATION:
+                // Ejection buffers are not modeled
+                delete ev;
+                break;
+            default:
+                routeUntimedData(i, ev);
+                break;
+            }
+        }
+    }
+}
+
+void
+flow_router::routeUntimedData(int port, Event* ev)
+{
+    // Untimed data follows the same links as with hr_router
+    internal_router_event *ire = dynamic_cast<internal_router_event*>(ev);
+    if ( ire == nullptr ) {
+        ire = topo->process_UntimedData_input(static_cast<RtrEvent*>(ev));
+    }
+    std::vector<int> outPorts;
+    topo->routeUntimedData(port, ire, outPorts);
+    for ( int out : outPorts ) {
+        switch ( topo->getPortState(out) ) {
+        case Topology::R2N:
+            ports[out]->sendUntimedData(ire->getEncapsulatedEvent()->clone());
+            break;
+        case Topology::R2R:
+        case Topology::FAILED: {
+            internal_router_event *new_ire = ire->clone();
+            new_ire->setEncapsulatedEvent(ire->getEncapsulatedEvent()->clone());
+            ports[out]->sendUntimedData(new_ire);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    delete ire;
+}
+
+void
+flow_router::setup()
+{
+    for ( int i = 0; i < num_ports; i++ ) {
+        if ( remote_rtr_id[i] == -1 ) continue;
+        remote_rtr[i] = fabric->getRouter(remote_rtr_id[i]);
+        if ( !remote_rtr[i] ) {
+            merlin_abort.fatal(CALL_INFO, -1, "flow_router %d: port %d is connected to router %d, which is not "
+                               "in the same network.  Routers in different networks need different network_name values\n",
+                               id, i, remote_rtr_id[i]);
+        }
+    }
+}
+
+void
+flow_router::handle_input(Event* ev, int port)
+{
+    BaseRtrEvent* base_event = static_cast<BaseRtrEvent*>(ev);
+    switch ( base_event->getType() ) {
+    case BaseRtrEvent::PACKET:
+        fabric->startFlow(this, port, static_cast<RtrEvent*>(ev));
+        break;
+    default:
+        // Credits returned by endpoints and congestion control
+        // messages have no meaning at the flow level
+        delete ev;
+        break;
+    }
+}
+
+void
+flow_router::handle_timer(Event* ev)
+{
+    fabric->progress();
+}
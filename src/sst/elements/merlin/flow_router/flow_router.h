@@ -0,0 +1,141 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_FLOW_ROUTER_FLOW_ROUTER_H
+#define COMPONENTS_MERLIN_FLOW_ROUTER_FLOW_ROUTER_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/output.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+
+using namespace SST;
+
+namespace SST {
+namespace Merlin {
+
+class FlowFabric;
+
+/*
+ * Router that moves packets as flows instead of flits
+ *
+ * Drop-in replacement for hr_router in large what-if studies.  The
+ * topology subcomponent, the endpoint interfaces (LinkControl) and
+ * the init protocol on host ports are the same as for hr_router, so
+ * neither topologies nor endpoints change.  Packets arriving from an
+ * endpoint are routed through the topology objects of all the routers
+ * on the path at once and then handed to the FlowFabric shared by the
+ * network, which moves them with max-min fair bandwidth sharing.  No
+ * timed events travel between routers and there is no router clock.
+ */
+class flow_router : public Component {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        flow_router,
+        "merlin",
+        "flow_router",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Flow-level router with max-min fair bandwidth sharing",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"id",                 "ID of the router."},
+        {"num_ports",          "Number of ports that the router has"},
+        {"num_vns",            "Number of VNs.","2"},
+        {"link_bw",            "Bandwidth of the links specified in either b/s or B/s (can include SI prefix)."},
+        {"flit_size",          "Flit size specified in either b or B (can include SI prefix)."},
+        {"input_buf_size",     "Size of input buffers specified in b or B (can include SI prefix).  Bounds the data an endpoint can have in flight."},
+        {"output_buf_size",    "Size of output buffers specified in b or B (can include SI prefix).  Only used for the congestion view given to adaptive routing.  Defaults to input_buf_size.", ""},
+        {"hop_latency",        "Latency added for each router a packet passes through, including the router to router link.", "20ns"},
+        {"network_name",       "Name of the network.  Only needs to be set when a simulation contains more than one network.", "network"}
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "send_bit_count",     "Count number of bits sent on link", "bits", 1},
+        { "send_packet_count",  "Count number of packets sent on link", "packets", 1},
+        { "flow_rate_updates",  "Number of flow rates recomputed when a flow entered at this router", "flows", 1}
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"port%(num_ports)d",  "Ports which connect to endpoints or other routers.", { "merlin.RtrEvent", "merlin.internal_router_event", "merlin.credit_event" } }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"topology", "Topology object to control routing", "SST::Merlin::Topology" }
+    )
+
+    flow_router(ComponentId_t cid, Params& params);
+    ~flow_router();
+
+    void init(unsigned int phase) override;
+    void complete(unsigned int phase) override;
+    void setup() override;
+
+private:
+    friend class FlowFabric;
+
+    int id;
+    int num_ports;
+    int num_vns;
+    int num_vcs;
+    std::vector<int> vcs_per_vn;
+
+    Topology* topo;
+    FlowFabric* fabric;
+    uint32_t link_base;
+
+    std::vector<Link*> ports;
+    Link* timer;
+
+    std::vector<UnitAlgebra> link_bw;
+    UnitAlgebra flit_size;
+    int input_buf_credits;
+    SimTime_t hop_latency;
+
+    // Router on the other side of each router to router port
+    std::vector<int> remote_rtr_id;
+    std::vector<int> remote_port;
+    std::vector<flow_router*> remote_rtr;
+    std::vector<bool> credits_sent;
+
+    // Congestion view handed to the topology
+    int* output_credits;
+    int* output_queue_lengths;
+
+    std::vector<Statistic<uint64_t>*> send_bit_count;
+    std::vector<Statistic<uint64_t>*> send_packet_count;
+    Statistic<uint64_t>* flow_rate_updates;
+
+    void handle_input(Event* ev, int port);
+    void handle_timer(Event* ev);
+
+    void routeUntimedData(int port, Event* ev);
+    void drainUntimedData();
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_FLOW_ROUTER_FLOW_ROUTER_H
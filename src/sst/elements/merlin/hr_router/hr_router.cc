@@ -337,6 +337,7 @@ hr_router::notifyEvent()
         tmp = out_port_busy[i] - elapsed_cycles;
     	if ( tmp < 0 ) out_port_busy[i] = 0;
         else out_port_busy[i] = tmp;
+        if ( in_port_busy[i] == 0 && out_port_busy[i] == 0 ) busy_ports.clear(i);
     }
 #endif
     // Report skipped cycles to arbitration unit.
@@ -400,6 +401,10 @@ hr_router::clock_handler(Cycle_t cycle)
 #endif
     }
 
+    // Only ports with a head can be picked by the arbitration unit.
+    // Copy the set first since recv() below can clear bits in it.
+    arb_ports = active_ports;
+
     // All we need to do is arbitrate the crossbar
 #if VERIFY_DECLOCKING
     arb->arbitrate(ports,in_port_busy,out_port_busy,progress_vcs,clocking);
@@ -407,12 +412,13 @@ hr_router::clock_handler(Cycle_t cycle)
     arb->arbitrate(ports,in_port_busy,out_port_busy,progress_vcs);
 #endif
 
-    // Move the events and decrement the busy values
-    for ( int i = 0; i < num_ports; i++ ) {
-        // if ( progress_vcs[i] != -1 ) {
+    // Move the events
+    for ( int i = arb_ports.next(0); i != -1; i = arb_ports.next(i+1) ) {
         if ( progress_vcs[i] > -1 ) {
             internal_router_event* ev = ports[i]->recv(progress_vcs[i]);
             ports[ev->getNextPort()]->send(ev,ev->getVC());
+            busy_ports.set(i);
+            busy_ports.set(ev->getNextPort());
 
             if ( ev->getTraceType() == SimpleNetwork::Request::FULL ) {
                 output.output("TRACE(%d): %" PRIu64 " ns: Copying event (src = %d, dest = %d) "
@@ -434,11 +440,14 @@ hr_router::clock_handler(Cycle_t cycle)
         else if ( progress_vcs[i] == -2 ) {
                 xbar_stalls[i]->addData(1);
         }
+        progress_vcs[i] = -1;
+    }
 
-        // Should stop at zero, need to find a clean way to do this
-        // with no branch.  For now it should work.
+    // Decrement the busy values
+    for ( int i = busy_ports.next(0); i != -1; i = busy_ports.next(i+1) ) {
         if ( in_port_busy[i] != 0 ) in_port_busy[i]--;
         if ( out_port_busy[i] != 0 ) out_port_busy[i]--;
+        if ( in_port_busy[i] == 0 && out_port_busy[i] == 0 ) busy_ports.clear(i);
     }
 
     return false;
@@ -615,7 +624,11 @@ hr_router::init_vcs()
 
     // Now that we have the number of VCs we can finish initializing
     // arbitration logic
+    initActiveSets(num_ports,num_vcs);
+    busy_ports.resize(num_ports);
+    arb_ports.resize(num_ports);
     arb->setPorts(num_ports,num_vcs);
+    arb->setActiveSets(&active_vcs,&active_ports,&busy_ports);
 
 
 }
@@ -117,6 +117,11 @@ private:
     int* out_port_busy;
     int* progress_vcs;
 
+    // Ports with a non-zero in_port_busy or out_port_busy
+    ActiveSet busy_ports;
+    // Copy of active_ports taken before arbitration
+    ActiveSet arb_ports;
+
     UnitAlgebra input_buf_size;
     UnitAlgebra output_buf_size;
 
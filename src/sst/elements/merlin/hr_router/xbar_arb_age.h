@@ -120,12 +120,15 @@ private:
 
     internal_router_event** vc_heads;
 
+    const ActiveSet* active_vcs;
+
     // PortControl** ports;
 
 public:
 
     xbar_arb_age(ComponentId_t cid, Params& params) :
-        XbarArbitration(cid)
+        XbarArbitration(cid),
+        active_vcs(NULL)
     {
     }
 
@@ -150,6 +153,10 @@ public:
         vc_heads = new internal_router_event*[num_vcs];
     }
 
+    void setActiveSets(const ActiveSet* vcs, const ActiveSet* ports, const ActiveSet* busy) {
+        active_vcs = vcs;
+    }
+
     // Naming convention is from point of view of the xbar.  So,
     // in_port_busy is >0 if someone is writing to that xbar port and
     // out_port_busy is >0 if that xbar port being read.
@@ -162,33 +169,48 @@ public:
                    )
     {
 
-        for ( int i = 0; i < num_ports; i++ ) progress_vc[i] = -1;
-
-
         // Find all ports that have data and who's inputs to the xbar
         // aren't busy.  Sort them by prioritizing on injection time.
         // Oldest gets top priority.
-        int index = 0;
-        for ( int i = 0; i < num_ports; i++ ) {
-            if ( in_port_busy[i] > 0 ) {
-                index += num_vcs;
-                continue; // No need to consider port if input to xbar is busy
+        if ( active_vcs ) {
+            for ( int index = active_vcs->next(0); index != -1; index = active_vcs->next(index+1) ) {
+                priority_entry_t& entry = entries[index];
+                if ( in_port_busy[entry.port] > 0 ) continue;
+
+                internal_router_event* src_event = ports[entry.port]->getVCHeads()[entry.vc];
+                entry.next_port = src_event->getNextPort();
+                entry.next_vc = src_event->getVC();
+                entry.injection_time = src_event->getEncapsulatedEvent()->getInjectionTime();
+                entry.size_in_flits = src_event->getFlitCount();
+
+                age_queue.push(&entry);
             }
+        }
+        else {
+            for ( int i = 0; i < num_ports; i++ ) progress_vc[i] = -1;
+
+            int index = 0;
+            for ( int i = 0; i < num_ports; i++ ) {
+                if ( in_port_busy[i] > 0 ) {
+                    index += num_vcs;
+                    continue; // No need to consider port if input to xbar is busy
+                }
 
-            vc_heads = ports[i]->getVCHeads();
-            for ( int j = 0; j < num_vcs; j++ ) {
-                internal_router_event* src_event = vc_heads[j];
-                if ( src_event != NULL ) {
-                    entries[index].next_port = vc_heads[j]->getNextPort();
-                    entries[index].next_vc = vc_heads[j]->getVC();
-                    entries[index].injection_time = vc_heads[j]->getEncapsulatedEvent()->getInjectionTime();
-                    entries[index].size_in_flits = vc_heads[j]->getFlitCount();
-
-                    age_queue.push(&entries[index]);
+                vc_heads = ports[i]->getVCHeads();
+                for ( int j = 0; j < num_vcs; j++ ) {
+                    internal_router_event* src_event = vc_heads[j];
+                    if ( src_event != NULL ) {
+                        entries[index].next_port = vc_heads[j]->getNextPort();
+                        entries[index].next_vc = vc_heads[j]->getVC();
+                        entries[index].injection_time = vc_heads[j]->getEncapsulatedEvent()->getInjectionTime();
+                        entries[index].size_in_flits = vc_heads[j]->getFlitCount();
+
+                        age_queue.push(&entries[index]);
+                    }
+                    index++;
                 }
-                index++;
-            }
 
+            }
         }
 
         while ( !age_queue.empty() ) {
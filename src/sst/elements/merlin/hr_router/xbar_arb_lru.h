@@ -22,6 +22,7 @@
 #include <sst/core/link.h>
 #include <sst/core/timeConverter.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "sst/elements/merlin/router.h"
@@ -51,21 +52,25 @@ private:
     int rr_port_shadow;
 #endif
 
-    typedef std::pair<uint16_t,uint16_t> priority_entry_t;
-    priority_entry_t* priority[2];
-    priority_entry_t* cur_list;
-    priority_entry_t* next_list;
-
     int total_entries;
 
-    internal_router_event** vc_heads;
+    // Priority of each port * num_vcs + vc entry, lowest goes first.
+    // An entry that wins arbitration gets a rank above all others,
+    // which puts it at the bottom of the list.  Entries that win in
+    // the same cycle end up in the reverse of the order they won in.
+    std::vector<uint64_t> rank;
+    uint64_t next_rank;
+
+    // Entries with a head on a port whose input to the xbar is free
+    std::vector<int> live;
 
-    // PortControl** ports;
+    const ActiveSet* active_vcs;
 
 public:
 
     xbar_arb_lru(ComponentId_t cid, Params& param) :
-        XbarArbitration(cid)
+        XbarArbitration(cid),
+        active_vcs(NULL)
     {
     }
 
@@ -78,20 +83,15 @@ public:
 
         total_entries = num_ports * num_vcs;
 
-        priority[0] = new priority_entry_t[total_entries];
-        priority[1] = new priority_entry_t[total_entries];
-        cur_list = priority[0];
-        next_list = priority[1];
-
-        int index = 0;
-        for ( int i = 0; i < num_ports; i++ ) {
-            for ( int j = 0; j < num_vcs; j++ ) {
-                cur_list[index++] = priority_entry_t(i,j);
-            }
-        }
+        rank.resize(total_entries);
+        for ( int i = 0; i < total_entries; i++ ) rank[i] = i;
+        next_rank = total_entries;
 
+        live.reserve(total_entries);
+    }
 
-        vc_heads = new internal_router_event*[num_vcs];
+    void setActiveSets(const ActiveSet* vcs, const ActiveSet* ports, const ActiveSet* busy) {
+        active_vcs = vcs;
     }
 
     // Naming convention is from point of view of the xbar.  So,
@@ -105,92 +105,62 @@ public:
 #endif
                    )
     {
+        // Only entries with an event on a port that isn't busy can
+        // win.  Everything else keeps its place in the list.
+        live.clear();
+        if ( active_vcs ) {
+            for ( int i = active_vcs->next(0); i != -1; i = active_vcs->next(i+1) ) {
+                if ( in_port_busy[i / num_vcs] <= 0 ) live.push_back(i);
+            }
+        }
+        else {
+            for ( int i = 0; i < num_ports; i++ ) progress_vc[i] = -1;
+            for ( int port = 0; port < num_ports; port++ ) {
+                if ( in_port_busy[port] > 0 ) continue;
+                internal_router_event** vc_heads = ports[port]->getVCHeads();
+                for ( int vc = 0; vc < num_vcs; vc++ ) {
+                    if ( vc_heads[vc] != NULL ) live.push_back(port * num_vcs + vc);
+                }
+            }
+        }
+        if ( live.empty() ) return;
 
-        for ( int i = 0; i < num_ports; i++ ) progress_vc[i] = -1;
-
-        // std::cout << "---------" << std::endl;
-        // for ( int i = 0; i < total_entries; i++ ) {
-        //     std::cout << priority[cur_list][i].first << ", " << priority[cur_list][i].second << std::endl;
-        // }
-        // std::cout << "---------" << std::endl;
-
-        // Run through the priority list
-        // for ( priority_list_t::iterator it = priority.begin(); it != priority.end(); ) {
-        // int sat_index = total_entries - 1;
-        // int unsat_index = 0;
-
-        priority_entry_t* sat_list = &next_list[total_entries-1];
-        priority_entry_t* unsat_list = next_list;
-
-        for ( int i = 0; i < total_entries; i++ ) {
-
-            // const priority_entry_t& check = priority[cur_list][i];
-            const priority_entry_t& check = cur_list[i];
-
-            /* std::cout << check.first << ", " << check.second << std::endl; */
-
-            int port = check.first;
-            int vc = check.second;
-
-            // std::cout << check.first << ", " << check.second << std::endl;
+        std::sort(live.begin(), live.end(), [this](int a, int b) { return rank[a] < rank[b]; });
 
-            vc_heads = ports[port]->getVCHeads();
+        uint64_t sat_rank = next_rank + live.size();
+        for ( int entry : live ) {
+            int port = entry / num_vcs;
+            int vc = entry % num_vcs;
 
-            // if the output of this port is busy or if there is no
-            // event to be processed, nothing to do.
-            internal_router_event* src_event = vc_heads[vc];
-            if ( in_port_busy[port] <= 0 && src_event != NULL) {
-                // Have an event, see if it can be progressed
-                int next_port = src_event->getNextPort();
-                int next_vc = src_event->getVC();
+            // Can only be busy here if another VC of this port was
+            // satisfied this cycle
+            if ( in_port_busy[port] > 0 ) continue;
 
-                // We can progress if the next port's input is not
-                // busy and there are enough credits.
-                if ( out_port_busy[next_port] <= 0 &&
-                     ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) {
+            // Have an event, see if it can be progressed
+            internal_router_event* src_event = ports[port]->getVCHeads()[vc];
+            int next_port = src_event->getNextPort();
+            int next_vc = src_event->getVC();
 
-                    // Tell the router what to move
-                    progress_vc[port] = vc;
+            // We can progress if the next port's input is not
+            // busy and there are enough credits.
+            if ( out_port_busy[next_port] <= 0 &&
+                 ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) {
 
-                    // Need to set the busy values
-                    in_port_busy[port] = src_event->getFlitCount();
-                    out_port_busy[next_port] = src_event->getFlitCount();
+                // Tell the router what to move
+                progress_vc[port] = vc;
 
+                // Need to set the busy values
+                in_port_busy[port] = src_event->getFlitCount();
+                out_port_busy[next_port] = src_event->getFlitCount();
 
-                    // Copy data to new list
-                    // std::cout << "putting at bottom of list" << std::endl;
-                    // next_list[sat_index--] = check;
-                    *sat_list = check;
-                    --sat_list;
-                }
-                else {
-                    // std::cout << "putting at top of list" << std::endl;
-                    // next_list[unsat_index++] = check;
-                    *unsat_list = check;
-                    ++unsat_list;
-                    progress_vc[port] = -2;
-                }
+                // Move to the bottom of the list
+                rank[entry] = sat_rank--;
             }
             else {
-                // std::cout << "putting at top of list" << std::endl;
-                // next_list[unsat_index++] = check;
-                *unsat_list = check;
-                ++unsat_list;
+                progress_vc[port] = -2;
             }
         }
-
-        // std::cout << "+++++++++" << std::endl;
-        // for ( int i = 0; i < total_entries; i++ ) {
-        //     std::cout << priority[next_list][i].first << ", " << priority[cur_list][i].second << std::endl;
-        // }
-        // std::cout << "+++++++++" << std::endl;
-
-        // cur_list ^= next_list;
-        // next_list ^= cur_list;
-        // cur_list ^= next_list;
-        priority_entry_t* tmp = cur_list;
-        cur_list = next_list;
-        next_list = tmp;
+        next_rank += live.size() + 1;
         return;
     }
 
@@ -49,22 +49,73 @@ private:
     int num_ports;
     int num_vcs;
 
+    // The round robin VC of a port goes up by one every cycle its
+    // input to the xbar isn't busy.  Instead of touching every port
+    // each cycle, rr_vcs holds the VC relative to rr_count, which
+    // goes up every cycle, and ports that are busy step back by one.
     int *rr_vcs;
+    int rr_count;
     int rr_port;
 
 #if VERIFY_DECLOCKING
     int rr_port_shadow;
 #endif
 
-    internal_router_event** vc_heads;
+    const ActiveSet* active_ports;
+    const ActiveSet* busy_ports;
 
     // PortControl** ports;
 
+    inline int getRRVC(int port) {
+        int vc = rr_vcs[port] + rr_count;
+        return vc < num_vcs ? vc : vc - num_vcs;
+    }
+
+    inline void arbitratePort(PortInterface** ports, int port, int* in_port_busy, int* out_port_busy, int* progress_vc) {
+        // if the output of this port is busy, nothing to do.
+        if ( in_port_busy[port] > 0 ) {
+            return;
+        }
+
+        internal_router_event** vc_heads = ports[port]->getVCHeads();
+
+        // See what we should progress for this port
+        for ( int vc = getRRVC(port), vcount = 0; vcount < num_vcs; vc = ((vc != num_vcs-1) ? (vc+1) : 0), vcount++ ) {
+
+            // If there is no event, move to next VC
+            internal_router_event* src_event = vc_heads[vc];
+            if ( src_event == NULL ) continue;
+
+            // Have an event, see if it can be progressed
+            int next_port = src_event->getNextPort();
+
+            // We can progress if the next port's input is not
+            // busy and there are enough credits.
+            if ( out_port_busy[next_port] > 0 ) continue;
+
+            // Need to see if the VC has enough credits
+            int next_vc = src_event->getVC();
+
+            // See if there is enough space
+            if ( !ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) continue;
+
+            // Tell the router what to move
+            progress_vc[port] = vc;
+
+            // Need to set the busy values
+            in_port_busy[port] = src_event->getFlitCount();
+            out_port_busy[next_port] = src_event->getFlitCount();
+            break;  // Go to next port;
+        }
+    }
+
 public:
 
     xbar_arb_rr(ComponentId_t cid, Params& params) :
         XbarArbitration(cid),
-        rr_vcs(NULL)
+        rr_vcs(NULL),
+        active_ports(NULL),
+        busy_ports(NULL)
     {
     }
 
@@ -81,11 +132,16 @@ public:
             rr_vcs[i] = 0;
         }
 
+        rr_count = 0;
         rr_port = 0;
 #if VERIFY_DECLOCKING
         rr_port_shadow = 0;
 #endif
-        vc_heads = new internal_router_event*[num_vcs];
+    }
+
+    void setActiveSets(const ActiveSet* vcs, const ActiveSet* ports, const ActiveSet* busy) {
+        active_ports = ports;
+        busy_ports = busy;
     }
 
     // Naming convention is from point of view of the xbar.  So,
@@ -99,51 +155,36 @@ public:
 #endif
                    )
     {
-        // Run through each of the ports, giving first pick in a round robin fashion
-        // for ( int port = rr_port, pcount = 0; pcount < num_ports; port = (port+1) % num_ports, pcount++ ) {
-        for ( int port = rr_port, pcount = 0; pcount < num_ports; port = ((port != num_ports-1) ? port+1 : 0), pcount++ ) {
-
-            vc_heads = ports[port]->getVCHeads();
-
-            // Overwrite old data
-            progress_vc[port] = -1;
-            // if the output of this port is busy, nothing to do.
-            if ( in_port_busy[port] > 0 ) {
-                continue;
+        if ( active_ports ) {
+            // Busy ports don't move their round robin VC this cycle
+            for ( int port = busy_ports->next(0); port != -1; port = busy_ports->next(port+1) ) {
+                if ( in_port_busy[port] > 0 ) rr_vcs[port] = rr_vcs[port] != 0 ? rr_vcs[port] - 1 : num_vcs - 1;
             }
 
-            // See what we should progress for this port
-            // for ( int vc = rr_vcs[port], vcount = 0; vcount < num_vcs; vc = (vc+1) % num_vcs, vcount++ ) {
-            for ( int vc = rr_vcs[port], vcount = 0; vcount < num_vcs; vc = ((vc != num_vcs-1) ? (vc+1) : 0), vcount++ ) {
-
-                // If there is no event, move to next VC
-                internal_router_event* src_event = vc_heads[vc];
-                if ( src_event == NULL ) continue;
-
-                // Have an event, see if it can be progressed
-                int next_port = src_event->getNextPort();
-
-                // We can progress if the next port's input is not
-                // busy and there are enough credits.
-                if ( out_port_busy[next_port] > 0 ) continue;
-
-                // Need to see if the VC has enough credits
-                int next_vc = src_event->getVC();
-
-                // See if there is enough space
-                if ( !ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) continue;
-
-                // Tell the router what to move
-                progress_vc[port] = vc;
+            // Run through the ports with data, giving first pick in a
+            // round robin fashion
+            for ( int port = active_ports->next(rr_port); port != -1; port = active_ports->next(port+1) ) {
+                arbitratePort(ports, port, in_port_busy, out_port_busy, progress_vc);
+            }
+            for ( int port = active_ports->next(0); port != -1 && port < rr_port; port = active_ports->next(port+1) ) {
+                arbitratePort(ports, port, in_port_busy, out_port_busy, progress_vc);
+            }
+        }
+        else {
+            for ( int port = 0; port < num_ports; port++ ) {
+                if ( in_port_busy[port] > 0 ) rr_vcs[port] = rr_vcs[port] != 0 ? rr_vcs[port] - 1 : num_vcs - 1;
+            }
 
-                // Need to set the busy values
-                in_port_busy[port] = src_event->getFlitCount();
-                out_port_busy[next_port] = src_event->getFlitCount();
-                break;  // Go to next port;
+            // Run through each of the ports, giving first pick in a round robin fashion
+            for ( int port = rr_port, pcount = 0; pcount < num_ports; port = ((port != num_ports-1) ? port+1 : 0), pcount++ ) {
+                // Overwrite old data
+                progress_vc[port] = -1;
+                arbitratePort(ports, port, in_port_busy, out_port_busy, progress_vc);
             }
-            // Increemnt rr_vcs for next time
-            rr_vcs[port] = (rr_vcs[port] + 1) % num_vcs;
         }
+
+        // Increment rr_vcs of all ports for next time
+        rr_count = (rr_count + 1) % num_vcs;
         rr_port = (rr_port + 1) % num_ports;
 
 #if VERIFY_DECLOCKING
@@ -170,7 +211,7 @@ public:
         stream << "Current round robin port: " << rr_port << std::endl;
         stream << "  Current round robin VC by port:" << std::endl;
         for ( int i = 0; i < num_ports; i++ ) {
-            stream << i << ": " << rr_vcs[i] << std::endl;
+            stream << i << ": " << getRRVC(i) << std::endl;
         }
     }
 
@@ -858,6 +858,75 @@ class hr_router(RouterTemplate):
     def getTopologySlotName(self):
         return "topology"
 
+class flow_router(RouterTemplate):
+    def __init__(self):
+        RouterTemplate.__init__(self)
+
+        self._declareParams("params",["link_bw","flit_size","input_buf_size","output_buf_size","hop_latency","num_vns","network_name"])
+
+        self._subscribeToPlatformParamSet("router")
+
+
+    def getDefaultNetworkInterface(self):
+        module_name, class_name = hr_router._default_linkcontrol.rsplit(".", 1)
+        return getattr(import_module(module_name), class_name)()
+
+    def instanceRouter(self, name, radix, rtr_id):
+        if self._check_first_build():
+            sst.addGlobalParams("%s_params"%self._instance_name, self._getGroupParams("params"))
+
+        rtr = sst.Component(name, "merlin.flow_router")
+        self._applyStatisticsSettings(rtr)
+        rtr.addGlobalParamSet("%s_params"%self._instance_name)
+        rtr.addParam("num_ports",radix)
+        rtr.addParam("id",rtr_id)
+        return rtr
+
+    def getTopologySlotName(self):
+        return "topology"
+
+class router_group(RouterTemplate):
+    def __init__(self):
+        RouterTemplate.__init__(self)
+
+        self._declareParams("params",["link_bw","flit_size","input_latency","output_latency","input_buf_size","output_buf_size",
+                                      "internal_latency","num_vns"])
+
+        self._subscribeToPlatformParamSet("router")
+
+
+    def getDefaultNetworkInterface(self):
+        module_name, class_name = hr_router._default_linkcontrol.rsplit(".", 1)
+        return getattr(import_module(module_name), class_name)()
+
+    # Port p of router r in the group is port r*radix+p of the
+    # component and router r uses slot r of the topology slot.
+    # internal_latency is the topology's router to router latency;
+    # an internal_latency set on the template takes precedence.
+    def instanceRouterGroup(self, name, num_routers, radix, first_id, internal_links, internal_latency = None):
+        if self._check_first_build():
+            sst.addGlobalParams("%s_params"%self._instance_name, self._getGroupParams("params"))
+
+        grp = sst.Component(name, "merlin.router_group")
+        self._applyStatisticsSettings(grp)
+        grp.addGlobalParamSet("%s_params"%self._instance_name)
+        grp.addParam("num_routers",num_routers)
+        grp.addParam("num_ports",radix)
+        grp.addParam("first_id",first_id)
+        if internal_links:
+            grp.addParam("internal_links",internal_links)
+        if internal_latency is not None and self.internal_latency is None:
+            grp.addParam("internal_latency",internal_latency)
+        return grp
+
+    # Topologies that do not build groups (all but dragonfly) get one
+    # router per component
+    def instanceRouter(self, name, radix, rtr_id):
+        return self.instanceRouterGroup(name, 1, radix, rtr_id, [])
+
+    def getTopologySlotName(self):
+        return "topology"
+
 class SystemEndpoint(Buildable):
     def __init__(self,system):
         Buildable.__init__(self)
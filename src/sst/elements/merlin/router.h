@@ -27,7 +27,9 @@
 #include <sst/core/unitAlgebra.h>
 #include <sst/core/interfaces/simpleNetwork.h>
 
+#include <cstdint>
 #include <queue>
+#include <vector>
 
 namespace SST {
 namespace Merlin {
@@ -42,21 +44,87 @@ class TopologyEvent;
 class CtrlRtrEvent;
 class internal_router_event;
 
+/*
+ * Fixed size bit set whose set bits can be walked in order.  Routers
+ * use it to track which ports and VCs have packets waiting so the
+ * crossbar only has to look at those.
+ */
+class ActiveSet {
+public:
+    ActiveSet() : num_bits(0) {}
+
+    void resize(int bits) {
+        num_bits = bits;
+        words.assign((bits + 63) / 64, 0);
+    }
+
+    inline int size() const { return num_bits; }
+
+    inline void set(int bit) { words[bit >> 6] |= (uint64_t)1 << (bit & 63); }
+    inline void clear(int bit) { words[bit >> 6] &= ~((uint64_t)1 << (bit & 63)); }
+    inline bool test(int bit) const { return (words[bit >> 6] >> (bit & 63)) & 1; }
+
+    inline bool empty() const {
+        for ( uint64_t word : words ) if ( word ) return false;
+        return true;
+    }
+
+    inline int count() const {
+        int total = 0;
+        for ( uint64_t word : words ) total += __builtin_popcountll(word);
+        return total;
+    }
+
+    // Returns the first set bit at or after bit, or -1 if there is none
+    inline int next(int bit) const {
+        if ( bit >= num_bits ) return -1;
+        size_t w = bit >> 6;
+        uint64_t word = words[w] & (~(uint64_t)0 << (bit & 63));
+        while ( true ) {
+            if ( word ) return (w << 6) + __builtin_ctzll(word);
+            if ( ++w == words.size() ) return -1;
+            word = words[w];
+        }
+    }
+
+private:
+    int num_bits;
+    std::vector<uint64_t> words;
+};
+
 class Router : public Component {
 private:
     bool requestNotifyOnEvent;
 
+    // Active sets are only kept if the router asks for them
+    int active_num_vcs;
+    std::vector<int> port_vcs_with_data;
+
 protected:
     inline void setRequestNotifyOnEvent(bool state)
     { requestNotifyOnEvent = state; }
 
     int vcs_with_data;
 
+    // Bit port * num_vcs + vc is set when that VC has a packet at the
+    // head of its input buffer
+    ActiveSet active_vcs;
+    // Bit port is set when any VC of the port has a head
+    ActiveSet active_ports;
+
+    void initActiveSets(int num_ports, int num_vcs) {
+        active_num_vcs = num_vcs;
+        port_vcs_with_data.assign(num_ports, 0);
+        active_vcs.resize(num_ports * num_vcs);
+        active_ports.resize(num_ports);
+    }
+
 public:
 
     Router(ComponentId_t id) :
         Component(id),
         requestNotifyOnEvent(false),
+        active_num_vcs(0),
         vcs_with_data(0)
     {}
 
@@ -70,6 +138,19 @@ public:
     inline void dec_vcs_with_data() { vcs_with_data--; }
     inline int get_vcs_with_data() { return vcs_with_data; }
 
+    inline void inc_vcs_with_data(int port, int vc) {
+        vcs_with_data++;
+        if ( active_num_vcs == 0 ) return;
+        active_vcs.set(port * active_num_vcs + vc);
+        if ( port_vcs_with_data[port]++ == 0 ) active_ports.set(port);
+    }
+    inline void dec_vcs_with_data(int port, int vc) {
+        vcs_with_data--;
+        if ( active_num_vcs == 0 ) return;
+        active_vcs.clear(port * active_num_vcs + vc);
+        if ( --port_vcs_with_data[port] == 0 ) active_ports.clear(port);
+    }
+
     virtual int const* getOutputBufferCredits() = 0;
     virtual void sendCtrlEvent(CtrlRtrEvent* ev, int port = -1) = 0;
     virtual void recvCtrlEvent(int port, CtrlRtrEvent* ev) = 0;
@@ -648,6 +729,12 @@ public:
     virtual void arbitrate(PortInterface** ports, int* port_busy, int* out_port_busy, int* progress_vc) = 0;
 #endif
     virtual void setPorts(int num_ports, int num_vcs) = 0;
+    // Optional.  Routers that keep active sets pass them here.  busy
+    // has a bit set for every port whose in_port_busy or out_port_busy
+    // is non-zero.  Arbitration units that use the sets only need to
+    // look at live ports and do not have to clear progress_vc, the
+    // router resets the entries it reads.
+    virtual void setActiveSets(const ActiveSet* vcs, const ActiveSet* ports, const ActiveSet* busy) {}
     virtual bool isOkayToPauseClock() { return true; }
     virtual void reportSkippedCycles(Cycle_t cycles) {};
     virtual void dumpState(std::ostream& stream) {};
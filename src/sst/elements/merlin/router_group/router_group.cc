@@ -0,0 +1,610 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "router_group/router_group.h"
+
+#include <sst/core/params.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "merlin.h"
+
+using namespace SST::Merlin;
+using namespace SST::Interfaces;
+
+static UnitAlgebra getLinkBW(const Params& params, Topology* topo, int port)
+{
+    // Link bandwidth can be overridden per logical group, as for hr_router
+    std::string key = std::string("link_bw:") + topo->getPortLogicalGroup(port);
+    std::string value = params.find<std::string>(key);
+    if ( value == "" ) value = params.find<std::string>("link_bw");
+
+    UnitAlgebra ua(value);
+    if ( ua.hasUnits("B/s") ) ua *= UnitAlgebra("8b/B");
+    if ( !ua.hasUnits("b/s") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group: link_bw must be specified in either b/s or B/s: %s\n",
+                           value.c_str());
+    }
+    return ua;
+}
+
+static UnitAlgebra getBits(const Params& params, const std::string& param)
+{
+    std::string value = params.find<std::string>(param);
+    if ( value == "" ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group requires %s to be specified\n", param.c_str());
+    }
+
+    UnitAlgebra ua(value);
+    if ( ua.hasUnits("B") ) ua *= UnitAlgebra("8b/B");
+    if ( !ua.hasUnits("b") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group: %s must be specified in either b or B: %s\n",
+                           param.c_str(), value.c_str());
+    }
+    return ua;
+}
+
+router_group::~router_group()
+{
+    for ( Port& port : ports ) {
+        for ( auto& q : port.input ) {
+            while ( !q.empty() ) { delete q.front(); q.pop(); }
+        }
+        for ( auto& q : port.output ) {
+            while ( !q.empty() ) { delete q.front(); q.pop(); }
+        }
+    }
+    for ( GroupRouter& rtr : routers ) delete rtr.topo;
+}
+
+router_group::router_group(ComponentId_t cid, Params& params) :
+    Component(cid),
+    num_vcs(0),
+    now(0),
+    next_wakeup(MAX_SIMTIME_T)
+{
+    num_routers = params.find<int>("num_routers",-1);
+    if ( num_routers <= 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group requires num_routers to be specified\n");
+    }
+
+    int first_id = params.find<int>("first_id",-1);
+    if ( first_id == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group requires first_id to be specified\n");
+    }
+
+    num_ports = params.find<int>("num_ports",-1);
+    if ( num_ports == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group requires num_ports to be specified\n");
+    }
+
+    num_vns = params.find<int>("num_vns",2);
+    vcs_per_vn.resize(num_vns);
+
+    // One topology object per router
+    SubComponentSlotInfo* topo_slots = getSubComponentSlotInfo("topology");
+    routers.resize(num_routers);
+    for ( int r = 0; r < num_routers; r++ ) {
+        GroupRouter& rtr = routers[r];
+        rtr.id = first_id + r;
+        rtr.topo = nullptr;
+        if ( topo_slots && topo_slots->isPopulated(r) ) {
+            rtr.topo = topo_slots->create<Topology>(r, ComponentInfo::SHARE_NONE, num_ports, rtr.id, num_vns);
+        }
+        if ( !rtr.topo ) {
+            merlin_abort.fatal(CALL_INFO_LONG, 1, "router_group requires a topology for router %d in slot %d\n", rtr.id, r);
+        }
+        rtr.dirty = false;
+        rtr.next_port = 0;
+    }
+
+    routers[0].topo->getVCsPerVN(vcs_per_vn);
+    for ( int vcs : vcs_per_vn ) num_vcs += vcs;
+
+    // Timing
+    flit_size = getBits(params, "flit_size");
+    std::string link_bw_s = params.find<std::string>("link_bw");
+    if ( link_bw_s == "" ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group requires link_bw to be specified\n");
+    }
+    UnitAlgebra link_bw(link_bw_s);
+    if ( link_bw.hasUnits("B/s") ) link_bw *= UnitAlgebra("8b/B");
+    tick = flit_size / link_bw;
+    tick_tc = getTimeConverter(tick);
+
+    std::string input_latency_s = params.find<std::string>("input_latency","0ns");
+    input_latency = (UnitAlgebra(input_latency_s) / tick).getRoundedValue();
+    output_latency = (params.find<UnitAlgebra>("output_latency","0ns") / tick).getRoundedValue();
+    internal_latency = (params.find<UnitAlgebra>("internal_latency","20ns") / tick).getRoundedValue();
+
+    input_buf_credits = (getBits(params, "input_buf_size") / flit_size).getRoundedValue();
+    int output_buf_credits = (getBits(params, "output_buf_size") / flit_size).getRoundedValue();
+
+    for ( GroupRouter& rtr : routers ) {
+        rtr.output_credits.resize(num_ports * num_vcs, output_buf_credits);
+        rtr.output_queue_lengths.resize(num_ports * num_vcs, 0);
+        rtr.topo->setOutputBufferCreditArray(rtr.output_credits.data(), num_vcs);
+        rtr.topo->setOutputQueueLengthsArray(rtr.output_queue_lengths.data(), num_vcs);
+    }
+
+    // Ports.  Internal ones come from the wiring list, the rest are
+    // SST links if they are connected.
+    ports.resize(num_routers * num_ports);
+
+    std::vector<int> wiring;
+    params.find_array<int>("internal_links", wiring);
+    if ( wiring.size() % 4 != 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group: internal_links must hold router, port, router, port quadruples\n");
+    }
+    for ( Port& port : ports ) port.kind = UNUSED;
+    for ( size_t i = 0; i < wiring.size(); i += 4 ) {
+        if ( wiring[i] < 0 || wiring[i] >= num_routers || wiring[i+2] < 0 || wiring[i+2] >= num_routers ||
+             wiring[i+1] < 0 || wiring[i+1] >= num_ports || wiring[i+3] < 0 || wiring[i+3] >= num_ports ) {
+            merlin_abort.fatal(CALL_INFO, -1, "router_group: internal link %zu is out of range\n", i / 4);
+        }
+        uint32_t a = wiring[i] * num_ports + wiring[i+1];
+        uint32_t b = wiring[i+2] * num_ports + wiring[i+3];
+        ports[a].kind = INTERNAL;
+        ports[a].peer = b;
+        ports[b].kind = INTERNAL;
+        ports[b].peer = a;
+    }
+
+    for ( int r = 0; r < num_routers; r++ ) {
+        for ( int p = 0; p < num_ports; p++ ) {
+            uint32_t gp = r * num_ports + p;
+            Port& port = ports[gp];
+            port.rtr = r;
+            port.port = p;
+            port.link = nullptr;
+            port.credits_sent = false;
+            port.busy = false;
+            port.next_vc = 0;
+            port.bw = getLinkBW(params, routers[r].topo, p);
+
+            std::string port_name = std::string("port") + std::to_string(gp);
+            if ( port.kind != INTERNAL ) {
+                port.link = configureLink(port_name, tick.toStringBestSI(),
+                                          new Event::Handler2<router_group,&router_group::handle_input,int>(this, gp));
+                if ( port.link ) {
+                    port.kind = routers[r].topo->isHostPort(p) ? HOST : EXTERNAL;
+                    port.link->addRecvLatency(1, input_latency_s);
+                }
+            }
+            if ( port.kind == UNUSED ) continue;
+
+            port.input.resize(num_vcs);
+            port.output.resize(num_vcs);
+            // Internal links start with the peer's input buffer
+            // space; external links get theirs during init
+            port.out_credits.resize(num_vcs, port.kind == INTERNAL ? input_buf_credits : 0);
+            port.ticks_per_flit = (link_bw / port.bw).getDoubleValue();
+
+            port.send_bit_count = registerStatistic<uint64_t>("send_bit_count", port_name);
+            port.send_packet_count = registerStatistic<uint64_t>("send_packet_count", port_name);
+        }
+    }
+
+    wheel_link = configureSelfLink("action_wheel", tick.toStringBestSI(),
+                                   new Event::Handler2<router_group,&router_group::handle_wheel>(this));
+}
+
+void
+router_group::init(unsigned int phase)
+{
+    RtrInitEvent* init_ev;
+
+    switch ( phase ) {
+    case 0:
+        // Same link negotiation as PortControl
+        for ( Port& port : ports ) {
+            if ( !port.link ) continue;
+            Topology* topo = routers[port.rtr].topo;
+
+            init_ev = new RtrInitEvent();
+            init_ev->command = RtrInitEvent::REPORT_BW;
+            init_ev->ua_value = port.bw;
+            port.link->sendUntimedData(init_ev);
+
+            if ( port.kind == HOST ) {
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_FLIT_SIZE;
+                init_ev->ua_value = flit_size;
+                port.link->sendUntimedData(init_ev);
+
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_ID;
+                init_ev->int_value = topo->getEndpointID(port.port);
+                port.link->sendUntimedData(init_ev);
+            }
+            else {
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_ID;
+                init_ev->int_value = routers[port.rtr].id;
+                port.link->sendUntimedData(init_ev);
+
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_PORT;
+                init_ev->int_value = port.port;
+                port.link->sendUntimedData(init_ev);
+            }
+        }
+        break;
+    case 1:
+        for ( Port& port : ports ) {
+            if ( !port.link ) continue;
+
+            Event* ev = port.link->recvUntimedData();
+            init_ev = dynamic_cast<RtrInitEvent*>(ev);
+            if ( !init_ev || init_ev->command != RtrInitEvent::REPORT_BW ) {
+                merlin_abort.fatal(CALL_INFO, -1, "router_group %s: protocol error during init on router %d port %d\n",
+                                   getName().c_str(), routers[port.rtr].id, port.port);
+            }
+            if ( port.bw > init_ev->ua_value ) {
+                port.ticks_per_flit *= (port.bw / init_ev->ua_value).getDoubleValue();
+                port.bw = init_ev->ua_value;
+            }
+            delete ev;
+
+            if ( port.kind == HOST ) {
+                ev = port.link->recvUntimedData();
+                init_ev = dynamic_cast<RtrInitEvent*>(ev);
+                if ( !init_ev || init_ev->command != RtrInitEvent::REQUEST_VNS ) {
+                    merlin_abort.fatal(CALL_INFO, -1, "router_group %s: protocol error during init on router %d port %d\n",
+                                       getName().c_str(), routers[port.rtr].id, port.port);
+                }
+                int req_vns = init_ev->int_value;
+                delete ev;
+
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REQUEST_VNS;
+                init_ev->int_value = num_vns;
+                port.link->sendUntimedData(init_ev);
+
+                for ( int i = 0; i < req_vns; ++i ) {
+                    init_ev = new RtrInitEvent();
+                    init_ev->command = RtrInitEvent::REQUEST_VNS;
+                    init_ev->int_value = i;
+                    port.link->sendUntimedData(init_ev);
+                }
+            }
+            else {
+                // Router ID and port of the other side are not needed
+                delete port.link->recvUntimedData();
+                delete port.link->recvUntimedData();
+            }
+        }
+        break;
+    default:
+        for ( Port& port : ports ) {
+            if ( !port.link || port.credits_sent ) continue;
+            if ( port.kind == HOST ) {
+                // Hosts get credits per VN
+                for ( int i = 0; i < num_vns; ++i ) {
+                    port.link->sendUntimedData(new credit_event(i, input_buf_credits));
+                }
+            }
+            else {
+                for ( int i = 0; i < num_vcs; ++i ) {
+                    port.link->sendUntimedData(new credit_event(i, input_buf_credits));
+                }
+            }
+            port.credits_sent = true;
+        }
+        drainUntimedData();
+        break;
+    }
+}
+
+void
+router_group::complete(unsigned int phase)
+{
+    drainUntimedData();
+}
+
+void
+router_group::drainUntimedData()
+{
+    for ( uint32_t gp = 0; gp < ports.size(); gp++ ) {
+        Port& port = ports[gp];
+        if ( !port.link ) continue;
+        Event* ev;
+        while ( (ev = port.link->recvUntimedData()) != nullptr ) {
+            switch ( static_cast<BaseRtrEvent*>(ev)->getType() ) {
+            case BaseRtrEvent::CREDIT:
+            {
+                credit_event* ce = static_cast<credit_event*>(ev);
+                port.out_credits[ce->vc] += ce->credits;
+                delete ev;
+                break;
+            }
+            case BaseRtrEvent::INITIALIZATION:
+                delete ev;
+                break;
+            default:
+                routeUntimedData(gp, ev);
+                break;
+            }
+        }
+    }
+}
+
+void
+router_group::routeUntimedData(uint32_t gp, Event* ev)
+{
+    Port& in = ports[gp];
+    Topology* topo = routers[in.rtr].topo;
+
+    internal_router_event *ire = dynamic_cast<internal_router_event*>(ev);
+    if ( ire == nullptr ) {
+        ire = topo->process_UntimedData_input(static_cast<RtrEvent*>(ev));
+    }
+    std::vector<int> outPorts;
+    topo->routeUntimedData(in.port, ire, outPorts);
+    for ( int out : outPorts ) {
+        Port& port = ports[in.rtr * num_ports + out];
+        switch ( port.kind ) {
+        case HOST:
+            port.link->sendUntimedData(ire->getEncapsulatedEvent()->clone());
+            break;
+        case EXTERNAL:
+        case INTERNAL: {
+            internal_router_event *new_ire = ire->clone();
+            new_ire->setEncapsulatedEvent(ire->getEncapsulatedEvent()->clone());
+            // Data for another router in the group is routed there
+            // right away rather than in the next phase
+            if ( port.kind == EXTERNAL ) port.link->sendUntimedData(new_ire);
+            else routeUntimedData(port.peer, new_ire);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    delete ire;
+}
+
+void
+router_group::handle_input(Event* ev, int gp)
+{
+    now = getCurrentSimTime(tick_tc);
+    Port& port = ports[gp];
+
+    switch ( static_cast<BaseRtrEvent*>(ev)->getType() ) {
+    case BaseRtrEvent::CREDIT:
+    {
+        credit_event* ce = static_cast<credit_event*>(ev);
+        port.out_credits[ce->vc] += ce->credits;
+        delete ev;
+        startOutput(gp);
+        break;
+    }
+    case BaseRtrEvent::PACKET:
+    {
+        RtrEvent* event = static_cast<RtrEvent*>(ev);
+        int vn = event->getRouteVN();
+        internal_router_event* ire = routers[port.rtr].topo->process_input(event);
+        ire->setCreditReturnVC(vn);
+        arrive(gp, ire);
+        break;
+    }
+    case BaseRtrEvent::INTERNAL:
+        arrive(gp, static_cast<internal_router_event*>(ev));
+        break;
+    default:
+        // Congestion control messages are not supported
+        delete ev;
+        break;
+    }
+    run();
+}
+
+void
+router_group::handle_wheel(Event* ev)
+{
+    now = getCurrentSimTime(tick_tc);
+    if ( now >= next_wakeup ) next_wakeup = MAX_SIMTIME_T;
+    run();
+}
+
+void
+router_group::run()
+{
+    // Process everything that is due, including actions with no delay
+    // that this creates, then let the routers move packets
+    while ( true ) {
+        while ( !wheel.empty() && wheel.earliest() <= now ) {
+            wheel.take(wheel.earliest(), batch);
+            for ( const Action& action : batch ) execute(action);
+            batch.clear();
+        }
+        if ( dirty_routers.empty() ) break;
+
+        std::vector<int> work;
+        work.swap(dirty_routers);
+        for ( int r : work ) {
+            routers[r].dirty = false;
+            arbitrate(r);
+        }
+    }
+    schedule();
+}
+
+void
+router_group::schedule()
+{
+    if ( wheel.empty() ) return;
+    SimTime_t time = wheel.earliest();
+    if ( time >= next_wakeup ) return;
+    wheel_link->send(time > now ? time - now : 0, nullptr);
+    next_wakeup = time;
+}
+
+void
+router_group::execute(const Action& action)
+{
+    switch ( action.type ) {
+    case Action::ARRIVE:
+        arrive(action.port, action.ev);
+        break;
+    case Action::CREDIT:
+        ports[action.port].out_credits[action.vc] += action.flits;
+        startOutput(action.port);
+        break;
+    case Action::OUTPUT_FREE:
+        ports[action.port].busy = false;
+        startOutput(action.port);
+        break;
+    }
+}
+
+void
+router_group::markDirty(int rtr)
+{
+    if ( routers[rtr].dirty ) return;
+    routers[rtr].dirty = true;
+    dirty_routers.push_back(rtr);
+}
+
+void
+router_group::arrive(uint32_t gp, internal_router_event* ev)
+{
+    Port& port = ports[gp];
+    int vc = ev->getVC();
+    port.input[vc].push(ev);
+    // Route the packet when it reaches the head of its VC
+    if ( port.input[vc].size() == 1 ) {
+        routers[port.rtr].topo->route_packet(port.port, vc, ev);
+    }
+    markDirty(port.rtr);
+}
+
+void
+router_group::returnCredits(uint32_t gp, int vc, int flits)
+{
+    Port& port = ports[gp];
+    switch ( port.kind ) {
+    case HOST:
+    case EXTERNAL:
+        port.link->send(output_latency, new credit_event(vc, flits));
+        break;
+    case INTERNAL:
+    {
+        Action action = { Action::CREDIT, port.peer, vc, flits, nullptr };
+        wheel.insert(now + output_latency + internal_latency, action);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void
+router_group::arbitrate(int r)
+{
+    GroupRouter& rtr = routers[r];
+
+    // Move every head packet that has space in its output buffer
+    bool moved = true;
+    while ( moved ) {
+        moved = false;
+        for ( int i = 0; i < num_ports; i++ ) {
+            int p = (rtr.next_port + i) % num_ports;
+            uint32_t gp = r * num_ports + p;
+            Port& in = ports[gp];
+            if ( in.kind == UNUSED ) continue;
+
+            for ( int vc = 0; vc < num_vcs; vc++ ) {
+                if ( in.input[vc].empty() ) continue;
+                internal_router_event* ev = in.input[vc].front();
+                int out_port = ev->getNextPort();
+                int idx = out_port * num_vcs + ev->getVC();
+                int flits = ev->getFlitCount();
+                if ( rtr.output_credits[idx] < flits ) continue;
+
+                in.input[vc].pop();
+                returnCredits(gp, in.kind == HOST ? ev->getCreditReturnVC() : vc, flits);
+                if ( !in.input[vc].empty() ) {
+                    internal_router_event* next = in.input[vc].front();
+                    rtr.topo->route_packet(p, next->getVC(), next);
+                }
+
+                rtr.output_credits[idx] -= flits;
+                rtr.output_queue_lengths[idx] += flits;
+                ports[r * num_ports + out_port].output[ev->getVC()].push(ev);
+                startOutput(r * num_ports + out_port);
+                moved = true;
+            }
+        }
+    }
+    rtr.next_port = (rtr.next_port + 1) % num_ports;
+}
+
+void
+router_group::startOutput(uint32_t gp)
+{
+    Port& port = ports[gp];
+    if ( port.busy ) return;
+
+    for ( int i = 0; i < num_vcs; i++ ) {
+        int vc = (port.next_vc + i) % num_vcs;
+        if ( port.output[vc].empty() ) continue;
+        internal_router_event* ev = port.output[vc].front();
+        int flits = ev->getFlitCount();
+        // Endpoints track space per VN
+        int credit_idx = port.kind == HOST ? ev->getVN() : vc;
+        if ( port.out_credits[credit_idx] < flits ) continue;
+
+        port.output[vc].pop();
+        port.out_credits[credit_idx] -= flits;
+        port.next_vc = vc + 1;
+
+        GroupRouter& rtr = routers[port.rtr];
+        int idx = port.port * num_vcs + vc;
+        rtr.output_credits[idx] += flits;
+        rtr.output_queue_lengths[idx] -= flits;
+        markDirty(port.rtr);
+
+        port.busy = true;
+        SimTime_t ser = std::max<SimTime_t>(1, std::lround(flits * port.ticks_per_flit));
+        Action done = { Action::OUTPUT_FREE, gp, 0, 0, nullptr };
+        wheel.insert(now + ser, done);
+
+        port.send_bit_count->addData(ev->getEncapsulatedEvent()->getSizeInBits());
+        port.send_packet_count->addData(1);
+
+        switch ( port.kind ) {
+        case HOST:
+            port.link->send(output_latency, ev->getEncapsulatedEvent());
+            ev->setEncapsulatedEvent(nullptr);
+            delete ev;
+            break;
+        case EXTERNAL:
+            port.link->send(output_latency, ev);
+            break;
+        case INTERNAL:
+        {
+            Action arrival = { Action::ARRIVE, port.peer, 0, 0, ev };
+            wheel.insert(now + output_latency + internal_latency + input_latency, arrival);
+            break;
+        }
+        default:
+            break;
+        }
+        return;
+    }
+}
@@ -0,0 +1,242 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_ROUTER_GROUP_ROUTER_GROUP_H
+#define COMPONENTS_MERLIN_ROUTER_GROUP_ROUTER_GROUP_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <map>
+#include <queue>
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+
+using namespace SST;
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Several routers simulated inside one component
+ *
+ * The routers of the group hand packets and credits to each other
+ * directly through a private timing wheel instead of through SST
+ * links, and only host ports and ports to routers outside the group
+ * are SST links.  Those ports speak the same protocol as PortControl,
+ * so a group connects to LinkControl endpoints, hr_routers and other
+ * groups.
+ *
+ * Of the pymerlin topologies only dragonfly builds groups, one per
+ * dragonfly group; the others build one router_group per router.
+ *
+ * Router r of the group has id first_id + r and its own topology
+ * object in slot r of "topology".  Port p of router r is SST port
+ * "port<r*num_ports+p>".  Ports wired together inside the group are
+ * listed in internal_links.
+ *
+ * Each router is input and output buffered with credit flow control
+ * on every link.  Packets move through the crossbar as soon as there
+ * is output buffer space, so the crossbar never limits bandwidth.
+ */
+class router_group : public Component {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        router_group,
+        "merlin",
+        "router_group",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Group of routers simulated in a single component. pymerlin builds groups for dragonfly only; other topologies get one router per component",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"num_routers",        "Number of routers in the group."},
+        {"first_id",           "ID of the first router in the group.  Router r has ID first_id + r."},
+        {"num_ports",          "Number of ports on each router."},
+        {"num_vns",            "Number of VNs.","2"},
+        {"internal_links",     "Array of router, port, router, port quadruples naming the ports connected inside the group.", ""},
+        {"internal_latency",   "Latency of the links inside the group.  pymerlin's dragonfly sets it to the topology's link_latency.", "20ns"},
+        {"link_bw",            "Bandwidth of the links specified in either b/s or B/s (can include SI prefix)."},
+        {"flit_size",          "Flit size specified in either b or B (can include SI prefix)."},
+        {"input_latency",      "Latency of packets entering switch into input buffers.  Specified in s (can include SI prefix).", "0ns"},
+        {"output_latency",     "Latency of packets exiting switch from output buffers.  Specified in s (can include SI prefix).", "0ns"},
+        {"input_buf_size",     "Size of input buffers specified in b or B (can include SI prefix)."},
+        {"output_buf_size",    "Size of output buffers specified in b or B (can include SI prefix)."}
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "send_bit_count",     "Count number of bits sent on link", "bits", 1},
+        { "send_packet_count",  "Count number of packets sent on link", "packets", 1}
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"port%(num_ports)d",  "Port r*num_ports+p is port p of router r.  Connect host ports and ports to other groups.", { "merlin.RtrEvent", "merlin.internal_router_event", "merlin.credit_event" } }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"topology", "Topology objects to control routing, one per router, in router order", "SST::Merlin::Topology" }
+    )
+
+    router_group(ComponentId_t cid, Params& params);
+    ~router_group();
+
+    void init(unsigned int phase) override;
+    void complete(unsigned int phase) override;
+
+private:
+
+    enum PortKind { UNUSED, HOST, EXTERNAL, INTERNAL };
+
+    struct Port {
+        int rtr;
+        int port;
+        PortKind kind;
+        Link* link;                     // HOST and EXTERNAL
+        uint32_t peer;                  // INTERNAL: group port on the other side
+        UnitAlgebra bw;
+        double ticks_per_flit;
+        bool credits_sent;
+
+        std::vector<std::queue<internal_router_event*> > input;     // Per VC
+        std::vector<std::queue<internal_router_event*> > output;    // Per VC
+        std::vector<int> out_credits;   // Space at the other side, per VN for host ports
+        bool busy;                      // Output is serializing a packet
+        int next_vc;                    // Output round robin
+
+        Statistic<uint64_t>* send_bit_count;
+        Statistic<uint64_t>* send_packet_count;
+    };
+
+    struct GroupRouter {
+        int id;
+        Topology* topo;
+        std::vector<int> output_credits;        // Output buffer space, num_ports x num_vcs
+        std::vector<int> output_queue_lengths;
+        bool dirty;                             // Needs crossbar arbitration
+        int next_port;                          // Crossbar round robin
+    };
+
+    struct Action {
+        enum Type { ARRIVE, CREDIT, OUTPUT_FREE } type;
+        uint32_t port;
+        int vc;
+        int flits;
+        internal_router_event* ev;
+    };
+
+    /*
+     * Timing wheel for actions inside the group, in ticks of one flit
+     * time at link_bw.  Actions within the next 'slots' ticks go into
+     * per-tick slots; later ones wait in an overflow map until the
+     * wheel reaches them.
+     */
+    class ActionWheel {
+    public:
+        explicit ActionWheel(uint32_t slots = 1024) : slots_(slots), mask_(slots - 1), cursor_(0), count_(0) {}
+
+        bool empty() const { return count_ == 0 && overflow_.empty(); }
+
+        void insert(SimTime_t time, const Action& action) {
+            if ( time < cursor_ ) time = cursor_;
+            if ( time - cursor_ <= mask_ ) {
+                slots_[time & mask_].push_back(action);
+                count_++;
+            }
+            else {
+                overflow_.insert(std::make_pair(time, action));
+            }
+        }
+
+        /* Time of the earliest pending action.  Only valid when not empty */
+        SimTime_t earliest() const {
+            if ( count_ == 0 ) return overflow_.begin()->first;
+            SimTime_t time = cursor_;
+            while ( slots_[time & mask_].empty() ) time++;
+            return time;
+        }
+
+        /* Move the actions for 'time' into 'out'.  'time' must be earliest() */
+        void take(SimTime_t time, std::vector<Action>& out) {
+            cursor_ = time;
+            while ( !overflow_.empty() && overflow_.begin()->first - cursor_ <= mask_ ) {
+                slots_[overflow_.begin()->first & mask_].push_back(overflow_.begin()->second);
+                count_++;
+                overflow_.erase(overflow_.begin());
+            }
+            out.swap(slots_[time & mask_]);
+            count_ -= out.size();
+        }
+
+    private:
+        std::vector<std::vector<Action> > slots_;
+        SimTime_t mask_;
+        SimTime_t cursor_;
+        size_t count_;
+        std::multimap<SimTime_t, Action> overflow_;
+    };
+
+    int num_routers;
+    int num_ports;
+    int num_vns;
+    int num_vcs;
+    std::vector<int> vcs_per_vn;
+
+    std::vector<GroupRouter> routers;
+    std::vector<Port> ports;            // num_routers x num_ports
+
+    UnitAlgebra flit_size;
+    UnitAlgebra tick;                   // Flit time at link_bw
+    TimeConverter tick_tc;
+    SimTime_t input_latency;            // All latencies in ticks
+    SimTime_t output_latency;
+    SimTime_t internal_latency;
+    int input_buf_credits;
+
+    ActionWheel wheel;
+    std::vector<Action> batch;
+    SimTime_t now;
+    SimTime_t next_wakeup;
+    Link* wheel_link;
+    std::vector<int> dirty_routers;
+
+    void handle_input(Event* ev, int port);
+    void handle_wheel(Event* ev);
+
+    void run();
+    void schedule();
+    void execute(const Action& action);
+    void arrive(uint32_t port, internal_router_event* ev);
+    void arbitrate(int rtr);
+    void startOutput(uint32_t port);
+    void returnCredits(uint32_t port, int vc, int flits);
+    void markDirty(int rtr);
+
+    void routeUntimedData(uint32_t port, Event* ev);
+    void drainUntimedData();
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_ROUTER_GROUP_ROUTER_GROUP_H
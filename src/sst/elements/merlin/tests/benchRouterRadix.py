@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+import argparse
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+# Router radix scaling microbenchmark
+#  A single hr_router with --radix ports where only --active of them have
+#  endpoints sending traffic, so most ports and VCs are empty on every
+#  crossbar cycle.  Run with e.g.
+#  'time sst benchRouterRadix.py --model-options="--radix 128 --active 8"'
+#  and compare wall-clock across radices, arbitration units and builds; the
+#  simulated results do not depend on the radix.
+
+parser = argparse.ArgumentParser()
+parser.add_argument("-r", "--radix", help="number of router ports", type=int, default=64)
+parser.add_argument("-a", "--active", help="number of ports with traffic", type=int, default=8)
+parser.add_argument("-n", "--messages", help="number of messages per endpoint", type=int, default=20000)
+parser.add_argument("-s", "--message-size", help="size of each message", default="64B")
+parser.add_argument("-x", "--xbar-arb", help="crossbar arbitration unit", default="merlin.xbar_arb_lru")
+args = parser.parse_args()
+
+if args.active > args.radix:
+    parser.error("--active can not be larger than --radix")
+
+if __name__ == "__main__":
+
+    topo = topoSingle()
+    topo.link_latency = "20ns"
+    topo.num_ports = args.radix
+
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "4GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 1
+    router.xbar_arb = args.xbar_arb
+
+    topo.router = router
+
+    networkif = LinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "4kB"
+    networkif.output_buf_size = "4kB"
+
+    # Ports without traffic get empty endpoints
+    ep = TestJob(0, args.active)
+    ep.network_interface = networkif
+    ep.num_messages = args.messages
+    ep.message_size = args.message_size
+    ep.send_untimed_bcast = False
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep, "linear")
+
+    system.build()
@@ -0,0 +1,57 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+# HyperX network built from flow-level routers. The testsuite checks that
+# every NIC sends and receives all of its packets.
+if __name__ == "__main__":
+
+
+    ### Setup the topology
+    topo = topoHyperX()
+    topo.shape = "4x4"
+    topo.width = "1x1"
+    topo.local_ports = 2
+    topo.algorithm = "DOR"
+
+    # Set up the routers
+    router = flow_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.hop_latency = "20ns"
+    router.num_vns = 1
+
+    topo.router = router
+    topo.link_latency = "20ns"
+
+    ### set up the endpoint
+    networkif = LinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "1kB"
+    networkif.output_buf_size = "1kB"
+
+    ep = TestJob(0,topo.getNumNodes())
+    ep.network_interface = networkif
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
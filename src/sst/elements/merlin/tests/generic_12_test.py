@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+import sys
+
+# Irregular router graph read from generic_12.edges, run from the tests
+# directory. Arguments: <algorithm> <path_select>. The testsuite checks
+# that every NIC sends and receives all of its packets.
+if __name__ == "__main__":
+
+    algorithm = "updown"
+    path_select = "ecmp"
+    if len(sys.argv) > 2:
+        algorithm = sys.argv[1]
+        path_select = sys.argv[2]
+
+    ### Setup the topology
+    topo = topoGeneric()
+    topo.setGraph("generic_12.edges", hosts_per_router = 2, graph_format = "edgelist")
+    topo.algorithm = algorithm
+    topo.path_select = path_select
+
+    # Set up the routers
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "6GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 1
+    router.xbar_arb = "merlin.xbar_arb_lru"
+
+    topo.router = router
+    topo.link_latency = "20ns"
+
+    ### set up the endpoint
+    networkif = LinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "1kB"
+    networkif.output_buf_size = "1kB"
+
+    ep = TestJob(0,topo.getNumNodes())
+    ep.network_interface = networkif
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
@@ -1,5 +1,7 @@
 # -*- coding: utf-8 -*-
 
+import re
+
 from sst_unittest import *
 from sst_unittest_support import *
 
@@ -62,6 +64,20 @@ class testcase_merlin_Component(SSTTestCase):
     def test_merlin_dragon_128_deferred(self):
         self.merlin_test_template("dragon_128_test_deferred")
 
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "merlin: test_merlin_flow_router_hyperx_32 skipped if ranks > 1")
+    @unittest.skipIf(testing_check_get_num_threads() > 1, "merlin: test_merlin_flow_router_hyperx_32 skipped if threads > 1")
+    def test_merlin_flow_router_hyperx_32(self):
+        self.merlin_delivery_template("flow_router_hyperx_32_test", 32)
+
+    def test_merlin_router_group_dragon_72(self):
+        self.merlin_delivery_template("router_group_dragon_72_test", 72)
+
+    def test_merlin_generic_12_updown(self):
+        self.merlin_delivery_template("generic_12_test", 24, cwd=True, args=["updown", "ecmp"])
+
+    def test_merlin_generic_12_shortest_adaptive(self):
+        self.merlin_delivery_template("generic_12_test", 24, cwd=True, args=["shortest", "adaptive"])
+
 
     @unittest.skipIf(not(('sympy.polys.galoistools' in sys.modules) and ('sympy.polys.domains' in sys.modules)), "Polarfly construction requires sympy")
     def test_merlin_polarfly_455(self):
@@ -108,3 +124,47 @@ class testcase_merlin_Component(SSTTestCase):
             diffdata = testing_get_diff_data(testcase)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
+
+    # For models whose timing differs from hr_router: check that every NIC
+    # sent and received all of its packets instead of comparing output
+    def merlin_delivery_template(self, testcase, num_nics, cwd=False, args=None):
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        # Set the various file paths
+        testDataFileName="test_merlin_{0}".format(testcase)
+        if args:
+            testDataFileName = "{0}_{1}".format(testDataFileName, "_".join(args))
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        other_args = '--model-options="{0}"'.format(" ".join(args)) if args else ""
+        if cwd:
+            self.run_sst(sdlfile, outfile, errfile, other_args=other_args, mpi_out_files=mpioutfiles, set_cwd=test_path)
+        else:
+            self.run_sst(sdlfile, outfile, errfile, other_args=other_args, mpi_out_files=mpioutfiles)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        with open(outfile) as f:
+            lines = f.read().splitlines()
+
+        received = set()
+        sent = set()
+        for line in lines:
+            self.assertFalse("didn't receive" in line, "Output file {0} reports missing packets: {1}".format(outfile, line))
+            m = re.search(r"NIC (\d+) received all packets", line)
+            if m:
+                received.add(int(m.group(1)))
+            m = re.match(r"\d+:\s+(\d+) Finished sending packets", line)
+            if m:
+                sent.add(int(m.group(1)))
+
+        self.assertTrue(any(line.startswith("Simulation is complete") for line in lines), "Output file {0} does not report that the simulation completed".format(outfile))
+        self.assertEqual(received, set(range(num_nics)), "Not every NIC received all packets, see {0}".format(outfile))
+        self.assertEqual(sent, set(range(num_nics)), "Not every NIC finished sending, see {0}".format(outfile))
@@ -227,6 +227,48 @@ RouteToGroup::getValiantGroup(int dest_group, RNG::Random* rng) const
 // }
 
 
+std::mutex DragonflyRouteTable::lock;
+std::map<std::string, DragonflyRouteTable*> DragonflyRouteTable::tables;
+
+const DragonflyRouteTable*
+DragonflyRouteTable::get(const std::string& name, const RouteToGroup& route_to_group, const dgnflyParams& params)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    DragonflyRouteTable*& table = tables[name];
+    if ( table != NULL ) return table;
+    table = new DragonflyRouteTable();
+
+    table->port.assign((size_t)params.g * params.a * params.g * params.n, FAILED);
+    table->far_router.assign((size_t)params.g * params.g * params.n, 0);
+
+    for ( uint32_t src = 0; src < params.g; src++ ) {
+        for ( uint32_t dest = 0; dest < params.g; dest++ ) {
+            if ( dest == src ) continue;
+            for ( uint32_t slice = 0; slice < params.n; slice++ ) {
+                const RouterPortPair& pair = route_to_group.getRouterPortPairForGroup(src, dest, slice);
+                uint16_t failed = route_to_group.isFailedPortForGroup(src, pair) ? FAILED : 0;
+                table->far_router[(src * params.g + dest) * params.n + slice] =
+                    route_to_group.getRouterPortPairForGroup(dest, src, slice).router;
+
+                for ( uint32_t router = 0; router < params.a; router++ ) {
+                    // Same as topo_dragonfly::port_for_router() with local slice 0
+                    uint32_t port = pair.port;
+                    if ( pair.router != router ) {
+                        uint32_t index = (pair.router > router) ? pair.router - 1 : pair.router;
+                        port = params.p + ( index * params.m );
+                    }
+                    if ( port >= FAILED ) {
+                        merlin_abort.fatal(CALL_INFO, -1, "dragonfly: port %u can not be used in the shared route table\n", port);
+                    }
+                    table->port[(((size_t)src * params.a + router) * params.g + dest) * params.n + slice] = port | failed;
+                }
+            }
+        }
+    }
+    return table;
+}
+
+
 topo_dragonfly::topo_dragonfly(ComponentId_t cid, Params &p, int num_ports, int rtr_id, int num_vns) :
     Topology(cid),
     num_vns(num_vns),
@@ -242,6 +284,12 @@ topo_dragonfly::topo_dragonfly(ComponentId_t cid, Params &p, int num_ports, int
 
     std::string prefix = p.find<std::string>("network_name","network");
     prefix += "_";
+    network_prefix = prefix;
+
+    use_route_table = p.find<bool>("shared_route_table","false");
+    shared_route_table = NULL;
+    route_table = NULL;
+    far_router_table = NULL;
 
     global_start = params.p + ((params.a - 1) * params.m);
 
@@ -338,6 +386,24 @@ topo_dragonfly::~topo_dragonfly()
 }
 
 
+void
+topo_dragonfly::setup()
+{
+    if ( !use_route_table ) return;
+
+    // The global link map and failed links are only complete once
+    // construction is done, so the table is built here.  Untimed data
+    // is routed without it.
+    shared_route_table = DragonflyRouteTable::get(network_prefix, group_to_global_port, params);
+    route_table = &shared_route_table->port[(group_id * params.a + router_id) * params.g * params.n];
+    far_router_table = &shared_route_table->far_router[group_id * params.g * params.n];
+
+    if ( rtr_id == 0 ) {
+        output.output("dragonfly: shared route table uses %zu KiB\n", shared_route_table->getBytes() / 1024);
+    }
+}
+
+
 void topo_dragonfly::route_nonadaptive(int port, int vc, internal_router_event* ev)
 {
     topo_dragonfly_event *td_ev = static_cast<topo_dragonfly_event*>(ev);
@@ -1128,6 +1194,12 @@ int32_t topo_dragonfly::router_to_group(uint32_t group)
 
 int32_t topo_dragonfly::hops_to_router(uint32_t group, uint32_t router, uint32_t slice)
 {
+    if ( route_table ) {
+        uint32_t index = group * params.n + slice;
+        uint32_t port = route_table[index] & ~DragonflyRouteTable::FAILED;
+        return 1 + (port < global_start) + (far_router_table[index] != router);
+    }
+
     int hops = 1;
     const RouterPortPair& pair = group_to_global_port.getRouterPortPair(group,slice);
     if ( pair.router != router_id ) hops++;
@@ -1139,6 +1211,12 @@ int32_t topo_dragonfly::hops_to_router(uint32_t group, uint32_t router, uint32_t
 /* returns local router port if group can't be reached from this router */
 int32_t topo_dragonfly::port_for_group(uint32_t group, uint32_t global_slice, uint32_t local_slice)
 {
+    if ( route_table ) {
+        uint32_t port = route_table[group * params.n + global_slice];
+        if ( port & DragonflyRouteTable::FAILED ) return -1;
+        return port < global_start ? port + local_slice : port;
+    }
+
     const RouterPortPair& pair = group_to_global_port.getRouterPortPair(group,global_slice);
     if ( group_to_global_port.isFailedPort(pair) ) {
         // printf("******** Skipping failed port ********\n");
@@ -20,6 +20,10 @@
 #define COMPONENTS_MERLIN_TOPOLOGY_DRAGONFLY_H
 
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <sst/core/event.h>
 #include <sst/core/link.h>
@@ -172,6 +176,34 @@ public:
 };
 
 
+/*
+ * Port to take toward each group for every router in the network,
+ * built from the global link map once per process and shared
+ * read-only by the dragonfly routers in it.
+ */
+struct DragonflyRouteTable {
+    // Or'd into a port entry when the global link is failed
+    static constexpr uint16_t FAILED = 0x8000;
+
+    // port[((src_group * a + router) * g + dest_group) * n + slice] is
+    // the port to use with local slice 0
+    std::vector<uint16_t> port;
+    // far_router[(src_group * g + dest_group) * n + slice] is the
+    // router in dest_group at the other end of the global link
+    std::vector<uint16_t> far_router;
+
+    static const DragonflyRouteTable* get(const std::string& name, const RouteToGroup& route_to_group,
+                                          const dgnflyParams& params);
+
+    size_t getBytes() const {
+        return (port.capacity() + far_router.capacity()) * sizeof(uint16_t);
+    }
+
+private:
+    static std::mutex lock;
+    static std::map<std::string, DragonflyRouteTable*> tables;
+};
+
 
 class topo_dragonfly: public Topology {
 
@@ -212,6 +244,7 @@ public:
         {"global_route_mode",     "Mode for intepreting global link map [absolute (default) | relative].","absolute"},
         {"config_failed_links",   "Controls whether or not failed links are considered","False"},
         {"failed_links",          "List of global links to mark as failed.  Only needs to be passed to router 0. Format is \"group1:group2:slice\"",""},
+        {"shared_route_table",    "Precompute the ports toward every group in a table shared by all routers in the process.","False"},
     )
 
     enum RouteAlgo {
@@ -244,6 +277,13 @@ public:
 
     global_route_mode_t global_route_mode;
 
+    std::string network_prefix;
+    bool use_route_table;
+    // Rows of the shared route table for this router, NULL until setup
+    const DragonflyRouteTable* shared_route_table;
+    const uint16_t* route_table;
+    const uint16_t* far_router_table;
+
 public:
     struct dgnflyAddr {
         uint32_t group;
@@ -256,6 +296,8 @@ public:
     topo_dragonfly(ComponentId_t cid, Params& p, int num_ports, int rtr_id, int num_vns);
     ~topo_dragonfly();
 
+    void setup() override;
+
     virtual void route_packet(int port, int vc, internal_router_event* ev);
     virtual internal_router_event* process_input(RtrEvent* ev);
 
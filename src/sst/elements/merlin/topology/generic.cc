@@ -0,0 +1,510 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "generic.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+using namespace SST::Merlin;
+
+std::mutex GenericRouteTable::shared_lock;
+std::map<std::string, GenericRouteTable*> GenericRouteTable::shared_tables;
+
+GenericRouteTable*
+GenericRouteTable::get(const std::string& filepath, const std::string& format, bool updown, int root, std::string& error)
+{
+    std::string key = filepath + "|" + format + "|" + (updown ? "updown" : "shortest") + "|" + std::to_string(root);
+
+    std::lock_guard<std::mutex> guard(shared_lock);
+    auto it = shared_tables.find(key);
+    if ( it != shared_tables.end() ) return it->second;
+
+    GenericRouteTable* table = new GenericRouteTable();
+    bool loaded = format == "edgelist" ? table->loadEdgeList(filepath) : table->loadAdjacency(filepath);
+    if ( !loaded ) {
+        error = "unable to read a " + format + " graph from " + filepath;
+        delete table;
+        return NULL;
+    }
+    if ( !table->build(updown, root, error) ) {
+        error += " in " + filepath;
+        delete table;
+        return NULL;
+    }
+    shared_tables[key] = table;
+    return table;
+}
+
+bool
+GenericRouteTable::loadAdjacency(const std::string& filepath)
+{
+    std::ifstream fp(filepath.c_str());
+    if ( !fp.is_open() ) return false;
+
+    // Same layout as the polarfly and polarstar data files: number of
+    // routers and links, then one line of neighbors per router
+    std::string line;
+    int routers = -1, links = 0, v;
+    if ( std::getline(fp, line) ) {
+        std::istringstream iss(line);
+        iss >> routers >> links;
+    }
+
+    adj_start.clear();
+    adj.clear();
+    adj.reserve(2 * links);
+    adj_start.push_back(0);
+    while ( std::getline(fp, line) ) {
+        std::istringstream iss(line);
+        while ( iss >> v ) adj.push_back(v);
+        adj_start.push_back(adj.size());
+    }
+
+    return getNumRouters() == routers;
+}
+
+bool
+GenericRouteTable::loadEdgeList(const std::string& filepath)
+{
+    std::ifstream fp(filepath.c_str());
+    if ( !fp.is_open() ) return false;
+
+    std::vector<std::pair<int,int> > edges;
+    int routers = 0;
+    std::string line;
+    while ( std::getline(fp, line) ) {
+        size_t comment = line.find('#');
+        if ( comment != std::string::npos ) line.erase(comment);
+
+        std::istringstream iss(line);
+        int u, v;
+        if ( !(iss >> u) ) continue;
+        if ( !(iss >> v) || u < 0 || v < 0 ) return false;
+        edges.push_back(std::make_pair(u, v));
+        routers = std::max(routers, std::max(u, v) + 1);
+    }
+
+    // Neighbors are listed in the order the links appear in the file
+    adj_start.assign(routers + 1, 0);
+    for ( auto& e : edges ) {
+        adj_start[e.first + 1]++;
+        adj_start[e.second + 1]++;
+    }
+    for ( int i = 0; i < routers; i++ ) adj_start[i + 1] += adj_start[i];
+
+    std::vector<int> fill(adj_start.begin(), adj_start.end() - 1);
+    adj.resize(2 * edges.size());
+    for ( auto& e : edges ) {
+        adj[fill[e.first]++] = e.second;
+        adj[fill[e.second]++] = e.first;
+    }
+    return routers > 0;
+}
+
+bool
+GenericRouteTable::build(bool updown, int root, std::string& error)
+{
+    int nodes = getNumRouters();
+    if ( nodes <= 0 ) {
+        error = "graph has no routers";
+        return false;
+    }
+    if ( root < 0 || root >= nodes ) {
+        error = "root " + std::to_string(root) + " is not a router";
+        return false;
+    }
+
+    // Every link has to be listed at both ends the same number of times
+    std::vector<std::pair<int,int> > fwd, rev;
+    fwd.reserve(adj.size());
+    rev.reserve(adj.size());
+    for ( int r = 0; r < nodes; r++ ) {
+        for ( int j = adj_start[r]; j < adj_start[r + 1]; j++ ) {
+            int s = adj[j];
+            if ( s < 0 || s >= nodes || s == r ) {
+                error = "bad link from router " + std::to_string(r) + " to " + std::to_string(s);
+                return false;
+            }
+            fwd.push_back(std::make_pair(r, s));
+            rev.push_back(std::make_pair(s, r));
+        }
+    }
+    std::sort(fwd.begin(), fwd.end());
+    std::sort(rev.begin(), rev.end());
+    if ( fwd != rev ) {
+        error = "links are not listed at both of their ends";
+        return false;
+    }
+
+    // BFS from the root gives the levels for up*/down* and the tree
+    // used for broadcasts
+    level.assign(nodes, -1);
+    parent.assign(nodes, -1);
+    std::vector<int> queue;
+    queue.reserve(nodes);
+    queue.push_back(root);
+    level[root] = 0;
+    for ( size_t i = 0; i < queue.size(); i++ ) {
+        int r = queue[i];
+        for ( int j = adj_start[r]; j < adj_start[r + 1]; j++ ) {
+            int s = adj[j];
+            if ( level[s] != -1 ) continue;
+            level[s] = level[r] + 1;
+            parent[s] = r;
+            queue.push_back(s);
+        }
+    }
+    if ( (int)queue.size() != nodes ) {
+        error = "graph is not connected";
+        return false;
+    }
+
+    // One BFS toward each destination.  For updown the search runs
+    // backwards over (router, phase) states: phase 0 may still go up,
+    // phase 1 has gone down and can only keep going down.
+    dist.assign((size_t)nodes * nodes, UNREACHABLE);
+    if ( updown ) down_dist.assign((size_t)nodes * nodes, UNREACHABLE);
+    diameter = 0;
+
+    std::vector<int> states;
+    states.reserve(updown ? 2 * nodes : nodes);
+    for ( int d = 0; d < nodes; d++ ) {
+        uint8_t* up = &dist[(size_t)d * nodes];
+        uint8_t* down = updown ? &down_dist[(size_t)d * nodes] : NULL;
+
+        states.clear();
+        up[d] = 0;
+        if ( updown ) {
+            down[d] = 0;
+            states.push_back(2 * d);
+            states.push_back(2 * d + 1);
+        }
+        else {
+            states.push_back(d);
+        }
+
+        for ( size_t i = 0; i < states.size(); i++ ) {
+            int y = updown ? states[i] / 2 : states[i];
+            bool went_down = updown && (states[i] & 1);
+            int next = (went_down ? down[y] : up[y]) + 1;
+            if ( next >= UNREACHABLE ) {
+                error = "a route is longer than " + std::to_string(UNREACHABLE - 1) + " hops";
+                return false;
+            }
+
+            for ( int j = adj_start[y]; j < adj_start[y + 1]; j++ ) {
+                int x = adj[j];
+                if ( !updown ) {
+                    if ( up[x] == UNREACHABLE ) {
+                        up[x] = next;
+                        states.push_back(x);
+                    }
+                    continue;
+                }
+
+                // Moves from x to y that end in the phase being expanded
+                bool up_link = isUpLink(x, y);
+                if ( up_link == went_down ) continue;
+                if ( up[x] == UNREACHABLE ) {
+                    up[x] = next;
+                    states.push_back(2 * x);
+                }
+                if ( went_down && down[x] == UNREACHABLE ) {
+                    down[x] = next;
+                    states.push_back(2 * x + 1);
+                }
+            }
+        }
+
+        for ( int r = 0; r < nodes; r++ ) {
+            if ( up[r] == UNREACHABLE ) {
+                error = "no route from router " + std::to_string(r) + " to router " + std::to_string(d);
+                return false;
+            }
+            diameter = std::max(diameter, (int)up[r]);
+        }
+    }
+    return true;
+}
+
+void
+GenericRouteTable::getTreeLinks(int router, std::vector<int>& list) const
+{
+    // Tree links use the first of any parallel links at both ends
+    list.clear();
+    int start = adj_start[router];
+    for ( int j = 0; j < getDegree(router); j++ ) {
+        int s = adj[start + j];
+        if ( s != parent[router] && parent[s] != router ) continue;
+        if ( std::find(adj.begin() + start, adj.begin() + start + j, s) != adj.begin() + start + j ) continue;
+        list.push_back(j);
+    }
+}
+
+size_t
+GenericRouteTable::getBytes() const
+{
+    return (adj_start.capacity() + adj.capacity() + level.capacity() + parent.capacity()) * sizeof(int) +
+        dist.capacity() + down_dist.capacity();
+}
+
+
+topo_generic::topo_generic(ComponentId_t cid, Params& params, int num_ports, int rtr_id, int num_vns) :
+    Topology(cid),
+    router_id(rtr_id),
+    num_vns(num_vns),
+    output_queue_lengths(NULL),
+    total_vcs(0)
+{
+    hosts_per_router = params.find<int>("hosts_per_router", 1);
+
+    std::string graph_file = params.find<std::string>("graph_file");
+    if ( graph_file == "" ) {
+        output.fatal(CALL_INFO, -1, "generic: graph_file must be specified\n");
+    }
+
+    std::string format = params.find<std::string>("graph_format", "adjacency");
+    if ( format != "adjacency" && format != "edgelist" ) {
+        output.fatal(CALL_INFO, -1, "generic: unknown graph_format: %s\n", format.c_str());
+    }
+
+    std::string algo = params.find<std::string>("algorithm", "updown");
+    if ( algo == "updown" ) updown = true;
+    else if ( algo == "shortest" ) updown = false;
+    else output.fatal(CALL_INFO, -1, "generic: unknown routing algorithm: %s\n", algo.c_str());
+
+    std::string select = params.find<std::string>("path_select", "ecmp");
+    if ( select == "ecmp" ) adaptive = false;
+    else if ( select == "adaptive" ) adaptive = true;
+    else output.fatal(CALL_INFO, -1, "generic: unknown path_select: %s\n", select.c_str());
+
+    std::string error;
+    table = GenericRouteTable::get(graph_file, format, updown, params.find<int>("root", 0), error);
+    if ( table == NULL ) {
+        output.fatal(CALL_INFO, -1, "generic: %s\n", error.c_str());
+    }
+    if ( router_id >= table->getNumRouters() ) {
+        output.fatal(CALL_INFO, -1, "generic: router %d is not in the %d router graph in %s\n",
+                     router_id, table->getNumRouters(), graph_file.c_str());
+    }
+
+    degree = table->getDegree(router_id);
+    if ( hosts_per_router + degree > 0xffff ) {
+        output.fatal(CALL_INFO, -1, "generic: router %d has more than 65535 ports\n", router_id);
+    }
+    if ( num_ports < hosts_per_router + degree ) {
+        output.fatal(CALL_INFO, -1, "generic: router %d needs at least %d ports\n", router_id, hosts_per_router + degree);
+    }
+
+    // Hop count layering needs one VC for every hop of the longest
+    // shortest path.  up*/down* paths can't form cycles, so one is enough.
+    vcs_per_vn_count = updown ? 1 : std::max(table->getDiameter(), 1);
+
+    std::vector<int> tree_links;
+    table->getTreeLinks(router_id, tree_links);
+    for ( int j : tree_links ) tree_ports.push_back(hosts_per_router + j);
+
+    buildPortLists();
+
+    hop_count = registerStatistic<uint32_t>("hop_count");
+}
+
+topo_generic::~topo_generic()
+{
+}
+
+void
+topo_generic::setup()
+{
+    if ( router_id == 0 ) {
+        output.output("generic: %d routers, diameter %d, shared tables use %zu KiB, router 0 port lists use %zu KiB\n",
+                      table->getNumRouters(), table->getDiameter(), table->getBytes() / 1024,
+                      ((up_start.capacity() + down_start.capacity()) * sizeof(uint32_t) +
+                       (up_ports.capacity() + down_ports.capacity()) * sizeof(uint16_t)) / 1024);
+    }
+}
+
+void
+topo_generic::buildPortLists()
+{
+    int nodes = table->getNumRouters();
+
+    if ( updown ) {
+        port_is_up.resize(degree);
+        for ( int j = 0; j < degree; j++ ) port_is_up[j] = table->isUp(router_id, j);
+    }
+
+    // A neighbor is on a minimal path if it is one hop closer to the
+    // destination.  For updown, up links lead to up distances and down
+    // links to down distances.
+    up_start.resize(nodes + 1);
+    if ( updown ) down_start.resize(nodes + 1);
+    for ( int d = 0; d < nodes; d++ ) {
+        up_start[d] = up_ports.size();
+        if ( updown ) down_start[d] = down_ports.size();
+        if ( d == router_id ) continue;
+
+        int up_dist = table->getDist(d, router_id);
+        int down_dist = updown ? table->getDownDist(d, router_id) : 0;
+        for ( int j = 0; j < degree; j++ ) {
+            int n = table->getNeighbor(router_id, j);
+            uint16_t port = hosts_per_router + j;
+            if ( !updown ) {
+                if ( table->getDist(d, n) == up_dist - 1 ) up_ports.push_back(port);
+            }
+            else if ( port_is_up[j] ) {
+                if ( table->getDist(d, n) == up_dist - 1 ) up_ports.push_back(port);
+            }
+            else {
+                int n_down = table->getDownDist(d, n);
+                if ( n_down == up_dist - 1 ) up_ports.push_back(port);
+                if ( n_down == down_dist - 1 ) down_ports.push_back(port);
+            }
+        }
+    }
+    up_start[nodes] = up_ports.size();
+    if ( updown ) down_start[nodes] = down_ports.size();
+}
+
+void
+topo_generic::setOutputQueueLengthsArray(int const* array, int vcs)
+{
+    output_queue_lengths = array;
+    total_vcs = vcs;
+}
+
+static inline uint32_t
+hashFlow(uint64_t src, uint64_t dest, uint64_t rtr)
+{
+    uint64_t h = (src << 32) ^ dest ^ (rtr * 0x9e3779b97f4a7c15ULL);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return (uint32_t)h;
+}
+
+int
+topo_generic::selectPort(const uint16_t* ports, int count, internal_router_event* ev, int out_vc)
+{
+    if ( count == 1 ) return ports[0];
+
+    // ECMP keeps a flow on one path.  Adaptive takes the shortest
+    // output queue and uses the hash order to break ties.
+    int start = hashFlow(ev->getSrc(), ev->getDest(), router_id) % count;
+    if ( !adaptive || output_queue_lengths == NULL ) return ports[start];
+
+    int best = ports[start];
+    int best_len = output_queue_lengths[best * total_vcs + out_vc];
+    for ( int i = 1; i < count; i++ ) {
+        int port = ports[(start + i) % count];
+        int len = output_queue_lengths[port * total_vcs + out_vc];
+        if ( len < best_len ) {
+            best = port;
+            best_len = len;
+        }
+    }
+    return best;
+}
+
+void
+topo_generic::route_packet(int port, int vc, internal_router_event* ev)
+{
+    topo_generic_event* tt_ev = static_cast<topo_generic_event*>(ev);
+
+    int dest_router = tt_ev->getDest() / hosts_per_router;
+    if ( dest_router == router_id ) {
+        // Deliver on the VC the packet arrived on
+        hop_count->addData(tt_ev->hops);
+        tt_ev->setNextPort(tt_ev->getDest() % hosts_per_router);
+        return;
+    }
+
+    const uint16_t* ports;
+    int count;
+    if ( updown && tt_ev->down ) {
+        ports = &down_ports[down_start[dest_router]];
+        count = down_start[dest_router + 1] - down_start[dest_router];
+    }
+    else {
+        ports = &up_ports[up_start[dest_router]];
+        count = up_start[dest_router + 1] - up_start[dest_router];
+    }
+
+    int out_vc = tt_ev->getVN() * vcs_per_vn_count;
+    if ( !updown ) out_vc += tt_ev->hops;
+
+    int out_port = selectPort(ports, count, ev, out_vc);
+    if ( updown && !port_is_up[out_port - hosts_per_router] ) tt_ev->down = true;
+    tt_ev->hops++;
+
+    tt_ev->setNextPort(out_port);
+    tt_ev->setVC(out_vc);
+}
+
+internal_router_event*
+topo_generic::process_input(RtrEvent* ev)
+{
+    topo_generic_event* tt_ev = new topo_generic_event();
+    tt_ev->setEncapsulatedEvent(ev);
+    tt_ev->setVC(tt_ev->getVN() * vcs_per_vn_count);
+    return tt_ev;
+}
+
+void
+topo_generic::routeUntimedData(int port, internal_router_event* ev, std::vector<int> &outPorts)
+{
+    if ( ev->getDest() == UNTIMED_BROADCAST_ADDR ) {
+        // Flood along the BFS tree, which reaches every router once
+        for ( int i = 0; i < hosts_per_router; i++ ) {
+            if ( i != port ) outPorts.push_back(i);
+        }
+        for ( int p : tree_ports ) {
+            if ( p != port ) outPorts.push_back(p);
+        }
+    }
+    else {
+        route_packet(port, 0, ev);
+        outPorts.push_back(ev->getNextPort());
+    }
+}
+
+internal_router_event*
+topo_generic::process_UntimedData_input(RtrEvent* ev)
+{
+    topo_generic_event* tt_ev = new topo_generic_event();
+    tt_ev->setEncapsulatedEvent(ev);
+    return tt_ev;
+}
+
+Topology::PortState
+topo_generic::getPortState(int port) const
+{
+    if ( port < hosts_per_router ) return R2N;
+    if ( port < hosts_per_router + degree ) return R2R;
+    return UNCONNECTED;
+}
+
+int
+topo_generic::getEndpointID(int port)
+{
+    if ( port < hosts_per_router ) return router_id * hosts_per_router + port;
+    return -1;
+}
@@ -0,0 +1,207 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TOPOLOGY_GENERIC_H
+#define COMPONENTS_MERLIN_TOPOLOGY_GENERIC_H
+
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/params.h>
+
+#include <stdint.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+
+namespace SST {
+namespace Merlin {
+
+class topo_generic_event : public internal_router_event {
+public:
+    int hops;       // Router to router hops taken so far
+    bool down;      // up*/down*: packet has taken a down link
+
+    topo_generic_event() : hops(0), down(false) {}
+    virtual ~topo_generic_event() {}
+
+    virtual internal_router_event* clone(void) override
+    {
+        return new topo_generic_event(*this);
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        internal_router_event::serialize_order(ser);
+        SST_SER(hops);
+        SST_SER(down);
+    }
+
+private:
+    ImplementSerializable(SST::Merlin::topo_generic_event)
+};
+
+
+/*
+ * Router graph and distance tables for the generic topology
+ *
+ * Built once per process for each graph file, routing algorithm and
+ * root, and shared by all the routers in the process.  Router r's
+ * ports to other routers follow its adjacency list, so the j-th
+ * neighbor of r is on port hosts_per_router + j.  A pair of routers
+ * may be listed more than once; the k-th entry of s in r's list and
+ * the k-th entry of r in s's list are the same link.
+ *
+ * Distances are kept per destination as one byte per router:
+ *  - shortest: dist is the hop count of a shortest path.
+ *  - updown:   routers are ordered by BFS level from the root, ties
+ *              broken by id, and a link toward a lower (level, id) is
+ *              up.  up_dist is the length of the shortest path that
+ *              takes some up links and then only down links, down_dist
+ *              the length of the shortest path of only down links.
+ */
+class GenericRouteTable {
+public:
+    static constexpr uint8_t UNREACHABLE = 0xff;
+
+    // Returns the shared table, building it on first use.  On failure
+    // returns NULL and sets error.
+    static GenericRouteTable* get(const std::string& filepath, const std::string& format,
+                                  bool updown, int root, std::string& error);
+
+    int getNumRouters() const { return adj_start.size() - 1; }
+    int getDegree(int router) const { return adj_start[router + 1] - adj_start[router]; }
+    int getNeighbor(int router, int j) const { return adj[adj_start[router] + j]; }
+    int getDiameter() const { return diameter; }
+
+    // updown: true if the link from router to its j-th neighbor is up
+    bool isUp(int router, int j) const { return isUpLink(router, getNeighbor(router, j)); }
+
+    uint8_t getDist(int dest, int router) const { return dist[(size_t)dest * getNumRouters() + router]; }
+    uint8_t getDownDist(int dest, int router) const { return down_dist[(size_t)dest * getNumRouters() + router]; }
+
+    // Neighbor indices of the links of the BFS spanning tree at router
+    void getTreeLinks(int router, std::vector<int>& list) const;
+
+    size_t getBytes() const;
+
+private:
+    std::vector<int> adj_start;     // CSR adjacency
+    std::vector<int> adj;
+    std::vector<int> level;         // BFS level from the root
+    std::vector<int> parent;        // BFS tree parent, -1 at the root
+    std::vector<uint8_t> dist;      // [dest][router], up_dist for updown
+    std::vector<uint8_t> down_dist; // [dest][router], updown only
+    int diameter;
+
+    bool loadAdjacency(const std::string& filepath);
+    bool loadEdgeList(const std::string& filepath);
+    bool build(bool updown, int root, std::string& error);
+
+    bool isUpLink(int from, int to) const {
+        return level[to] < level[from] || (level[to] == level[from] && to < from);
+    }
+
+    static std::mutex shared_lock;
+    static std::map<std::string, GenericRouteTable*> shared_tables;
+};
+
+
+class topo_generic: public Topology {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        topo_generic,
+        "merlin",
+        "generic",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Topology object for an arbitrary router graph read from a file",
+        SST::Merlin::Topology)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"graph_file",       "File describing the router graph."},
+        {"graph_format",     "Format of graph_file: adjacency (a \"routers links\" line, then one line of neighbors per router) or edgelist (one \"router router\" line per link, # starts a comment).", "adjacency"},
+        {"hosts_per_router", "Number of endpoints attached to each router.  They use the lowest numbered ports.", "1"},
+        {"algorithm",        "Deadlock free routing: updown (up*/down* over a BFS tree, one VC per VN) or shortest (all shortest paths, one VC per hop up to the diameter).", "updown"},
+        {"path_select",      "How to choose among the allowed output ports: ecmp (hash of source and destination) or adaptive (shortest output queue).", "ecmp"},
+        {"root",             "Root router of the BFS tree used for up*/down* and broadcasts.", "0"},
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "hop_count",     "Number of router to router hops taken by each packet delivered at this router", "hops", 1}
+    )
+
+    topo_generic(ComponentId_t cid, Params& params, int num_ports, int rtr_id, int num_vns);
+    ~topo_generic();
+
+    void setup() override;
+
+    virtual void route_packet(int port, int vc, internal_router_event* ev);
+    virtual internal_router_event* process_input(RtrEvent* ev);
+
+    virtual void routeUntimedData(int port, internal_router_event* ev, std::vector<int> &outPorts);
+    virtual internal_router_event* process_UntimedData_input(RtrEvent* ev);
+
+    virtual PortState getPortState(int port) const;
+    virtual int getEndpointID(int port);
+
+    virtual void setOutputQueueLengthsArray(int const* array, int vcs);
+
+    virtual void getVCsPerVN(std::vector<int>& vcs_per_vn) {
+        for ( int i = 0; i < num_vns; ++i ) {
+            vcs_per_vn[i] = vcs_per_vn_count;
+        }
+    }
+
+private:
+    int router_id;
+    int hosts_per_router;
+    int num_vns;
+    int vcs_per_vn_count;
+    bool updown;
+    bool adaptive;
+
+    GenericRouteTable* table;
+    int degree;
+    std::vector<int> tree_ports;
+
+    // Allowed output ports for each destination router, CSR by
+    // destination.  For updown the up lists are for packets that may
+    // still take up links and the down lists for packets that can't.
+    std::vector<uint32_t> up_start;
+    std::vector<uint16_t> up_ports;
+    std::vector<uint32_t> down_start;
+    std::vector<uint16_t> down_ports;
+    std::vector<bool> port_is_up;
+
+    int const* output_queue_lengths;
+    int total_vcs;
+
+    Statistic<uint32_t>* hop_count;
+
+    void buildPortLists();
+    int selectPort(const uint16_t* ports, int count, internal_router_event* ev, int out_vc);
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_TOPOLOGY_GENERIC_H
@@ -0,0 +1,137 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "polar_route_table.h"
+
+#include <fstream>
+#include <sstream>
+
+using namespace SST::Merlin;
+
+std::mutex PolarRouteTable::shared_lock;
+std::map<std::string, PolarRouteTable*> PolarRouteTable::shared_tables;
+
+bool
+PolarRouteTable::load(const std::string& filepath)
+{
+    std::ifstream fp(filepath.c_str());
+    if ( !fp.is_open() ) return false;
+
+    // First line is the number of vertices and edges, then one line
+    // per vertex listing its neighbors
+    std::string line;
+    int fV = 0, fE = 0, v;
+    if ( std::getline(fp, line) ) {
+        std::istringstream iss(line);
+        iss >> fV >> fE;
+    }
+
+    adj_start.clear();
+    adj.clear();
+    adj.reserve(2 * fE);
+    adj_start.push_back(0);
+    while ( std::getline(fp, line) ) {
+        std::istringstream iss(line);
+        while ( iss >> v ) adj.push_back(v);
+        adj_start.push_back(adj.size());
+    }
+
+    if ( getNumRouters() != fV ) return false;
+    rows.resize(fV);
+    return true;
+}
+
+PolarRouteTable*
+PolarRouteTable::getShared(const std::string& filepath)
+{
+    std::lock_guard<std::mutex> guard(shared_lock);
+    PolarRouteTable*& table = shared_tables[filepath];
+    if ( table == NULL ) {
+        PolarRouteTable* t = new PolarRouteTable();
+        if ( !t->load(filepath) ) {
+            delete t;
+            shared_tables.erase(filepath);
+            return NULL;
+        }
+        table = t;
+    }
+    return table;
+}
+
+bool
+PolarRouteTable::computeRow(int router, uint16_t* row) const
+{
+    int nodes = getNumRouters();
+    for ( int i = 0; i < nodes; i++ ) row[i] = NO_ROUTE;
+
+    std::vector<int> frontier;
+    std::vector<int> nxt;
+
+    // 1-hop neighbors go out their own port
+    int node_links = adj_start[router + 1] - adj_start[router];
+    for ( int j = 0; j < node_links; j++ ) {
+        int neighbor = adj[adj_start[router] + j];
+        row[neighbor] = j;
+        frontier.push_back(neighbor);
+    }
+
+    // Everything else goes out the port its BFS parent was reached on
+    while ( frontier.size() > 0 ) {
+        for ( int v : frontier ) {
+            uint16_t pId = row[v];
+            for ( int j = adj_start[v]; j < adj_start[v + 1]; j++ ) {
+                int neighbor = adj[j];
+                if ( row[neighbor] == NO_ROUTE && neighbor != router ) {
+                    row[neighbor] = pId;
+                    nxt.push_back(neighbor);
+                }
+            }
+        }
+        frontier.swap(nxt);
+        nxt.clear();
+    }
+
+    for ( int i = 0; i < nodes; i++ ) {
+        if ( i != router && row[i] == NO_ROUTE ) return false;
+    }
+    return true;
+}
+
+const uint16_t*
+PolarRouteTable::getRow(int router)
+{
+    // Each router only builds its own row, so no locking is needed
+    std::vector<uint16_t>& row = rows[router];
+    if ( row.empty() ) {
+        row.resize(getNumRouters());
+        if ( !computeRow(router, row.data()) ) return NULL;
+    }
+    return row.data();
+}
+
+size_t
+PolarRouteTable::getGraphBytes() const
+{
+    return (adj_start.capacity() + adj.capacity()) * sizeof(int);
+}
+
+size_t
+PolarRouteTable::getRowBytes() const
+{
+    size_t bytes = rows.capacity() * sizeof(std::vector<uint16_t>);
+    for ( const std::vector<uint16_t>& row : rows ) bytes += row.capacity() * sizeof(uint16_t);
+    return bytes;
+}
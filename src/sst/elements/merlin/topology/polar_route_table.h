@@ -0,0 +1,89 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TOPOLOGY_POLAR_ROUTE_TABLE_H
+#define COMPONENTS_MERLIN_TOPOLOGY_POLAR_ROUTE_TABLE_H
+
+#include <stdint.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Router graph and minimal routing tables for polarfly and polarstar
+ *
+ * The graph is read from the same data files the topologies use.  A
+ * route row for router r has one entry per router in the network
+ * giving the index, in r's neighbor list, of the first hop of a
+ * shortest path to that router.
+ *
+ * Topologies either load a private copy to build their own row and
+ * then drop it, or use getShared(), which reads each file once per
+ * process and keeps every row built from it so routers in the same
+ * process share one graph and one table.
+ */
+class PolarRouteTable {
+public:
+    static constexpr uint16_t NO_ROUTE = 0xffff;
+
+    PolarRouteTable() {}
+
+    // Returns false if the file can't be read
+    bool load(const std::string& filepath);
+
+    // Shared table for filepath, loaded on first use.  Returns NULL if
+    // the file can't be read.
+    static PolarRouteTable* getShared(const std::string& filepath);
+
+    int getNumRouters() const { return adj_start.size() - 1; }
+
+    void getNeighbors(int router, std::vector<int>& list) const {
+        list.assign(adj.begin() + adj_start[router], adj.begin() + adj_start[router + 1]);
+    }
+
+    // Fills row, which must hold getNumRouters() entries.  Returns
+    // false if some router can't be reached.
+    bool computeRow(int router, uint16_t* row) const;
+
+    // Row kept in the table.  Built on the first call for each router.
+    // Calls for different routers may come from different threads.
+    // Returns NULL if some router can't be reached.
+    const uint16_t* getRow(int router);
+
+    // Bytes used by the graph and by the rows built so far
+    size_t getGraphBytes() const;
+    size_t getRowBytes() const;
+
+private:
+    std::vector<int> adj_start;     // CSR adjacency
+    std::vector<int> adj;
+    std::vector<std::vector<uint16_t> > rows;
+
+    static std::mutex shared_lock;
+    static std::map<std::string, PolarRouteTable*> shared_tables;
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_TOPOLOGY_POLAR_ROUTE_TABLE_H
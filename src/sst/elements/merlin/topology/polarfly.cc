@@ -18,6 +18,7 @@ using namespace SST::Merlin;
 topo_polarfly::topo_polarfly(ComponentId_t cid, Params& params, int num_ports, int rtr_id, int num_vns) :
     Topology(cid),
     router_id(rtr_id),
+    shared_table(NULL),
     num_vns(num_vns)
 {
     //Get the various parameters
@@ -56,12 +57,8 @@ topo_polarfly::topo_polarfly(ComponentId_t cid, Params& params, int num_ports, i
         output.fatal(CALL_INFO, -1, "Number of ports should be at least %d for this configuration\n", total_radix);
     }
 
-    /* first generate the polar graph, so that we can get the number of
-     nodes and links to set the globals */
-    initPolarGraph();
-
-    /* Initialize the routing table*/
-    initRouteTable();
+    /* Read the polar graph and initialize the routing table */
+    initRouteTable(params.find<bool>("shared_route_table", false));
 
     /* Initialize the hopcount_map statistic
      * For now, doing it in a dumb way, should figure out an error-free way to create a vector array of statistics*/
@@ -77,6 +74,15 @@ topo_polarfly::topo_polarfly(ComponentId_t cid, Params& params, int num_ports, i
 topo_polarfly::~topo_polarfly(){
 }
 
+void
+topo_polarfly::setup()
+{
+    if ( shared_table && router_id == 0 ) {
+        output.output("polarfly: shared routing table uses %zu KiB for rows and %zu KiB for the graph\n",
+                      shared_table->getRowBytes() / 1024, shared_table->getGraphBytes() / 1024);
+    }
+}
+
 void
 topo_polarfly::setOutputBufferCreditArray(int const* array, int vcs)
 {
@@ -94,12 +100,10 @@ topo_polarfly::setOutputQueueLengthsArray(int const* array, int vcs)
 
 bool topo_polarfly::isNeighbor(int node)
 {
-    for (int i=0; i<node_links; i++)
-    {
-        if (neighbor_list[i]==node)
-            return true;
-    }
-    return false;
+    // The table sends a packet for a neighbor straight to it
+    if (node == router_id)
+        return false;
+    return neighbor_list[route_table[node]]==node;
 }
 
 void topo_polarfly::route_packet(int port, int vc, internal_router_event* ev){
@@ -221,99 +225,42 @@ void topo_polarfly::routeValiant(int port, int vc, internal_router_event* ev){
 }
 
 
-void topo_polarfly::initPolarGraph() {
+void topo_polarfly::initRouteTable(bool shared) {
     //Read polarfly topology from file
     char dir[256];
     (void) !getcwd(dir, 256);
     std::string filepath    = std::string(dir) + "/polarfly_data/PolarFly.q_" + std::to_string(this->q) + ".txt";
 
-    std::fstream fp;
-    fp.open(filepath.c_str(), std::ios::in);
+    // route_table[j] contains the port link from current router to router/node j (could be 1 hop or 2 hop)
+    PolarRouteTable local;
+    PolarRouteTable* graph  = &local;
+    if (shared)
+        graph   = shared_table  = PolarRouteTable::getShared(filepath);
+    else if (!local.load(filepath))
+        graph   = NULL;
 
-    std::string line;
-    int line_no = 0;
-    int fV, fE, v;
-    while(std::getline(fp, line))
-    {
-        std::istringstream iss(line);
-        if (line_no == 0)
-        {
-            iss>>fV;
-            iss>>fE;
-        }
-        else
-        {
-            this->polar.push_back(std::vector<int>());
-            int u   = line_no - 1;
-            while(iss >> v)
-                this->polar[u].push_back(v);
-        }
-        line_no += 1;
-    }
-    fp.close();
-
-    assert(fV==this->total_routers);
-}
+    if (graph == NULL || graph->getNumRouters() != this->total_routers)
+        output.fatal(CALL_INFO, -1, "Unable to read a %d router polarfly graph from %s\n", this->total_routers, filepath.c_str());
 
+    graph->getNeighbors(router_id, neighbor_list);
+    node_links      = neighbor_list.size();
 
-void topo_polarfly::initRouteTable() {
-
-    int i, j, k, neighbor;
-    int links, neighbor_links, NODES;
-
-    NODES           = this->total_routers;
-
-    /* allocate the routing tables */
-    route_table.resize(NODES); // route_table[j] contains the port link from current router to router/node j (could be 1 hop or 2 hop)
-    node_links      = polar[router_id].size();
-
-    for( i = 0; i < NODES; i++ )
-        route_table[i]          = -1;
-    neighbor_list.resize(node_links);
-    neighbor_list.assign(polar[router_id].begin(), polar[router_id].end());
-
-    /* initialize the routing table */
-    for( i = 0; i < node_links; i++)
-    {
-        // 1-hop neighbor
-        neighbor                = polar[router_id][i];
-        route_table[neighbor]   = i;
-        neighbor_links          = polar[neighbor].size();
-    }
-    for( i = 0; i < node_links; i++)
+    if (shared)
+        route_table = shared_table->getRow(router_id);
+    else
     {
-        neighbor                = polar[router_id][i];
-        neighbor_links          = polar[neighbor].size();
-        for( j = 0; j < neighbor_links; j++)
-        {
-            // 2-hop neighbors, not already covered
-            int neigh2          = polar[neighbor][j];
-
-            if (route_table[neigh2]<0 && neigh2!=router_id)
-                route_table[neigh2] = i;
-        }
+        own_route_table.resize(total_routers);
+        route_table = local.computeRow(router_id, own_route_table.data()) ? own_route_table.data() : NULL;
     }
 
     /* make sure the table is properly built */
-    for( i = 0; i < NODES; i++ )
+    if (route_table == NULL)
+        output.fatal(CALL_INFO, -1, "polarfly graph in %s is not connected\n", filepath.c_str());
+    for(int i = 0; i < total_routers; i++ )
     {
 	    if ( i != router_id )
-        {
-	        assert(route_table[i] >= 0);
             assert(route_table[i] < node_links);
-        }
-	    else
-	        assert( route_table[i] == -1 );
-    }
-
-    //Free memory associated with graph topology
-    for( i = 0; i < NODES; i++)
-    {
-        std::vector<int> tmp;
-        polar[i].swap(tmp);
     }
-    std::vector<std::vector<int>> tmp;
-    polar.swap(tmp);
 }
 
 
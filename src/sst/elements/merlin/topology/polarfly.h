@@ -24,6 +24,7 @@
 #include <sstream>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/topology/polar_route_table.h"
 
 
 namespace SST {
@@ -122,6 +123,7 @@ public:
         {"total_radix", "Radix of the router."},
         {"total_routers", "Number of total routers in the network."},
         {"total_endnodes", "Number of total endpoints in the network."},
+        {"shared_route_table", "Read the graph once per process and keep the routing tables of all routers in one shared table.", "false"},
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -149,7 +151,9 @@ public:
 
     //network radix of router
     int node_links;
-    std::vector<int> route_table; //output port for each destination
+    const uint16_t* route_table; //output port for each destination
+    std::vector<uint16_t> own_route_table; //storage for route_table when not shared
+    PolarRouteTable* shared_table;
     std::vector<int> neighbor_list; //all neighbors of current router
 
     int num_vns;
@@ -161,8 +165,6 @@ public:
     int output_buffer_size;
     int adaptive_bias;
 
-    std::vector<std::vector<int>> polar;
-
     //For now, doing this in a very dumb way, need to figure out a right way to do it with an vector array of statistics
     Statistic<uint32_t>* hopcount1;
     Statistic<uint32_t>* hopcount2;
@@ -174,6 +176,8 @@ public:
     topo_polarfly(ComponentId_t cid, Params& params, int num_ports, int rtr_id, int num_vns);
     ~topo_polarfly();
 
+    void setup() override;
+
     virtual void route_packet(int port, int vc, internal_router_event* ev);
     //called at injection, add metadata about packet
     virtual internal_router_event* process_input(RtrEvent* ev);
@@ -205,8 +209,7 @@ private:
    void routeUgal(int port, int vc, internal_router_event* ev);
    void routeUgalpf(int port, int vc, internal_router_event* ev);
 
-   void initPolarGraph();
-   void initRouteTable();
+   void initRouteTable(bool shared);
 
    int getRouterID(int endpoint);
    int getDestLocalPort(int node);
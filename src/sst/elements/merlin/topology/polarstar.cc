@@ -17,6 +17,7 @@ using namespace SST::Merlin;
 topo_polarstar::topo_polarstar(ComponentId_t cid, Params& params, int num_ports, int rtr_id, int num_vns) :
     Topology(cid),
     router_id(rtr_id),
+    shared_table(NULL),
     num_vns(num_vns)
 {
 
@@ -62,14 +63,8 @@ topo_polarstar::topo_polarstar(ComponentId_t cid, Params& params, int num_ports,
         output.fatal(CALL_INFO, -1, "Number of ports should be at least %d for this configuration\n", total_radix);
     }
 
-    /* first generate the polar graph, so that we can get the number of
-     nodes and links to set the globals */
-    initPolarGraph();
-
-    assert(total_routers == polar.size());
-
-    /* Initialize the routing table*/
-    initRouteTable();
+    /* Read the polar graph and initialize the routing table */
+    initRouteTable(params.find<bool>("shared_route_table", false));
 
     /* Initialize the hopcount_map statistic
      * For now, doing it in a dumb way, should figure out an error-free way to create a vector array of statistics*/
@@ -89,6 +84,15 @@ topo_polarstar::topo_polarstar(ComponentId_t cid, Params& params, int num_ports,
 topo_polarstar::~topo_polarstar(){
 }
 
+void
+topo_polarstar::setup()
+{
+    if ( shared_table && router_id == 0 ) {
+        output.output("polarstar: shared routing table uses %zu KiB for rows and %zu KiB for the graph\n",
+                      shared_table->getRowBytes() / 1024, shared_table->getGraphBytes() / 1024);
+    }
+}
+
 void topo_polarstar::route_packet(int port, int vc, internal_router_event* ev){
 
     if (routing_algo == MINIMAL) return routeMinimal(port,vc,ev);
@@ -285,7 +289,7 @@ void topo_polarstar::routeUgal(int port, int vc, internal_router_event* ev){
 
 
 
-void topo_polarstar::initPolarGraph() {
+void topo_polarstar::initRouteTable(bool shared) {
     char dir[256];
     (void) !getcwd(dir, 256);
     std::string filepath    = std::string(dir) + "/polarstar_data/PolarStar.d_" +
@@ -293,101 +297,36 @@ void topo_polarstar::initPolarGraph() {
                             + "_sn_" + this->sn_type +
                             "_snq_" + std::to_string(this->snq) + ".txt";
 
-    std::fstream fp;
-    fp.open(filepath.c_str(), std::ios::in);
-
-    std::string line;
-    int line_no = 0;
-    int fV, fE, v;
-    while(std::getline(fp, line))
-    {
-        std::istringstream iss(line);
-        if (line_no == 0)
-        {
-            iss>>fV;
-            iss>>fE;
-        }
-        else
-        {
-            this->polar.push_back(std::vector<int>());
-            int u   = line_no - 1;
-            while(iss >> v)
-                this->polar[u].push_back(v);
-        }
-        line_no += 1;
-    }
-    fp.close();
-}
-
-
-void topo_polarstar::initRouteTable() {
+    // route_table[j] contains the port link from current router to router/node j
+    PolarRouteTable local;
+    PolarRouteTable* graph  = &local;
+    if (shared)
+        graph   = shared_table  = PolarRouteTable::getShared(filepath);
+    else if (!local.load(filepath))
+        graph   = NULL;
 
-    int i, j, k, neighbor, links, NODES;
+    if (graph == NULL || graph->getNumRouters() != this->total_routers)
+        output.fatal(CALL_INFO, -1, "Unable to read a %d router polarstar graph from %s\n", this->total_routers, filepath.c_str());
 
-    NODES = this->total_routers;
+    graph->getNeighbors(router_id, neighbor_list);
+    node_links      = neighbor_list.size();
 
-    /* allocate the routing tables */
-    route_table.resize(NODES); // route_table[j] contains the port link from current router to router/node j (could be 1 hop or 2 hop)
-    node_links      = polar[router_id].size();
-
-    for( i = 0; i < NODES; i++ )
-        route_table[i]  = -1;
-    neighbor_list.resize(node_links);
-    neighbor_list.assign(polar[router_id].begin(), polar[router_id].end());
-
-    std::vector<int> frontier;
-    std::vector<int> nxt;
-
-    /* initialize the routing table */
-    for (j = 0; j < node_links; j++)
-    {
-        neighbor                = polar[router_id][j];
-        route_table[neighbor]   = j;
-        frontier.push_back(neighbor);
-    }
-    while(frontier.size()>0)
+    if (shared)
+        route_table = shared_table->getRow(router_id);
+    else
     {
-        int fs      = frontier.size();
-        for (i=0; i<fs; i++)
-        {
-            int v       = frontier[i];
-            int pId     = route_table[v]; assert(pId >= 0);
-            links       = polar[v].size();
-
-            for (j=0; j<links; j++)
-            {
-                neighbor    = polar[v][j];
-                if ((route_table[neighbor] < 0) && (neighbor != router_id))
-                {
-                    route_table[neighbor]   = pId;
-                    nxt.push_back(neighbor);
-                }
-            }
-        }
-        frontier.swap(nxt);
-        nxt.clear();
+        own_route_table.resize(total_routers);
+        route_table = local.computeRow(router_id, own_route_table.data()) ? own_route_table.data() : NULL;
     }
 
     /* make sure the table is properly built */
-    for( i = 0; i < NODES; i++ )
+    if (route_table == NULL)
+        output.fatal(CALL_INFO, -1, "polarstar graph in %s is not connected\n", filepath.c_str());
+    for(int i = 0; i < total_routers; i++ )
     {
 	    if ( i != router_id )
-        {
-	        assert(route_table[i] >= 0);
             assert(route_table[i] < node_links);
-        }
-	    else
-	        assert( route_table[i] == -1 );
-    }
-
-    //Free memory associated with graph topology
-    for( i = 0; i < NODES; i++)
-    {
-        std::vector<int> tmp;
-        polar[i].swap(tmp);
     }
-    std::vector<std::vector<int>> tmp;
-    polar.swap(tmp);
 }
 
 //For now, while building the polarstar topology, we assume all local ports of the switch are connected to the endpoints
@@ -23,6 +23,7 @@
 #include <sstream>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/topology/polar_route_table.h"
 
 namespace SST {
 namespace Merlin {
@@ -122,6 +123,7 @@ public:
         {"total_radix", "Radix of the router."},
         {"total_routers", "Number of total routers in the network."},
         {"total_endnodes", "Number of total endpoints in the network."},
+        {"shared_route_table", "Read the graph once per process and keep the routing tables of all routers in one shared table.", "false"},
     )
     SST_ELI_DOCUMENT_STATISTICS(
         { "hopcount1",     "Number of packets with 1 switch hopcount", "hops", 0},
@@ -152,7 +154,9 @@ public:
     RouteAlgo routing_algo;
 
     int node_links;
-    std::vector<int> route_table;
+    const uint16_t* route_table;
+    std::vector<uint16_t> own_route_table;
+    PolarRouteTable* shared_table;
     std::vector<int> neighbor_list;
 
     int num_vns;
@@ -164,8 +168,6 @@ public:
     int output_buffer_size;
     int adaptive_bias;
 
-    std::vector<std::vector<int>> polar;
-
     //For now, doing this in a very dumb way, need to figure out a right way to do it with an vector array of statistics
     Statistic<uint32_t>* hopcount1;
     Statistic<uint32_t>* hopcount2;
@@ -180,6 +182,8 @@ public:
     topo_polarstar(ComponentId_t cid, Params& params, int num_ports, int rtr_id, int num_vns);
     ~topo_polarstar();
 
+    void setup() override;
+
     virtual void route_packet(int port, int vc, internal_router_event* ev);
     //called at injection, add metadata about packet
     virtual internal_router_event* process_input(RtrEvent* ev);
@@ -211,8 +215,7 @@ private:
    void routeValiant(int port, int vc, internal_router_event* ev);
    void routeUgal(int port, int vc, internal_router_event* ev);
 
-   void initPolarGraph();
-   void initRouteTable();
+   void initRouteTable(bool shared);
 
    int getRouterID(int endpoint);
    int getDestLocalPort(int node);
@@ -26,7 +26,7 @@ class topoDragonFly(Topology):
         self._declareClassVariables(["link_latency","host_link_latency","global_link_map"])
         self._declareParams("main",["hosts_per_router","routers_per_group","intergroup_links","intragroup_links",
                                     "num_groups","algorithm","adaptive_threshold","global_routes",
-                                    "config_failed_links","failed_links"])
+                                    "config_failed_links","failed_links","shared_route_table"])
         self.global_routes = "absolute"
         self._subscribeToPlatformParamSet("topology")
         self.intragroup_links = 1
@@ -154,16 +154,38 @@ class topoDragonFly(Topology):
         #########################
 
 
+        # Router templates that can simulate a whole group in one
+        # component get the intra-group links as a wiring list instead
+        # of SST links
+        grouped = hasattr(self.router, "instanceRouterGroup")
+        internal_links = []
+        if grouped:
+            for r in range(rpg):
+                for p in range(r + 1, rpg):
+                    for s in range(self.intragroup_links):
+                        internal_links.extend([r, self.hosts_per_router + (p - 1) * self.intragroup_links + s,
+                                               p, self.hosts_per_router + r * self.intragroup_links + s])
+
         router_num = 0
         nic_num = 0
         # GROUPS
         for g in range(self.num_groups):
+            if grouped:
+                grp = self.router.instanceRouterGroup("rtr_G%d"%g, rpg, num_ports, router_num, internal_links,
+                                                      internal_latency = self.link_latency)
             # GROUP ROUTERS
             for r in range(self.routers_per_group):
-                rtr = self._instanceRouter(num_ports,router_num)
+                if grouped:
+                    rtr = grp
+                    slot = r
+                    base = r * num_ports
+                else:
+                    rtr = self._instanceRouter(num_ports,router_num)
+                    slot = 0
+                    base = 0
 
                 # Insert the topology object
-                sub = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.dragonfly",0)
+                sub = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.dragonfly",slot)
                 self._applyStatisticsSettings(sub)
                 sub.addGlobalParamSet("params_%s"%self._instance_name)
                 sub.addParam("intergroup_per_router",intergroup_per_router)
@@ -177,7 +199,7 @@ class topoDragonFly(Topology):
                 for p in range(self.hosts_per_router):
                     link = sst.Link("link_g%dr%dh%d"%(g, r, p), self.host_link_latency)
 
-                    Buildable._instanceBuildableBackCompat(endpoint, rtr, "port%d"%port, nic_num, {}, link)
+                    Buildable._instanceBuildableBackCompat(endpoint, rtr, "port%d"%(base + port), nic_num, {}, link)
                     #link.setNoCut()
                     #rtr.addLink(link,"port%d"%port,self.host_link_latency)
                     nic_num = nic_num + 1
@@ -188,13 +210,14 @@ class topoDragonFly(Topology):
                         src = min(p,r)
                         dst = max(p,r)
                         for s in range(self.intragroup_links):
-                            rtr.addLink(getLink("link_g%dr%dr%ds%d"%(g, src, dst, s)), "port%d"%port, self.link_latency)
+                            if not grouped:
+                                rtr.addLink(getLink("link_g%dr%dr%ds%d"%(g, src, dst, s)), "port%d"%port, self.link_latency)
                             port = port + 1
 
                 for p in range(igpr):
                     link = getGlobalLink(g,r,p)
                     if link is not None:
-                        rtr.addLink(link,"port%d"%port, self.link_latency)
+                        rtr.addLink(link,"port%d"%(base + port), self.link_latency)
                     port = port +1
 
                 router_num = router_num + 1
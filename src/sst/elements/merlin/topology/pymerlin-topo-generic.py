@@ -0,0 +1,155 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+from sst.merlin.base import *
+
+import json
+import os
+
+# Router graph read from a file.  graph_format is one of:
+#   adjacency: "routers links" line, then one line of neighbors per router
+#   edgelist:  one "router router" line per link, # starts a comment
+#   json:      {"routers": N, "links": [[router, router], ...]}
+# JSON graphs are written out as an edge list in generic_data/ in the
+# current directory, which is what the routers read.
+class topoGeneric(Topology):
+    def __init__(self):
+        Topology.__init__(self)
+        self._declareClassVariables(["link_latency","host_link_latency","bundleEndpoints","_adj"])
+        self._declareParams("main",["graph_file","graph_format","hosts_per_router","algorithm","path_select","root"])
+        self._subscribeToPlatformParamSet("topology")
+
+    def getName(self):
+        return "Generic"
+
+    def setGraph(self, graph_file, hosts_per_router = 1, graph_format = None):
+        self.graph_file = graph_file
+        self.hosts_per_router = hosts_per_router
+        if graph_format is not None:
+            self.graph_format = graph_format
+
+    def _getFormat(self):
+        if self.graph_format is not None:
+            return self.graph_format
+        if self.graph_file.endswith(".json"):
+            return "json"
+        return "adjacency"
+
+    def _readEdgeList(self, lines):
+        edges = []
+        for line in lines:
+            fields = line.split('#')[0].split()
+            if fields:
+                edges.append((int(fields[0]), int(fields[1])))
+        return edges
+
+    def _makeAdjacency(self, routers, edges):
+        adj = [[] for _ in range(routers)]
+        for (u, v) in edges:
+            adj[u].append(v)
+            adj[v].append(u)
+        return adj
+
+    def _loadGraph(self):
+        if self._adj is not None:
+            return self._adj
+
+        if self.graph_file is None:
+            print("topoGeneric: graph_file must be set")
+            exit(1)
+
+        fmt = self._getFormat()
+        with open(self.graph_file) as f:
+            if fmt == "adjacency":
+                lines = f.read().splitlines()
+                routers = int(lines[0].split()[0])
+                self._adj = [[int(x) for x in line.split()] for line in lines[1:routers+1]]
+            elif fmt == "edgelist":
+                edges = self._readEdgeList(f)
+                routers = max(max(u, v) for (u, v) in edges) + 1
+                self._adj = self._makeAdjacency(routers, edges)
+            elif fmt == "json":
+                graph = json.load(f)
+                edges = [(int(u), int(v)) for (u, v) in graph["links"]]
+                routers = graph.get("routers", max(max(u, v) for (u, v) in edges) + 1)
+                self._adj = self._makeAdjacency(routers, edges)
+
+                # Hand the routers an edge list with the links in the same order
+                folder = os.getcwd() + "/generic_data/"
+                if not os.path.exists(folder):
+                    os.makedirs(folder)
+                name = folder + os.path.splitext(os.path.basename(self.graph_file))[0] + ".txt"
+                with open(name, "w") as out:
+                    for (u, v) in edges:
+                        print(u, v, file=out)
+                self.graph_file = name
+                self.graph_format = "edgelist"
+            else:
+                print("topoGeneric: unknown graph_format %s"%fmt)
+                exit(1)
+
+        return self._adj
+
+    def _getHostsPerRouter(self):
+        if self.hosts_per_router is None:
+            return 1
+        return int(self.hosts_per_router)
+
+    def getNumNodes(self):
+        return len(self._loadGraph()) * self._getHostsPerRouter()
+
+    def _build_impl(self, endpoint):
+        if self.host_link_latency is None:
+            self.host_link_latency = self.link_latency
+
+        adj = self._loadGraph()
+        hosts_per_router = self._getHostsPerRouter()
+
+        links = dict()
+        def getLink(rtr1, rtr2, num):
+            name = "link_%d_%d_%d"%(min(rtr1, rtr2), max(rtr1, rtr2), num)
+            if name not in links:
+                links[name] = sst.Link(name)
+            return links[name]
+
+        for r in range(len(adj)):
+            rtr = self._instanceRouter(hosts_per_router + len(adj[r]), r)
+
+            topology = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.generic")
+            self._applyStatisticsSettings(topology)
+            topology.addParams(self._getGroupParams("main"))
+
+            port = 0
+            for n in range(hosts_per_router):
+                nodeID = hosts_per_router * r + n
+                (ep, port_name) = endpoint.build(nodeID, {})
+                if ep:
+                    nicLink = sst.Link("nic_%d_%d"%(r, n))
+                    if self.bundleEndpoints:
+                       nicLink.setNoCut()
+                    nicLink.connect( (ep, port_name, self.host_link_latency), (rtr, "port%d"%port, self.host_link_latency) )
+                port = port+1
+
+            # The k-th link to a neighbor pairs with the neighbor's k-th
+            # link back, which is how the routers number parallel links
+            count = dict()
+            for neighbor in adj[r]:
+                num = count.get(neighbor, 0)
+                count[neighbor] = num + 1
+                rtr.addLink(getLink(r, neighbor, num), "port%d"%port, self.link_latency)
+                port = port+1
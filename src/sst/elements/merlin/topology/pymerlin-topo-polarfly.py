@@ -229,7 +229,7 @@ class topoPolarFly(Topology):
         self._declareClassVariables(["link_latency","host_link_latency","global_link_map","bundleEndpoints"])
         self._declareParams("main",["topo","q","hosts_per_router","network_radix","total_radix","total_routers",
                                     "total_endnodes","edge","name","algorithm","adaptive_threshold","global_routes","config_failed_links",
-                                    "failed_links", "GF", "vec_len"])
+                                    "failed_links","shared_route_table", "GF", "vec_len"])
         self.global_routes = "absolute"
         self._subscribeToPlatformParamSet("topology")
 
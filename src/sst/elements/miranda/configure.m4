@@ -8,5 +8,8 @@ AC_DEFUN([SST_miranda_CONFIG], [
   # Use global Stake check
   SST_CHECK_STAKE([],[],[AC_MSG_ERROR([Stake requests but could not be found])])
 
+  # Use LIBZ for compressed trace replay
+  SST_CHECK_LIBZ()
+
   AS_IF([test "$miranda_happy" = "yes"], [$1], [$2])
 ])
@@ -0,0 +1,169 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include <sst/core/params.h>
+#include <sst/core/unitAlgebra.h>
+#include <sst/elements/miranda/generators/tracereplaygen.h>
+
+#include <string.h>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+using namespace SST::Miranda;
+using namespace SST::MemHierarchy;
+
+TraceReplayGenerator::TraceReplayGenerator( ComponentId_t id, Params& params ) :
+	RequestGenerator(id, params), trace(nullptr), eof(false), next(0), started(false), firstTime(0), startCycle(0) {
+
+	const uint32_t verbose = params.find<uint32_t>("verbose", 0);
+	out = new Output("TraceReplayGenerator[@p:@l]: ", verbose, 0, Output::STDOUT);
+
+	const std::string traceFile = params.find<std::string>("trace_file", "");
+	if (traceFile.empty())
+		out->fatal(CALL_INFO, -1, "%s, Error: trace_file must be specified\n", getName().c_str());
+
+	const std::string timing = params.find<std::string>("replay_timing", "trace");
+	if (timing != "trace" && timing != "none")
+		out->fatal(CALL_INFO, -1, "%s, Error: replay_timing must be 'trace' or 'none', got '%s'\n", getName().c_str(), timing.c_str());
+	timed = (timing == "trace");
+	timeScale = params.find<double>("time_scale", 1.0);
+
+	remaining = params.find<uint64_t>("max_requests", 0);
+	limited = (remaining != 0);
+
+	size_t bufferRecords = params.find<size_t>("buffer_records", 4096);
+	buffer.reserve(bufferRecords ? bufferRecords : 1);
+
+	MemTraceHeader header;
+#ifdef HAVE_LIBZ
+	// gzread also reads uncompressed files
+	gzFile gz = gzopen(traceFile.c_str(), "rb");
+	if (!gz)
+		out->fatal(CALL_INFO, -1, "%s, Error: unable to open trace_file '%s'\n", getName().c_str(), traceFile.c_str());
+	trace = gz;
+	bool headerOk = gzread(gz, &header, sizeof(header)) == (int) sizeof(header);
+#else
+	FILE* file = fopen(traceFile.c_str(), "rb");
+	if (!file)
+		out->fatal(CALL_INFO, -1, "%s, Error: unable to open trace_file '%s'\n", getName().c_str(), traceFile.c_str());
+	trace = file;
+	bool headerOk = fread(&header, sizeof(header), 1, file) == 1;
+	if (headerOk && (uint8_t)header.magic[0] == 0x1f && (uint8_t)header.magic[1] == 0x8b)
+		out->fatal(CALL_INFO, -1, "%s, Error: trace_file '%s' is compressed but SST Elements was configured without libz\n", getName().c_str(), traceFile.c_str());
+#endif
+	if (!headerOk || strncmp(header.magic, MEMTRACE_MAGIC, sizeof(header.magic)) != 0)
+		out->fatal(CALL_INFO, -1, "%s, Error: '%s' is not a memHierarchy trace\n", getName().c_str(), traceFile.c_str());
+	if (header.version != MEMTRACE_VERSION || header.record_size != sizeof(MemTraceRecord))
+		out->fatal(CALL_INFO, -1, "%s, Error: trace '%s' has version %" PRIu32 " (record size %" PRIu32 "), expected version %d (record size %zu)\n",
+			getName().c_str(), traceFile.c_str(), header.version, header.record_size, MEMTRACE_VERSION, sizeof(MemTraceRecord));
+
+	traceTickFs = header.tick_fs;
+	simTickFs = (getCoreTimeBase() / UnitAlgebra("1fs")).getRoundedValue();
+
+	statSkipped = registerStatistic<uint64_t>("records_skipped");
+
+	out->verbose(CALL_INFO, 1, 0, "Replaying %s, timing: %s, time scale: %f\n", traceFile.c_str(), timing.c_str(), timeScale);
+}
+
+TraceReplayGenerator::~TraceReplayGenerator() {
+#ifdef HAVE_LIBZ
+	if (trace) gzclose((gzFile) trace);
+#else
+	if (trace) fclose((FILE*) trace);
+#endif
+	delete out;
+}
+
+/* Refill the record buffer, returns false at the end of the trace */
+bool TraceReplayGenerator::fill() {
+	if (eof)
+		return false;
+
+	buffer.resize(buffer.capacity());
+	size_t bytes = buffer.size() * sizeof(MemTraceRecord);
+#ifdef HAVE_LIBZ
+	int got = gzread((gzFile) trace, buffer.data(), bytes);
+	size_t records = (got > 0) ? (size_t) got / sizeof(MemTraceRecord) : 0;
+#else
+	size_t records = fread(buffer.data(), sizeof(MemTraceRecord), buffer.size(), (FILE*) trace);
+#endif
+	if (records < buffer.size())
+		eof = true;
+	buffer.resize(records);
+	next = 0;
+	return records != 0;
+}
+
+void TraceReplayGenerator::generate(MirandaRequestQueue<GeneratorRequest*>* q) {
+	while (next < buffer.size() || fill()) {
+		const MemTraceRecord& rec = buffer[next];
+
+		ReqOperation op;
+		switch ((MemTraceOp) rec.op) {
+			case MemTraceOp::Read:
+			case MemTraceOp::ReadLock:
+			case MemTraceOp::LoadLink:
+				op = READ;
+				break;
+			case MemTraceOp::Write:
+			case MemTraceOp::WriteUnlock:
+			case MemTraceOp::StoreConditional:
+				op = WRITE;
+				break;
+			default:
+				statSkipped->addData(1);
+				next++;
+				continue;
+		}
+		if (rec.size == 0) {
+			statSkipped->addData(1);
+			next++;
+			continue;
+		}
+
+		if (timed) {
+			const uint64_t now = getCurrentSimCycle();
+			if (!started) {
+				started = true;
+				firstTime = rec.time;
+				startCycle = now;
+			}
+			const uint64_t offsetFs = (rec.time > firstTime) ? (uint64_t)((rec.time - firstTime) * traceTickFs * timeScale) : 0;
+			if ((now - startCycle) * simTickFs < offsetFs)
+				return; // Not yet
+		}
+
+		out->verbose(CALL_INFO, 4, 0, "Issuing %s addr 0x%" PRIx64 " size %" PRIu32 "\n", op == READ ? "read" : "write", rec.addr, rec.size);
+		q->push_back(new MemoryOpRequest(rec.addr, rec.size, op));
+		next++;
+		if (limited)
+			remaining--;
+		return;
+	}
+}
+
+bool TraceReplayGenerator::isFinished() {
+	if (limited && remaining == 0)
+		return true;
+	return next >= buffer.size() && eof;
+}
+
+void TraceReplayGenerator::completed() {
+
+}
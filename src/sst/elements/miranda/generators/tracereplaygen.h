@@ -0,0 +1,94 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+
+#ifndef _H_SST_MIRANDA_TRACE_REPLAY_GEN
+#define _H_SST_MIRANDA_TRACE_REPLAY_GEN
+
+#include <sst/elements/miranda/mirandaGenerator.h>
+#include <sst/elements/memHierarchy/memTrace.h>
+#include <sst/core/output.h>
+
+#include <vector>
+
+namespace SST {
+namespace Miranda {
+
+/*
+ * Replays a memHierarchy StandardInterface trace (see memHierarchy/memTrace.h)
+ *
+ * Reads and locks replay as reads; writes, unlocks and store-conditionals replay as writes.
+ * Flushes and custom requests are skipped. With replay_timing=trace a request is not issued
+ * before its recorded issue time (relative to the first record, scaled by time_scale).
+ * Records are in issue order, so requests replay in the order they were recorded.
+ */
+class TraceReplayGenerator : public RequestGenerator {
+
+public:
+	TraceReplayGenerator( ComponentId_t id, Params& params );
+	~TraceReplayGenerator();
+	void generate(MirandaRequestQueue<GeneratorRequest*>* q);
+	bool isFinished();
+	void completed();
+
+	SST_ELI_REGISTER_SUBCOMPONENT(
+        TraceReplayGenerator,
+        "miranda",
+        "TraceReplayGenerator",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Replays a memory trace recorded by memHierarchy.standardInterface",
+        SST::Miranda::RequestGenerator
+    )
+
+	SST_ELI_DOCUMENT_PARAMS(
+		{ "verbose",          "Sets the verbosity output of the generator", "0" },
+        { "trace_file",       "Trace to replay, written by memHierarchy.standardInterface 'trace_file'. gzip traces require libz", "" },
+        { "replay_timing",    "Options: trace[issue no earlier than the recorded issue time], none[issue as fast as the CPU allows]", "trace" },
+        { "time_scale",       "For replay_timing=trace, multiply recorded inter-request times by this factor", "1.0" },
+        { "max_requests",     "Stop after this many requests (0: replay the whole trace)", "0" },
+        { "buffer_records",   "Number of records read from the trace at a time", "4096" }
+    )
+
+	SST_ELI_DOCUMENT_STATISTICS(
+        { "records_skipped",  "Trace records not replayed (flushes, custom and unknown requests)", "records", 1 }
+    )
+
+private:
+	bool fill();
+
+	Output* out;
+	void* trace;            // gzFile or FILE*
+	bool eof;
+	std::vector<SST::MemHierarchy::MemTraceRecord> buffer;
+	size_t next;            // Next record in buffer
+
+	bool timed;
+	double timeScale;
+	uint64_t traceTickFs;   // Tick lengths in femtoseconds
+	uint64_t simTickFs;
+	bool started;
+	uint64_t firstTime;     // Trace time of the first record
+	uint64_t startCycle;    // Simulation time the replay started
+	uint64_t remaining;     // Requests left if max_requests is set
+	bool limited;
+
+	Statistic<uint64_t>* statSkipped;
+};
+
+}
+}
+
+#endif